@@ -26,7 +26,9 @@
 #include "pvt_conf.h"                 // for Pvt_Conf
 #include "rtklib_rtkpos.h"            // for rtkfree, rtkinit
 #include <glog/logging.h>             // for LOG
+#include <algorithm>                  // for find, replace
 #include <iostream>                   // for operator<<
+#include <sstream>                    // for stringstream
 #if USE_OLD_BOOST_MATH_COMMON_FACTOR
 #include <boost/math/common_factor_rt.hpp>
 namespace bc = boost::math;
@@ -91,6 +93,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.flag_rtcm_server = configuration->property(role + ".flag_rtcm_server", false);
     pvt_output_parameters.rtcm_tcp_port = configuration->property(role + ".rtcm_tcp_port", 2101);
     pvt_output_parameters.rtcm_station_id = configuration->property(role + ".rtcm_station_id", 1234);
+    // RTCM 3 input of base station observations for the relative positioning modes
+    pvt_output_parameters.rtcm_base_source = configuration->property(role + ".rtcm_base_source", std::string(""));
+    pvt_output_parameters.rtcm_base_max_age_s = configuration->property(role + ".rtcm_base_max_age_s", pvt_output_parameters.rtcm_base_max_age_s);
     // RTCM message rates: least common multiple with output_rate_ms
     const int rtcm_MT1019_rate_ms = bc::lcm(configuration->property(role + ".rtcm_MT1019_rate_ms", 5000), pvt_output_parameters.output_rate_ms);
     const int rtcm_MT1020_rate_ms = bc::lcm(configuration->property(role + ".rtcm_MT1020_rate_ms", 5000), pvt_output_parameters.output_rate_ms);
@@ -420,6 +425,10 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             positioning_mode = PMODE_SINGLE;
         }
+    if (positioning_mode_str == "DGNSS")
+        {
+            positioning_mode = PMODE_DGPS;
+        }
     if (positioning_mode_str == "Static")
         {
             positioning_mode = PMODE_STATIC;
@@ -441,12 +450,39 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             // warn user and set the default
             std::cout << "WARNING: Bad specification of positioning mode.\n";
-            std::cout << "positioning_mode possible values: Single / Static / Kinematic / PPP_Static / PPP_Kinematic\n";
+            std::cout << "positioning_mode possible values: Single / DGNSS / Static / Kinematic / PPP_Static / PPP_Kinematic\n";
             std::cout << "positioning_mode specified value: " << positioning_mode_str << '\n';
             std::cout << "Setting positioning_mode to Single\n";
             positioning_mode = PMODE_SINGLE;
         }
 
+    // Additional positioning modes, solved concurrently on the same epochs, each one with its own outputs
+    const std::map<std::string, int> positioning_modes = {
+        {"Single", PMODE_SINGLE},
+        {"DGNSS", PMODE_DGPS},
+        {"Static", PMODE_STATIC},
+        {"Kinematic", PMODE_KINEMA},
+        {"PPP_Static", PMODE_PPP_STATIC},
+        {"PPP_Kinematic", PMODE_PPP_KINEMA}};
+    std::string extra_positioning_modes_str = configuration->property(role + ".extra_positioning_modes", std::string(""));
+    std::replace(extra_positioning_modes_str.begin(), extra_positioning_modes_str.end(), ',', ' ');
+    std::stringstream extra_positioning_modes_ss(extra_positioning_modes_str);
+    std::string extra_positioning_mode_str;
+    while (extra_positioning_modes_ss >> extra_positioning_mode_str)
+        {
+            const auto mode_it = positioning_modes.find(extra_positioning_mode_str);
+            if (mode_it == positioning_modes.cend())
+                {
+                    std::cout << "WARNING: Unknown positioning mode " << extra_positioning_mode_str << " in " << role << ".extra_positioning_modes, ignored.\n";
+                    continue;
+                }
+            if (mode_it->second != positioning_mode && std::find(pvt_output_parameters.extra_positioning_modes.cbegin(), pvt_output_parameters.extra_positioning_modes.cend(), mode_it->second) == pvt_output_parameters.extra_positioning_modes.cend())
+                {
+                    pvt_output_parameters.extra_positioning_modes.push_back(mode_it->second);
+                }
+        }
+    pvt_output_parameters.pvt_workers = configuration->property(role + ".pvt_workers", pvt_output_parameters.pvt_workers);
+
     int num_bands = 0;
 
     if ((gps_1C_count > 0) || (gal_1B_count > 0) || (gal_E6_count > 0) || (glo_1G_count > 0) || (bds_B1_count > 0))
@@ -794,10 +830,14 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.nmea_output_file_path = configuration->property(role + ".nmea_output_file_path", default_output_path);
     pvt_output_parameters.rtcm_output_file_path = configuration->property(role + ".rtcm_output_file_path", default_output_path);
 
+    // Binary navigation data store. By default, the one the receiver reads the assistance data from
+    pvt_output_parameters.nav_data_store_file = configuration->property(role + ".nav_data_store_file", configuration->property("GNSS-SDR.nav_data_store_file", std::string("")));
+
     // Read PVT MONITOR Configuration
     pvt_output_parameters.monitor_enabled = configuration->property(role + ".enable_monitor", false);
     pvt_output_parameters.udp_addresses = configuration->property(role + ".monitor_client_addresses", std::string("127.0.0.1"));
     pvt_output_parameters.udp_port = configuration->property(role + ".monitor_udp_port", 1234);
+    pvt_output_parameters.monitor_max_latency_ms = configuration->property(role + ".monitor_max_latency_ms", 0);
     pvt_output_parameters.protobuf_enabled = configuration->property(role + ".enable_protobuf", true);
     if (configuration->property("Monitor.enable_protobuf", false) == true)
         {
@@ -810,6 +850,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     // Enable or disable rx clock correction in observables
     pvt_output_parameters.enable_rx_clock_correction = configuration->property(role + ".enable_rx_clock_correction", false);
 
+    // Approximate the broadcast satellite orbits and clocks by short-arc polynomials
+    pvt_output_parameters.enable_orbit_cache = configuration->property(role + ".enable_orbit_cache", pvt_output_parameters.enable_orbit_cache);
+
     // Set maximum clock offset allowed if pvt_output_parameters.enable_rx_clock_correction = false
     pvt_output_parameters.max_obs_block_rx_clock_offset_ms = configuration->property(role + ".max_clock_offset_ms", pvt_output_parameters.max_obs_block_rx_clock_offset_ms);
 
@@ -876,6 +919,12 @@ std::map<int, Galileo_Almanac> Rtklib_Pvt::get_galileo_almanac() const
 }
 
 
+std::vector<pmt::pmt_t> Rtklib_Pvt::get_nav_data_msgs() const
+{
+    return pvt_->get_nav_data_msgs();
+}
+
+
 void Rtklib_Pvt::connect(gr::top_block_sptr top_block)
 {
     if (top_block)
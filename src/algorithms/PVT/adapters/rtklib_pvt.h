@@ -28,6 +28,7 @@
 #include <ctime>                     // for time_t
 #include <map>                       // for map
 #include <string>                    // for string
+#include <vector>                    // for vector
 
 /** \addtogroup PVT
  * Computation of Position, Velocity and Time from GNSS observables.
@@ -71,6 +72,7 @@ public:
     std::map<int, Galileo_Ephemeris> get_galileo_ephemeris() const override;
     std::map<int, Gps_Almanac> get_gps_almanac() const override;
     std::map<int, Galileo_Almanac> get_galileo_almanac() const override;
+    std::vector<pmt::pmt_t> get_nav_data_msgs() const override;
 
     void connect(gr::top_block_sptr top_block) override;
     void disconnect(gr::top_block_sptr top_block) override;
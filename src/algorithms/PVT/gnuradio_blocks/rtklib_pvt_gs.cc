@@ -44,10 +44,14 @@
 #include "kml_printer.h"
 #include "monitor_pvt.h"
 #include "monitor_pvt_udp_sink.h"
+#include "nav_data_store.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_worker_pool.h"
 #include "rinex_printer.h"
+#include "rtcm_base_input.h"
 #include "rtcm_printer.h"
+#include "rtklib_rtkpos.h"
 #include "rtklib_solver.h"
 #include <boost/any.hpp>                   // for any_cast, any
 #include <boost/archive/xml_iarchive.hpp>  // for xml_iarchive
@@ -59,7 +63,7 @@
 #include <glog/logging.h>               // for LOG
 #include <gnuradio/io_signature.h>      // for io_signature
 #include <pmt/pmt_sugar.h>              // for mp
-#include <algorithm>                    // for sort, unique
+#include <algorithm>                    // for min, none_of, sort, unique
 #include <cerrno>                       // for errno
 #include <cstring>                      // for strerror
 #include <exception>                    // for exception
@@ -67,10 +71,12 @@
 #include <iomanip>                      // for put_time, setprecision
 #include <iostream>                     // for operator<<
 #include <locale>                       // for locale
+#include <mutex>                        // for mutex, lock_guard
 #include <sstream>                      // for ostringstream
 #include <stdexcept>                    // for length_error
 #include <sys/ipc.h>                    // for IPC_CREAT
 #include <sys/msg.h>                    // for msgctl
+#include <thread>                       // for hardware_concurrency
 #include <typeinfo>                     // for std::type_info, typeid
 #include <utility>                      // for pair
 
@@ -121,6 +127,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
                             gr::io_signature::make(nchannels, nchannels, sizeof(Gnss_Synchro)),
                             gr::io_signature::make(0, 0, 0))
 {
+    d_stats = Block_Stats_Registry::instance().make("PVT", this->name());
     // Send feedback message to observables block with the receiver clock offset
     this->message_port_register_out(pmt::mp("pvt_to_observables"));
     // Send PVT status to gnss_flowgraph
@@ -393,6 +400,14 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_xml_base_path = d_xml_base_path + fs::path::preferred_separator;
         }
 
+    // Binary navigation data store, updated as soon as new data arrives
+    if (!conf_.nav_data_store_file.empty())
+        {
+            d_nav_data_store = std::make_unique<Nav_Data_Store>(conf_.nav_data_store_file);
+            d_nav_data_store->load();
+            std::cout << "Navigation data will be stored at " << conf_.nav_data_store_file << '\n';
+        }
+
     d_rx_time = 0.0;
     d_last_status_print_seg = 0;
 
@@ -405,7 +420,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled);
+            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled, conf_.monitor_max_latency_ms);
         }
     else
         {
@@ -470,6 +485,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_user_pvt_solver = std::make_shared<Rtklib_Solver>(rtk, static_cast<int32_t>(nchannels), dump_ls_pvt_filename, d_dump, d_dump_mat);
             d_user_pvt_solver->set_averaging_depth(1);
             d_user_pvt_solver->set_pre_2009_file(conf_.pre_2009_file);
+            d_user_pvt_solver->set_orbit_cache(conf_.enable_orbit_cache);
 
             // internal PVT solver, mainly used to estimate the receiver clock
             rtk_t internal_rtk = rtk;
@@ -477,6 +493,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_internal_pvt_solver = std::make_shared<Rtklib_Solver>(internal_rtk, static_cast<int32_t>(nchannels), dump_ls_pvt_filename, false, false);
             d_internal_pvt_solver->set_averaging_depth(1);
             d_internal_pvt_solver->set_pre_2009_file(conf_.pre_2009_file);
+            d_internal_pvt_solver->set_orbit_cache(conf_.enable_orbit_cache);
         }
     else
         {
@@ -484,9 +501,99 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_internal_pvt_solver = std::make_shared<Rtklib_Solver>(rtk, static_cast<int32_t>(nchannels), dump_ls_pvt_filename, d_dump, d_dump_mat);
             d_internal_pvt_solver->set_averaging_depth(1);
             d_internal_pvt_solver->set_pre_2009_file(conf_.pre_2009_file);
+            d_internal_pvt_solver->set_orbit_cache(conf_.enable_orbit_cache);
             d_user_pvt_solver = d_internal_pvt_solver;
         }
 
+    // Base station observations for the relative positioning modes
+    const auto is_relative_mode = [](int mode) { return mode != PMODE_SINGLE && mode < PMODE_PPP_KINEMA; };
+    if (!conf_.rtcm_base_source.empty())
+        {
+            if (!is_relative_mode(rtk.opt.mode) && std::none_of(conf_.extra_positioning_modes.cbegin(), conf_.extra_positioning_modes.cend(), is_relative_mode))
+                {
+                    LOG(WARNING) << "PVT.rtcm_base_source is ignored: no positioning mode is a relative one";
+                }
+            else
+                {
+                    d_rtcm_base_input = std::make_shared<Rtcm_Base_Input>(conf_.rtcm_base_source);
+                    if (is_relative_mode(rtk.opt.mode))
+                        {
+                            d_user_pvt_solver->set_base_input(d_rtcm_base_input, conf_.rtcm_base_max_age_s);
+                        }
+                    LOG(INFO) << "Reading base station observations from " << conf_.rtcm_base_source;
+                }
+        }
+
+    // Additional positioning modes. They share the preparation of each output
+    // epoch with the user solver, and have their own solver state and outputs,
+    // named after the main ones with the mode name as a suffix
+    const std::map<int, std::string> positioning_mode_names = {
+        {PMODE_SINGLE, "single"},
+        {PMODE_DGPS, "dgnss"},
+        {PMODE_STATIC, "static"},
+        {PMODE_KINEMA, "kinematic"},
+        {PMODE_PPP_STATIC, "ppp_static"},
+        {PMODE_PPP_KINEMA, "ppp_kinematic"}};
+    const auto add_suffix = [](const std::string& filename, const std::string& suffix) {
+        const size_t name_start = filename.find_last_of('/') == std::string::npos ? 0 : filename.find_last_of('/') + 1;
+        const size_t extension = filename.find_last_of('.');
+        if (extension == std::string::npos || extension <= name_start)
+            {
+                return filename + suffix;
+            }
+        return filename.substr(0, extension) + suffix + filename.substr(extension);
+    };
+    d_pvt_modes.reserve(conf_.extra_positioning_modes.size());
+    for (const int mode : conf_.extra_positioning_modes)
+        {
+            d_pvt_modes.emplace_back();
+            Pvt_Mode& pvt_mode = d_pvt_modes.back();
+            pvt_mode.name = positioning_mode_names.at(mode);
+            const std::string suffix = "_" + pvt_mode.name;
+            prcopt_t mode_options = rtk.opt;
+            mode_options.mode = mode;
+            rtkinit(&pvt_mode.rtk, &mode_options);
+            pvt_mode.solver = std::make_shared<Rtklib_Solver>(pvt_mode.rtk, static_cast<int32_t>(nchannels), add_suffix(dump_ls_pvt_filename, suffix), d_dump, d_dump_mat);
+            pvt_mode.solver->set_averaging_depth(1);
+            pvt_mode.solver->set_pre_2009_file(conf_.pre_2009_file);
+            pvt_mode.solver->set_orbit_cache(conf_.enable_orbit_cache);
+            if (d_rtcm_base_input && is_relative_mode(mode))
+                {
+                    pvt_mode.solver->set_base_input(d_rtcm_base_input, conf_.rtcm_base_max_age_s);
+                }
+            if (d_kml_output_enabled)
+                {
+                    pvt_mode.kml_dump = std::make_unique<Kml_Printer>(conf_.kml_output_path);
+                    pvt_mode.kml_dump->set_headers(add_suffix(kml_dump_filename, suffix));
+                }
+            if (d_gpx_output_enabled)
+                {
+                    pvt_mode.gpx_dump = std::make_unique<Gpx_Printer>(conf_.gpx_output_path);
+                    pvt_mode.gpx_dump->set_headers(add_suffix(gpx_dump_filename, suffix));
+                }
+            if (d_geojson_output_enabled)
+                {
+                    pvt_mode.geojson_printer = std::make_unique<GeoJSON_Printer>(conf_.geojson_output_path);
+                    pvt_mode.geojson_printer->set_headers(add_suffix(geojson_dump_filename, suffix));
+                }
+            if (d_nmea_output_file_enabled and conf_.nmea_output_file_enabled)
+                {
+                    // only to file, the serial port is kept for the user solution
+                    pvt_mode.nmea_printer = std::make_unique<Nmea_Printer>(add_suffix(conf_.nmea_dump_filename, suffix), true, false, conf_.nmea_dump_devname, conf_.nmea_output_file_path);
+                }
+            LOG(INFO) << "Additional positioning mode: " << pvt_mode.name;
+        }
+
+    // Threads solving the modes of an epoch, including the one of this block
+    const size_t n_mode_solvers = d_pvt_modes.size() + 1;
+    size_t n_pvt_threads = std::min(n_mode_solvers, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)));
+    if (conf_.pvt_workers > 0)
+        {
+            n_pvt_threads = std::min(n_mode_solvers, static_cast<size_t>(conf_.pvt_workers));
+        }
+    d_pvt_worker_pool = std::make_unique<Pvt_Worker_Pool>(n_pvt_threads - 1);
+    d_pvt_epoch = std::make_unique<Rtklib_Epoch>();
+
     d_gps_ephemeris_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Ephemeris>).hash_code();
     d_gps_iono_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Iono>).hash_code();
     d_gps_utc_model_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Utc_Model>).hash_code();
@@ -514,6 +621,24 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    for (auto& pvt_mode : d_pvt_modes)
+        {
+            rtkfree(&pvt_mode.rtk);
+        }
+    if (d_rtcm_base_input)
+        {
+            const Rtcm_Base_Stats stats = d_rtcm_base_input->get_stats();
+            LOG(INFO) << "RTCM base station input: " << stats.bytes << " bytes, " << stats.epochs_decoded << " epochs decoded, "
+                      << stats.epochs_used << " used, " << stats.epochs_missing << " rover epochs without base data, "
+                      << "mean age " << stats.mean_age_s << " s (max " << stats.max_age_s << " s), "
+                      << "mean queue delay " << stats.mean_queue_delay_ms << " ms (max " << stats.max_queue_delay_ms << " ms)";
+            if (d_rtcm_base_input->is_real_time())
+                {
+                    LOG(INFO) << "RTCM base station latency: arrival mean " << stats.mean_arrival_latency_ms << " ms (max "
+                              << stats.max_arrival_latency_ms << " ms), end to end mean " << stats.mean_latency_ms << " ms (max "
+                              << stats.max_latency_ms << " ms)";
+                }
+        }
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -1064,6 +1189,8 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
 
 void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
 {
+    // The navigation data maps are read by other threads through the getters below
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     try
         {
             const size_t msg_type_hash_code = pmt::any_ref(msg).type().hash_code();
@@ -1101,6 +1228,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->gps_ephemeris_map[gps_eph->i_satellite_PRN] = *gps_eph;
+                    store_nav_data(*gps_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_ephemeris_map[gps_eph->i_satellite_PRN] = *gps_eph;
@@ -1111,6 +1239,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS IONO ###
                     const auto gps_iono = boost::any_cast<std::shared_ptr<Gps_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_iono = *gps_iono;
+                    store_nav_data(*gps_iono);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_iono = *gps_iono;
@@ -1122,6 +1251,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS UTC MODEL ###
                     const auto gps_utc_model = boost::any_cast<std::shared_ptr<Gps_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_utc_model = *gps_utc_model;
+                    store_nav_data(*gps_utc_model);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_utc_model = *gps_utc_model;
@@ -1156,6 +1286,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->i_satellite_PRN] = *gps_cnav_ephemeris;
+                    store_nav_data(*gps_cnav_ephemeris);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->i_satellite_PRN] = *gps_cnav_ephemeris;
@@ -1167,6 +1298,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV IONO ###
                     const auto gps_cnav_iono = boost::any_cast<std::shared_ptr<Gps_CNAV_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
+                    store_nav_data(*gps_cnav_iono);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
@@ -1178,6 +1310,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV UTC MODEL ###
                     const auto gps_cnav_utc_model = boost::any_cast<std::shared_ptr<Gps_CNAV_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
+                    store_nav_data(*gps_cnav_utc_model);
                     {
                         d_user_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
                     }
@@ -1189,6 +1322,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS ALMANAC ###
                     const auto gps_almanac = boost::any_cast<std::shared_ptr<Gps_Almanac>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_almanac_map[gps_almanac->i_satellite_PRN] = *gps_almanac;
+                    store_nav_data(*gps_almanac);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_almanac_map[gps_almanac->i_satellite_PRN] = *gps_almanac;
@@ -1229,6 +1363,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->i_satellite_PRN] = *galileo_eph;
+                    store_nav_data(*galileo_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->i_satellite_PRN] = *galileo_eph;
@@ -1239,6 +1374,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### Galileo IONO ###
                     const auto galileo_iono = boost::any_cast<std::shared_ptr<Galileo_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->galileo_iono = *galileo_iono;
+                    store_nav_data(*galileo_iono);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_iono = *galileo_iono;
@@ -1250,6 +1386,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### Galileo UTC MODEL ###
                     const auto galileo_utc_model = boost::any_cast<std::shared_ptr<Galileo_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->galileo_utc_model = *galileo_utc_model;
+                    store_nav_data(*galileo_utc_model);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_utc_model = *galileo_utc_model;
@@ -1267,6 +1404,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv1.i_satellite_PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1;
+                            store_nav_data(sv1);
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1;
@@ -1275,6 +1413,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv2.i_satellite_PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2;
+                            store_nav_data(sv2);
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2;
@@ -1283,6 +1422,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv3.i_satellite_PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3;
+                            store_nav_data(sv3);
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3;
@@ -1296,6 +1436,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     const auto galileo_alm = boost::any_cast<std::shared_ptr<Galileo_Almanac>>(pmt::any_ref(msg));
                     // update/insert new almanac record to the global almanac map
                     d_internal_pvt_solver->galileo_almanac_map[galileo_alm->i_satellite_PRN] = *galileo_alm;
+                    store_nav_data(*galileo_alm);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_almanac_map[galileo_alm->i_satellite_PRN] = *galileo_alm;
@@ -1337,6 +1478,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->i_satellite_PRN] = *glonass_gnav_eph;
+                    store_nav_data(*glonass_gnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->i_satellite_PRN] = *glonass_gnav_eph;
@@ -1347,6 +1489,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GLONASS GNAV UTC MODEL ###
                     const auto glonass_gnav_utc_model = boost::any_cast<std::shared_ptr<Glonass_Gnav_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
+                    store_nav_data(*glonass_gnav_utc_model);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
@@ -1400,6 +1543,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->i_satellite_PRN] = *bds_dnav_eph;
+                    store_nav_data(*bds_dnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->i_satellite_PRN] = *bds_dnav_eph;
@@ -1410,6 +1554,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou IONO ###
                     const auto bds_dnav_iono = boost::any_cast<std::shared_ptr<Beidou_Dnav_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
+                    store_nav_data(*bds_dnav_iono);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
@@ -1421,6 +1566,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou UTC MODEL ###
                     const auto bds_dnav_utc_model = boost::any_cast<std::shared_ptr<Beidou_Dnav_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
+                    store_nav_data(*bds_dnav_utc_model);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
@@ -1432,6 +1578,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou ALMANAC ###
                     const auto bds_dnav_almanac = boost::any_cast<std::shared_ptr<Beidou_Dnav_Almanac>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->i_satellite_PRN] = *bds_dnav_almanac;
+                    store_nav_data(*bds_dnav_almanac);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->i_satellite_PRN] = *bds_dnav_almanac;
@@ -1452,42 +1599,97 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
 
 std::map<int, Gps_Ephemeris> rtklib_pvt_gs::get_gps_ephemeris_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->gps_ephemeris_map;
 }
 
 
 std::map<int, Gps_Almanac> rtklib_pvt_gs::get_gps_almanac_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->gps_almanac_map;
 }
 
 
 std::map<int, Galileo_Ephemeris> rtklib_pvt_gs::get_galileo_ephemeris_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->galileo_ephemeris_map;
 }
 
 
 std::map<int, Galileo_Almanac> rtklib_pvt_gs::get_galileo_almanac_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->galileo_almanac_map;
 }
 
 
 std::map<int, Beidou_Dnav_Ephemeris> rtklib_pvt_gs::get_beidou_dnav_ephemeris_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->beidou_dnav_ephemeris_map;
 }
 
 
 std::map<int, Beidou_Dnav_Almanac> rtklib_pvt_gs::get_beidou_dnav_almanac_map() const
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     return d_internal_pvt_solver->beidou_dnav_almanac_map;
 }
 
 
+template <class T>
+static void append_nav_data_msgs(const std::map<int, T>& nav_data_map, std::vector<pmt::pmt_t>& msgs)
+{
+    for (const auto& nav_data : nav_data_map)
+        {
+            msgs.push_back(pmt::make_any(std::make_shared<T>(nav_data.second)));
+        }
+}
+
+
+template <class T>
+static void append_nav_data_msg(const T& nav_data, bool decoded, std::vector<pmt::pmt_t>& msgs)
+{
+    if (decoded)
+        {
+            msgs.push_back(pmt::make_any(std::make_shared<T>(nav_data)));
+        }
+}
+
+
+std::vector<pmt::pmt_t> rtklib_pvt_gs::get_nav_data_msgs() const
+{
+    std::vector<pmt::pmt_t> msgs;
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
+    const Rtklib_Solver& solver = *d_internal_pvt_solver;
+    append_nav_data_msgs(solver.gps_ephemeris_map, msgs);
+    append_nav_data_msgs(solver.gps_cnav_ephemeris_map, msgs);
+    append_nav_data_msgs(solver.galileo_ephemeris_map, msgs);
+    append_nav_data_msgs(solver.glonass_gnav_ephemeris_map, msgs);
+    append_nav_data_msgs(solver.beidou_dnav_ephemeris_map, msgs);
+    append_nav_data_msgs(solver.gps_almanac_map, msgs);
+    append_nav_data_msgs(solver.galileo_almanac_map, msgs);
+    append_nav_data_msgs(solver.beidou_dnav_almanac_map, msgs);
+    append_nav_data_msg(solver.glonass_gnav_almanac, solver.glonass_gnav_almanac.i_satellite_PRN != 0, msgs);
+    append_nav_data_msg(solver.gps_utc_model, solver.gps_utc_model.valid, msgs);
+    append_nav_data_msg(solver.gps_iono, solver.gps_iono.valid, msgs);
+    append_nav_data_msg(solver.gps_cnav_utc_model, solver.gps_cnav_utc_model.valid, msgs);
+    append_nav_data_msg(solver.gps_cnav_iono, solver.gps_cnav_iono.valid, msgs);
+    // The Galileo models have no valid flag, their reference time is set when they are decoded
+    append_nav_data_msg(solver.galileo_utc_model, solver.galileo_utc_model.WNot_6 != 0 || solver.galileo_utc_model.t0t_6 != 0, msgs);
+    append_nav_data_msg(solver.galileo_iono, solver.galileo_iono.WN_5 != 0, msgs);
+    append_nav_data_msg(solver.glonass_gnav_utc_model, solver.glonass_gnav_utc_model.valid, msgs);
+    append_nav_data_msg(solver.beidou_dnav_utc_model, solver.beidou_dnav_utc_model.valid, msgs);
+    append_nav_data_msg(solver.beidou_dnav_iono, solver.beidou_dnav_iono.valid, msgs);
+    return msgs;
+}
+
+
 void rtklib_pvt_gs::clear_ephemeris()
 {
+    std::lock_guard<std::mutex> lock(d_nav_data_mutex);
     d_internal_pvt_solver->gps_ephemeris_map.clear();
     d_internal_pvt_solver->gps_almanac_map.clear();
     d_internal_pvt_solver->galileo_ephemeris_map.clear();
@@ -1526,6 +1728,16 @@ bool rtklib_pvt_gs::send_sys_v_ttff_msg(d_ttff_msgbuf ttff) const
 }
 
 
+template <class T>
+void rtklib_pvt_gs::store_nav_data(const T& nav_data)
+{
+    if (d_nav_data_store != nullptr && !d_nav_data_store->put(nav_data))
+        {
+            LOG(WARNING) << "Failed to write navigation data to " << d_nav_data_store->file_name();
+        }
+}
+
+
 bool rtklib_pvt_gs::save_gnss_synchro_map_xml(const std::string& file_name)
 {
     if (d_gnss_observables_map.empty() == false)
@@ -1790,9 +2002,57 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
 }
 
 
+bool rtklib_pvt_gs::solve_pvt_modes(bool solve_user_solver, uint32_t current_RX_time_ms)
+{
+    // Task 0 is the user solver, the next ones the additional positioning modes
+    const size_t first_task = solve_user_solver ? 0 : 1;
+    bool user_solution_valid = false;
+    d_pvt_worker_pool->run(d_pvt_modes.size() + 1 - first_task, [&](size_t task) {
+        if (task + first_task == 0)
+            {
+                user_solution_valid = d_user_pvt_solver->get_PVT(*d_pvt_epoch, false);
+                return;
+            }
+        Pvt_Mode& pvt_mode = d_pvt_modes[task + first_task - 1];
+        try
+            {
+                if (!pvt_mode.solver->get_PVT(*d_pvt_epoch, false))
+                    {
+                        return;
+                    }
+                DLOG(INFO) << "Position (" << pvt_mode.name << ") at " << boost::posix_time::to_simple_string(pvt_mode.solver->get_position_UTC_time())
+                           << " UTC using " << pvt_mode.solver->get_num_valid_observations() << " observations is Lat = " << pvt_mode.solver->get_latitude()
+                           << " [deg], Long = " << pvt_mode.solver->get_longitude() << " [deg], Height = " << pvt_mode.solver->get_height() << " [m]";
+                if (pvt_mode.kml_dump and current_RX_time_ms % d_kml_rate_ms == 0)
+                    {
+                        pvt_mode.kml_dump->print_position(pvt_mode.solver.get(), false);
+                    }
+                if (pvt_mode.gpx_dump and current_RX_time_ms % d_gpx_rate_ms == 0)
+                    {
+                        pvt_mode.gpx_dump->print_position(pvt_mode.solver.get(), false);
+                    }
+                if (pvt_mode.geojson_printer and current_RX_time_ms % d_geojson_rate_ms == 0)
+                    {
+                        pvt_mode.geojson_printer->print_position(pvt_mode.solver.get(), false);
+                    }
+                if (pvt_mode.nmea_printer and current_RX_time_ms % d_nmea_rate_ms == 0)
+                    {
+                        pvt_mode.nmea_printer->Print_Nmea_Line(pvt_mode.solver.get(), false);
+                    }
+            }
+        catch (const std::exception& e)
+            {
+                LOG(WARNING) << "Exception in the " << pvt_mode.name << " positioning mode: " << e.what();
+            }
+    });
+    return user_solution_valid;
+}
+
+
 int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_items,
     gr_vector_void_star& output_items __attribute__((unused)))
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(noutput_items));
     for (int32_t epoch = 0; epoch < noutput_items; epoch++)
         {
             bool flag_display_pvt = false;
@@ -1924,7 +2184,8 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                     // old_time_debug = d_gnss_observables_map.cbegin()->second.RX_time * 1000.0;
                     uint32_t current_RX_time_ms = 0;
                     // #### solve PVT and store the corrected observable set
-                    if (d_internal_pvt_solver->get_PVT(d_gnss_observables_map, false))
+                    d_internal_pvt_solver->prepare_epoch(d_gnss_observables_map, *d_pvt_epoch);
+                    if (d_internal_pvt_solver->get_PVT(*d_pvt_epoch, false))
                         {
                             const double Rx_clock_offset_s = d_internal_pvt_solver->get_time_offset_s();
                             if (fabs(Rx_clock_offset_s) * 1000.0 > d_max_obs_block_rx_clock_offset_ms)
@@ -1988,10 +2249,20 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                     //         DLOG(INFO) << "Internal PVT solver error";
                     //     }
 
-                    // compute on the fly PVT solution
+                    // compute on the fly PVT solution, and the additional positioning modes
                     if (flag_compute_pvt_output == true)
                         {
-                            flag_pvt_valid = d_user_pvt_solver->get_PVT(d_gnss_observables_map, false);
+                            if (d_enable_rx_clock_correction == true)
+                                {
+                                    // observables interpolated at the output time, shared by all the modes
+                                    d_user_pvt_solver->prepare_epoch(d_gnss_observables_map, *d_pvt_epoch);
+                                    flag_pvt_valid = solve_pvt_modes(true, current_RX_time_ms);
+                                }
+                            else
+                                {
+                                    // the user solver is the internal one, already solved on this epoch
+                                    solve_pvt_modes(false, current_RX_time_ms);
+                                }
                         }
 
                     if (flag_pvt_valid == true)
@@ -2214,6 +2485,7 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                             if (d_flag_monitor_pvt_enabled)
                                 {
                                     d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                                    d_udp_sink_ptr->send_pending();
                                 }
                         }
                 }
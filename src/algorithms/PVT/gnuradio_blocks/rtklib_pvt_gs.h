@@ -18,6 +18,7 @@
 #define GNSS_SDR_RTKLIB_PVT_GS_H
 
 #include "gnss_block_interface.h"
+#include "gnss_sdr_block_stats.h"
 #include "gnss_synchro.h"
 #include "rtklib.h"
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -31,6 +32,7 @@
 #include <ctime>                  // for time_t
 #include <map>                    // for map
 #include <memory>                 // for shared_ptr, unique_ptr
+#include <mutex>                  // for mutex
 #include <string>                 // for string
 #include <sys/types.h>            // for key_t
 #include <vector>                 // for vector
@@ -52,12 +54,16 @@ class Gps_Ephemeris;
 class Gpx_Printer;
 class Kml_Printer;
 class Monitor_Pvt_Udp_Sink;
+class Nav_Data_Store;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Worker_Pool;
 class Rinex_Printer;
+class Rtcm_Base_Input;
 class Rtcm_Printer;
 class Rtklib_Solver;
 class rtklib_pvt_gs;
+struct Rtklib_Epoch;
 
 using rtklib_pvt_gs_sptr = gnss_shared_ptr<rtklib_pvt_gs>;
 
@@ -103,6 +109,13 @@ public:
      */
     std::map<int, Beidou_Dnav_Almanac> get_beidou_dnav_almanac_map() const;
 
+    /*!
+     * \brief Get all the navigation data (ephemeris, almanacs, UTC and
+     * ionospheric models) as messages accepted by the telemetry port. Models
+     * not decoded yet are left out.
+     */
+    std::vector<pmt::pmt_t> get_nav_data_msgs() const;
+
     /*!
      * \brief Clear all ephemeris information and the almanacs for GPS and Galileo
      */
@@ -158,8 +171,29 @@ private:
     bool save_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
     bool load_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
 
+    template <class T>
+    void store_nav_data(const T& nav_data);
+
+    // Additional positioning mode, solved on the same epochs as the user one
+    struct Pvt_Mode
+    {
+        rtk_t rtk{};
+        std::string name;
+        std::shared_ptr<Rtklib_Solver> solver;
+        std::unique_ptr<Kml_Printer> kml_dump;
+        std::unique_ptr<Gpx_Printer> gpx_dump;
+        std::unique_ptr<GeoJSON_Printer> geojson_printer;
+        std::unique_ptr<Nmea_Printer> nmea_printer;
+    };
+
+    // Solves the additional positioning modes of the epoch in d_pvt_epoch, and
+    // also the user solver if solve_user_solver is true, on the worker pool.
+    // Returns the validity of the user solution.
+    bool solve_pvt_modes(bool solve_user_solver, uint32_t current_RX_time_ms);
+
     std::shared_ptr<Rtklib_Solver> d_internal_pvt_solver;
     std::shared_ptr<Rtklib_Solver> d_user_pvt_solver;
+    std::shared_ptr<Rtcm_Base_Input> d_rtcm_base_input;
 
     std::unique_ptr<Rinex_Printer> d_rp;
     std::unique_ptr<Kml_Printer> d_kml_dump;
@@ -168,6 +202,11 @@ private:
     std::unique_ptr<GeoJSON_Printer> d_geojson_printer;
     std::unique_ptr<Rtcm_Printer> d_rtcm_printer;
     std::unique_ptr<Monitor_Pvt_Udp_Sink> d_udp_sink_ptr;
+    std::unique_ptr<Nav_Data_Store> d_nav_data_store;
+    mutable std::mutex d_nav_data_mutex;  // protects the navigation data maps of the solvers from the getters
+    std::unique_ptr<Pvt_Worker_Pool> d_pvt_worker_pool;
+    std::unique_ptr<Rtklib_Epoch> d_pvt_epoch;
+    std::vector<Pvt_Mode> d_pvt_modes;
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
@@ -263,6 +302,7 @@ private:
     bool d_show_local_time_zone;
     bool d_waiting_obs_block_rx_clock_offset_correction_msg;
     bool d_enable_rx_clock_correction;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -16,18 +16,22 @@
  */
 
 #include "monitor_pvt_udp_sink.h"
+#include "gnss_sdr_make_unique.h"
+#include "udp_batch_sender.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
-#include <sstream>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
 
 
-Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : socket{io_context}
+Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled, int max_latency_ms)
 {
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
     for (const auto& address : addresses)
         {
             boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
             endpoints.push_back(endpoint);
         }
+    sender = std::make_unique<Udp_Batch_Sender>(endpoints, max_latency_ms);
 
     use_protobuf = protobuf_enabled;
     if (use_protobuf)
@@ -37,34 +41,31 @@ Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addre
 }
 
 
+Monitor_Pvt_Udp_Sink::~Monitor_Pvt_Udp_Sink() = default;
+
+
 bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* const monitor_pvt)
 {
-    std::string outbound_data;
+    std::string& outbound_data = sender->next_datagram();
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
-            oa << *monitor_pvt;
-            outbound_data = archive_stream.str();
+            boost::iostreams::back_insert_device<std::string> device(outbound_data);
+            boost::iostreams::stream<boost::iostreams::back_insert_device<std::string>> archive_stream(device);
+            {
+                boost::archive::binary_oarchive oa{archive_stream};
+                oa << *monitor_pvt;
+            }
+            archive_stream.flush();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(monitor_pvt);
+            serdes.createProtobuffer(monitor_pvt, outbound_data);
         }
+    return sender->push();
+}
 
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
 
-            try
-                {
-                    socket.send(boost::asio::buffer(outbound_data));
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
-        }
-    return true;
+bool Monitor_Pvt_Udp_Sink::send_pending()
+{
+    return sender->send_if_due();
 }
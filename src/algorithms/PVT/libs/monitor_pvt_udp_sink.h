@@ -37,17 +37,28 @@ using b_io_context = boost::asio::io_context;
 using b_io_context = boost::asio::io_service;
 #endif
 
+class Udp_Batch_Sender;
+
+/*!
+ * \brief This class sends serialized Monitor_Pvt objects
+ * over UDP to one or multiple endpoints.
+ *
+ * Each call to write_monitor_pvt() queues one datagram. The queued
+ * datagrams are sent together once the oldest one has waited
+ * max_latency_ms, even if no more datagrams are written. With 0, they are
+ * sent at every call to send_pending().
+ */
 class Monitor_Pvt_Udp_Sink
 {
 public:
-    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled);
+    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled, int max_latency_ms = 0);
+    ~Monitor_Pvt_Udp_Sink();
     bool write_monitor_pvt(const Monitor_Pvt* const monitor_pvt);
+    bool send_pending();
 
 private:
     Serdes_Monitor_Pvt serdes;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    std::unique_ptr<Udp_Batch_Sender> sender;
     boost::system::error_code error;
     bool use_protobuf;
 };
@@ -27,6 +27,7 @@ Pvt_Conf::Pvt_Conf()
     nmea_rate_ms = 1000;
 
     max_obs_block_rx_clock_offset_ms = 40;
+    pvt_workers = 0;
     rinex_version = 0;
     rinexobs_rate_ms = 0;
     rinex_name = "-";
@@ -40,6 +41,7 @@ Pvt_Conf::Pvt_Conf()
     flag_rtcm_tty_port = false;
     rtcm_tcp_port = 0U;
     rtcm_station_id = 0U;
+    rtcm_base_max_age_s = 10.0;
 
     output_enabled = true;
     rinex_output_enabled = true;
@@ -60,9 +62,11 @@ Pvt_Conf::Pvt_Conf()
     rtcm_output_file_path = std::string(".");
 
     enable_rx_clock_correction = true;
+    enable_orbit_cache = true;
     monitor_enabled = false;
     protobuf_enabled = true;
     udp_port = 0;
+    monitor_max_latency_ms = 0;
     pre_2009_file = false;
     show_local_time_zone = false;
 }
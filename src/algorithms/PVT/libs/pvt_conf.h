@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 /** \addtogroup PVT
  * \{ */
@@ -33,6 +34,7 @@ public:
     Pvt_Conf();
 
     std::map<int, int> rtcm_msg_rate_ms;
+    std::vector<int> extra_positioning_modes;
 
     std::string rinex_name;
     std::string dump_filename;
@@ -46,9 +48,13 @@ public:
     std::string nmea_output_file_path;
     std::string kml_output_path;
     std::string xml_output_path;
+    std::string nav_data_store_file;
     std::string rtcm_output_file_path;
+    std::string rtcm_base_source;
     std::string udp_addresses;
 
+    double rtcm_base_max_age_s;
+
     uint32_t type_of_receiver;
     int32_t output_rate_ms;
     int32_t display_rate_ms;
@@ -59,7 +65,9 @@ public:
     int32_t rinex_version;
     int32_t rinexobs_rate_ms;
     int32_t max_obs_block_rx_clock_offset_ms;
+    int32_t pvt_workers;
     int udp_port;
+    int monitor_max_latency_ms;
 
     uint16_t rtcm_tcp_port;
     uint16_t rtcm_station_id;
@@ -78,6 +86,7 @@ public:
     bool monitor_enabled;
     bool protobuf_enabled;
     bool enable_rx_clock_correction;
+    bool enable_orbit_cache;
     bool show_local_time_zone;
     bool pre_2009_file;
     bool dump;
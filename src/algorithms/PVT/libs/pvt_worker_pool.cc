@@ -0,0 +1,110 @@
+/*!
+ * \file pvt_worker_pool.cc
+ * \brief Pool of worker threads that solve the positioning modes of an epoch
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_worker_pool.h"
+
+
+Pvt_Worker_Pool::Pvt_Worker_Pool(size_t n_workers)
+{
+    d_workers.reserve(n_workers);
+    for (size_t i = 0; i < n_workers; i++)
+        {
+            d_workers.emplace_back(&Pvt_Worker_Pool::worker, this);
+        }
+}
+
+
+Pvt_Worker_Pool::~Pvt_Worker_Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_work_cv.notify_all();
+    for (auto& w : d_workers)
+        {
+            w.join();
+        }
+}
+
+
+void Pvt_Worker_Pool::run(size_t n_tasks, const std::function<void(size_t)>& task)
+{
+    if (n_tasks == 0)
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_task = &task;
+        d_n_tasks = n_tasks;
+        d_next_task = 0;
+        d_pending_tasks = n_tasks;
+        d_batch++;
+    }
+    if (n_tasks > 1)
+        {
+            d_work_cv.notify_all();
+        }
+    execute_tasks();
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_done_cv.wait(lock, [this] { return d_pending_tasks == 0; });
+    d_task = nullptr;
+}
+
+
+void Pvt_Worker_Pool::worker()
+{
+    uint64_t batch = 0;
+    while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_work_cv.wait(lock, [this, batch] { return d_stop || d_batch != batch; });
+                if (d_stop)
+                    {
+                        return;
+                    }
+                batch = d_batch;
+            }
+            execute_tasks();
+        }
+}
+
+
+void Pvt_Worker_Pool::execute_tasks()
+{
+    while (true)
+        {
+            size_t i;
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                if (d_next_task >= d_n_tasks)
+                    {
+                        return;
+                    }
+                i = d_next_task++;
+            }
+            // the batch, and thus d_task, cannot finish before this task does
+            (*d_task)(i);
+            std::lock_guard<std::mutex> lock(d_mutex);
+            if (--d_pending_tasks == 0)
+                {
+                    d_done_cv.notify_one();
+                }
+        }
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file pvt_worker_pool.h
+ * \brief Pool of worker threads that solve the positioning modes of an epoch
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_WORKER_POOL_H
+#define GNSS_SDR_PVT_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Fixed pool of threads that run a batch of tasks and wait for all of
+ * them, once per epoch.
+ *
+ * The thread calling run() also executes tasks, so a pool without workers
+ * runs the whole batch sequentially on the calling thread. The workers are
+ * created once and sleep between batches.
+ */
+class Pvt_Worker_Pool
+{
+public:
+    explicit Pvt_Worker_Pool(size_t n_workers);
+    ~Pvt_Worker_Pool();
+
+    Pvt_Worker_Pool(const Pvt_Worker_Pool&) = delete;
+    Pvt_Worker_Pool& operator=(const Pvt_Worker_Pool&) = delete;
+
+    /*!
+     * \brief Runs task(0), ..., task(n_tasks - 1) and returns when all of
+     * them are done. Tasks must not throw.
+     */
+    void run(size_t n_tasks, const std::function<void(size_t)>& task);
+
+    inline size_t size() const
+    {
+        return d_workers.size();
+    }
+
+private:
+    void worker();
+    void execute_tasks();
+
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_work_cv;
+    std::condition_variable d_done_cv;
+    const std::function<void(size_t)>* d_task{nullptr};
+    uint64_t d_batch{0};
+    size_t d_n_tasks{0};
+    size_t d_next_task{0};
+    size_t d_pending_tasks{0};
+    bool d_stop{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_WORKER_POOL_H
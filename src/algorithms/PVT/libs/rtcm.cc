@@ -24,7 +24,6 @@
 #include "Galileo_FNAV.h"
 #include "Galileo_INAV.h"
 #include <boost/algorithm/string.hpp>  // for to_upper_copy
-#include <boost/crc.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/exception/diagnostic_information.hpp>
@@ -38,8 +37,6 @@
 Rtcm::Rtcm(uint16_t port)
 {
     RTCM_port = port;
-    preamble = std::bitset<8>("11010011");
-    reserved_field = std::bitset<6>("000000");
     rtcm_message_queue = std::make_shared<Concurrent_Queue<std::string> >();
     boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), RTCM_port);
     servers.emplace_back(io_context, endpoint);
@@ -125,49 +122,18 @@ bool Rtcm::is_server_running() const
 //
 // *****************************************************************************************************
 
-std::string Rtcm::add_CRC(const std::string& message_without_crc) const
-{
-    // ******  Computes Qualcomm CRC-24Q ******
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
-    // 1) Converts the string to a vector of uint8_t:
-    boost::dynamic_bitset<uint8_t> frame_bits(message_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    // 2) Computes CRC
-    CRC_RTCM.process_bytes(bytes.data(), bytes.size());
-    const auto crc_frame = std::bitset<24>(CRC_RTCM.checksum());
-
-    // 3) Builds the complete message
-    const std::string complete_message = message_without_crc + crc_frame.to_string();
-    return bin_to_binary_data(complete_message);
-}
-
-
 bool Rtcm::check_CRC(const std::string& message) const
 {
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
-    // Check CRC
-    const std::string crc = message_bin.substr(message_bin.length() - 24, 24);
-    const auto read_crc = std::bitset<24>(crc);
-    const std::string msg_without_crc = message_bin.substr(0, message_bin.length() - 24);
-
-    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_RTCM_CHECK.process_bytes(bytes.data(), bytes.size());
-    const auto computed_crc = std::bitset<24>(CRC_RTCM_CHECK.checksum());
-    if (read_crc == computed_crc)
+    if (message.length() < 6)
         {
-            return true;
+            return false;
         }
-
-    return false;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(message.data());
+    const std::size_t length = message.length() - 3;
+    const uint32_t read_crc = (static_cast<uint32_t>(bytes[length]) << 16) |
+                              (static_cast<uint32_t>(bytes[length + 1]) << 8) |
+                              static_cast<uint32_t>(bytes[length + 2]);
+    return read_crc == Rtcm_Bit_Writer::crc24q(bytes, length);
 }
 
 
@@ -402,17 +368,15 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 
 std::string Rtcm::build_message(const std::string& data) const
 {
-    const uint32_t msg_length_bits = data.length();
-    const uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
-    const auto message_length = std::bitset<10>(msg_length_bytes);
-    const uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    const std::string b(zeros_to_fill, '0');
-    const std::string msg_content = data + b;
-    const std::string msg_without_crc = preamble.to_string() +
-                                        reserved_field.to_string() +
-                                        message_length.to_string() +
-                                        msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    Rtcm_Bit_Writer writer;
+    writer.put(data);
+    return writer.frame();
+}
+
+
+std::string Rtcm::build_message(const Rtcm_Bit_Writer& data) const
+{
+    return data.frame();
 }
 
 
@@ -578,6 +542,8 @@ std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF011(gnss_synchro);
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
+    Rtcm::set_DF014(gnss_synchro);
+    Rtcm::set_DF015(gnss_synchro);
 
     const std::string content = DF009.to_string() +
                                 DF010.to_string() +
@@ -1544,41 +1510,42 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
     Rtcm::set_DF103(gps_eph);
     Rtcm::set_DF137(gps_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF009.to_string() +
-                             DF076.to_string() +
-                             DF077.to_string() +
-                             DF078.to_string() +
-                             DF079.to_string() +
-                             DF071.to_string() +
-                             DF081.to_string() +
-                             DF082.to_string() +
-                             DF083.to_string() +
-                             DF084.to_string() +
-                             DF085.to_string() +
-                             DF086.to_string() +
-                             DF087.to_string() +
-                             DF088.to_string() +
-                             DF089.to_string() +
-                             DF090.to_string() +
-                             DF091.to_string() +
-                             DF092.to_string() +
-                             DF093.to_string() +
-                             DF094.to_string() +
-                             DF095.to_string() +
-                             DF096.to_string() +
-                             DF097.to_string() +
-                             DF098.to_string() +
-                             DF099.to_string() +
-                             DF100.to_string() +
-                             DF101.to_string() +
-                             DF102.to_string() +
-                             DF103.to_string() +
-                             DF137.to_string();
-
-    if (data.length() != 488)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data.put(DF002);
+    data.put(DF009);
+    data.put(DF076);
+    data.put(DF077);
+    data.put(DF078);
+    data.put(DF079);
+    data.put(DF071);
+    data.put(DF081);
+    data.put(DF082);
+    data.put(DF083);
+    data.put(DF084);
+    data.put(DF085);
+    data.put(DF086);
+    data.put(DF087);
+    data.put(DF088);
+    data.put(DF089);
+    data.put(DF090);
+    data.put(DF091);
+    data.put(DF092);
+    data.put(DF093);
+    data.put(DF094);
+    data.put(DF095);
+    data.put(DF096);
+    data.put(DF097);
+    data.put(DF098);
+    data.put(DF099);
+    data.put(DF100);
+    data.put(DF101);
+    data.put(DF102);
+    data.put(DF103);
+    data.put(DF137);
+
+    if (data.size_bits() != 488)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.size_bits() << ")";
         }
 
     std::string msg = build_message(data);
@@ -1769,47 +1736,48 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
     Rtcm::set_DF135(glonass_gnav_utc_model);
     Rtcm::set_DF136(glonass_gnav_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF038.to_string() +
-                             DF040.to_string() +
-                             DF104.to_string() +
-                             DF105.to_string() +
-                             DF106.to_string() +
-                             DF107.to_string() +
-                             DF108.to_string() +
-                             DF109.to_string() +
-                             DF110.to_string() +
-                             DF111.to_string() +
-                             DF112.to_string() +
-                             DF113.to_string() +
-                             DF114.to_string() +
-                             DF115.to_string() +
-                             DF116.to_string() +
-                             DF117.to_string() +
-                             DF118.to_string() +
-                             DF119.to_string() +
-                             DF120.to_string() +
-                             DF121.to_string() +
-                             DF122.to_string() +
-                             DF123.to_string() +
-                             DF124.to_string() +
-                             DF125.to_string() +
-                             DF126.to_string() +
-                             DF127.to_string() +
-                             DF128.to_string() +
-                             DF129.to_string() +
-                             DF130.to_string() +
-                             DF131.to_string() +
-                             DF132.to_string() +
-                             DF133.to_string() +
-                             DF134.to_string() +
-                             DF135.to_string() +
-                             DF136.to_string() +
-                             std::bitset<7>().to_string();  // Reserved bits
-
-    if (data.length() != 360)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data.put(DF002);
+    data.put(DF038);
+    data.put(DF040);
+    data.put(DF104);
+    data.put(DF105);
+    data.put(DF106);
+    data.put(DF107);
+    data.put(DF108);
+    data.put(DF109);
+    data.put(DF110);
+    data.put(DF111);
+    data.put(DF112);
+    data.put(DF113);
+    data.put(DF114);
+    data.put(DF115);
+    data.put(DF116);
+    data.put(DF117);
+    data.put(DF118);
+    data.put(DF119);
+    data.put(DF120);
+    data.put(DF121);
+    data.put(DF122);
+    data.put(DF123);
+    data.put(DF124);
+    data.put(DF125);
+    data.put(DF126);
+    data.put(DF127);
+    data.put(DF128);
+    data.put(DF129);
+    data.put(DF130);
+    data.put(DF131);
+    data.put(DF132);
+    data.put(DF133);
+    data.put(DF134);
+    data.put(DF135);
+    data.put(DF136);
+    data.put(std::bitset<7>());  // Reserved bits
+
+    if (data.size_bits() != 360)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.size_bits() << ")";
         }
 
     std::string msg = build_message(data);
@@ -2083,39 +2051,40 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
     const uint32_t seven_zero = 0;
     const auto DF001_ = std::bitset<7>(seven_zero);
 
-    const std::string data = DF002.to_string() +
-                             DF252.to_string() +
-                             DF289.to_string() +
-                             DF290.to_string() +
-                             DF291.to_string() +
-                             DF292.to_string() +
-                             DF293.to_string() +
-                             DF294.to_string() +
-                             DF295.to_string() +
-                             DF296.to_string() +
-                             DF297.to_string() +
-                             DF298.to_string() +
-                             DF299.to_string() +
-                             DF300.to_string() +
-                             DF301.to_string() +
-                             DF302.to_string() +
-                             DF303.to_string() +
-                             DF304.to_string() +
-                             DF305.to_string() +
-                             DF306.to_string() +
-                             DF307.to_string() +
-                             DF308.to_string() +
-                             DF309.to_string() +
-                             DF310.to_string() +
-                             DF311.to_string() +
-                             DF312.to_string() +
-                             DF314.to_string() +
-                             DF315.to_string() +
-                             DF001_.to_string();
-
-    if (data.length() != 496)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.length() << ")";
+    Rtcm_Bit_Writer data;
+    data.put(DF002);
+    data.put(DF252);
+    data.put(DF289);
+    data.put(DF290);
+    data.put(DF291);
+    data.put(DF292);
+    data.put(DF293);
+    data.put(DF294);
+    data.put(DF295);
+    data.put(DF296);
+    data.put(DF297);
+    data.put(DF298);
+    data.put(DF299);
+    data.put(DF300);
+    data.put(DF301);
+    data.put(DF302);
+    data.put(DF303);
+    data.put(DF304);
+    data.put(DF305);
+    data.put(DF306);
+    data.put(DF307);
+    data.put(DF308);
+    data.put(DF309);
+    data.put(DF310);
+    data.put(DF311);
+    data.put(DF312);
+    data.put(DF314);
+    data.put(DF315);
+    data.put(DF001_);
+
+    if (data.size_bits() != 496)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.size_bits() << ")";
         }
 
     std::string msg = build_message(data);
@@ -2292,7 +2261,7 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
             msg_number = 1071;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2302,11 +2271,11 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_1_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_1_content_signal_data(observables);
+    data.append(Rtcm::get_MSM_1_content_signal_data(observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
 
     if (server_is_running)
         {
@@ -2317,7 +2286,7 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_header(uint32_t msg_number,
+Rtcm_Bit_Writer Rtcm::get_MSM_header(uint32_t msg_number,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id,
@@ -2344,39 +2313,41 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
 
-    std::string header = DF002.to_string() + DF003.to_string();
+    Rtcm_Bit_Writer header;
+    header.put(DF002);
+    header.put(DF003);
     // GNSS Epoch Time Specific to each constellation
     if ((sys == "R"))
         {
             // GLONASS Epoch Time
             Rtcm::set_DF034(obs_time);
-            header += DF034.to_string();
+            header.put(DF034);
         }
     else
         {
             // GPS, Galileo Epoch Time
             Rtcm::set_DF004(obs_time);
-            header += DF004.to_string();
+            header.put(DF004);
         }
 
-    header = header + DF393.to_string() +
-             DF409.to_string() +
-             DF001_.to_string() +
-             DF411.to_string() +
-             DF417.to_string() +
-             DF412.to_string() +
-             DF418.to_string() +
-             DF394.to_string() +
-             DF395.to_string() +
-             Rtcm::set_DF396(observables);
+    header.put(DF393);
+    header.put(DF409);
+    header.put(DF001_);
+    header.put(DF411);
+    header.put(DF417);
+    header.put(DF412);
+    header.put(DF418);
+    header.put(DF394);
+    header.put(DF395);
+    header.put(Rtcm::set_DF396(observables));
 
     return header;
 }
 
 
-std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+Rtcm_Bit_Writer Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
+    Rtcm_Bit_Writer sat_data;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2406,16 +2377,16 @@ std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchr
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            sat_data += DF398.to_string();
+            sat_data.put(DF398);
         }
 
     return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
+Rtcm_Bit_Writer Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
+    Rtcm_Bit_Writer signal_data;
     const uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2436,7 +2407,7 @@ std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Syn
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
-            signal_data += DF400.to_string();
+            signal_data.put(DF400);
         }
 
     return signal_data;
@@ -2489,7 +2460,7 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
             msg_number = 1072;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2499,11 +2470,11 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_1_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2513,17 +2484,17 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2547,12 +2518,14 @@ std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF401.to_string();
-            second_data_type += DF402.to_string();
-            third_data_type += DF420.to_string();
+            first_data_type.put(DF401);
+            second_data_type.put(DF402);
+            third_data_type.put(DF420);
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type;
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
     return signal_data;
 }
 
@@ -2603,7 +2576,7 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
             msg_number = 1073;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2613,11 +2586,11 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_1_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2627,18 +2600,18 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2663,13 +2636,16 @@ std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
+            first_data_type.put(DF400);
+            second_data_type.put(DF401);
+            third_data_type.put(DF402);
+            fourth_data_type.put(DF420);
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
+    signal_data.append(fourth_data_type);
     return signal_data;
 }
 
@@ -2720,7 +2696,7 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
             msg_number = 1074;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2730,11 +2706,11 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_4_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2744,11 +2720,11 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+Rtcm_Bit_Writer Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
+    Rtcm_Bit_Writer sat_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2779,27 +2755,28 @@ std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchr
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            first_data_type += DF397.to_string();
-            second_data_type += DF398.to_string();
+            first_data_type.put(DF397);
+            second_data_type.put(DF398);
         }
-    sat_data = first_data_type + second_data_type;
+    sat_data.append(first_data_type);
+    sat_data.append(second_data_type);
     return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2825,14 +2802,18 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-        }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
+            first_data_type.put(DF400);
+            second_data_type.put(DF401);
+            third_data_type.put(DF402);
+            fourth_data_type.put(DF420);
+            fifth_data_type.put(DF403);
+        }
+
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
+    signal_data.append(fourth_data_type);
+    signal_data.append(fifth_data_type);
     return signal_data;
 }
 
@@ -2883,7 +2864,7 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
             msg_number = 1075;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2893,11 +2874,11 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_5_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2907,13 +2888,13 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+Rtcm_Bit_Writer Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    Rtcm_Bit_Writer sat_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2946,30 +2927,33 @@ std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchr
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF399(ordered_by_PRN_pos.at(nsat).second);
             auto reserved = std::bitset<4>("0000");
-            first_data_type += DF397.to_string();
-            second_data_type += reserved.to_string();
-            third_data_type += DF398.to_string();
-            fourth_data_type += DF399.to_string();
-        }
-    sat_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
+            first_data_type.put(DF397);
+            second_data_type.put(reserved);
+            third_data_type.put(DF398);
+            fourth_data_type.put(DF399);
+        }
+    sat_data.append(first_data_type);
+    sat_data.append(second_data_type);
+    sat_data.append(third_data_type);
+    sat_data.append(fourth_data_type);
     return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
+    Rtcm_Bit_Writer sixth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -2996,15 +2980,20 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-            sixth_data_type += DF404.to_string();
-        }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
+            first_data_type.put(DF400);
+            second_data_type.put(DF401);
+            third_data_type.put(DF402);
+            fourth_data_type.put(DF420);
+            fifth_data_type.put(DF403);
+            sixth_data_type.put(DF404);
+        }
+
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
+    signal_data.append(fourth_data_type);
+    signal_data.append(fifth_data_type);
+    signal_data.append(sixth_data_type);
     return signal_data;
 }
 
@@ -3055,7 +3044,7 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3065,11 +3054,11 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_4_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3079,19 +3068,19 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -3117,14 +3106,18 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-        }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
+            first_data_type.put(DF405);
+            second_data_type.put(DF406);
+            third_data_type.put(DF407);
+            fourth_data_type.put(DF420);
+            fifth_data_type.put(DF408);
+        }
+
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
+    signal_data.append(fourth_data_type);
+    signal_data.append(fifth_data_type);
     return signal_data;
 }
 
@@ -3175,7 +3168,7 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    Rtcm_Bit_Writer data = Rtcm::get_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3185,11 +3178,11 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    data.append(Rtcm::get_MSM_5_content_sat_data(observables));
 
-    const std::string signal_data = Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    data.append(Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables));
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(data);
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3199,20 +3192,20 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
+Rtcm_Bit_Writer Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    Rtcm_Bit_Writer signal_data;
+    Rtcm_Bit_Writer first_data_type;
+    Rtcm_Bit_Writer second_data_type;
+    Rtcm_Bit_Writer third_data_type;
+    Rtcm_Bit_Writer fourth_data_type;
+    Rtcm_Bit_Writer fifth_data_type;
+    Rtcm_Bit_Writer sixth_data_type;
 
     const uint32_t Ncells = observables.size();
 
@@ -3239,15 +3232,20 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-            sixth_data_type += DF404.to_string();
-        }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
+            first_data_type.put(DF405);
+            second_data_type.put(DF406);
+            third_data_type.put(DF407);
+            fourth_data_type.put(DF420);
+            fifth_data_type.put(DF408);
+            sixth_data_type.put(DF404);
+        }
+
+    signal_data.append(first_data_type);
+    signal_data.append(second_data_type);
+    signal_data.append(third_data_type);
+    signal_data.append(fourth_data_type);
+    signal_data.append(fifth_data_type);
+    signal_data.append(sixth_data_type);
     return signal_data;
 }
 
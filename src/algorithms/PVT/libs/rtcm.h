@@ -26,6 +26,7 @@
 #include "gnss_synchro.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_ephemeris.h"
+#include "rtcm_bit_writer.h"
 #include <boost/asio.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <glog/logging.h>
@@ -454,7 +455,7 @@ private:
      */
     std::bitset<130> get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
 
-    std::string get_MSM_header(uint32_t msg_number,
+    Rtcm_Bit_Writer get_MSM_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -464,17 +465,17 @@ private:
         bool divergence_free,
         bool more_messages);
 
-    std::string get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
 
-    std::string get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
 
     //
     // Utilities
@@ -594,7 +595,7 @@ private:
     {
     public:
         virtual ~RtcmListener() = default;
-        virtual void deliver(const Rtcm_Message& msg) = 0;
+        virtual void deliver(const std::shared_ptr<const Rtcm_Message>& msg) = 0;
     };
 
 
@@ -604,7 +605,7 @@ private:
         inline void join(const std::shared_ptr<RtcmListener>& participant)
         {
             participants_.insert(participant);
-            for (auto msg : recent_msgs_)
+            for (const auto& msg : recent_msgs_)
                 {
                     participant->deliver(msg);
                 }
@@ -617,7 +618,9 @@ private:
 
         inline void deliver(const Rtcm_Message& msg)
         {
-            recent_msgs_.push_back(msg);
+            // A single immutable copy is shared by all the sessions
+            const auto shared_msg = std::make_shared<const Rtcm_Message>(msg);
+            recent_msgs_.push_back(shared_msg);
             while (recent_msgs_.size() > max_recent_msgs)
                 {
                     recent_msgs_.pop_front();
@@ -625,7 +628,7 @@ private:
 
             for (const auto& participant : participants_)
                 {
-                    participant->deliver(msg);
+                    participant->deliver(shared_msg);
                 }
         }
 
@@ -635,7 +638,7 @@ private:
         {
             max_recent_msgs = 1
         };
-        std::deque<Rtcm_Message> recent_msgs_;
+        std::deque<std::shared_ptr<const Rtcm_Message> > recent_msgs_;
     };
 
 
@@ -651,7 +654,7 @@ private:
             do_read_message_header();
         }
 
-        inline void deliver(const Rtcm_Message& msg)
+        inline void deliver(const std::shared_ptr<const Rtcm_Message>& msg)
         {
             bool write_in_progress = !write_msgs_.empty();
             write_msgs_.push_back(msg);
@@ -722,7 +725,7 @@ private:
         {
             auto self(shared_from_this());
             boost::asio::async_write(socket_,
-                boost::asio::buffer(write_msgs_.front().body(), write_msgs_.front().body_length()),
+                boost::asio::buffer(write_msgs_.front()->body(), write_msgs_.front()->body_length()),
                 [this, self](boost::system::error_code ec, std::size_t /*length*/) {
                     if (!ec)
                         {
@@ -743,7 +746,7 @@ private:
         boost::asio::ip::tcp::socket socket_;
         Rtcm_Listener_Room& room_;
         Rtcm_Message read_msg_;
-        std::deque<Rtcm_Message> write_msgs_;
+        std::deque<std::shared_ptr<const Rtcm_Message> > write_msgs_;
         std::string client_says;
     };
 
@@ -860,6 +863,10 @@ private:
                         {
                             break;
                         }
+                    if (message.empty())
+                        {
+                            continue;  // message that did not fit in a frame
+                        }
 
                     const char* char_msg = message.c_str();
                     msg.body_length(message.length());
@@ -956,10 +963,8 @@ private:
     //
     // Transport Layer
     //
-    std::bitset<8> preamble;
-    std::bitset<6> reserved_field;
-    std::string add_CRC(const std::string& m) const;
-    std::string build_message(const std::string& data) const;  // adds 0s to complete a byte and adds the CRC
+    std::string build_message(const std::string& data) const;      // adds 0s to complete a byte and adds the CRC
+    std::string build_message(const Rtcm_Bit_Writer& data) const;  // frames an already packed message
 
     //
     // Data Fields
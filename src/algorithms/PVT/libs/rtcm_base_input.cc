@@ -0,0 +1,405 @@
+/*!
+ * \file rtcm_base_input.cc
+ * \brief Input of RTCM 3 base station observations for differential and RTK
+ * positioning
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_base_input.h"
+#include "gnss_sdr_make_unique.h"
+#include "rtklib_rtcm.h"
+#include "rtklib_rtkcmn.h"
+#include <boost/asio.hpp>
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+
+namespace
+{
+double to_seconds(const gtime_t& t)
+{
+    return static_cast<double>(t.time) + t.sec;
+}
+
+
+void update_max(std::atomic<uint64_t>& max, uint64_t value)
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+}
+
+
+void record(std::atomic<uint64_t>& sum_us, std::atomic<uint64_t>& max_us, double value_s)
+{
+    const auto value_us = static_cast<uint64_t>(std::max(value_s, 0.0) * 1e6);
+    sum_us.fetch_add(value_us, std::memory_order_relaxed);
+    update_max(max_us, value_us);
+}
+
+
+double mean_ms(const std::atomic<uint64_t>& sum_us, uint64_t count)
+{
+    return count > 0 ? static_cast<double>(sum_us.load(std::memory_order_relaxed)) / static_cast<double>(count) / 1e3 : 0.0;
+}
+}  // namespace
+
+
+/*
+ * TCP client of the base station stream. It runs on the decoding thread
+ * and retries the connection every second until it is stopped.
+ */
+class Rtcm_Base_Input::Tcp_Reader
+{
+public:
+    Tcp_Reader(Rtcm_Base_Input* input, const boost::asio::ip::tcp::endpoint& endpoint)
+        : d_input(input),
+          d_endpoint(endpoint),
+          d_socket(d_io_context),
+          d_timer(d_io_context)
+    {
+    }
+
+    void run()
+    {
+        connect();
+        d_io_context.run();
+    }
+
+    void stop()
+    {
+        d_io_context.stop();
+    }
+
+private:
+    void connect()
+    {
+        d_socket.async_connect(d_endpoint, [this](const boost::system::error_code& ec) {
+            if (ec)
+                {
+                    if (d_connected)
+                        {
+                            LOG(WARNING) << "Unable to connect to the RTCM base station at " << d_endpoint << ": " << ec.message();
+                            d_connected = false;
+                        }
+                    reconnect();
+                    return;
+                }
+            LOG(INFO) << "Connected to the RTCM base station at " << d_endpoint;
+            d_connected = true;
+            read();
+        });
+    }
+
+    void read()
+    {
+        d_socket.async_read_some(boost::asio::buffer(d_buffer), [this](const boost::system::error_code& ec, size_t length) {
+            if (ec)
+                {
+                    LOG(WARNING) << "Connection to the RTCM base station at " << d_endpoint << " lost: " << ec.message();
+                    reconnect();
+                    return;
+                }
+            d_input->decode(d_buffer.data(), length);
+            read();
+        });
+    }
+
+    void reconnect()
+    {
+        boost::system::error_code ec;
+        d_socket.close(ec);
+#if USE_BOOST_ASIO_IO_CONTEXT
+        d_timer.expires_after(std::chrono::seconds(1));
+#else
+        d_timer.expires_from_now(std::chrono::seconds(1));
+#endif
+        d_timer.async_wait([this](const boost::system::error_code& ec2) {
+            if (!ec2)
+                {
+                    connect();
+                }
+        });
+    }
+
+    Rtcm_Base_Input* d_input;
+    boost::asio::ip::tcp::endpoint d_endpoint;
+    b_io_context d_io_context;
+    boost::asio::ip::tcp::socket d_socket;
+    boost::asio::steady_timer d_timer;
+    std::array<uint8_t, 4096> d_buffer{};
+    bool d_connected{true};  // so the first failure is logged
+};
+
+
+Rtcm_Base_Input::Rtcm_Base_Input(const std::string& source) : d_rtcm(std::make_unique<rtcm_t>())
+{
+    if (init_rtcm(d_rtcm.get()) == 0)
+        {
+            LOG(WARNING) << "Unable to allocate the RTCM decoder buffers";
+            return;
+        }
+
+    const std::string tcp_prefix("tcp://");
+    const std::string file_prefix("file://");
+    if (source.compare(0, tcp_prefix.size(), tcp_prefix) == 0)
+        {
+            const std::string address_port = source.substr(tcp_prefix.size());
+            const size_t colon = address_port.rfind(':');
+            boost::system::error_code ec;
+            const auto address = boost::asio::ip::address::from_string(address_port.substr(0, colon), ec);
+            const uint64_t port = colon == std::string::npos ? 0 : std::strtoul(address_port.c_str() + colon + 1, nullptr, 10);
+            if (ec || port == 0 || port > 65535)
+                {
+                    LOG(WARNING) << "Invalid RTCM base station source " << source << ", expected tcp://<ip address>:<port>";
+                    return;
+                }
+            d_real_time = true;
+            d_tcp_reader = std::make_unique<Tcp_Reader>(this, boost::asio::ip::tcp::endpoint(address, static_cast<uint16_t>(port)));
+            d_thread = std::thread([this]() { d_tcp_reader->run(); });
+        }
+    else
+        {
+            const std::string file_name = source.compare(0, file_prefix.size(), file_prefix) == 0 ? source.substr(file_prefix.size()) : source;
+            d_thread = std::thread(&Rtcm_Base_Input::read_file, this, file_name);
+        }
+}
+
+
+Rtcm_Base_Input::~Rtcm_Base_Input()
+{
+    d_stop.store(true);
+    if (d_tcp_reader)
+        {
+            d_tcp_reader->stop();
+        }
+    if (d_thread.joinable())
+        {
+            d_thread.join();
+        }
+    free_rtcm(d_rtcm.get());
+}
+
+
+void Rtcm_Base_Input::read_file(const std::string& file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.is_open())
+        {
+            LOG(WARNING) << "Unable to open the RTCM base station file " << file_name;
+            return;
+        }
+
+    // The first rover epoch resolves the week of the base epochs
+    while (!d_stop.load(std::memory_order_relaxed) && d_requested_time_s.load(std::memory_order_relaxed) == 0.0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    const double first_time_s = d_requested_time_s.load(std::memory_order_relaxed);
+    d_rtcm->time.time = static_cast<time_t>(std::floor(first_time_s));
+    d_rtcm->time.sec = first_time_s - std::floor(first_time_s);
+
+    std::array<char, 256> buffer{};
+    while (!d_stop.load(std::memory_order_relaxed))
+        {
+            if (d_written.load(std::memory_order_relaxed) > 0 &&
+                d_newest_time_s.load(std::memory_order_relaxed) > d_requested_time_s.load(std::memory_order_relaxed) + RTCM_BASE_FILE_READ_AHEAD_S)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+            file.read(buffer.data(), buffer.size());
+            const auto length = file.gcount();
+            if (length <= 0)
+                {
+                    break;
+                }
+            decode(reinterpret_cast<const uint8_t*>(buffer.data()), static_cast<size_t>(length));
+        }
+    LOG(INFO) << "End of the RTCM base station file " << file_name;
+}
+
+
+void Rtcm_Base_Input::decode(const uint8_t* data, size_t length)
+{
+    d_bytes.fetch_add(length, std::memory_order_relaxed);
+    for (size_t i = 0; i < length; i++)
+        {
+            switch (input_rtcm3(d_rtcm.get(), data[i]))
+                {
+                case 1:  // observation data
+                    publish_epoch();
+                    break;
+                case 5:  // station parameters
+                    {
+                        // Antenna reference point plus antenna height, as in RTKLIB's rtksvr
+                        const sta_t& sta = d_rtcm->sta;
+                        std::array<double, 3> pos{};
+                        std::array<double, 3> del{};
+                        std::array<double, 3> dr{};
+                        ecef2pos(sta.pos, pos.data());
+                        if (sta.deltype == 0)  // e/n/u
+                            {
+                                del = {sta.del[0], sta.del[1], sta.del[2] + sta.hgt};
+                                enu2ecef(pos.data(), del.data(), dr.data());
+                                for (int k = 0; k < 3; k++)
+                                    {
+                                        d_station_position[k] = sta.pos[k] + dr[k];
+                                    }
+                            }
+                        else  // x/y/z
+                            {
+                                del[2] = sta.hgt;
+                                enu2ecef(pos.data(), del.data(), dr.data());
+                                for (int k = 0; k < 3; k++)
+                                    {
+                                        d_station_position[k] = sta.pos[k] + sta.del[k] + dr[k];
+                                    }
+                            }
+                        DLOG(INFO) << "RTCM base station " << d_rtcm->staid << " at ECEF (" << d_station_position[0] << ", "
+                                   << d_station_position[1] << ", " << d_station_position[2] << ")";
+                    }
+                    break;
+                default:
+                    break;
+                }
+        }
+}
+
+
+void Rtcm_Base_Input::publish_epoch()
+{
+    const obs_t& obs = d_rtcm->obs;
+    if (obs.n <= 0)
+        {
+            return;
+        }
+    const int n_obs = std::min(obs.n, MAXOBS);
+    const double time_s = to_seconds(obs.data[0].time);
+
+    // Seqlock write: readers discard the slot if the counter is odd or changes while they copy it
+    const uint64_t written = d_written.load(std::memory_order_relaxed);
+    Slot& slot = d_ring[written % RTCM_BASE_RING_SIZE];
+    const uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Rtcm_Base_Epoch& epoch = slot.epoch;
+    std::copy(obs.data, obs.data + n_obs, epoch.obs.begin());
+    std::sort(epoch.obs.begin(), epoch.obs.begin() + n_obs, [](const obsd_t& a, const obsd_t& b) { return a.sat < b.sat; });
+    for (int i = 0; i < n_obs; i++)
+        {
+            epoch.obs[i].rcv = 2;
+        }
+    epoch.n_obs = n_obs;
+    epoch.time = obs.data[0].time;
+    epoch.position = d_station_position;
+    epoch.station_id = d_rtcm->staid;
+    epoch.decoded = std::chrono::steady_clock::now();
+    slot.time_s.store(time_s, std::memory_order_relaxed);
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    d_written.store(written + 1, std::memory_order_release);
+    d_newest_time_s.store(time_s, std::memory_order_relaxed);
+
+    if (d_real_time)
+        {
+            record(d_arrival_latency_sum_us, d_arrival_latency_max_us, timediff(utc2gpst(timeget()), epoch.time));
+        }
+}
+
+
+bool Rtcm_Base_Input::get_base_epoch(const gtime_t& rover_time, double max_age_s, Rtcm_Base_Epoch& epoch)
+{
+    const double rover_time_s = to_seconds(rover_time);
+    d_requested_time_s.store(rover_time_s, std::memory_order_relaxed);
+
+    // A second attempt in case the chosen slot is overwritten while being copied
+    for (int attempt = 0; attempt < 2; attempt++)
+        {
+            const Slot* best = nullptr;
+            uint64_t best_seq = 0;
+            double best_dt = max_age_s;
+            for (const auto& slot : d_ring)
+                {
+                    const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+                    if (seq == 0 || (seq & 1U) != 0)
+                        {
+                            continue;
+                        }
+                    const double dt = std::abs(rover_time_s - slot.time_s.load(std::memory_order_relaxed));
+                    if (dt <= best_dt)
+                        {
+                            best = &slot;
+                            best_seq = seq;
+                            best_dt = dt;
+                        }
+                }
+            if (best == nullptr)
+                {
+                    break;
+                }
+
+            epoch = best->epoch;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (best->seq.load(std::memory_order_relaxed) != best_seq)
+                {
+                    d_torn_reads.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+            d_epochs_used.fetch_add(1, std::memory_order_relaxed);
+            record(d_age_sum_us, d_age_max_us, std::abs(timediff(rover_time, epoch.time)));
+            record(d_queue_delay_sum_us, d_queue_delay_max_us, std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch.decoded).count());
+            if (d_real_time)
+                {
+                    record(d_latency_sum_us, d_latency_max_us, timediff(utc2gpst(timeget()), epoch.time));
+                }
+            return true;
+        }
+    d_epochs_missing.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+
+Rtcm_Base_Stats Rtcm_Base_Input::get_stats() const
+{
+    Rtcm_Base_Stats stats;
+    stats.bytes = d_bytes.load(std::memory_order_relaxed);
+    stats.epochs_decoded = d_written.load(std::memory_order_relaxed);
+    stats.epochs_used = d_epochs_used.load(std::memory_order_relaxed);
+    stats.epochs_missing = d_epochs_missing.load(std::memory_order_relaxed);
+    stats.torn_reads = d_torn_reads.load(std::memory_order_relaxed);
+    stats.mean_queue_delay_ms = mean_ms(d_queue_delay_sum_us, stats.epochs_used);
+    stats.max_queue_delay_ms = static_cast<double>(d_queue_delay_max_us.load(std::memory_order_relaxed)) / 1e3;
+    stats.mean_age_s = mean_ms(d_age_sum_us, stats.epochs_used) / 1e3;
+    stats.max_age_s = static_cast<double>(d_age_max_us.load(std::memory_order_relaxed)) / 1e6;
+    if (d_real_time)
+        {
+            stats.mean_arrival_latency_ms = mean_ms(d_arrival_latency_sum_us, stats.epochs_decoded);
+            stats.max_arrival_latency_ms = static_cast<double>(d_arrival_latency_max_us.load(std::memory_order_relaxed)) / 1e3;
+            stats.mean_latency_ms = mean_ms(d_latency_sum_us, stats.epochs_used);
+            stats.max_latency_ms = static_cast<double>(d_latency_max_us.load(std::memory_order_relaxed)) / 1e3;
+        }
+    return stats;
+}
@@ -0,0 +1,168 @@
+/*!
+ * \file rtcm_base_input.h
+ * \brief Input of RTCM 3 base station observations for differential and RTK
+ * positioning
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BASE_INPUT_H
+#define GNSS_SDR_RTCM_BASE_INPUT_H
+
+#include "rtklib.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Base station observations of one epoch, as decoded from RTCM 3
+ */
+struct Rtcm_Base_Epoch
+{
+    gtime_t time{};                                   //!< Epoch time (GPST)
+    std::array<obsd_t, MAXOBS> obs{};                 //!< Observations, sorted by satellite and with rcv = 2
+    std::array<double, 3> position{};                 //!< Station ECEF position [m] from MT1005/1006, zero if not received yet
+    std::chrono::steady_clock::time_point decoded{};  //!< When the epoch was complete
+    int n_obs{0};
+    int station_id{0};
+};
+
+
+/*!
+ * \brief Statistics of the base observations input
+ *
+ * Latencies are measured from the base epoch time to the receiver system
+ * clock, so they are only meaningful for real-time sources and a system
+ * clock synchronized to GPS time (e.g., by NTP). The queue delay only
+ * depends on the local steady clock. The age is the difference
+ * between the rover and the base epoch times, as seen by the solver.
+ */
+struct Rtcm_Base_Stats
+{
+    uint64_t bytes{0};                    //!< Bytes received
+    uint64_t epochs_decoded{0};           //!< Complete base epochs written to the ring
+    uint64_t epochs_used{0};              //!< Requests served with a base epoch
+    uint64_t epochs_missing{0};           //!< Requests without a base epoch within the maximum age
+    uint64_t torn_reads{0};               //!< Reads discarded because the epoch was being overwritten
+    double mean_arrival_latency_ms{0.0};  //!< From the base epoch time to its decoding
+    double max_arrival_latency_ms{0.0};   //!< Maximum arrival latency
+    double mean_latency_ms{0.0};          //!< From the base epoch time to its use by the solver (end to end)
+    double max_latency_ms{0.0};           //!< Maximum end-to-end latency
+    double mean_queue_delay_ms{0.0};      //!< From the decoding of the base epoch to its use by the solver
+    double max_queue_delay_ms{0.0};       //!< Maximum queue delay
+    double mean_age_s{0.0};               //!< Rover epoch time minus base epoch time
+    double max_age_s{0.0};                //!< Maximum age
+};
+
+
+/*!
+ * \brief Reads an RTCM 3 stream of base station observations (MT1001-1004,
+ * MT1009-1012 and MSM) and station coordinates (MT1005/1006) from a TCP
+ * server or from a file.
+ *
+ * The stream is decoded with the RTKLIB functions on a dedicated thread,
+ * which writes each complete base epoch into a ring of slots. Each slot is
+ * protected by a sequence counter, so get_base_epoch() copies the epoch
+ * closest to the rover time without taking any lock and without ever
+ * waiting for the decoding thread: a slot that is overwritten while being
+ * read is just discarded.
+ *
+ * Sources are given as "tcp://<ip address>:<port>" or as a file path,
+ * optionally prefixed by "file://". The TCP client reconnects automatically
+ * if the connection is lost. Files are replayed at the pace of the rover:
+ * the week of the base epochs is resolved with the time of the first rover
+ * epoch, and decoding stops while the base data is more than
+ * RTCM_BASE_FILE_READ_AHEAD_S ahead of the last rover epoch.
+ */
+class Rtcm_Base_Input
+{
+public:
+    explicit Rtcm_Base_Input(const std::string& source);
+    ~Rtcm_Base_Input();
+
+    Rtcm_Base_Input(const Rtcm_Base_Input&) = delete;
+    Rtcm_Base_Input& operator=(const Rtcm_Base_Input&) = delete;
+
+    /*!
+     * \brief Copies into epoch the base epoch closest to rover_time, if its
+     * time difference does not exceed max_age_s. Never blocks. Safe to call
+     * concurrently from the solvers of several positioning modes.
+     */
+    bool get_base_epoch(const gtime_t& rover_time, double max_age_s, Rtcm_Base_Epoch& epoch);
+
+    Rtcm_Base_Stats get_stats() const;
+
+    inline bool is_real_time() const
+    {
+        return d_real_time;
+    }
+
+private:
+    class Tcp_Reader;
+
+    struct Slot
+    {
+        std::atomic<uint64_t> seq{0};  // odd while being written, zero if never written
+        std::atomic<double> time_s{0.0};
+        Rtcm_Base_Epoch epoch{};
+    };
+
+    static constexpr size_t RTCM_BASE_RING_SIZE = 32;
+    static constexpr double RTCM_BASE_FILE_READ_AHEAD_S = 2.0;
+
+    void read_file(const std::string& file_name);
+    void decode(const uint8_t* data, size_t length);
+    void publish_epoch();
+
+    std::array<Slot, RTCM_BASE_RING_SIZE> d_ring{};
+    std::unique_ptr<rtcm_t> d_rtcm;  // only accessed by the decoding thread
+    std::unique_ptr<Tcp_Reader> d_tcp_reader;
+    std::thread d_thread;
+
+    std::array<double, 3> d_station_position{};  // only accessed by the decoding thread
+
+    std::atomic<uint64_t> d_written{0};
+    std::atomic<double> d_requested_time_s{0.0};
+    std::atomic<double> d_newest_time_s{0.0};
+    std::atomic<bool> d_stop{false};
+
+    std::atomic<uint64_t> d_bytes{0};
+    std::atomic<uint64_t> d_epochs_used{0};
+    std::atomic<uint64_t> d_epochs_missing{0};
+    std::atomic<uint64_t> d_torn_reads{0};
+    std::atomic<uint64_t> d_arrival_latency_sum_us{0};
+    std::atomic<uint64_t> d_arrival_latency_max_us{0};
+    std::atomic<uint64_t> d_latency_sum_us{0};
+    std::atomic<uint64_t> d_latency_max_us{0};
+    std::atomic<uint64_t> d_queue_delay_sum_us{0};
+    std::atomic<uint64_t> d_queue_delay_max_us{0};
+    std::atomic<uint64_t> d_age_sum_us{0};
+    std::atomic<uint64_t> d_age_max_us{0};
+
+    bool d_real_time{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BASE_INPUT_H
@@ -0,0 +1,145 @@
+/*!
+ * \file rtcm_bit_writer.cc
+ * \brief Packs RTCM 3 data fields into a byte buffer and frames them
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_bit_writer.h"
+#include <glog/logging.h>
+#include <array>
+
+
+namespace
+{
+constexpr uint32_t CRC24Q_POLY = 0x1864CFBU;
+constexpr uint8_t RTCM_PREAMBLE = 0xD3;
+constexpr std::size_t RTCM_MAX_PAYLOAD_BYTES = 1023;  // 10-bit message length field
+
+
+std::array<uint32_t, 256> make_crc24q_table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i << 16;
+            for (int32_t bit = 0; bit < 8; bit++)
+                {
+                    crc <<= 1;
+                    if (crc & 0x1000000U)
+                        {
+                            crc ^= CRC24Q_POLY;
+                        }
+                }
+            table[i] = crc & 0xFFFFFFU;
+        }
+    return table;
+}
+}  // namespace
+
+
+void Rtcm_Bit_Writer::put(uint64_t value, uint32_t bits)
+{
+    uint32_t remaining = bits > 64 ? 64 : bits;
+    while (remaining > 0)
+        {
+            const uint32_t used_bits = bit_count_ % 8;
+            if (used_bits == 0)
+                {
+                    buffer_.push_back(0);
+                }
+            const uint32_t free_bits = 8 - used_bits;
+            const uint32_t n = remaining < free_bits ? remaining : free_bits;
+            const auto chunk = static_cast<uint8_t>((value >> (remaining - n)) & ((1U << n) - 1U));
+            buffer_.back() |= static_cast<uint8_t>(chunk << (free_bits - n));
+            bit_count_ += n;
+            remaining -= n;
+        }
+}
+
+
+void Rtcm_Bit_Writer::put(const std::string& bits)
+{
+    // pack in chunks of up to 64 characters
+    std::size_t pos = 0;
+    while (pos < bits.length())
+        {
+            const std::size_t n = (bits.length() - pos) < 64 ? (bits.length() - pos) : 64;
+            uint64_t value = 0;
+            for (std::size_t i = 0; i < n; i++)
+                {
+                    value = (value << 1) | (bits[pos + i] == '1' ? 1ULL : 0ULL);
+                }
+            put(value, static_cast<uint32_t>(n));
+            pos += n;
+        }
+}
+
+
+void Rtcm_Bit_Writer::append(const Rtcm_Bit_Writer& other)
+{
+    if (bit_count_ % 8 == 0)
+        {
+            buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+            bit_count_ += other.bit_count_;
+            return;
+        }
+    const std::size_t full_bytes = other.bit_count_ / 8;
+    for (std::size_t i = 0; i < full_bytes; i++)
+        {
+            put(other.buffer_[i], 8);
+        }
+    const auto tail_bits = static_cast<uint32_t>(other.bit_count_ % 8);
+    if (tail_bits > 0)
+        {
+            put(other.buffer_[full_bytes] >> (8 - tail_bits), tail_bits);
+        }
+}
+
+
+std::string Rtcm_Bit_Writer::frame() const
+{
+    const std::size_t payload_bytes = buffer_.size();
+    if (payload_bytes > RTCM_MAX_PAYLOAD_BYTES)
+        {
+            LOG(WARNING) << "RTCM message too long (" << payload_bytes << " bytes, "
+                         << RTCM_MAX_PAYLOAD_BYTES << " allowed), not sent";
+            return std::string();
+        }
+    // the unused bits of the last byte are already zero
+    std::string msg(payload_bytes + 6, '\0');
+    auto* bytes = reinterpret_cast<uint8_t*>(&msg[0]);
+    bytes[0] = RTCM_PREAMBLE;
+    bytes[1] = static_cast<uint8_t>((payload_bytes >> 8) & 0x03U);  // 6 reserved bits set to 0
+    bytes[2] = static_cast<uint8_t>(payload_bytes & 0xFFU);
+    for (std::size_t i = 0; i < payload_bytes; i++)
+        {
+            bytes[3 + i] = buffer_[i];
+        }
+    const uint32_t crc = crc24q(bytes, payload_bytes + 3);
+    bytes[payload_bytes + 3] = static_cast<uint8_t>((crc >> 16) & 0xFFU);
+    bytes[payload_bytes + 4] = static_cast<uint8_t>((crc >> 8) & 0xFFU);
+    bytes[payload_bytes + 5] = static_cast<uint8_t>(crc & 0xFFU);
+    return msg;
+}
+
+
+uint32_t Rtcm_Bit_Writer::crc24q(const uint8_t* data, std::size_t length)
+{
+    static const std::array<uint32_t, 256> table = make_crc24q_table();
+    uint32_t crc = 0;
+    for (std::size_t i = 0; i < length; i++)
+        {
+            crc = ((crc << 8) & 0xFFFFFFU) ^ table[((crc >> 16) ^ data[i]) & 0xFFU];
+        }
+    return crc;
+}
@@ -0,0 +1,95 @@
+/*!
+ * \file rtcm_bit_writer.h
+ * \brief Packs RTCM 3 data fields into a byte buffer and frames them
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BIT_WRITER_H
+#define GNSS_SDR_RTCM_BIT_WRITER_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Writes data fields most significant bit first into a packed
+ * byte buffer, and wraps the result in an RTCM 3 transport layer frame
+ * (preamble, message length, payload padded to a byte boundary and
+ * CRC-24Q parity) as defined in RTCM Standard 10403.2.
+ */
+class Rtcm_Bit_Writer
+{
+public:
+    Rtcm_Bit_Writer() = default;
+
+    /*!
+     * \brief Appends the \p bits least significant bits of \p value (up to 64)
+     */
+    void put(uint64_t value, uint32_t bits);
+
+    /*!
+     * \brief Appends a data field stored in a std::bitset
+     */
+    template <std::size_t N>
+    inline void put(const std::bitset<N>& field)
+    {
+        static_assert(N <= 64, "Data fields are limited to 64 bits");
+        put(static_cast<uint64_t>(field.to_ullong()), N);
+    }
+
+    /*!
+     * \brief Appends a string of '0' and '1' characters
+     */
+    void put(const std::string& bits);
+
+    /*!
+     * \brief Appends the content of another writer
+     */
+    void append(const Rtcm_Bit_Writer& other);
+
+    inline void clear()
+    {
+        buffer_.clear();
+        bit_count_ = 0;
+    }
+
+    inline std::size_t size_bits() const { return bit_count_; }
+
+    /*!
+     * \brief Returns the complete RTCM 3 frame, as binary data, or an empty
+     * string if the payload does not fit in a frame (more than 1023 bytes)
+     */
+    std::string frame() const;
+
+    /*!
+     * \brief Computes the Qualcomm CRC-24Q of a sequence of bytes
+     */
+    static uint32_t crc24q(const uint8_t* data, std::size_t length);
+
+private:
+    std::vector<uint8_t> buffer_;
+    std::size_t bit_count_{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BIT_WRITER_H
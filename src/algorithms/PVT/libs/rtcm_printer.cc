@@ -1662,6 +1662,11 @@ void Rtcm_Printer::close_serial() const
 
 bool Rtcm_Printer::Print_Message(const std::string& message)
 {
+    if (message.empty())
+        {
+            return false;  // message that did not fit in a frame
+        }
+
     // write to file
     if (d_rtcm_file_dump)
         {
@@ -32,12 +32,15 @@
 
 #include "rtklib_solver.h"
 #include "Beidou_DNAV.h"
+#include "gnss_sdr_make_unique.h"
 #include "rtklib_conversions.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solution.h"
 #include <glog/logging.h>
 #include <matio.h>
+#include <algorithm>
 #include <exception>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -63,6 +66,13 @@ namespace errorlib = boost::system;
 // clang-format on
 
 
+Rtklib_Epoch::Rtklib_Epoch()
+{
+    nav.eph = eph.data();
+    nav.geph = geph.data();
+}
+
+
 Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk, int nchannels, const std::string &dump_filename, bool flag_dump_to_file, bool flag_dump_to_mat)
 {
     // init empty ephemeris for all the available GNSS channels
@@ -71,6 +81,7 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk, int nchannels, const std::string
     d_dump_filename = dump_filename;
     d_flag_dump_enabled = flag_dump_to_file;
     d_flag_dump_mat_enabled = flag_dump_to_mat;
+    d_nav = std::make_unique<nav_t>();
     this->set_averaging_flag(false);
 
     // ############# ENABLE DATA FILE LOG #################
@@ -399,7 +410,68 @@ Monitor_Pvt Rtklib_Solver::get_monitor_pvt() const
 }
 
 
+void Rtklib_Solver::set_base_input(std::shared_ptr<Rtcm_Base_Input> base_input, double max_age_s)
+{
+    d_base_input = std::move(base_input);
+    d_base_max_age_s = max_age_s;
+}
+
+
+void Rtklib_Solver::set_orbit_cache(bool enable)
+{
+    if (enable && !d_orbcache)
+        {
+            d_orbcache = std::make_unique<orbcache_t>();
+        }
+    else if (!enable)
+        {
+            d_orbcache.reset();
+        }
+}
+
+
+int Rtklib_Solver::add_base_observations(int n_rover_obs)
+{
+    if (rtk_.opt.mode == PMODE_SINGLE || rtk_.opt.mode >= PMODE_PPP_KINEMA || n_rover_obs == 0)
+        {
+            return 0;
+        }
+    if (!d_base_input->get_base_epoch(obs_data[0].time, d_base_max_age_s, d_base_epoch))
+        {
+            DLOG(INFO) << "No base station observations within " << d_base_max_age_s << " s of the rover epoch";
+            return 0;
+        }
+    if (d_base_epoch.position[0] == 0.0 && d_base_epoch.position[1] == 0.0 && d_base_epoch.position[2] == 0.0 && rtk_.opt.mode != PMODE_MOVEB)
+        {
+            DLOG(INFO) << "Base station position not received yet";
+            return 0;
+        }
+
+    // rtkpos() pairs rover and base observations of the same satellite assuming both sorted by satellite
+    std::stable_sort(obs_data.begin(), obs_data.begin() + n_rover_obs, [](const obsd_t &a, const obsd_t &b) { return a.sat < b.sat; });
+    std::copy(d_base_epoch.obs.cbegin(), d_base_epoch.obs.cbegin() + d_base_epoch.n_obs, obs_data.begin() + n_rover_obs);
+    for (int i = 0; i < 3; i++)
+        {
+            rtk_.opt.rb[i] = d_base_epoch.position[i];
+        }
+    DLOG(INFO) << "Using " << d_base_epoch.n_obs << " observations from base station " << d_base_epoch.station_id
+               << ", age " << timediff(obs_data[0].time, d_base_epoch.time) << " s";
+    return d_base_epoch.n_obs;
+}
+
+
 bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, bool flag_averaging)
+{
+    if (!d_epoch)
+        {
+            d_epoch = std::make_unique<Rtklib_Epoch>();
+        }
+    this->prepare_epoch(gnss_observables_map, *d_epoch);
+    return this->get_PVT(*d_epoch, flag_averaging);
+}
+
+
+bool Rtklib_Solver::prepare_epoch(const std::map<int, Gnss_Synchro> &gnss_observables_map, Rtklib_Epoch &epoch) const
 {
     std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
     std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
@@ -410,17 +482,16 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
     const Glonass_Gnav_Utc_Model gnav_utc = this->glonass_gnav_utc_model;
 
-    this->set_averaging_flag(flag_averaging);
-
     // ********************************************************************************
     // ****** PREPARE THE DATA (SV EPHEMERIS AND OBSERVATIONS) ************************
     // ********************************************************************************
     int valid_obs = 0;      // valid observations counter
     int glo_valid_obs = 0;  // GLONASS L1/L2 valid observations counter
 
+    std::array<obsd_t, MAXOBS> &obs_data = epoch.obs;
+    std::array<eph_t, MAXOBS> &eph_data = epoch.eph;
+    std::array<geph_t, MAXOBS> &geph_data = epoch.geph;
     obs_data.fill({});
-    std::vector<eph_t> eph_data(MAXOBS);
-    std::vector<geph_t> geph_data(MAXOBS);
 
     // Workaround for NAV/CNAV clash problem
     bool gps_dual_band = false;
@@ -796,109 +867,156 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                 }
         }
 
+    epoch.n_obs = valid_obs + glo_valid_obs;
+    if (!gnss_observables_map.empty())
+        {
+            epoch.rx_time = gnss_observables_map.cbegin()->second.RX_time;
+            epoch.tow_at_current_symbol_ms = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
+        }
+    if (epoch.n_obs <= 3)
+        {
+            return false;
+        }
+
+    nav_t &nav_data = epoch.nav;
+    nav_data.n = valid_obs;
+    nav_data.ng = glo_valid_obs;
+    std::fill(std::begin(nav_data.ion_gps), std::end(nav_data.ion_gps), 0.0);
+    std::fill(std::begin(nav_data.ion_gal), std::end(nav_data.ion_gal), 0.0);
+    std::fill(std::begin(nav_data.ion_cmp), std::end(nav_data.ion_cmp), 0.0);
+    std::fill(std::begin(nav_data.utc_gps), std::end(nav_data.utc_gps), 0.0);
+    std::fill(std::begin(nav_data.utc_glo), std::end(nav_data.utc_glo), 0.0);
+    std::fill(std::begin(nav_data.utc_gal), std::end(nav_data.utc_gal), 0.0);
+    std::fill(std::begin(nav_data.utc_cmp), std::end(nav_data.utc_cmp), 0.0);
+    nav_data.leaps = 0;
+    if (gps_iono.valid)
+        {
+            nav_data.ion_gps[0] = gps_iono.d_alpha0;
+            nav_data.ion_gps[1] = gps_iono.d_alpha1;
+            nav_data.ion_gps[2] = gps_iono.d_alpha2;
+            nav_data.ion_gps[3] = gps_iono.d_alpha3;
+            nav_data.ion_gps[4] = gps_iono.d_beta0;
+            nav_data.ion_gps[5] = gps_iono.d_beta1;
+            nav_data.ion_gps[6] = gps_iono.d_beta2;
+            nav_data.ion_gps[7] = gps_iono.d_beta3;
+        }
+    if (!(gps_iono.valid) and gps_cnav_iono.valid)
+        {
+            nav_data.ion_gps[0] = gps_cnav_iono.d_alpha0;
+            nav_data.ion_gps[1] = gps_cnav_iono.d_alpha1;
+            nav_data.ion_gps[2] = gps_cnav_iono.d_alpha2;
+            nav_data.ion_gps[3] = gps_cnav_iono.d_alpha3;
+            nav_data.ion_gps[4] = gps_cnav_iono.d_beta0;
+            nav_data.ion_gps[5] = gps_cnav_iono.d_beta1;
+            nav_data.ion_gps[6] = gps_cnav_iono.d_beta2;
+            nav_data.ion_gps[7] = gps_cnav_iono.d_beta3;
+        }
+    if (galileo_iono.ai0_5 != 0.0)
+        {
+            nav_data.ion_gal[0] = galileo_iono.ai0_5;
+            nav_data.ion_gal[1] = galileo_iono.ai1_5;
+            nav_data.ion_gal[2] = galileo_iono.ai2_5;
+            nav_data.ion_gal[3] = 0.0;
+        }
+    if (beidou_dnav_iono.valid)
+        {
+            nav_data.ion_cmp[0] = beidou_dnav_iono.d_alpha0;
+            nav_data.ion_cmp[1] = beidou_dnav_iono.d_alpha1;
+            nav_data.ion_cmp[2] = beidou_dnav_iono.d_alpha2;
+            nav_data.ion_cmp[3] = beidou_dnav_iono.d_alpha3;
+            nav_data.ion_cmp[4] = beidou_dnav_iono.d_beta0;
+            nav_data.ion_cmp[5] = beidou_dnav_iono.d_beta0;
+            nav_data.ion_cmp[6] = beidou_dnav_iono.d_beta0;
+            nav_data.ion_cmp[7] = beidou_dnav_iono.d_beta3;
+        }
+    if (gps_utc_model.valid)
+        {
+            nav_data.utc_gps[0] = gps_utc_model.d_A0;
+            nav_data.utc_gps[1] = gps_utc_model.d_A1;
+            nav_data.utc_gps[2] = gps_utc_model.d_t_OT;
+            nav_data.utc_gps[3] = gps_utc_model.i_WN_T;
+            nav_data.leaps = gps_utc_model.d_DeltaT_LS;
+        }
+    if (!(gps_utc_model.valid) and gps_cnav_utc_model.valid)
+        {
+            nav_data.utc_gps[0] = gps_cnav_utc_model.d_A0;
+            nav_data.utc_gps[1] = gps_cnav_utc_model.d_A1;
+            nav_data.utc_gps[2] = gps_cnav_utc_model.d_t_OT;
+            nav_data.utc_gps[3] = gps_cnav_utc_model.i_WN_T;
+            nav_data.leaps = gps_cnav_utc_model.d_DeltaT_LS;
+        }
+    if (glonass_gnav_utc_model.valid)
+        {
+            nav_data.utc_glo[0] = glonass_gnav_utc_model.d_tau_c;  // ??
+            nav_data.utc_glo[1] = 0.0;                             // ??
+            nav_data.utc_glo[2] = 0.0;                             // ??
+            nav_data.utc_glo[3] = 0.0;                             // ??
+        }
+    if (galileo_utc_model.A0_6 != 0.0)
+        {
+            nav_data.utc_gal[0] = galileo_utc_model.A0_6;
+            nav_data.utc_gal[1] = galileo_utc_model.A1_6;
+            nav_data.utc_gal[2] = galileo_utc_model.t0t_6;
+            nav_data.utc_gal[3] = galileo_utc_model.WNot_6;
+            nav_data.leaps = galileo_utc_model.Delta_tLS_6;
+        }
+    if (beidou_dnav_utc_model.valid)
+        {
+            nav_data.utc_cmp[0] = beidou_dnav_utc_model.d_A0_UTC;
+            nav_data.utc_cmp[1] = beidou_dnav_utc_model.d_A1_UTC;
+            nav_data.utc_cmp[2] = 0.0;  // ??
+            nav_data.utc_cmp[3] = 0.0;  // ??
+            nav_data.leaps = beidou_dnav_utc_model.i_DeltaT_LS;
+        }
+
+    /* update carrier wave length using native function call in RTKlib */
+    for (int i = 0; i < MAXSAT; i++)
+        {
+            for (int j = 0; j < NFREQ; j++)
+                {
+                    nav_data.lam[i][j] = satwavelen(i + 1, j, &nav_data);
+                }
+        }
+    return true;
+}
+
+
+bool Rtklib_Solver::get_PVT(const Rtklib_Epoch &epoch, bool flag_averaging)
+{
+    this->set_averaging_flag(flag_averaging);
+
     // **********************************************************************
     // ****** SOLVE PVT******************************************************
     // **********************************************************************
 
     this->set_valid_position(false);
-    if ((valid_obs + glo_valid_obs) > 3)
+    if (epoch.n_obs > 3)
         {
             int result = 0;
-            nav_t nav_data{};
-            nav_data.eph = eph_data.data();
-            nav_data.geph = geph_data.data();
-            nav_data.n = valid_obs;
-            nav_data.ng = glo_valid_obs;
-            if (gps_iono.valid)
-                {
-                    nav_data.ion_gps[0] = gps_iono.d_alpha0;
-                    nav_data.ion_gps[1] = gps_iono.d_alpha1;
-                    nav_data.ion_gps[2] = gps_iono.d_alpha2;
-                    nav_data.ion_gps[3] = gps_iono.d_alpha3;
-                    nav_data.ion_gps[4] = gps_iono.d_beta0;
-                    nav_data.ion_gps[5] = gps_iono.d_beta1;
-                    nav_data.ion_gps[6] = gps_iono.d_beta2;
-                    nav_data.ion_gps[7] = gps_iono.d_beta3;
-                }
-            if (!(gps_iono.valid) and gps_cnav_iono.valid)
-                {
-                    nav_data.ion_gps[0] = gps_cnav_iono.d_alpha0;
-                    nav_data.ion_gps[1] = gps_cnav_iono.d_alpha1;
-                    nav_data.ion_gps[2] = gps_cnav_iono.d_alpha2;
-                    nav_data.ion_gps[3] = gps_cnav_iono.d_alpha3;
-                    nav_data.ion_gps[4] = gps_cnav_iono.d_beta0;
-                    nav_data.ion_gps[5] = gps_cnav_iono.d_beta1;
-                    nav_data.ion_gps[6] = gps_cnav_iono.d_beta2;
-                    nav_data.ion_gps[7] = gps_cnav_iono.d_beta3;
-                }
-            if (galileo_iono.ai0_5 != 0.0)
-                {
-                    nav_data.ion_gal[0] = galileo_iono.ai0_5;
-                    nav_data.ion_gal[1] = galileo_iono.ai1_5;
-                    nav_data.ion_gal[2] = galileo_iono.ai2_5;
-                    nav_data.ion_gal[3] = 0.0;
-                }
-            if (beidou_dnav_iono.valid)
-                {
-                    nav_data.ion_cmp[0] = beidou_dnav_iono.d_alpha0;
-                    nav_data.ion_cmp[1] = beidou_dnav_iono.d_alpha1;
-                    nav_data.ion_cmp[2] = beidou_dnav_iono.d_alpha2;
-                    nav_data.ion_cmp[3] = beidou_dnav_iono.d_alpha3;
-                    nav_data.ion_cmp[4] = beidou_dnav_iono.d_beta0;
-                    nav_data.ion_cmp[5] = beidou_dnav_iono.d_beta0;
-                    nav_data.ion_cmp[6] = beidou_dnav_iono.d_beta0;
-                    nav_data.ion_cmp[7] = beidou_dnav_iono.d_beta3;
-                }
-            if (gps_utc_model.valid)
+            // The ephemeris are shared with the other solvers of the epoch, the orbit cache is not
+            nav_t &nav_data = *d_nav;
+            nav_data.eph = epoch.nav.eph;
+            nav_data.geph = epoch.nav.geph;
+            nav_data.n = epoch.nav.n;
+            nav_data.ng = epoch.nav.ng;
+            nav_data.orbcache = d_orbcache.get();
+            std::copy(std::begin(epoch.nav.ion_gps), std::end(epoch.nav.ion_gps), nav_data.ion_gps);
+            std::copy(std::begin(epoch.nav.ion_gal), std::end(epoch.nav.ion_gal), nav_data.ion_gal);
+            std::copy(std::begin(epoch.nav.ion_cmp), std::end(epoch.nav.ion_cmp), nav_data.ion_cmp);
+            std::copy(std::begin(epoch.nav.utc_gps), std::end(epoch.nav.utc_gps), nav_data.utc_gps);
+            std::copy(std::begin(epoch.nav.utc_glo), std::end(epoch.nav.utc_glo), nav_data.utc_glo);
+            std::copy(std::begin(epoch.nav.utc_gal), std::end(epoch.nav.utc_gal), nav_data.utc_gal);
+            std::copy(std::begin(epoch.nav.utc_cmp), std::end(epoch.nav.utc_cmp), nav_data.utc_cmp);
+            nav_data.leaps = epoch.nav.leaps;
+            std::copy(&epoch.nav.lam[0][0], &epoch.nav.lam[0][0] + MAXSAT * NFREQ, &nav_data.lam[0][0]);
+
+            int n_obs = epoch.n_obs;
+            std::copy(epoch.obs.cbegin(), epoch.obs.cbegin() + n_obs, obs_data.begin());
+            if (d_base_input)
                 {
-                    nav_data.utc_gps[0] = gps_utc_model.d_A0;
-                    nav_data.utc_gps[1] = gps_utc_model.d_A1;
-                    nav_data.utc_gps[2] = gps_utc_model.d_t_OT;
-                    nav_data.utc_gps[3] = gps_utc_model.i_WN_T;
-                    nav_data.leaps = gps_utc_model.d_DeltaT_LS;
+                    n_obs += add_base_observations(n_obs);
                 }
-            if (!(gps_utc_model.valid) and gps_cnav_utc_model.valid)
-                {
-                    nav_data.utc_gps[0] = gps_cnav_utc_model.d_A0;
-                    nav_data.utc_gps[1] = gps_cnav_utc_model.d_A1;
-                    nav_data.utc_gps[2] = gps_cnav_utc_model.d_t_OT;
-                    nav_data.utc_gps[3] = gps_cnav_utc_model.i_WN_T;
-                    nav_data.leaps = gps_cnav_utc_model.d_DeltaT_LS;
-                }
-            if (glonass_gnav_utc_model.valid)
-                {
-                    nav_data.utc_glo[0] = glonass_gnav_utc_model.d_tau_c;  // ??
-                    nav_data.utc_glo[1] = 0.0;                             // ??
-                    nav_data.utc_glo[2] = 0.0;                             // ??
-                    nav_data.utc_glo[3] = 0.0;                             // ??
-                }
-            if (galileo_utc_model.A0_6 != 0.0)
-                {
-                    nav_data.utc_gal[0] = galileo_utc_model.A0_6;
-                    nav_data.utc_gal[1] = galileo_utc_model.A1_6;
-                    nav_data.utc_gal[2] = galileo_utc_model.t0t_6;
-                    nav_data.utc_gal[3] = galileo_utc_model.WNot_6;
-                    nav_data.leaps = galileo_utc_model.Delta_tLS_6;
-                }
-            if (beidou_dnav_utc_model.valid)
-                {
-                    nav_data.utc_cmp[0] = beidou_dnav_utc_model.d_A0_UTC;
-                    nav_data.utc_cmp[1] = beidou_dnav_utc_model.d_A1_UTC;
-                    nav_data.utc_cmp[2] = 0.0;  // ??
-                    nav_data.utc_cmp[3] = 0.0;  // ??
-                    nav_data.leaps = beidou_dnav_utc_model.i_DeltaT_LS;
-                }
-
-            /* update carrier wave length using native function call in RTKlib */
-            for (int i = 0; i < MAXSAT; i++)
-                {
-                    for (int j = 0; j < NFREQ; j++)
-                        {
-                            nav_data.lam[i][j] = satwavelen(i + 1, j, &nav_data);
-                        }
-                }
-
-            result = rtkpos(&rtk_, obs_data.data(), valid_obs + glo_valid_obs, &nav_data);
+            result = rtkpos(&rtk_, obs_data.data(), n_obs, &nav_data);
 
             if (result == 0)
                 {
@@ -979,7 +1097,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
                     this->set_time_offset_s(rx_position_and_time[3]);
 
-                    DLOG(INFO) << "RTKLIB Position at RX TOW = " << gnss_observables_map.cbegin()->second.RX_time
+                    DLOG(INFO) << "RTKLIB Position at RX TOW = " << epoch.rx_time
                                << " in ECEF (X,Y,Z,t[meters]) = " << rx_position_and_time[0] << ", " << rx_position_and_time[1] << ", " << rx_position_and_time[2] << ", " << rx_position_and_time[3];
 
                     // gtime_t rtklib_utc_time = gpst2utc(pvt_sol.time); // Corrected RX Time (Non integer multiply of 1 ms of granularity)
@@ -998,11 +1116,11 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
                     // ######## PVT MONITOR #########
                     // TOW
-                    monitor_pvt.TOW_at_current_symbol_ms = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
+                    monitor_pvt.TOW_at_current_symbol_ms = epoch.tow_at_current_symbol_ms;
                     // WEEK
                     monitor_pvt.week = adjgpsweek(nav_data.eph[0].week, this->is_pre_2009());
                     // PVT GPS time
-                    monitor_pvt.RX_time = gnss_observables_map.cbegin()->second.RX_time;
+                    monitor_pvt.RX_time = epoch.rx_time;
                     // User clock offset [s]
                     monitor_pvt.user_clk_offset = rx_position_and_time[3];
 
@@ -1063,13 +1181,13 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     double tmp_double;
                                     uint32_t tmp_uint32;
                                     // TOW
-                                    tmp_uint32 = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
+                                    tmp_uint32 = epoch.tow_at_current_symbol_ms;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // WEEK
                                     tmp_uint32 = adjgpsweek(nav_data.eph[0].week, this->is_pre_2009());
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // PVT GPS time
-                                    tmp_double = gnss_observables_map.cbegin()->second.RX_time;
+                                    tmp_double = epoch.rx_time;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                                     // User clock offset [s]
                                     tmp_double = rx_position_and_time[3];
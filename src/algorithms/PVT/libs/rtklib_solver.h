@@ -56,10 +56,13 @@
 #include "gps_utc_model.h"
 #include "monitor_pvt.h"
 #include "pvt_solution.h"
+#include "rtcm_base_input.h"
 #include "rtklib.h"
 #include <array>
+#include <cstdint>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <string>
 
 /** \addtogroup PVT
@@ -69,6 +72,29 @@
  * \{ */
 
 
+/*!
+ * \brief Observations and navigation data of one epoch, converted to RTKLIB
+ * structures and ready to be solved by one or several Rtklib_Solver objects.
+ *
+ * The navigation data points to the ephemeris stored in the same object, so
+ * it cannot be copied. It is large: allocate it on the heap, once.
+ */
+struct Rtklib_Epoch
+{
+    Rtklib_Epoch();
+    Rtklib_Epoch(const Rtklib_Epoch&) = delete;
+    Rtklib_Epoch& operator=(const Rtklib_Epoch&) = delete;
+
+    std::array<obsd_t, MAXOBS> obs{};      //!< Rover observations
+    std::array<eph_t, MAXOBS> eph{};       //!< GPS, Galileo and BeiDou ephemeris of the observed satellites
+    std::array<geph_t, MAXOBS> geph{};     //!< GLONASS ephemeris of the observed satellites
+    nav_t nav{};                           //!< Ephemeris, ionospheric and UTC models and carrier wavelengths
+    double rx_time{0.0};                   //!< Receiver time of the observables [s]
+    uint32_t tow_at_current_symbol_ms{0};  //!< Time of week of the observables [ms]
+    int n_obs{0};                          //!< Number of valid observations
+};
+
+
 /*!
  * \brief This class implements a PVT solution based on RTKLIB
  */
@@ -80,12 +106,38 @@ public:
 
     bool get_PVT(const std::map<int, Gnss_Synchro>& gnss_observables_map, bool flag_averaging);
 
+    /*!
+     * \brief Converts the observables, and the ephemeris and models stored in
+     * this solver, to RTKLIB structures. Returns false if there are not
+     * enough observations to compute a solution.
+     */
+    bool prepare_epoch(const std::map<int, Gnss_Synchro>& gnss_observables_map, Rtklib_Epoch& epoch) const;
+
+    /*!
+     * \brief Computes the solution of an epoch prepared by this or by any
+     * other solver. Several solvers can work on the same epoch concurrently.
+     */
+    bool get_PVT(const Rtklib_Epoch& epoch, bool flag_averaging);
+
     double get_hdop() const override;
     double get_vdop() const override;
     double get_pdop() const override;
     double get_gdop() const override;
     Monitor_Pvt get_monitor_pvt() const;
 
+    /*!
+     * \brief Sets the source of base station observations for the relative
+     * positioning modes. Base epochs older than max_age_s with respect to the
+     * rover epoch are not used.
+     */
+    void set_base_input(std::shared_ptr<Rtcm_Base_Input> base_input, double max_age_s);
+
+    /*!
+     * \brief Enables or disables the short-arc cache of broadcast satellite
+     * orbits and clocks. Disabled by default.
+     */
+    void set_orbit_cache(bool enable);
+
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
 
@@ -115,13 +167,20 @@ public:
 
 private:
     bool save_matfile() const;
-
-    std::array<obsd_t, MAXOBS> obs_data{};
+    int add_base_observations(int n_rover_obs);
+
+    std::array<obsd_t, 2 * MAXOBS> obs_data{};  // rover observations, followed by the base ones in relative modes
+    std::shared_ptr<Rtcm_Base_Input> d_base_input;
+    std::unique_ptr<orbcache_t> d_orbcache;
+    std::unique_ptr<nav_t> d_nav;           // navigation data of the epoch being solved, with the orbit cache of this solver
+    std::unique_ptr<Rtklib_Epoch> d_epoch;  // only used by get_PVT(gnss_observables_map, ...)
+    Rtcm_Base_Epoch d_base_epoch{};
     std::array<double, 4> dop_{};
     rtk_t rtk_{};
     Monitor_Pvt monitor_pvt{};
     std::string d_dump_filename;
     std::ofstream d_dump_file;
+    double d_base_max_age_s{0.0};
     int d_nchannels;  // Number of available channels for positioning
     bool d_flag_dump_enabled;
     bool d_flag_dump_mat_enabled;
@@ -76,9 +76,14 @@ public:
 
     inline std::string createProtobuffer(const Monitor_Pvt* const monitor)  //!< Serialization into a string
     {
-        monitor_.Clear();
-
         std::string data;
+        createProtobuffer(monitor, data);
+        return data;
+    }
+
+    inline void createProtobuffer(const Monitor_Pvt* const monitor, std::string& data)  //!< Serialization into a reused string
+    {
+        monitor_.Clear();
 
         monitor_.set_tow_at_current_symbol_ms(monitor->TOW_at_current_symbol_ms);
         monitor_.set_week(monitor->week);
@@ -111,7 +116,6 @@ public:
         monitor_.set_user_clk_drift_ppm(monitor->user_clk_drift_ppm);
 
         monitor_.SerializeToString(&data);
-        return data;
     }
 
     inline Monitor_Pvt readProtobuffer(const gnss_sdr::MonitorPvt& mon) const  //!< Deserialization
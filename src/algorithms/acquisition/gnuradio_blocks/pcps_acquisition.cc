@@ -70,6 +70,7 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
                                                                 gr::io_signature::make(1, 1, conf_.it_size),
                                                                 gr::io_signature::make(0, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("Acquisition", this->name());
     this->message_port_register_out(pmt::mp("events"));
 
     d_acq_parameters = conf_;
@@ -201,11 +202,9 @@ void pcps_acquisition::set_resampler_latency(uint32_t latency_samples)
 
 void pcps_acquisition::set_local_code(std::complex<float>* code)
 {
-    // This will check if it's fdma, if yes will update the intermediate frequency and the doppler grid
-    if (is_fdma())
-        {
-            update_grid_doppler_wipeoffs();
-        }
+    // This will check if it's fdma, if yes will update the intermediate frequency.
+    // The doppler grid follows it at the start of the next acquisition
+    is_fdma();
     // COD
     // Here we want to create a buffer that looks like this:
     // [ 0 0 0 ... 0 c_0 c_1 ... c_L]
@@ -287,19 +286,15 @@ void pcps_acquisition::init()
 
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(static_cast<int32_t>(d_acq_parameters.doppler_max) - static_cast<int32_t>(-d_acq_parameters.doppler_max)) / static_cast<double>(d_doppler_step)));
 
-    // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs.empty())
-        {
-            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
-        }
+    // The carrier Doppler wipeoff signals are created at the start of the acquisition
     if (d_acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two.empty()))
         {
             d_grid_doppler_wipeoffs_step_two = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins_step2, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
         }
 
-    if (d_magnitude_grid.empty())
+    if (d_magnitude_grid.size() < d_num_doppler_bins)
         {
-            d_magnitude_grid = volk_gnsssdr::vector<volk_gnsssdr::vector<float>>(d_num_doppler_bins, volk_gnsssdr::vector<float>(d_fft_size));
+            d_magnitude_grid.resize(d_num_doppler_bins, volk_gnsssdr::vector<float>(d_fft_size));
         }
 
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
@@ -307,25 +302,42 @@ void pcps_acquisition::init()
             std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
         }
 
-    update_grid_doppler_wipeoffs();
     d_worker_active = false;
 
     if (d_dump)
         {
+            // zeros() keeps the memory if the size does not change
             const uint32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? (d_fft_size / 2) : d_fft_size);
-            d_grid = arma::fmat(effective_fft_size, d_num_doppler_bins, arma::fill::zeros);
-            d_narrow_grid = arma::fmat(effective_fft_size, d_num_doppler_bins_step2, arma::fill::zeros);
+            d_grid.zeros(effective_fft_size, d_num_doppler_bins);
+            d_narrow_grid.zeros(effective_fft_size, d_num_doppler_bins_step2);
         }
 }
 
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    // Each search range keeps its own grid, so switching between the full range and an
+    // assisted window only recomputes the carriers if the center, the step or the bias moved
+    Doppler_Grid& grid = d_doppler_grids[d_acq_parameters.doppler_max];
+    d_doppler_grid = &grid;
+    if (grid.wipeoffs.size() != d_num_doppler_bins)
+        {
+            grid.wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+            grid.valid = false;
+        }
+    if (grid.valid && grid.center == d_doppler_center && grid.bias == d_doppler_bias && grid.step == d_doppler_step)
+        {
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
             const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
-            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], static_cast<float>(d_doppler_bias + doppler));
+            update_local_carrier(grid.wipeoffs[doppler_index], static_cast<float>(d_doppler_bias + doppler));
         }
+    grid.center = d_doppler_center;
+    grid.bias = d_doppler_bias;
+    grid.step = d_doppler_step;
+    grid.valid = true;
 }
 
 
@@ -656,6 +668,9 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                << ", doppler_step: " << d_doppler_step
                << ", use_CFAR_algorithm_flag: " << (d_use_CFAR_algorithm_flag ? "true" : "false");
 
+    update_grid_doppler_wipeoffs();
+    const auto& grid_doppler_wipeoffs = d_doppler_grid->wipeoffs;
+
     if (d_acq_parameters.blocking)
         {
             lk.unlock();
@@ -667,7 +682,7 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
                 {
                     // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
 
                     // Perform the FFT-based convolution  (parallel time search)
                     // Compute the FFT of the carrier wiped--off incoming signal
@@ -923,6 +938,7 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
     gr_vector_const_void_star& input_items,
     gr_vector_void_star& output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     /*
      * By J.Arribas, L.Esteve and M.Molina
      * Acquisition strategy (Kay Borre book + CFAR threshold):
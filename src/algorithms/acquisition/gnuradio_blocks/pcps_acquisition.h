@@ -44,6 +44,7 @@
 
 #include "acq_conf.h"
 #include "channel_fsm.h"
+#include "gnss_sdr_block_stats.h"
 #include <armadillo>
 #include <glog/logging.h>
 #include <gnuradio/block.h>
@@ -55,6 +56,7 @@
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <complex>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <queue>
 #include <string>
@@ -151,6 +153,7 @@ public:
     inline void set_channel(uint32_t channel)
     {
         d_channel = channel;
+        d_stats->set_channel(static_cast<int32_t>(channel));
     }
 
     /*!
@@ -193,7 +196,8 @@ public:
     }
 
     /*!
-     * \brief Set Doppler center frequency for the grid search. It will refresh the Doppler grid.
+     * \brief Set Doppler center frequency for the grid search. The Doppler grid
+     * is refreshed at the start of the next acquisition.
      * \param doppler_center - Frequency center of the search grid [Hz].
      */
     inline void set_doppler_center(int32_t doppler_center)
@@ -203,7 +207,6 @@ public:
             {
                 DLOG(INFO) << " Doppler assistance for Channel: " << d_channel << " => Doppler: " << doppler_center << "[Hz]";
                 d_doppler_center = doppler_center;
-                update_grid_doppler_wipeoffs();
             }
     }
 
@@ -215,6 +218,16 @@ public:
         gr_vector_void_star& output_items);
 
 private:
+    // Carrier wipeoffs of a Doppler search range, and the grid they were computed for
+    struct Doppler_Grid
+    {
+        volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> wipeoffs;
+        int32_t center{0};
+        int32_t bias{0};
+        uint32_t step{0};
+        bool valid{false};
+    };
+
     friend pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
     explicit pcps_acquisition(const Acq_Conf& conf_);
 
@@ -234,7 +247,8 @@ private:
     volk_gnsssdr::vector<volk_gnsssdr::vector<float>> d_magnitude_grid;
     volk_gnsssdr::vector<float> d_tmp_buffer;
     volk_gnsssdr::vector<std::complex<float>> d_input_signal;
-    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
+    std::map<uint32_t, Doppler_Grid> d_doppler_grids;  // indexed by doppler_max
+    Doppler_Grid* d_doppler_grid{nullptr};             // grid of the current search range
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
     volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
@@ -288,6 +302,7 @@ private:
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
     bool d_dump;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -23,7 +23,9 @@
 #include "telemetry_decoder_interface.h"
 #include "tracking_interface.h"
 #include <glog/logging.h>
-#include <utility>  // for std::move
+#include <gnuradio/block.h>
+#include <algorithm>  // for std::find
+#include <utility>    // for std::move
 
 
 Channel::Channel(const ConfigurationInterface* configuration,
@@ -79,6 +81,17 @@ Channel::Channel(const ConfigurationInterface* configuration,
 
     acq_->set_doppler_step(doppler_step);
 
+    doppler_max_ = configuration->property("Acquisition_" + signal_str + std::to_string(channel_) + ".doppler_max", 0);
+    if (doppler_max_ == 0)
+        {
+            doppler_max_ = configuration->property("Acquisition_" + signal_str + ".doppler_max", 5000);
+        }
+    if (FLAGS_doppler_max != 0)
+        {
+            doppler_max_ = static_cast<uint32_t>(FLAGS_doppler_max);
+        }
+    acq_doppler_max_ = doppler_max_;
+
     float threshold = configuration->property("Acquisition_" + signal_str + std::to_string(channel_) + ".threshold", static_cast<float>(0.0));
     if (threshold == 0.0)
         {
@@ -230,10 +243,58 @@ void Channel::stop_channel()
 
 void Channel::assist_acquisition_doppler(double Carrier_Doppler_hz)
 {
+    set_acquisition_doppler_window(Carrier_Doppler_hz, 0);
+}
+
+
+void Channel::set_acquisition_doppler_window(double Carrier_Doppler_hz, uint32_t doppler_window_hz)
+{
+    // never exceed the configured range, the acquisition grid was allocated for it
+    uint32_t doppler_max = doppler_max_;
+    if (doppler_window_hz > 0 and doppler_window_hz < doppler_max_)
+        {
+            doppler_max = doppler_window_hz;
+        }
+    if (!flag_enable_fpga_ and doppler_max != acq_doppler_max_)
+        {
+            DLOG(INFO) << "Channel " << channel_ << " Doppler search range set to +/-" << doppler_max << " [Hz]";
+            acq_->set_doppler_max(doppler_max);
+            acq_->init();
+            acq_doppler_max_ = doppler_max;
+        }
     acq_->set_doppler_center(static_cast<int>(Carrier_Doppler_hz));
 }
 
 
+void Channel::set_processor_affinity(const std::vector<int>& mask)
+{
+    std::vector<gr::basic_block_sptr> channel_blocks{trk_->get_left_block(),
+        trk_->get_right_block(),
+        nav_->get_left_block(),
+        nav_->get_right_block(),
+        channel_msg_rx_};
+    if (!flag_enable_fpga_)
+        {
+            channel_blocks.push_back(acq_->get_left_block());
+            channel_blocks.push_back(acq_->get_right_block());
+        }
+
+    std::vector<gr::block*> pinned_blocks;
+    for (const auto& basic_block : channel_blocks)
+        {
+            // Hierarchical blocks and null pointers are skipped, only gr::block instances own a thread
+            auto* blk = dynamic_cast<gr::block*>(basic_block.get());
+            if (blk == nullptr or std::find(pinned_blocks.begin(), pinned_blocks.end(), blk) != pinned_blocks.end())
+                {
+                    continue;
+                }
+            blk->set_processor_affinity(mask);
+            pinned_blocks.push_back(blk);
+        }
+    DLOG(INFO) << "Channel " << channel_ << ": " << pinned_blocks.size() << " blocks pinned to core " << (mask.empty() ? -1 : mask.front());
+}
+
+
 void Channel::start_acquisition()
 {
     std::lock_guard<std::mutex> lk(mx_);
@@ -34,6 +34,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 /** \addtogroup Channel
  * Classes containing a GNSS channel.
@@ -91,6 +92,19 @@ public:
 
     void assist_acquisition_doppler(double Carrier_Doppler_hz) override;
 
+    /*!
+     * \brief Centers the acquisition Doppler search at Carrier_Doppler_hz and
+     * narrows it to +/- doppler_window_hz. A zero window, or a window larger
+     * than the configured doppler_max, restores the configured search range.
+     */
+    void set_acquisition_doppler_window(double Carrier_Doppler_hz, uint32_t doppler_window_hz);
+
+    /*!
+     * \brief Pins the acquisition, tracking, telemetry decoder and message
+     * receiver blocks of this channel to the given set of CPU cores.
+     */
+    void set_processor_affinity(const std::vector<int>& mask);
+
     inline std::shared_ptr<AcquisitionInterface> acquisition() const { return acq_; }
     inline std::shared_ptr<TrackingInterface> tracking() const { return trk_; }
     inline std::shared_ptr<TelemetryDecoderInterface> telemetry() const { return nav_; }
@@ -106,6 +120,8 @@ private:
     std::string role_;
     std::mutex mx_;
     uint32_t channel_;
+    uint32_t doppler_max_;
+    uint32_t acq_doppler_max_;
     bool connected_;
     bool repeat_;
     bool flag_enable_fpga_;
@@ -28,6 +28,7 @@ ChannelFsm::ChannelFsm()
     channel_ = 0U;
     state_ = 0U;
     queue_ = nullptr;
+    make_events();
 }
 
 
@@ -37,6 +38,7 @@ ChannelFsm::ChannelFsm(std::shared_ptr<AcquisitionInterface> acquisition) : acq_
     channel_ = 0U;
     state_ = 0U;
     queue_ = nullptr;
+    make_events();
 }
 
 
@@ -178,6 +180,18 @@ void ChannelFsm::set_channel(uint32_t channel)
 {
     std::lock_guard<std::mutex> lk(mx_);
     channel_ = channel;
+    make_events();
+}
+
+
+void ChannelFsm::make_events()
+{
+    // The events are immutable, so the same message is pushed every time
+    // instead of allocating a new one at each transition
+    for (uint32_t i = 0; i < events_.size(); i++)
+        {
+            events_[i] = pmt::make_any(channel_event_make(static_cast<int>(channel_), static_cast<int>(i)));
+        }
 }
 
 
@@ -203,17 +217,17 @@ void ChannelFsm::start_acquisition()
 void ChannelFsm::start_tracking()
 {
     trk_->start_tracking();
-    queue_->push(pmt::make_any(channel_event_make(channel_, 1)));
+    queue_->push(events_[1]);
 }
 
 
 void ChannelFsm::request_satellite()
 {
-    queue_->push(pmt::make_any(channel_event_make(channel_, 0)));
+    queue_->push(events_[0]);
 }
 
 
 void ChannelFsm::notify_stop_tracking()
 {
-    queue_->push(pmt::make_any(channel_event_make(channel_, 2)));
+    queue_->push(events_[2]);
 }
@@ -24,6 +24,7 @@
 #include "telemetry_decoder_interface.h"
 #include "tracking_interface.h"
 #include <pmt/pmt.h>
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -67,11 +68,16 @@ private:
     void stop_tracking();
     void request_satellite();
     void notify_stop_tracking();
+    void make_events();
 
     std::shared_ptr<AcquisitionInterface> acq_;
     std::shared_ptr<TrackingInterface> trk_;
     std::shared_ptr<TelemetryDecoderInterface> nav_;
 
+    // Channel events sent to the control queue: 0 acquisition failed,
+    // 1 acquisition successful, 2 tracking lost
+    std::array<pmt::pmt_t, 3> events_;
+
     std::mutex mx_;
 
     Concurrent_Queue<pmt::pmt_t>* queue_;
@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 /** \addtogroup Signal_Conditioner
  * \{ */
@@ -68,6 +69,7 @@ private:
     std::shared_ptr<GNSSBlockInterface> data_type_adapt_;
     std::shared_ptr<GNSSBlockInterface> in_filt_;
     std::shared_ptr<GNSSBlockInterface> res_;
+    std::vector<std::shared_ptr<GNSSBlockInterface>> stages_;  // stages with blocks, in order
     std::string role_;
     bool connected_;
 };
@@ -30,6 +30,14 @@ SignalConditioner::SignalConditioner(std::shared_ptr<GNSSBlockInterface> data_ty
                         role_(std::move(role))
 {
     connected_ = false;
+    // Stages without blocks (e.g. Pass_Through) are skipped when connecting
+    for (const auto& stage : {data_type_adapt_, in_filt_, res_})
+        {
+            if (stage->get_left_block() != nullptr)
+                {
+                    stages_.push_back(stage);
+                }
+        }
 }
 
 
@@ -44,11 +52,11 @@ void SignalConditioner::connect(gr::top_block_sptr top_block)
     in_filt_->connect(top_block);
     res_->connect(top_block);
 
-    top_block->connect(data_type_adapt_->get_right_block(), 0, in_filt_->get_left_block(), 0);
-    DLOG(INFO) << "data_type_adapter -> input_filter";
-
-    top_block->connect(in_filt_->get_right_block(), 0, res_->get_left_block(), 0);
-    DLOG(INFO) << "input_filter -> resampler";
+    for (size_t i = 1; i < stages_.size(); i++)
+        {
+            top_block->connect(stages_[i - 1]->get_right_block(), 0, stages_[i]->get_left_block(), 0);
+            DLOG(INFO) << stages_[i - 1]->role() << " -> " << stages_[i]->role();
+        }
     connected_ = true;
 }
 
@@ -61,10 +69,10 @@ void SignalConditioner::disconnect(gr::top_block_sptr top_block)
             return;
         }
 
-    top_block->disconnect(data_type_adapt_->get_right_block(), 0,
-        in_filt_->get_left_block(), 0);
-    top_block->disconnect(in_filt_->get_right_block(), 0,
-        res_->get_left_block(), 0);
+    for (size_t i = 1; i < stages_.size(); i++)
+        {
+            top_block->disconnect(stages_[i - 1]->get_right_block(), 0, stages_[i]->get_left_block(), 0);
+        }
 
     data_type_adapt_->disconnect(top_block);
     in_filt_->disconnect(top_block);
@@ -76,11 +84,19 @@ void SignalConditioner::disconnect(gr::top_block_sptr top_block)
 
 gr::basic_block_sptr SignalConditioner::get_left_block()
 {
-    return data_type_adapt_->get_left_block();
+    if (stages_.empty())
+        {
+            return nullptr;
+        }
+    return stages_.front()->get_left_block();
 }
 
 
 gr::basic_block_sptr SignalConditioner::get_right_block()
 {
-    return res_->get_right_block();
+    if (stages_.empty())
+        {
+            return nullptr;
+        }
+    return stages_.back()->get_right_block();
 }
@@ -18,6 +18,7 @@
 #include "notch_filter.h"
 #include "configuration_interface.h"
 #include "notch_cc.h"
+#include "notch_sc.h"
 #include <boost/lexical_cast.hpp>
 #include <glog/logging.h>
 
@@ -41,10 +42,18 @@ NotchFilter::NotchFilter(const ConfigurationInterface* configuration, const std:
     const int length_ = configuration->property(role + ".length", default_length_);
     const int n_segments_est = configuration->property(role + ".segments_est", default_n_segments_est);
     const int n_segments_reset = configuration->property(role + ".segments_reset", default_n_segments_reset);
+    const float pfa_blanking = configuration->property(role + ".pfa_blanking", 0.0F);
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            notch_filter_ = make_notch_filter(pfa, p_c_factor, length_, n_segments_est, n_segments_reset);
+            notch_filter_ = make_notch_filter(pfa, p_c_factor, length_, n_segments_est, n_segments_reset, pfa_blanking);
+            DLOG(INFO) << "Item size " << item_size_;
+            DLOG(INFO) << "input filter(" << notch_filter_->unique_id() << ")";
+        }
+    else if (item_type_ == "cshort")
+        {
+            item_size_ = sizeof(lv_16sc_t);
+            notch_filter_ = make_notch_filter_sc(pfa, p_c_factor, length_, n_segments_est, n_segments_reset, pfa_blanking);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "input filter(" << notch_filter_->unique_id() << ")";
         }
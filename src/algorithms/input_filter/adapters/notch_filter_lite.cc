@@ -18,6 +18,7 @@
 #include "notch_filter_lite.h"
 #include "configuration_interface.h"
 #include "notch_lite_cc.h"
+#include "notch_lite_sc.h"
 #include <boost/lexical_cast.hpp>
 #include <glog/logging.h>
 #include <algorithm>  // for max
@@ -46,12 +47,20 @@ NotchFilterLite::NotchFilterLite(const ConfigurationInterface* configuration, co
     const int length_ = configuration->property(role + ".length", default_length_);
     const int n_segments_est = configuration->property(role + ".segments_est", default_n_segments_est);
     const int n_segments_reset = configuration->property(role + ".segments_reset", default_n_segments_reset);
+    const float pfa_blanking = configuration->property(role + ".pfa_blanking", 0.0F);
     int n_segments_coeff = static_cast<int>((samp_freq / coeff_rate) / static_cast<float>(length_));
     n_segments_coeff = std::max(1, n_segments_coeff);
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            notch_filter_lite_ = make_notch_filter_lite(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff);
+            notch_filter_lite_ = make_notch_filter_lite(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff, pfa_blanking);
+            DLOG(INFO) << "Item size " << item_size_;
+            DLOG(INFO) << "input filter(" << notch_filter_lite_->unique_id() << ")";
+        }
+    else if (item_type_ == "cshort")
+        {
+            item_size_ = sizeof(lv_16sc_t);
+            notch_filter_lite_ = make_notch_filter_lite_sc(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff, pfa_blanking);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "input filter(" << notch_filter_lite_->unique_id() << ")";
         }
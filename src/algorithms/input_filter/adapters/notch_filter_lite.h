@@ -19,7 +19,7 @@
 #define GNSS_SDR_NOTCH_FILTER_LITE_H
 
 #include "gnss_block_interface.h"
-#include "notch_lite_cc.h"
+#include <gnuradio/block.h>
 #include <gnuradio/blocks/file_sink.h>
 #include <string>
 #include <vector>
@@ -63,7 +63,7 @@ public:
     gr::basic_block_sptr get_right_block();
 
 private:
-    notch_lite_sptr notch_filter_lite_;
+    gr::block_sptr notch_filter_lite_;
     gr::blocks::file_sink::sptr file_sink_;
     std::string dump_filename_;
     std::string role_;
@@ -55,6 +55,12 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
             input_size_ = sizeof(gr_complex);  // input
             pulse_blanking_cc_ = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset);
         }
+    else if (input_item_type_ == "cshort")
+        {
+            item_size = sizeof(lv_16sc_t);    // output
+            input_size_ = sizeof(lv_16sc_t);  // input
+            pulse_blanking_sc_ = make_pulse_blanking_sc(pfa, length_, n_segments_est, n_segments_reset);
+        }
     else
         {
             LOG(ERROR) << " Unknown input filter input/output item type conversion";
@@ -64,7 +70,11 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
     const double default_if = 0.0;
     const double if_aux = configuration->property(role_ + ".if", default_if);
     const double if_ = configuration->property(role_ + ".IF", if_aux);
-    if (std::abs(if_) > 1.0)
+    if (std::abs(if_) > 1.0 && input_item_type_ == "cshort")
+        {
+            LOG(WARNING) << "The frequency translation of the pulse blanking filter is only available for gr_complex samples";
+        }
+    else if (std::abs(if_) > 1.0)
         {
             xlat_ = true;
             const double default_sampling_freq = 4000000.0;
@@ -106,7 +116,13 @@ void PulseBlankingFilter::connect(gr::top_block_sptr top_block)
                     top_block->connect(freq_xlating_, 0, pulse_blanking_cc_, 0);
                 }
         }
-
+    else if (input_item_type_ == "cshort")
+        {
+            if (dump_)
+                {
+                    top_block->connect(pulse_blanking_sc_, 0, file_sink_, 0);
+                }
+        }
     else
         {
             LOG(ERROR) << " Unknown input filter input/output item type conversion";
@@ -127,6 +143,13 @@ void PulseBlankingFilter::disconnect(gr::top_block_sptr top_block)
                     top_block->disconnect(freq_xlating_, 0, pulse_blanking_cc_, 0);
                 }
         }
+    else if (input_item_type_ == "cshort")
+        {
+            if (dump_)
+                {
+                    top_block->disconnect(pulse_blanking_sc_, 0, file_sink_, 0);
+                }
+        }
     else
         {
             LOG(ERROR) << " Unknown input filter input/output item type conversion";
@@ -144,6 +167,10 @@ gr::basic_block_sptr PulseBlankingFilter::get_left_block()
                 }
             return pulse_blanking_cc_;
         }
+    if (input_item_type_ == "cshort")
+        {
+            return pulse_blanking_sc_;
+        }
     LOG(ERROR) << " Unknown input filter input/output item type conversion";
     return nullptr;
 }
@@ -155,6 +182,10 @@ gr::basic_block_sptr PulseBlankingFilter::get_right_block()
         {
             return pulse_blanking_cc_;
         }
+    if (input_item_type_ == "cshort")
+        {
+            return pulse_blanking_sc_;
+        }
     LOG(ERROR) << " Unknown input filter input/output item type conversion";
     return nullptr;
 }
@@ -20,6 +20,7 @@
 
 #include "gnss_block_interface.h"
 #include "pulse_blanking_cc.h"
+#include "pulse_blanking_sc.h"
 #include <gnuradio/blocks/file_sink.h>
 #ifdef GR_GREATER_38
 #include <gnuradio/filter/freq_xlating_fir_filter.h>
@@ -68,6 +69,7 @@ public:
 
 private:
     pulse_blanking_cc_sptr pulse_blanking_cc_;
+    pulse_blanking_sc_sptr pulse_blanking_sc_;
     gr::filter::freq_xlating_fir_filter_ccf::sptr freq_xlating_;
     gr::blocks::file_sink::sptr file_sink_;
     std::string dump_filename_;
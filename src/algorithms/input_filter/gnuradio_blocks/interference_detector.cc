@@ -0,0 +1,86 @@
+/*!
+ * \file interference_detector.cc
+ * \brief Segment energy detector shared by the interference mitigation filters
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#include "interference_detector.h"
+#include <boost/math/distributions/chi_squared.hpp>
+#include <volk/volk.h>
+#include <limits>
+
+
+Interference_Detector::Interference_Detector(float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset,
+    float pfa_blanking) : noise_power_estimation_(0.0),
+                          length_(length),
+                          n_deg_fred_(2 * length),
+                          n_segments_(0),
+                          n_segments_est_(n_segments_est),
+                          n_segments_reset_(n_segments_reset),
+                          detected_(false),
+                          blank_(false)
+{
+    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
+    thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
+    thres_blanking_ = std::numeric_limits<float>::max();
+    if (pfa_blanking > 0.0)
+        {
+            thres_blanking_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_blanking));
+        }
+}
+
+
+float Interference_Detector::energy(const gr_complex* in) const
+{
+    lv_32fc_t dot_prod;
+    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod, in, in, length_);
+    return lv_creal(dot_prod);
+}
+
+
+float Interference_Detector::energy(const lv_16sc_t* in) const
+{
+    // The squared modulus of a 16-bit sample fits in 31 bits, so it is
+    // accumulated without overflow and without converting the samples to float
+    uint64_t acc = 0;
+    for (int32_t i = 0; i < length_; i++)
+        {
+            const int32_t re = lv_creal(in[i]);
+            const int32_t im = lv_cimag(in[i]);
+            acc += static_cast<uint32_t>(re * re) + static_cast<uint32_t>(im * im);
+        }
+    return static_cast<float>(acc);
+}
+
+
+void Interference_Detector::update_noise_estimation(float noise_power)
+{
+    noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + noise_power) / static_cast<float>(n_segments_ + 1);
+}
+
+
+bool Interference_Detector::detect(float energy)
+{
+    const float statistic = energy / noise_power_estimation_;
+    blank_ = statistic > thres_blanking_;
+    detected_ = statistic > thres_;
+    if (!detected_ && (n_segments_ > n_segments_reset_))
+        {
+            n_segments_ = 0;
+        }
+    return detected_;
+}
@@ -0,0 +1,133 @@
+/*!
+ * \file interference_detector.h
+ * \brief Segment energy detector shared by the interference mitigation filters
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#ifndef GNSS_SDR_INTERFERENCE_DETECTOR_H
+#define GNSS_SDR_INTERFERENCE_DETECTOR_H
+
+#include <gnuradio/gr_complex.h>
+#include <volk/volk_complex.h>  // for lv_16sc_t
+#include <cstdint>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Energy detector of the pulse blanking and notch filters.
+ *
+ * The input stream is processed in segments of length samples. During the
+ * first n_segments_est interference-free segments (and again after
+ * n_segments_reset segments), the filter feeds its noise power estimation.
+ * Then, the energy of each segment, normalized by the noise power, is
+ * compared against the threshold of a chi-squared distribution with
+ * 2 * length degrees of freedom for the requested probability of false alarm.
+ * If a blanking pfa is set, a second, higher threshold tells pulses that
+ * must be blanked from the interferences that the notch can remove, with the
+ * same energy statistic.
+ */
+class Interference_Detector
+{
+public:
+    Interference_Detector(float pfa,
+        int32_t length,
+        int32_t n_segments_est,
+        int32_t n_segments_reset,
+        float pfa_blanking = 0.0);
+
+    /*!
+     * \brief Energy of a segment of length samples
+     */
+    float energy(const gr_complex* in) const;
+
+    /*!
+     * \brief Energy of a segment of length samples, accumulated with integers
+     */
+    float energy(const lv_16sc_t* in) const;
+
+    /*!
+     * \brief True if the current segment must feed the noise power estimation
+     */
+    inline bool estimating() const
+    {
+        return (n_segments_ < n_segments_est_) && !detected_;
+    }
+
+    /*!
+     * \brief Adds the noise power per degree of freedom of the current segment
+     */
+    void update_noise_estimation(float noise_power);
+
+    /*!
+     * \brief Decides whether the current segment contains interference, and
+     * updates the state of the detector
+     */
+    bool detect(float energy);
+
+    /*!
+     * \brief True if the last segment passed to detect() exceeded the
+     * blanking threshold. Always false if the blanking pfa is not set.
+     */
+    inline bool blank() const
+    {
+        return blank_;
+    }
+
+    /*!
+     * \brief True if interference was detected in the last segment
+     */
+    inline bool detected() const
+    {
+        return detected_;
+    }
+
+    /*!
+     * \brief Moves to the next segment
+     */
+    inline void next_segment()
+    {
+        n_segments_++;
+    }
+
+    inline int32_t length() const
+    {
+        return length_;
+    }
+
+    inline int32_t degrees_of_freedom() const
+    {
+        return n_deg_fred_;
+    }
+
+private:
+    float noise_power_estimation_;
+    float thres_;
+    float thres_blanking_;
+    int32_t length_;
+    int32_t n_deg_fred_;
+    int32_t n_segments_;
+    int32_t n_segments_est_;
+    int32_t n_segments_reset_;
+    bool detected_;
+    bool blank_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_INTERFERENCE_DETECTOR_H
@@ -16,7 +16,6 @@
 
 #include "notch_cc.h"
 #include "gnss_sdr_make_unique.h"
-#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 #include <algorithm>
@@ -25,9 +24,10 @@
 
 
 notch_sptr make_notch_filter(float pfa, float p_c_factor,
-    int32_t length, int32_t n_segments_est, int32_t n_segments_reset)
+    int32_t length, int32_t n_segments_est, int32_t n_segments_reset,
+    float pfa_blanking)
 {
-    return notch_sptr(new Notch(pfa, p_c_factor, length, n_segments_est, n_segments_reset));
+    return notch_sptr(new Notch(pfa, p_c_factor, length, n_segments_est, n_segments_reset, pfa_blanking));
 }
 
 
@@ -35,24 +35,17 @@ Notch::Notch(float pfa,
     float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset) : gr::block("Notch",
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)))
+    int32_t n_segments_reset,
+    float pfa_blanking) : gr::block("Notch",
+                              gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                              gr::io_signature::make(1, 1, sizeof(gr_complex))),
+                          detector_(pfa, length, n_segments_est, n_segments_reset, pfa_blanking)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
     set_alignment(std::max(1, alignment_multiple));
-    pfa_ = pfa;
-    noise_pow_est_ = 0.0;
     p_c_factor_ = gr_complex(p_c_factor, 0.0);
-    length_ = length;           // Set the number of samples per segment
-    filter_state_ = false;      // Initial state of the filter
-    n_deg_fred_ = 2 * length_;  // Number of dregrees of freedom
-    n_segments_ = 0;
-    n_segments_est_ = n_segments_est;      // Set the number of segments for noise power estimation
-    n_segments_reset_ = n_segments_reset;  // Set the period (in segments) when the noise power is estimated
+    length_ = length;  // Set the number of samples per segment
     z_0_ = gr_complex(0.0, 0.0);
-    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
-    thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
     c_samples_ = volk_gnsssdr::vector<gr_complex>(length_);
     angle_ = volk_gnsssdr::vector<float>(length_);
     power_spect_ = volk_gnsssdr::vector<float>(length_);
@@ -71,53 +64,54 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
     int32_t index_out = 0;
     float sig2dB = 0.0;
     float sig2lin = 0.0;
-    lv_32fc_t dot_prod_;
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
     in++;
     while ((index_out + length_) < noutput_items)
         {
-            if ((n_segments_ < n_segments_est_) && (filter_state_ == false))
+            if (detector_.estimating())
                 {
                     memcpy(d_fft_->get_inbuf(), in, sizeof(gr_complex) * length_);
                     d_fft_->execute();
                     volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), d_fft_->get_outbuf(), 1.0, length_);
                     volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
-                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(n_deg_fred_));
-                    noise_pow_est_ = (static_cast<float>(n_segments_) * noise_pow_est_ + sig2lin) / (static_cast<float>(n_segments_ + 1));
+                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(detector_.degrees_of_freedom()));
+                    detector_.update_noise_estimation(sig2lin);
                     memcpy(out, in, sizeof(gr_complex) * length_);
                 }
             else
                 {
-                    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod_, in, in, length_);
-                    if ((lv_creal(dot_prod_) / noise_pow_est_) > thres_)
+                    const bool filter_state = detector_.detected();
+                    if (detector_.detect(detector_.energy(in)))
                         {
-                            if (filter_state_ == false)
+                            if (filter_state == false)
                                 {
-                                    filter_state_ = true;
                                     last_out_ = gr_complex(0.0, 0.0);
                                 }
-                            volk_32fc_x2_multiply_conjugate_32fc(c_samples_.data(), in, (in - 1), length_);
-                            volk_32fc_s32f_atan2_32f(angle_.data(), c_samples_.data(), static_cast<float>(1.0), length_);
-                            for (int32_t aux = 0; aux < length_; aux++)
+                            if (detector_.blank())
                                 {
-                                    z_0_ = std::exp(gr_complex(0.0, 1.0) * (*(angle_.data() + aux)));
-                                    *(out + aux) = *(in + aux) - z_0_ * (*(in + aux - 1)) + p_c_factor_ * z_0_ * last_out_;
-                                    last_out_ = *(out + aux);
+                                    std::fill_n(out, length_, gr_complex(0.0, 0.0));
+                                    last_out_ = gr_complex(0.0, 0.0);
+                                }
+                            else
+                                {
+                                    volk_32fc_x2_multiply_conjugate_32fc(c_samples_.data(), in, (in - 1), length_);
+                                    volk_32fc_s32f_atan2_32f(angle_.data(), c_samples_.data(), static_cast<float>(1.0), length_);
+                                    for (int32_t aux = 0; aux < length_; aux++)
+                                        {
+                                            z_0_ = std::exp(gr_complex(0.0, 1.0) * (*(angle_.data() + aux)));
+                                            *(out + aux) = *(in + aux) - z_0_ * (*(in + aux - 1)) + p_c_factor_ * z_0_ * last_out_;
+                                            last_out_ = *(out + aux);
+                                        }
                                 }
                         }
                     else
                         {
-                            if (n_segments_ > n_segments_reset_)
-                                {
-                                    n_segments_ = 0;
-                                }
-                            filter_state_ = false;
                             memcpy(out, in, sizeof(gr_complex) * length_);
                         }
                 }
             index_out += length_;
-            n_segments_++;
+            detector_.next_segment();
             in += length_;
             out += length_;
         }
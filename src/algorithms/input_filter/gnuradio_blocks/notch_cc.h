@@ -19,6 +19,7 @@
 #define GNSS_SDR_NOTCH_CC_H
 
 #include "gnss_block_interface.h"
+#include "interference_detector.h"
 #include <gnuradio/block.h>
 #include <gnuradio/fft/fft.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
@@ -40,10 +41,14 @@ notch_sptr make_notch_filter(
     float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset);
+    int32_t n_segments_reset,
+    float pfa_blanking);
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter
+ *
+ * If pfa_blanking is greater than zero, the segments whose energy exceeds
+ * the corresponding threshold are blanked instead of filtered.
  */
 class Notch : public gr::block
 {
@@ -55,28 +60,21 @@ public:
         gr_vector_void_star &output_items);
 
 private:
-    friend notch_sptr make_notch_filter(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    friend notch_sptr make_notch_filter(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, float pfa_blanking);
+    Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, float pfa_blanking);
 #if GNURADIO_FFT_USES_TEMPLATES
     std::unique_ptr<gr::fft::fft_complex_fwd> d_fft_;
 #else
     std::unique_ptr<gr::fft::fft_complex> d_fft_;
 #endif
+    Interference_Detector detector_;
     volk_gnsssdr::vector<gr_complex> c_samples_;
     volk_gnsssdr::vector<float> angle_;
     volk_gnsssdr::vector<float> power_spect_;
     gr_complex last_out_;
     gr_complex z_0_;
     gr_complex p_c_factor_;
-    float pfa_;
-    float noise_pow_est_;
-    float thres_;
     int32_t length_;
-    int32_t n_deg_fred_;
-    uint32_t n_segments_;
-    uint32_t n_segments_est_;
-    uint32_t n_segments_reset_;
-    bool filter_state_;
 };
 
 
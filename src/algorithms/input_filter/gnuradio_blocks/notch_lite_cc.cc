@@ -17,7 +17,6 @@
 
 #include "notch_lite_cc.h"
 #include "gnss_sdr_make_unique.h"
-#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 #include <algorithm>
@@ -25,9 +24,9 @@
 #include <cstring>
 
 
-notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff)
+notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, float pfa_blanking)
 {
-    return notch_lite_sptr(new NotchLite(p_c_factor, pfa, length, n_segments_est, n_segments_reset, n_segments_coeff));
+    return notch_lite_sptr(new NotchLite(p_c_factor, pfa, length, n_segments_est, n_segments_reset, n_segments_coeff, pfa_blanking));
 }
 
 
@@ -36,28 +35,21 @@ NotchLite::NotchLite(float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
     int32_t n_segments_reset,
-    int32_t n_segments_coeff) : gr::block("NotchLite",
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)))
+    int32_t n_segments_coeff,
+    float pfa_blanking) : gr::block("NotchLite",
+                              gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                              gr::io_signature::make(1, 1, sizeof(gr_complex))),
+                          detector_(pfa, length, n_segments_est, n_segments_reset, pfa_blanking)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
     set_alignment(std::max(1, alignment_multiple));
     set_history(2);
     p_c_factor_ = gr_complex(p_c_factor, 0.0);
-    n_segments_est_ = n_segments_est;
-    n_segments_reset_ = n_segments_reset;
     n_segments_coeff_reset_ = n_segments_coeff;
     n_segments_coeff_ = 0;
     length_ = length;
-    pfa_ = pfa;
-    n_segments_ = 0;
-    n_deg_fred_ = 2 * length_;
-    noise_pow_est_ = 0.0;
-    filter_state_ = false;
     z_0_ = gr_complex(0.0, 0.0);
     last_out_ = gr_complex(0.0, 0.0);
-    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
-    thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
     c_samples1_ = gr_complex(0.0, 0.0);
     c_samples2_ = gr_complex(0.0, 0.0);
     angle1_ = 0.0;
@@ -77,30 +69,34 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
     int32_t index_out = 0;
     float sig2dB = 0.0;
     float sig2lin = 0.0;
-    lv_32fc_t dot_prod_;
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
     in++;
     while ((index_out + length_) < noutput_items)
         {
-            if ((n_segments_ < n_segments_est_) && (filter_state_ == false))
+            if (detector_.estimating())
                 {
                     memcpy(d_fft_->get_inbuf(), in, sizeof(gr_complex) * length_);
                     d_fft_->execute();
                     volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), d_fft_->get_outbuf(), 1.0, length_);
                     volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
-                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / static_cast<float>(n_deg_fred_);
-                    noise_pow_est_ = (static_cast<float>(n_segments_) * noise_pow_est_ + sig2lin) / static_cast<float>(n_segments_ + 1);
+                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / static_cast<float>(detector_.degrees_of_freedom());
+                    detector_.update_noise_estimation(sig2lin);
                     memcpy(out, in, sizeof(gr_complex) * length_);
                 }
             else
                 {
-                    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod_, in, in, length_);
-                    if ((lv_creal(dot_prod_) / noise_pow_est_) > thres_)
+                    const bool filter_state = detector_.detected();
+                    if (detector_.detect(detector_.energy(in)) && detector_.blank())
                         {
-                            if (filter_state_ == false)
+                            std::fill_n(out, length_, gr_complex(0.0, 0.0));
+                            last_out_ = gr_complex(0, 0);
+                            n_segments_coeff_ = 0;
+                        }
+                    else if (detector_.detected())
+                        {
+                            if (filter_state == false)
                                 {
-                                    filter_state_ = true;
                                     last_out_ = gr_complex(0, 0);
                                     n_segments_coeff_ = 0;
                                 }
@@ -123,16 +119,11 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
                         }
                     else
                         {
-                            if (n_segments_ > n_segments_reset_)
-                                {
-                                    n_segments_ = 0;
-                                }
-                            filter_state_ = false;
                             memcpy(out, in, sizeof(gr_complex) * length_);
                         }
                 }
             index_out += length_;
-            n_segments_++;
+            detector_.next_segment();
             in += length_;
             out += length_;
         }
@@ -19,6 +19,7 @@
 #define GNSS_SDR_NOTCH_LITE_CC_H
 
 #include "gnss_block_interface.h"
+#include "interference_detector.h"
 #include <gnuradio/block.h>
 #include <gnuradio/fft/fft.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
@@ -41,10 +42,14 @@ notch_lite_sptr make_notch_filter_lite(
     int32_t length,
     int32_t n_segments_est,
     int32_t n_segments_reset,
-    int32_t n_segments_coeff);
+    int32_t n_segments_coeff,
+    float pfa_blanking);
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter light version
+ *
+ * If pfa_blanking is greater than zero, the segments whose energy exceeds
+ * the corresponding threshold are blanked instead of filtered.
  */
 class NotchLite : public gr::block
 {
@@ -56,32 +61,25 @@ public:
         gr_vector_void_star &output_items);
 
 private:
-    friend notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
-    NotchLite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
+    friend notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, float pfa_blanking);
+    NotchLite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, float pfa_blanking);
 #if GNURADIO_FFT_USES_TEMPLATES
     std::unique_ptr<gr::fft::fft_complex_fwd> d_fft_;
 #else
     std::unique_ptr<gr::fft::fft_complex> d_fft_;
 #endif
+    Interference_Detector detector_;
     volk_gnsssdr::vector<float> power_spect_;
     gr_complex last_out_;
     gr_complex z_0_;
     gr_complex p_c_factor_;
     gr_complex c_samples1_;
     gr_complex c_samples2_;
-    float pfa_;
-    float thres_;
-    float noise_pow_est_;
     float angle1_;
     float angle2_;
     int32_t length_;
-    int32_t n_segments_;
-    int32_t n_segments_est_;
-    int32_t n_segments_reset_;
     int32_t n_segments_coeff_reset_;
     int32_t n_segments_coeff_;
-    int32_t n_deg_fred_;
-    bool filter_state_;
 };
 
 
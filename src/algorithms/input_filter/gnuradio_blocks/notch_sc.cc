@@ -0,0 +1,130 @@
+/*!
+ * \file notch_sc.cc
+ * \brief Implements a multi state notch filter algorithm for complex 16-bit
+ * integer samples
+ * \author Antonio Ramos (antonio.ramosdet(at)gmail.com)
+ * \author agent, 2026. agent(at)local (16-bit integer samples version)
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "notch_sc.h"
+#include "gnss_sdr_make_unique.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+notch_sc_sptr make_notch_filter_sc(float pfa, float p_c_factor,
+    int32_t length, int32_t n_segments_est, int32_t n_segments_reset,
+    float pfa_blanking)
+{
+    return notch_sc_sptr(new NotchSc(pfa, p_c_factor, length, n_segments_est, n_segments_reset, pfa_blanking));
+}
+
+
+NotchSc::NotchSc(float pfa,
+    float p_c_factor,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset,
+    float pfa_blanking) : gr::block("NotchSc",
+                              gr::io_signature::make(1, 1, sizeof(lv_16sc_t)),
+                              gr::io_signature::make(1, 1, sizeof(lv_16sc_t))),
+                          detector_(pfa, length, n_segments_est, n_segments_reset, pfa_blanking)
+{
+    const int32_t alignment_multiple = volk_get_alignment() / sizeof(lv_16sc_t);
+    set_alignment(std::max(1, alignment_multiple));
+    set_history(2);
+    p_c_factor_ = gr_complex(p_c_factor, 0.0);
+    length_ = length;  // Set the number of samples per segment
+    z_0_ = gr_complex(0.0, 0.0);
+    in_ = volk_gnsssdr::vector<gr_complex>(length_ + 1);
+    out_ = volk_gnsssdr::vector<gr_complex>(length_);
+    c_samples_ = volk_gnsssdr::vector<gr_complex>(length_);
+    angle_ = volk_gnsssdr::vector<float>(length_);
+    power_spect_ = volk_gnsssdr::vector<float>(length_);
+    last_out_ = gr_complex(0.0, 0.0);
+#if GNURADIO_FFT_USES_TEMPLATES
+    d_fft_ = std::make_unique<gr::fft::fft_complex_fwd>(length_);
+#else
+    d_fft_ = std::make_unique<gr::fft::fft_complex>(length_, true);
+#endif
+}
+
+
+int NotchSc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    int32_t index_out = 0;
+    float sig2dB = 0.0;
+    float sig2lin = 0.0;
+    const auto *in = reinterpret_cast<const lv_16sc_t *>(input_items[0]);
+    auto *out = reinterpret_cast<lv_16sc_t *>(output_items[0]);
+    in++;
+    while ((index_out + length_) < noutput_items)
+        {
+            if (detector_.estimating())
+                {
+                    volk_gnsssdr_16ic_convert_32fc(d_fft_->get_inbuf(), in, length_);
+                    d_fft_->execute();
+                    volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), d_fft_->get_outbuf(), 1.0, length_);
+                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
+                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(detector_.degrees_of_freedom()));
+                    detector_.update_noise_estimation(sig2lin);
+                    memcpy(out, in, sizeof(lv_16sc_t) * length_);
+                }
+            else
+                {
+                    const bool filter_state = detector_.detected();
+                    if (detector_.detect(detector_.energy(in)))
+                        {
+                            if (filter_state == false)
+                                {
+                                    last_out_ = gr_complex(0.0, 0.0);
+                                }
+                            if (detector_.blank())
+                                {
+                                    std::fill_n(out, length_, lv_16sc_t(0, 0));
+                                    last_out_ = gr_complex(0.0, 0.0);
+                                }
+                            else
+                                {
+                                    // in_[0] holds the sample before the segment
+                                    volk_gnsssdr_16ic_convert_32fc(in_.data(), in - 1, length_ + 1);
+                                    const gr_complex *in_f = in_.data() + 1;
+                                    volk_32fc_x2_multiply_conjugate_32fc(c_samples_.data(), in_f, in_.data(), length_);
+                                    volk_32fc_s32f_atan2_32f(angle_.data(), c_samples_.data(), static_cast<float>(1.0), length_);
+                                    for (int32_t aux = 0; aux < length_; aux++)
+                                        {
+                                            z_0_ = std::exp(gr_complex(0.0, 1.0) * angle_[aux]);
+                                            out_[aux] = in_f[aux] - z_0_ * in_f[aux - 1] + p_c_factor_ * z_0_ * last_out_;
+                                            last_out_ = out_[aux];
+                                        }
+                                    volk_gnsssdr_32fc_convert_16ic(out, out_.data(), length_);
+                                }
+                        }
+                    else
+                        {
+                            memcpy(out, in, sizeof(lv_16sc_t) * length_);
+                        }
+                }
+            index_out += length_;
+            detector_.next_segment();
+            in += length_;
+            out += length_;
+        }
+    consume_each(index_out);
+    return index_out;
+}
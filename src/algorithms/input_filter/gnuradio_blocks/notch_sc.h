@@ -0,0 +1,89 @@
+/*!
+ * \file notch_sc.h
+ * \brief Implements a notch filter algorithm for complex 16-bit integer samples
+ * \author Antonio Ramos (antonio.ramosdet(at)gmail.com)
+ * \author agent, 2026. agent(at)local (16-bit integer samples version)
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#ifndef GNSS_SDR_NOTCH_SC_H
+#define GNSS_SDR_NOTCH_SC_H
+
+#include "gnss_block_interface.h"
+#include "interference_detector.h"
+#include <gnuradio/block.h>
+#include <gnuradio/fft/fft.h>
+#include <volk/volk_complex.h>  // for lv_16sc_t
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <memory>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class NotchSc;
+
+using notch_sc_sptr = gnss_shared_ptr<NotchSc>;
+
+notch_sc_sptr make_notch_filter_sc(
+    float pfa,
+    float p_c_factor,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset,
+    float pfa_blanking);
+
+/*!
+ * \brief This class implements the multi state notch filter of Notch for
+ * complex 16-bit integer samples.
+ *
+ * Detection and pass-through are done on the integer samples. Only the
+ * segments used for the noise floor estimation, and those being filtered,
+ * are converted to floating point.
+ */
+class NotchSc : public gr::block
+{
+public:
+    ~NotchSc() = default;
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend notch_sc_sptr make_notch_filter_sc(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, float pfa_blanking);
+    NotchSc(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, float pfa_blanking);
+#if GNURADIO_FFT_USES_TEMPLATES
+    std::unique_ptr<gr::fft::fft_complex_fwd> d_fft_;
+#else
+    std::unique_ptr<gr::fft::fft_complex> d_fft_;
+#endif
+    Interference_Detector detector_;
+    volk_gnsssdr::vector<gr_complex> in_;
+    volk_gnsssdr::vector<gr_complex> out_;
+    volk_gnsssdr::vector<gr_complex> c_samples_;
+    volk_gnsssdr::vector<float> angle_;
+    volk_gnsssdr::vector<float> power_spect_;
+    gr_complex last_out_;
+    gr_complex z_0_;
+    gr_complex p_c_factor_;
+    int32_t length_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NOTCH_SC_H
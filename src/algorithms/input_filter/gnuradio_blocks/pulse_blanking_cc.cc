@@ -17,10 +17,10 @@
  */
 
 #include "pulse_blanking_cc.h"
-#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 #include <algorithm>
+#include <cstring>
 
 
 pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length,
@@ -35,21 +35,12 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
     int32_t n_segments_est,
     int32_t n_segments_reset) : gr::block("pulse_blanking_cc",
                                     gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)))
+                                    gr::io_signature::make(1, 1, sizeof(gr_complex))),
+                                detector_(pfa, length, n_segments_est, n_segments_reset)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
     set_alignment(std::max(1, alignment_multiple));
-    pfa_ = pfa;
     length_ = length;
-    last_filtered_ = false;
-    n_segments_ = 0;
-    n_segments_est_ = n_segments_est;
-    n_segments_reset_ = n_segments_reset;
-    noise_power_estimation_ = 0.0;
-    n_deg_fred_ = 2 * length_;
-    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
-    thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
-    zeros_ = volk_gnsssdr::vector<gr_complex>(length_);
 }
 
 
@@ -58,39 +49,27 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
 {
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    auto magnitude = volk_gnsssdr::vector<float>(noutput_items);
-    volk_32fc_magnitude_squared_32f(magnitude.data(), in, noutput_items);
     int32_t sample_index = 0;
-    float segment_energy;
     while ((sample_index + length_) < noutput_items)
         {
-            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), length_);
-            if ((n_segments_ < n_segments_est_) && (last_filtered_ == false))
+            const float segment_energy = detector_.energy(in);
+            if (detector_.estimating())
                 {
-                    noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + segment_energy / static_cast<float>(n_deg_fred_)) / static_cast<float>(n_segments_ + 1);
-                    memcpy(out, in, sizeof(gr_complex) * length_);
+                    detector_.update_noise_estimation(segment_energy / static_cast<float>(detector_.degrees_of_freedom()));
+                    std::memcpy(out, in, sizeof(gr_complex) * length_);
+                }
+            else if (detector_.detect(segment_energy))
+                {
+                    std::fill_n(out, length_, gr_complex(0.0, 0.0));
                 }
             else
                 {
-                    if ((segment_energy / noise_power_estimation_) > thres_)
-                        {
-                            memcpy(out, zeros_.data(), sizeof(gr_complex) * length_);
-                            last_filtered_ = true;
-                        }
-                    else
-                        {
-                            memcpy(out, in, sizeof(gr_complex) * length_);
-                            last_filtered_ = false;
-                            if (n_segments_ > n_segments_reset_)
-                                {
-                                    n_segments_ = 0;
-                                }
-                        }
+                    std::memcpy(out, in, sizeof(gr_complex) * length_);
                 }
             in += length_;
             out += length_;
             sample_index += length_;
-            n_segments_++;
+            detector_.next_segment();
         }
     consume_each(sample_index);
     return sample_index;
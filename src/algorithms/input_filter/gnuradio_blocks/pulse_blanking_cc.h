@@ -20,8 +20,8 @@
 #define GNSS_SDR_PULSE_BLANKING_CC_H
 
 #include "gnss_block_interface.h"
+#include "interference_detector.h"
 #include <gnuradio/block.h>
-#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
 
 /** \addtogroup Input_Filter
@@ -41,6 +41,11 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     int32_t n_segments_est,
     int32_t n_segments_reset);
 
+/*!
+ * \brief This class implements a pulse blanking filter: the segments of
+ * length samples whose energy exceeds the noise floor estimation by a
+ * threshold, set by the probability of false alarm pfa, are set to zero.
+ */
 class pulse_blanking_cc : public gr::block
 {
 public:
@@ -52,16 +57,8 @@ public:
 private:
     friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
     pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    volk_gnsssdr::vector<gr_complex> zeros_;
-    float noise_power_estimation_;
-    float thres_;
-    float pfa_;
+    Interference_Detector detector_;
     int32_t length_;
-    int32_t n_segments_;
-    int32_t n_segments_est_;
-    int32_t n_segments_reset_;
-    int32_t n_deg_fred_;
-    bool last_filtered_;
 };
 
 
@@ -0,0 +1,77 @@
+/*!
+ * \file pulse_blanking_sc.cc
+ * \brief Implements a pulse blanking algorithm for complex 16-bit integer samples
+ * \author Javier Arribas (jarribas(at)cttc.es)
+ *         Antonio Ramos  (antonio.ramosdet(at)gmail.com)
+ * \author agent, 2026. agent(at)local (16-bit integer samples version)
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#include "pulse_blanking_sc.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cstring>
+
+
+pulse_blanking_sc_sptr make_pulse_blanking_sc(float pfa, int32_t length,
+    int32_t n_segments_est, int32_t n_segments_reset)
+{
+    return pulse_blanking_sc_sptr(new pulse_blanking_sc(pfa, length, n_segments_est, n_segments_reset));
+}
+
+
+pulse_blanking_sc::pulse_blanking_sc(float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset) : gr::block("pulse_blanking_sc",
+                                    gr::io_signature::make(1, 1, sizeof(lv_16sc_t)),
+                                    gr::io_signature::make(1, 1, sizeof(lv_16sc_t))),
+                                detector_(pfa, length, n_segments_est, n_segments_reset)
+{
+    const int32_t alignment_multiple = volk_get_alignment() / sizeof(lv_16sc_t);
+    set_alignment(std::max(1, alignment_multiple));
+    length_ = length;
+}
+
+
+int pulse_blanking_sc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const lv_16sc_t *>(input_items[0]);
+    auto *out = reinterpret_cast<lv_16sc_t *>(output_items[0]);
+    int32_t sample_index = 0;
+    while ((sample_index + length_) < noutput_items)
+        {
+            const float segment_energy = detector_.energy(in);
+            if (detector_.estimating())
+                {
+                    detector_.update_noise_estimation(segment_energy / static_cast<float>(detector_.degrees_of_freedom()));
+                    std::memcpy(out, in, sizeof(lv_16sc_t) * length_);
+                }
+            else if (detector_.detect(segment_energy))
+                {
+                    std::fill_n(out, length_, lv_16sc_t(0, 0));
+                }
+            else
+                {
+                    std::memcpy(out, in, sizeof(lv_16sc_t) * length_);
+                }
+            in += length_;
+            out += length_;
+            sample_index += length_;
+            detector_.next_segment();
+        }
+    consume_each(sample_index);
+    return sample_index;
+}
@@ -0,0 +1,68 @@
+/*!
+ * \file pulse_blanking_sc.h
+ * \brief Implements a pulse blanking algorithm for complex 16-bit integer samples
+ * \author Javier Arribas (jarribas(at)cttc.es)
+ *         Antonio Ramos  (antonio.ramosdet(at)gmail.com)
+ * \author agent, 2026. agent(at)local (16-bit integer samples version)
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#ifndef GNSS_SDR_PULSE_BLANKING_SC_H
+#define GNSS_SDR_PULSE_BLANKING_SC_H
+
+#include "gnss_block_interface.h"
+#include "interference_detector.h"
+#include <gnuradio/block.h>
+#include <volk/volk_complex.h>  // for lv_16sc_t
+#include <cstdint>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class pulse_blanking_sc;
+
+using pulse_blanking_sc_sptr = gnss_shared_ptr<pulse_blanking_sc>;
+
+pulse_blanking_sc_sptr make_pulse_blanking_sc(
+    float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset);
+
+/*!
+ * \brief This class implements the pulse blanking filter of
+ * pulse_blanking_cc for complex 16-bit integer samples, which are processed
+ * without conversion to floating point.
+ */
+class pulse_blanking_sc : public gr::block
+{
+public:
+    ~pulse_blanking_sc() = default;
+
+    int general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+        gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
+
+private:
+    friend pulse_blanking_sc_sptr make_pulse_blanking_sc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    pulse_blanking_sc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    Interference_Detector detector_;
+    int32_t length_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PULSE_BLANKING_SC_H
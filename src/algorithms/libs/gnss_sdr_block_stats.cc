@@ -0,0 +1,284 @@
+/*!
+ * \file gnss_sdr_block_stats.cc
+ * \brief Lightweight run-time instrumentation of the processing blocks
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_block_stats.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <utility>
+
+
+namespace
+{
+const std::array<std::string, 6> STAGE_ORDER{"SignalSource", "Acquisition", "Tracking", "TelemetryDecoder", "Observables", "PVT"};
+
+
+size_t stage_rank(const std::string& stage)
+{
+    return static_cast<size_t>(std::find(STAGE_ORDER.begin(), STAGE_ORDER.end(), stage) - STAGE_ORDER.begin());
+}
+
+
+// Only the owner thread writes a given maximum, but reset() may run concurrently
+void update_max(std::atomic<uint64_t>& max, uint64_t value)
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+}
+}  // namespace
+
+
+double Block_Stats_Snapshot::mean_work_time_us() const
+{
+    return work_calls > 0 ? static_cast<double>(work_time_ns) / static_cast<double>(work_calls) / 1e3 : 0.0;
+}
+
+
+double Block_Stats_Snapshot::mean_input_items() const
+{
+    return work_calls > 0 ? static_cast<double>(input_items) / static_cast<double>(work_calls) : 0.0;
+}
+
+
+double Block_Stats_Snapshot::work_time_percentile_us(double fraction) const
+{
+    uint64_t calls = 0;
+    for (const auto& bin : histogram)
+        {
+            calls += bin;
+        }
+    if (calls == 0)
+        {
+            return 0.0;
+        }
+    const auto target = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(calls)));
+    uint64_t accumulated = 0;
+    for (size_t k = 0; k < histogram.size(); k++)
+        {
+            accumulated += histogram[k];
+            if (accumulated >= target && accumulated > 0)
+                {
+                    return static_cast<double>(uint64_t(1) << k);
+                }
+        }
+    return static_cast<double>(uint64_t(1) << (histogram.size() - 1));
+}
+
+
+std::atomic<bool> Block_Stats::s_enabled{false};
+
+
+Block_Stats::Block_Stats(std::string stage, std::string block) : d_stage(std::move(stage)),
+                                                                 d_block(std::move(block)),
+                                                                 d_channel(-1),
+                                                                 d_work_calls(0),
+                                                                 d_work_time_ns(0),
+                                                                 d_max_work_time_ns(0),
+                                                                 d_input_items(0),
+                                                                 d_max_input_items(0),
+                                                                 d_dropped_samples(0)
+{
+}
+
+
+void Block_Stats::set_enabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+
+void Block_Stats::record_work(uint64_t elapsed_ns, uint64_t input_items)
+{
+    d_work_calls.fetch_add(1, std::memory_order_relaxed);
+    d_work_time_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+    d_input_items.fetch_add(input_items, std::memory_order_relaxed);
+    update_max(d_max_work_time_ns, elapsed_ns);
+    update_max(d_max_input_items, input_items);
+    size_t bin = 0;
+    for (uint64_t us = elapsed_ns / 1000; us > 0 && bin < BLOCK_STATS_HISTOGRAM_BINS - 1; us >>= 1)
+        {
+            bin++;
+        }
+    d_histogram[bin].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+void Block_Stats::add_dropped_samples(uint64_t samples)
+{
+    d_dropped_samples.fetch_add(samples, std::memory_order_relaxed);
+}
+
+
+void Block_Stats::set_channel(int32_t channel)
+{
+    d_channel.store(channel, std::memory_order_relaxed);
+}
+
+
+void Block_Stats::reset()
+{
+    d_work_calls.store(0, std::memory_order_relaxed);
+    d_work_time_ns.store(0, std::memory_order_relaxed);
+    d_max_work_time_ns.store(0, std::memory_order_relaxed);
+    d_input_items.store(0, std::memory_order_relaxed);
+    d_max_input_items.store(0, std::memory_order_relaxed);
+    d_dropped_samples.store(0, std::memory_order_relaxed);
+    for (auto& bin : d_histogram)
+        {
+            bin.store(0, std::memory_order_relaxed);
+        }
+}
+
+
+Block_Stats_Snapshot Block_Stats::snapshot() const
+{
+    Block_Stats_Snapshot snap;
+    snap.stage = d_stage;
+    snap.block = d_block;
+    snap.channel = d_channel.load(std::memory_order_relaxed);
+    snap.work_calls = d_work_calls.load(std::memory_order_relaxed);
+    snap.work_time_ns = d_work_time_ns.load(std::memory_order_relaxed);
+    snap.max_work_time_ns = d_max_work_time_ns.load(std::memory_order_relaxed);
+    snap.input_items = d_input_items.load(std::memory_order_relaxed);
+    snap.max_input_items = d_max_input_items.load(std::memory_order_relaxed);
+    snap.dropped_samples = d_dropped_samples.load(std::memory_order_relaxed);
+    for (size_t k = 0; k < BLOCK_STATS_HISTOGRAM_BINS; k++)
+        {
+            snap.histogram[k] = d_histogram[k].load(std::memory_order_relaxed);
+        }
+    return snap;
+}
+
+
+Block_Stats_Registry& Block_Stats_Registry::instance()
+{
+    static Block_Stats_Registry registry;
+    return registry;
+}
+
+
+std::shared_ptr<Block_Stats> Block_Stats_Registry::make(const std::string& stage, const std::string& block)
+{
+    auto stats = std::make_shared<Block_Stats>(stage, block);
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_stats.erase(std::remove_if(d_stats.begin(), d_stats.end(),
+                      [](const std::weak_ptr<Block_Stats>& s) { return s.expired(); }),
+        d_stats.end());
+    d_stats.push_back(stats);
+    return stats;
+}
+
+
+std::vector<std::shared_ptr<Block_Stats>> Block_Stats_Registry::alive_stats()
+{
+    std::vector<std::shared_ptr<Block_Stats>> alive;
+    std::lock_guard<std::mutex> lock(d_mutex);
+    for (const auto& weak_stats : d_stats)
+        {
+            auto stats = weak_stats.lock();
+            if (stats != nullptr)
+                {
+                    alive.push_back(std::move(stats));
+                }
+        }
+    return alive;
+}
+
+
+std::vector<Block_Stats_Snapshot> Block_Stats_Registry::snapshot()
+{
+    std::vector<Block_Stats_Snapshot> snaps;
+    for (const auto& stats : alive_stats())
+        {
+            snaps.push_back(stats->snapshot());
+        }
+    std::stable_sort(snaps.begin(), snaps.end(), [](const Block_Stats_Snapshot& a, const Block_Stats_Snapshot& b) {
+        const size_t rank_a = stage_rank(a.stage);
+        const size_t rank_b = stage_rank(b.stage);
+        return rank_a != rank_b ? rank_a < rank_b : a.channel < b.channel;
+    });
+    return snaps;
+}
+
+
+void Block_Stats_Registry::reset()
+{
+    for (const auto& stats : alive_stats())
+        {
+            stats->reset();
+        }
+}
+
+
+std::string Block_Stats_Registry::report()
+{
+    const auto snaps = snapshot();
+    std::stringstream str_stream;
+    if (!Block_Stats::enabled())
+        {
+            str_stream << "Block statistics are disabled (use 'stats on' to enable them)\n";
+        }
+    str_stream << std::fixed << std::setprecision(1);
+    str_stream << std::left << std::setw(17) << "stage" << std::setw(36) << "block" << std::right
+               << std::setw(4) << "ch" << std::setw(11) << "calls" << std::setw(10) << "mean[us]"
+               << std::setw(10) << "p99[us]" << std::setw(10) << "max[us]" << std::setw(10) << "cpu[s]"
+               << std::setw(11) << "mean_in" << std::setw(11) << "max_in" << std::setw(9) << "dropped" << '\n';
+
+    std::map<std::string, Block_Stats_Snapshot> totals;
+    for (const auto& snap : snaps)
+        {
+            str_stream << std::left << std::setw(17) << snap.stage << std::setw(36) << snap.block << std::right
+                       << std::setw(4) << snap.channel << std::setw(11) << snap.work_calls
+                       << std::setw(10) << snap.mean_work_time_us() << std::setw(10) << snap.work_time_percentile_us(0.99)
+                       << std::setw(10) << static_cast<double>(snap.max_work_time_ns) / 1e3
+                       << std::setprecision(3) << std::setw(10) << static_cast<double>(snap.work_time_ns) / 1e9
+                       << std::setprecision(1) << std::setw(11) << snap.mean_input_items() << std::setw(11) << snap.max_input_items
+                       << std::setw(9) << snap.dropped_samples << '\n';
+            auto& total = totals[snap.stage];
+            total.stage = snap.stage;
+            total.work_calls += snap.work_calls;
+            total.work_time_ns += snap.work_time_ns;
+            total.max_work_time_ns = std::max(total.max_work_time_ns, snap.max_work_time_ns);
+            total.dropped_samples += snap.dropped_samples;
+        }
+
+    uint64_t total_time_ns = 0;
+    for (const auto& total : totals)
+        {
+            total_time_ns += total.second.work_time_ns;
+        }
+    str_stream << "Totals per stage:\n";
+    for (const auto& stage : STAGE_ORDER)
+        {
+            const auto it = totals.find(stage);
+            if (it == totals.end())
+                {
+                    continue;
+                }
+            const auto& total = it->second;
+            str_stream << std::left << std::setw(17) << stage << std::right
+                       << " calls " << total.work_calls
+                       << "  cpu " << std::setprecision(3) << static_cast<double>(total.work_time_ns) / 1e9 << std::setprecision(1) << " s ("
+                       << (total_time_ns > 0 ? 100.0 * static_cast<double>(total.work_time_ns) / static_cast<double>(total_time_ns) : 0.0)
+                       << " %)  max " << static_cast<double>(total.max_work_time_ns) / 1e3 << " us"
+                       << "  dropped " << total.dropped_samples << '\n';
+        }
+    return str_stream.str();
+}
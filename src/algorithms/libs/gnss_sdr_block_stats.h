@@ -0,0 +1,182 @@
+/*!
+ * \file gnss_sdr_block_stats.h
+ * \brief Lightweight run-time instrumentation of the processing blocks
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_BLOCK_STATS_H
+#define GNSS_SDR_GNSS_SDR_BLOCK_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Number of bins of the work() latency histograms. Bin 0 counts the
+ * calls shorter than 1 us, bin k the calls in [2^(k-1), 2^k) us, and the last
+ * bin all the longer ones.
+ */
+constexpr size_t BLOCK_STATS_HISTOGRAM_BINS = 32;
+
+
+/*!
+ * \brief Copy of the counters of a block at a given time
+ */
+struct Block_Stats_Snapshot
+{
+    std::string stage;  // "SignalSource", "Acquisition", "Tracking", "TelemetryDecoder", "Observables" or "PVT"
+    std::string block;
+    int32_t channel{-1};  // -1 for blocks not tied to a channel
+    uint64_t work_calls{0};
+    uint64_t work_time_ns{0};
+    uint64_t max_work_time_ns{0};
+    uint64_t input_items{0};  // sum over work() calls of the items waiting at the input
+    uint64_t max_input_items{0};
+    uint64_t dropped_samples{0};
+    std::array<uint64_t, BLOCK_STATS_HISTOGRAM_BINS> histogram{};
+
+    double mean_work_time_us() const;
+    double mean_input_items() const;
+
+    /*!
+     * \brief Upper edge, in us, of the histogram bin that holds the given
+     * fraction (0 to 1) of the work() calls
+     */
+    double work_time_percentile_us(double fraction) const;
+};
+
+
+/*!
+ * \brief Counters of one block. The block updates them from its own thread
+ * with relaxed atomic operations, and they can be read at any time.
+ */
+class Block_Stats
+{
+public:
+    Block_Stats(std::string stage, std::string block);
+
+    /*!
+     * \brief True if the instrumentation is enabled. Blocks must check it
+     * before collecting anything (Block_Stats_Scope does).
+     */
+    static inline bool enabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static void set_enabled(bool enabled);
+
+    void record_work(uint64_t elapsed_ns, uint64_t input_items);
+    void add_dropped_samples(uint64_t samples);
+    void set_channel(int32_t channel);
+    void reset();
+    Block_Stats_Snapshot snapshot() const;
+
+private:
+    static std::atomic<bool> s_enabled;
+
+    std::string d_stage;
+    std::string d_block;
+    std::atomic<int32_t> d_channel;
+    std::atomic<uint64_t> d_work_calls;
+    std::atomic<uint64_t> d_work_time_ns;
+    std::atomic<uint64_t> d_max_work_time_ns;
+    std::atomic<uint64_t> d_input_items;
+    std::atomic<uint64_t> d_max_input_items;
+    std::atomic<uint64_t> d_dropped_samples;
+    std::array<std::atomic<uint64_t>, BLOCK_STATS_HISTOGRAM_BINS> d_histogram{};
+};
+
+
+/*!
+ * \brief Keeps track of the Block_Stats of all the blocks alive
+ */
+class Block_Stats_Registry
+{
+public:
+    static Block_Stats_Registry& instance();
+
+    /*!
+     * \brief Returns new counters for a block, registered until they are destroyed
+     */
+    std::shared_ptr<Block_Stats> make(const std::string& stage, const std::string& block);
+
+    std::vector<Block_Stats_Snapshot> snapshot();
+    void reset();
+
+    /*!
+     * \brief Human-readable table of the counters, one line per block plus
+     * the totals of each stage
+     */
+    std::string report();
+
+private:
+    Block_Stats_Registry() = default;
+    std::vector<std::shared_ptr<Block_Stats>> alive_stats();
+
+    std::mutex d_mutex;
+    std::vector<std::weak_ptr<Block_Stats>> d_stats;
+};
+
+
+/*!
+ * \brief Times the scope where it lives (usually a work() call) and records
+ * it, together with the items waiting at the input, in a Block_Stats. When
+ * the instrumentation is disabled it only costs a relaxed atomic load.
+ */
+class Block_Stats_Scope
+{
+public:
+    Block_Stats_Scope(Block_Stats* stats, uint64_t input_items) : d_stats(Block_Stats::enabled() ? stats : nullptr),
+                                                                  d_input_items(input_items)
+    {
+        if (d_stats != nullptr)
+            {
+                d_start = std::chrono::steady_clock::now();
+            }
+    }
+
+    ~Block_Stats_Scope()
+    {
+        if (d_stats != nullptr)
+            {
+                const auto elapsed = std::chrono::steady_clock::now() - d_start;
+                d_stats->record_work(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), d_input_items);
+            }
+    }
+
+    Block_Stats_Scope(const Block_Stats_Scope&) = delete;
+    Block_Stats_Scope& operator=(const Block_Stats_Scope&) = delete;
+
+private:
+    Block_Stats* d_stats;
+    uint64_t d_input_items;
+    std::chrono::steady_clock::time_point d_start{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SDR_BLOCK_STATS_H
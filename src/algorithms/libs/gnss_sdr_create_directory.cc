@@ -16,6 +16,8 @@
  */
 
 #include "gnss_sdr_create_directory.h"
+#include <unistd.h>   // for getpid
+#include <atomic>     // for atomic
 #include <exception>  // for exception
 #include <fstream>    // for ofstream
 
@@ -49,12 +51,8 @@ bool gnss_sdr_create_directory(const std::string& foldername)
             errorlib::error_code ec;
             if (!fs::exists(new_folder))
                 {
-                    if (!fs::create_directory(new_folder, ec))
-                        {
-                            return false;
-                        }
-
-                    if (static_cast<bool>(ec))
+                    // Another thread or process may create it at the same time
+                    if (!fs::create_directory(new_folder, ec) && !fs::is_directory(new_folder, ec))
                         {
                             return false;
                         }
@@ -62,8 +60,9 @@ bool gnss_sdr_create_directory(const std::string& foldername)
             new_folder += fs::path::preferred_separator;
         }
 
-    // Check if we have writing permissions
-    std::string test_file = foldername + "/test_file.txt";
+    // Check if we have writing permissions, with a file name that no other caller uses
+    static std::atomic<unsigned int> test_file_counter{0};
+    const std::string test_file = foldername + "/test_file_" + std::to_string(getpid()) + "_" + std::to_string(test_file_counter++) + ".txt";
     std::ofstream os_test_file;
     os_test_file.open(test_file.c_str(), std::ios::out | std::ios::binary);
 
@@ -72,6 +72,12 @@ DEFINE_string(RINEX_version, "-", "If defined, specifies the RINEX version (2.11
 
 DEFINE_string(RINEX_name, "-", "If defined, specifies the RINEX files base name");
 
+DEFINE_string(batch_file, "", "If defined, path to a file listing one job per line (configuration file, and optionally the capture file and the output path), which are processed concurrently, each one by a new gnss-sdr process.");
+
+DEFINE_int32(batch_jobs, 0, "Maximum number of batch jobs running concurrently (0: as many as CPU cores in the budget).");
+
+DEFINE_int32(batch_cpu_budget, 0, "Number of CPU cores that the batch jobs can use (0: all of them).");
+
 #if GFLAGS_GREATER_2_0
 
 static bool ValidateC(const char* flagname, const std::string& value)
@@ -214,6 +220,28 @@ static bool ValidatePllBw(const char* flagname, double value)
     return false;
 }
 
+static bool ValidateBatchFile(const char* flagname, const std::string& value)
+{
+    if (value.empty() or fs::exists(value))
+        {  // value is ok
+            return true;
+        }
+    std::cout << "Invalid value for flag -" << flagname << ". The file '" << value << "' does not exist.\n";
+    std::cout << "GNSS-SDR program ended.\n";
+    return false;
+}
+
+static bool ValidateBatchNonNegative(const char* flagname, int32_t value)
+{
+    if (value >= 0)
+        {  // value is ok
+            return true;
+        }
+    std::cout << "Invalid value for flag -" << flagname << ": " << value << ". Allowed range is 0 <= " << flagname << ".\n";
+    std::cout << "GNSS-SDR program ended.\n";
+    return false;
+}
+
 static bool ValidateCarrierSmoothingFactor(const char* flagname, int32_t value)
 {
     const int32_t min_value = 1;
@@ -240,5 +268,8 @@ DEFINE_validator(carrier_lock_th, &ValidateCarrierLockTh);
 DEFINE_validator(dll_bw_hz, &ValidateDllBw);
 DEFINE_validator(pll_bw_hz, &ValidatePllBw);
 DEFINE_validator(carrier_smoothing_factor, &ValidateCarrierSmoothingFactor);
+DEFINE_validator(batch_file, &ValidateBatchFile);
+DEFINE_validator(batch_jobs, &ValidateBatchNonNegative);
+DEFINE_validator(batch_cpu_budget, &ValidateBatchNonNegative);
 
 #endif
@@ -60,6 +60,11 @@ const int32_t DEFAULT_CARRIER_SMOOTHING_FACTOR = 200;
 DECLARE_string(RINEX_version);  //!< If defined, specifies the RINEX version (2.11 or 3.02). Overrides the configuration file.
 DECLARE_string(RINEX_name);     //!< If defined, specifies the RINEX files base name
 
+// Declare flags for batch post-processing
+DECLARE_string(batch_file);       //!< If defined, path to a list of (configuration, capture file) jobs, each one processed by a new receiver process.
+DECLARE_int32(batch_jobs);        //!< Maximum number of batch jobs running concurrently (0: as many as CPU cores in the budget).
+DECLARE_int32(batch_cpu_budget);  //!< Number of CPU cores that the batch jobs can use (0: all of them).
+
 
 /** \} */
 /** \} */
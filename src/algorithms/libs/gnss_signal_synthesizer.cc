@@ -0,0 +1,587 @@
+/*!
+ * \file gnss_signal_synthesizer.cc
+ * \brief Multithreaded synthesizer of multi-satellite GNSS baseband signals
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_synthesizer.h"
+#include "Beidou_B1I.h"
+#include "GPS_L1_CA.h"
+#include "GPS_L5.h"
+#include "Galileo_E1.h"
+#include "Galileo_E5a.h"
+#include "Galileo_E5b.h"
+#include "MATH_CONSTANTS.h"
+#include "beidou_b1i_signal_replica.h"
+#include "galileo_e1_signal_replica.h"
+#include "galileo_e5_signal_replica.h"
+#include "gps_l5_signal_replica.h"
+#include "gps_sdr_signal_replica.h"
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+
+namespace
+{
+// '0' -> +1, '1' -> -1
+std::vector<float> code_from_string(const char* str, size_t length)
+{
+    std::vector<float> code(length);
+    for (size_t i = 0; i < length; i++)
+        {
+            code[i] = (str[i] == '0') ? 1.0F : -1.0F;
+        }
+    return code;
+}
+
+
+// 0 -> +1, 1 -> -1
+std::vector<float> code_from_bits(const int32_t* bits, size_t length)
+{
+    std::vector<float> code(length);
+    for (size_t i = 0; i < length; i++)
+        {
+            code[i] = (bits[i] == 0) ? 1.0F : -1.0F;
+        }
+    return code;
+}
+
+
+std::vector<float> real_part(const std::vector<std::complex<float>>& x)
+{
+    std::vector<float> re(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        {
+            re[i] = x[i].real();
+        }
+    return re;
+}
+
+
+inline uint64_t positive_modulo(int64_t a, uint64_t b)
+{
+    const int64_t r = a % static_cast<int64_t>(b);
+    return static_cast<uint64_t>(r < 0 ? r + static_cast<int64_t>(b) : r);
+}
+
+
+inline int64_t floor_division(int64_t a, int64_t b)
+{
+    const int64_t q = a / b;
+    return (a % b != 0 && a < 0) ? q - 1 : q;
+}
+}  // namespace
+
+
+Gnss_Signal_Synthesizer::Gnss_Signal_Synthesizer(const Gnss_Scenario& scenario,
+    unsigned int n_threads,
+    size_t chunk_size) : d_scenario(scenario),
+                         d_out(nullptr),
+                         d_type(Output_Type::gr_complex),
+                         d_first_sample(0),
+                         d_first_chunk(0),
+                         d_end_chunk(0),
+                         d_next_chunk(0),
+                         d_job(0),
+                         d_num_samples(0),
+                         d_busy(0),
+                         d_gain(1.0),
+                         d_chunk_size(chunk_size > 0 ? chunk_size : 4096),
+                         d_stop(false)
+{
+    if (d_scenario.fs_hz <= 0.0)
+        {
+            throw std::invalid_argument("Gnss_Signal_Synthesizer: the sampling rate must be positive");
+        }
+    d_satellites.resize(d_scenario.satellites.size());
+    for (size_t i = 0; i < d_satellites.size(); i++)
+        {
+            init_satellite(d_scenario.satellites[i], i, d_satellites[i]);
+        }
+
+    if (n_threads == 0)
+        {
+            n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+    d_scratch.resize(n_threads);
+    for (auto& scratch : d_scratch)
+        {
+            scratch.out.resize(d_chunk_size);
+            scratch.carrier.resize(d_chunk_size);
+            scratch.code.resize(d_chunk_size);
+            scratch.i.resize(d_chunk_size);
+            scratch.q.resize(d_chunk_size);
+        }
+    for (size_t worker = 1; worker < n_threads; worker++)
+        {
+            d_workers.emplace_back(&Gnss_Signal_Synthesizer::worker_loop, this, worker);
+        }
+}
+
+
+Gnss_Signal_Synthesizer::~Gnss_Signal_Synthesizer()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_job_ready.notify_all();
+    for (auto& worker : d_workers)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+}
+
+
+void Gnss_Signal_Synthesizer::init_satellite(const Gnss_Scenario_Satellite& sat, size_t index, Satellite& out) const
+{
+    const std::string id = sat.system + " " + sat.signal + " PRN " + std::to_string(sat.PRN);
+    const double half_power = std::sqrt(0.5);
+    out.samples_per_chip = 1.0;
+    if (sat.system == "G" && sat.signal == "1C")
+        {
+            if (!((sat.PRN >= 1 && sat.PRN <= 32) || (sat.PRN >= 120 && sat.PRN <= 138)))
+                {
+                    throw std::invalid_argument("Gnss_Signal_Synthesizer: invalid " + id);
+                }
+            std::vector<float> code(static_cast<size_t>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+            gps_l1_ca_code_gen_float(code, static_cast<int32_t>(sat.PRN), 0);
+            out.components.push_back({code, {1.0F}, {1.0F, 0.0F}, true});
+            out.carrier_freq_hz = GPS_L1_FREQ_HZ;
+            out.code_rate_cps = GPS_L1_CA_CODE_RATE_CPS;
+            out.periods_per_symbol = GPS_L1_CA_BIT_PERIOD_MS / GPS_L1_CA_CODE_PERIOD_MS;
+        }
+    else if (sat.system == "G" && sat.signal == "L5")
+        {
+            if (sat.PRN < 1 || sat.PRN > 32)
+                {
+                    throw std::invalid_argument("Gnss_Signal_Synthesizer: invalid " + id);
+                }
+            std::vector<float> code_i(GPS_L5I_CODE_LENGTH_CHIPS);
+            std::vector<float> code_q(GPS_L5Q_CODE_LENGTH_CHIPS);
+            gps_l5i_code_gen_float(code_i, sat.PRN);
+            gps_l5q_code_gen_float(code_q, sat.PRN);
+            out.components.push_back({code_i, code_from_bits(GPS_L5I_NH_CODE, GPS_L5I_NH_CODE_LENGTH), {static_cast<float>(half_power), 0.0F}, true});
+            out.components.push_back({code_q, code_from_bits(GPS_L5Q_NH_CODE, GPS_L5Q_NH_CODE_LENGTH), {0.0F, static_cast<float>(half_power)}, false});
+            out.carrier_freq_hz = GPS_L5_FREQ_HZ;
+            out.code_rate_cps = GPS_L5I_CODE_RATE_CPS;
+            out.periods_per_symbol = GPS_L5I_SYMBOL_PERIOD_MS / GPS_L5I_PERIOD_MS;
+        }
+    else if (sat.system == "E" && sat.signal == "1B")
+        {
+            if (sat.PRN < 1 || sat.PRN > 50)
+                {
+                    throw std::invalid_argument("Gnss_Signal_Synthesizer: invalid " + id);
+                }
+            // sinBOC(1,1), two sub-chips per chip
+            std::vector<float> code_b(2 * static_cast<size_t>(GALILEO_E1_B_CODE_LENGTH_CHIPS));
+            std::vector<float> code_c(2 * static_cast<size_t>(GALILEO_E1_B_CODE_LENGTH_CHIPS));
+            galileo_e1_code_gen_sinboc11_float(code_b, {'1', 'B', '\0'}, sat.PRN);
+            galileo_e1_code_gen_sinboc11_float(code_c, {'1', 'C', '\0'}, sat.PRN);
+            out.components.push_back({code_b, {1.0F}, {static_cast<float>(half_power), 0.0F}, true});
+            out.components.push_back({code_c, code_from_string(GALILEO_E1_C_SECONDARY_CODE, GALILEO_E1_C_SECONDARY_CODE_LENGTH), {static_cast<float>(-half_power), 0.0F}, false});
+            out.carrier_freq_hz = GALILEO_E1_FREQ_HZ;
+            out.code_rate_cps = 2.0 * GALILEO_E1_CODE_CHIP_RATE_CPS;
+            out.samples_per_chip = 2.0;
+            out.periods_per_symbol = 1;
+        }
+    else if (sat.system == "E" && (sat.signal == "5X" || sat.signal == "7X"))
+        {
+            if (sat.PRN < 1 || sat.PRN > 50)
+                {
+                    throw std::invalid_argument("Gnss_Signal_Synthesizer: invalid " + id);
+                }
+            const bool e5a = sat.signal == "5X";
+            std::vector<std::complex<float>> code_i(GALILEO_E5A_CODE_LENGTH_CHIPS);
+            std::vector<std::complex<float>> code_q(GALILEO_E5A_CODE_LENGTH_CHIPS);
+            if (e5a)
+                {
+                    galileo_e5_a_code_gen_complex_primary(code_i, static_cast<int32_t>(sat.PRN), {'5', 'I', '\0'});
+                    galileo_e5_a_code_gen_complex_primary(code_q, static_cast<int32_t>(sat.PRN), {'5', 'Q', '\0'});
+                    out.components.push_back({real_part(code_i), code_from_string(GALILEO_E5A_I_SECONDARY_CODE, GALILEO_E5A_I_SECONDARY_CODE_LENGTH), {static_cast<float>(half_power), 0.0F}, true});
+                    out.components.push_back({real_part(code_q), code_from_string(GALILEO_E5A_Q_SECONDARY_CODE[sat.PRN - 1], GALILEO_E5A_Q_SECONDARY_CODE_LENGTH), {0.0F, static_cast<float>(half_power)}, false});
+                    out.carrier_freq_hz = GALILEO_E5A_FREQ_HZ;
+                    out.code_rate_cps = GALILEO_E5A_CODE_CHIP_RATE_CPS;
+                    out.periods_per_symbol = static_cast<uint32_t>(1000 / GALILEO_E5A_SYMBOL_RATE_BPS / GALILEO_E5A_CODE_PERIOD_MS);
+                }
+            else
+                {
+                    galileo_e5_b_code_gen_complex_primary(code_i, static_cast<int32_t>(sat.PRN), {'7', 'I', '\0'});
+                    galileo_e5_b_code_gen_complex_primary(code_q, static_cast<int32_t>(sat.PRN), {'7', 'Q', '\0'});
+                    out.components.push_back({real_part(code_i), code_from_string(GALILEO_E5B_I_SECONDARY_CODE, GALILEO_E5B_I_SECONDARY_CODE_LENGTH), {static_cast<float>(half_power), 0.0F}, true});
+                    out.components.push_back({real_part(code_q), code_from_string(GALILEO_E5B_Q_SECONDARY_CODE[sat.PRN - 1], GALILEO_E5B_Q_SECONDARY_CODE_LENGTH), {0.0F, static_cast<float>(half_power)}, false});
+                    out.carrier_freq_hz = GALILEO_E5B_FREQ_HZ;
+                    out.code_rate_cps = GALILEO_E5B_CODE_CHIP_RATE_CPS;
+                    out.periods_per_symbol = static_cast<uint32_t>(1000 / GALILEO_E5B_SYMBOL_RATE_BPS / GALILEO_E5B_CODE_PERIOD_MS);
+                }
+        }
+    else if (sat.system == "C" && sat.signal == "B1")
+        {
+            if (sat.PRN < 1 || sat.PRN > 33)
+                {
+                    throw std::invalid_argument("Gnss_Signal_Synthesizer: invalid " + id);
+                }
+            std::vector<float> code(static_cast<size_t>(BEIDOU_B1I_CODE_LENGTH_CHIPS));
+            beidou_b1i_code_gen_float(code, static_cast<int32_t>(sat.PRN), 0);
+            out.components.push_back({code, code_from_string(BEIDOU_B1I_SECONDARY_CODE_STR, BEIDOU_B1I_SECONDARY_CODE_LENGTH), {1.0F, 0.0F}, true});
+            out.carrier_freq_hz = BEIDOU_B1I_FREQ_HZ;
+            out.code_rate_cps = BEIDOU_B1I_CODE_RATE_CPS;
+            out.periods_per_symbol = static_cast<uint32_t>(BEIDOU_B1I_TELEMETRY_SYMBOL_PERIOD_MS / BEIDOU_B1I_CODE_PERIOD_MS);
+        }
+    else
+        {
+            throw std::invalid_argument("Gnss_Signal_Synthesizer: unsupported signal " + id);
+        }
+    out.code_length = static_cast<double>(out.components[0].code.size());
+
+    if (!sat.nav_symbols.empty())
+        {
+            out.symbols = code_from_string(sat.nav_symbols.c_str(), sat.nav_symbols.size());
+        }
+    else if (d_scenario.data_flag)
+        {
+            // One GPS L1 C/A frame worth of random symbols, different for each satellite
+            std::seed_seq seed{static_cast<uint32_t>(d_scenario.seed), static_cast<uint32_t>(d_scenario.seed >> 32U), static_cast<uint32_t>(index), 0x5eedU};
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<int> bit(0, 1);
+            out.symbols.resize(1500);
+            for (auto& symbol : out.symbols)
+                {
+                    symbol = bit(generator) == 0 ? 1.0F : -1.0F;
+                }
+        }
+    else
+        {
+            out.symbols = {1.0F};
+        }
+
+    if (d_scenario.noise_flag)
+        {
+            // Noise of unit power in a bandwidth of fs_hz: C = CN0 * N0 = CN0 / fs
+            out.amplitude = std::sqrt(std::pow(10.0, sat.CN0_dB_Hz / 10.0) / d_scenario.fs_hz);
+        }
+    else
+        {
+            out.amplitude = 1.0;
+        }
+}
+
+
+Gnss_Scenario_Observables Gnss_Signal_Synthesizer::true_observables(size_t satellite, double t) const
+{
+    const auto& sat = d_scenario.satellites.at(satellite);
+    const auto& gen = d_satellites.at(satellite);
+    Gnss_Scenario_Observables obs{};
+    obs.doppler_Hz = sat.doppler_Hz + sat.doppler_rate_Hz_s * t;
+    obs.carrier_phase_cycles = sat.doppler_Hz * t + 0.5 * sat.doppler_rate_Hz_s * t * t;
+    const double code_length_chips = gen.code_length / gen.samples_per_chip;
+    const double chips = sat.code_phase_chips + gen.code_rate_cps / gen.samples_per_chip * (t + obs.carrier_phase_cycles / gen.carrier_freq_hz);
+    obs.code_phase_chips = chips - std::floor(chips / code_length_chips) * code_length_chips;
+    return obs;
+}
+
+
+void Gnss_Signal_Synthesizer::synthesize_chunk(uint64_t chunk, Scratch& scratch)
+{
+    const size_t n = d_chunk_size;
+    const double fs = d_scenario.fs_hz;
+    const double t0 = static_cast<double>(chunk * n) / fs;
+    // Frequencies are taken at the middle of the chunk, and the phases are
+    // computed exactly at its first sample, so the errors do not accumulate
+    const double t_mid = t0 + 0.5 * static_cast<double>(n) / fs;
+    std::fill(scratch.out.begin(), scratch.out.end(), std::complex<float>(0.0, 0.0));
+
+    for (size_t s = 0; s < d_satellites.size(); s++)
+        {
+            const auto& sat = d_scenario.satellites[s];
+            const auto& gen = d_satellites[s];
+            const double doppler_mid = sat.doppler_Hz + sat.doppler_rate_Hz_s * t_mid;
+            const double doppler_cycles = sat.doppler_Hz * t0 + 0.5 * sat.doppler_rate_Hz_s * t0 * t0;
+
+            // Carrier
+            const double carrier_cycles = sat.if_Hz * t0 + doppler_cycles;
+            float phase_rad = static_cast<float>(TWO_PI * (carrier_cycles - std::floor(carrier_cycles)));
+            const auto phase_step_rad = static_cast<float>(TWO_PI * (sat.if_Hz + doppler_mid) / fs);
+            volk_gnsssdr_s32f_sincos_32fc(scratch.carrier.data(), phase_step_rad, &phase_rad, n);
+
+            // Codes, resampled between primary code period boundaries, where
+            // the secondary code and data symbols are constant
+            const double code_samples = sat.code_phase_chips * gen.samples_per_chip + gen.code_rate_cps * (t0 + doppler_cycles / gen.carrier_freq_hz);
+            const double code_step = gen.code_rate_cps * (1.0 + doppler_mid / gen.carrier_freq_hz) / fs;
+            auto period = static_cast<int64_t>(std::floor(code_samples / gen.code_length));
+            double rem = code_samples - static_cast<double>(period) * gen.code_length;
+            std::fill(scratch.i.begin(), scratch.i.end(), 0.0F);
+            std::fill(scratch.q.begin(), scratch.q.end(), 0.0F);
+            size_t k = 0;
+            while (k < n)
+                {
+                    const double to_boundary = std::ceil((gen.code_length - rem) / code_step);
+                    size_t m = n - k;
+                    if (to_boundary < static_cast<double>(m))
+                        {
+                            m = std::max(static_cast<size_t>(to_boundary), static_cast<size_t>(1));
+                        }
+                    const float symbol = gen.symbols[positive_modulo(floor_division(period, gen.periods_per_symbol), gen.symbols.size())];
+                    for (const auto& component : gen.components)
+                        {
+                            float* code = scratch.code.data();
+                            std::array<float, 1> shift{0.0F};
+                            volk_gnsssdr_32f_xn_resampler_32f_xn(&code, component.code.data(), static_cast<float>(-rem),
+                                static_cast<float>(code_step), shift.data(), static_cast<unsigned int>(component.code.size()), 1, static_cast<unsigned int>(m));
+                            float value = static_cast<float>(gen.amplitude) * component.secondary[positive_modulo(period, component.secondary.size())];
+                            if (component.data)
+                                {
+                                    value *= symbol;
+                                }
+                            const float value_i = value * component.weight.real();
+                            const float value_q = value * component.weight.imag();
+                            float* i = &scratch.i[k];
+                            float* q = &scratch.q[k];
+                            if (value_i != 0.0F)
+                                {
+                                    for (size_t j = 0; j < m; j++)
+                                        {
+                                            i[j] += value_i * code[j];
+                                        }
+                                }
+                            if (value_q != 0.0F)
+                                {
+                                    for (size_t j = 0; j < m; j++)
+                                        {
+                                            q[j] += value_q * code[j];
+                                        }
+                                }
+                        }
+                    rem += static_cast<double>(m) * code_step;
+                    if (rem >= gen.code_length)
+                        {
+                            rem -= gen.code_length;
+                            period++;
+                        }
+                    k += m;
+                }
+
+            // Baseband to carrier, accumulated over satellites
+            const auto* carrier = reinterpret_cast<const float*>(scratch.carrier.data());
+            auto* out = reinterpret_cast<float*>(scratch.out.data());
+            const float* i = scratch.i.data();
+            const float* q = scratch.q.data();
+            for (size_t j = 0; j < n; j++)
+                {
+                    out[2 * j] += i[j] * carrier[2 * j] - q[j] * carrier[2 * j + 1];
+                    out[2 * j + 1] += i[j] * carrier[2 * j + 1] + q[j] * carrier[2 * j];
+                }
+        }
+
+    if (d_scenario.noise_flag)
+        {
+            std::seed_seq seed{static_cast<uint32_t>(d_scenario.seed), static_cast<uint32_t>(d_scenario.seed >> 32U),
+                static_cast<uint32_t>(chunk), static_cast<uint32_t>(chunk >> 32U)};
+            std::mt19937 generator(seed);
+            std::normal_distribution<float> noise(0.0F, static_cast<float>(std::sqrt(0.5)));
+            for (auto& sample : scratch.out)
+                {
+                    const float noise_i = noise(generator);
+                    const float noise_q = noise(generator);
+                    sample += std::complex<float>(noise_i, noise_q);
+                }
+        }
+}
+
+
+void Gnss_Signal_Synthesizer::process_chunks(size_t worker)
+{
+    auto& scratch = d_scratch[worker];
+    while (true)
+        {
+            uint64_t chunk;
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                if (d_next_chunk == d_end_chunk)
+                    {
+                        return;
+                    }
+                chunk = d_next_chunk++;
+            }
+            synthesize_chunk(chunk, scratch);
+
+            // Copy the part of the chunk that was requested
+            const uint64_t chunk_begin = chunk * d_chunk_size;
+            const uint64_t begin = std::max(chunk_begin, d_first_sample);
+            const uint64_t end = std::min(chunk_begin + d_chunk_size, d_first_sample + d_num_samples);
+            const float* src = reinterpret_cast<const float*>(&scratch.out[begin - chunk_begin]);
+            const auto len = static_cast<unsigned int>(end - begin);
+            const size_t offset = begin - d_first_sample;
+            switch (d_type)
+                {
+                case Output_Type::gr_complex:
+                    std::copy(src, src + 2 * len, reinterpret_cast<float*>(static_cast<std::complex<float>*>(d_out) + offset));
+                    break;
+                case Output_Type::cshort:
+                    volk_32f_s32f_convert_16i(reinterpret_cast<int16_t*>(static_cast<std::complex<int16_t>*>(d_out) + offset), src, d_gain, 2 * len);
+                    break;
+                case Output_Type::cbyte:
+                    volk_32f_s32f_convert_8i(reinterpret_cast<int8_t*>(static_cast<std::complex<int8_t>*>(d_out) + offset), src, d_gain, 2 * len);
+                    break;
+                }
+        }
+}
+
+
+void Gnss_Signal_Synthesizer::worker_loop(size_t worker)
+{
+    uint64_t last_job = 0;
+    while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_job_ready.wait(lock, [&] { return d_stop || d_job != last_job; });
+                if (d_stop)
+                    {
+                        return;
+                    }
+                last_job = d_job;
+            }
+            process_chunks(worker);
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                d_busy--;
+            }
+            d_job_done.notify_one();
+        }
+}
+
+
+void Gnss_Signal_Synthesizer::run(void* out, Output_Type type, uint64_t first_sample, size_t num_samples, float gain)
+{
+    if (num_samples == 0)
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_out = out;
+        d_type = type;
+        d_gain = gain;
+        d_first_sample = first_sample;
+        d_num_samples = num_samples;
+        d_first_chunk = first_sample / d_chunk_size;
+        d_end_chunk = (first_sample + num_samples + d_chunk_size - 1) / d_chunk_size;
+        d_next_chunk = d_first_chunk;
+        d_busy = d_workers.size();
+        d_job++;
+    }
+    d_job_ready.notify_all();
+    process_chunks(0);
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_job_done.wait(lock, [&] { return d_busy == 0; });
+}
+
+
+void Gnss_Signal_Synthesizer::generate(std::complex<float>* out, uint64_t first_sample, size_t num_samples)
+{
+    run(out, Output_Type::gr_complex, first_sample, num_samples, 1.0);
+}
+
+
+void Gnss_Signal_Synthesizer::generate(std::complex<int16_t>* out, uint64_t first_sample, size_t num_samples, float gain)
+{
+    run(out, Output_Type::cshort, first_sample, num_samples, gain);
+}
+
+
+void Gnss_Signal_Synthesizer::generate(std::complex<int8_t>* out, uint64_t first_sample, size_t num_samples, float gain)
+{
+    run(out, Output_Type::cbyte, first_sample, num_samples, gain);
+}
+
+
+bool Gnss_Signal_Synthesizer::write_samples(const std::string& filename, const std::string& item_type,
+    uint64_t num_samples, float gain)
+{
+    size_t item_size;
+    if (item_type == "gr_complex")
+        {
+            item_size = sizeof(std::complex<float>);
+        }
+    else if (item_type == "cshort" || item_type == "ishort")
+        {
+            item_size = sizeof(std::complex<int16_t>);
+        }
+    else if (item_type == "cbyte" || item_type == "ibyte")
+        {
+            item_size = sizeof(std::complex<int8_t>);
+        }
+    else
+        {
+            return false;
+        }
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        {
+            return false;
+        }
+    const size_t block = 64 * d_chunk_size;
+    std::vector<char> buffer(block * item_size);
+    for (uint64_t first = 0; first < num_samples; first += block)
+        {
+            const auto n = static_cast<size_t>(std::min(static_cast<uint64_t>(block), num_samples - first));
+            if (item_size == sizeof(std::complex<float>))
+                {
+                    generate(reinterpret_cast<std::complex<float>*>(buffer.data()), first, n);
+                }
+            else if (item_size == sizeof(std::complex<int16_t>))
+                {
+                    generate(reinterpret_cast<std::complex<int16_t>*>(buffer.data()), first, n, gain);
+                }
+            else
+                {
+                    generate(reinterpret_cast<std::complex<int8_t>*>(buffer.data()), first, n, gain);
+                }
+            file.write(buffer.data(), static_cast<std::streamsize>(n * item_size));
+        }
+    return file.good();
+}
+
+
+bool Gnss_Signal_Synthesizer::write_true_observables(const std::string& filename, size_t satellite,
+    double duration_s, double period_s) const
+{
+    if (satellite >= d_satellites.size() || period_s <= 0.0)
+        {
+            return false;
+        }
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        {
+            return false;
+        }
+    const auto epochs = static_cast<uint64_t>(std::floor(duration_s / period_s)) + 1;
+    for (uint64_t epoch = 0; epoch < epochs; epoch++)
+        {
+            const double t = static_cast<double>(epoch) * period_s;
+            const auto obs = true_observables(satellite, t);
+            const std::array<double, 5> record{t, obs.carrier_phase_cycles, obs.doppler_Hz, obs.code_phase_chips, t};
+            file.write(reinterpret_cast<const char*>(record.data()), sizeof(record));
+        }
+    return file.good();
+}
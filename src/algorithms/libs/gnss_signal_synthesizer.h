@@ -0,0 +1,219 @@
+/*!
+ * \file gnss_signal_synthesizer.h
+ * \brief Multithreaded synthesizer of multi-satellite GNSS baseband signals
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SIGNAL_SYNTHESIZER_H
+#define GNSS_SDR_GNSS_SIGNAL_SYNTHESIZER_H
+
+#include <complex>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief One satellite signal of a synthesized scenario
+ */
+struct Gnss_Scenario_Satellite
+{
+    std::string system{"G"};        // "G", "E" or "C"
+    std::string signal{"1C"};       // "1C", "L5", "1B", "5X", "7X" or "B1"
+    uint32_t PRN{1};                //
+    double CN0_dB_Hz{45.0};         // carrier to noise density ratio [dB-Hz]
+    double doppler_Hz{0.0};         // carrier Doppler at t = 0 [Hz]
+    double doppler_rate_Hz_s{0.0};  // carrier Doppler rate [Hz/s]
+    double code_phase_chips{0.0};   // primary code phase at t = 0 [chips]
+    double if_Hz{0.0};              // carrier offset from the center of the stream [Hz]
+    std::string nav_symbols;        // '0' / '1' data symbols, sent cyclically
+};
+
+
+/*!
+ * \brief A set of satellites seen by a receiver sampling at fs_hz
+ */
+struct Gnss_Scenario
+{
+    std::vector<Gnss_Scenario_Satellite> satellites;
+    double fs_hz{4e6};
+    bool noise_flag{true};  // add complex white noise of unit power
+    bool data_flag{true};   // random data symbols for satellites without nav_symbols
+    uint64_t seed{0};
+};
+
+
+/*!
+ * \brief True signal parameters of one satellite at a given time
+ */
+struct Gnss_Scenario_Observables
+{
+    double doppler_Hz;
+    double carrier_phase_cycles;
+    double code_phase_chips;  // within the primary code period
+};
+
+
+/*!
+ * \brief Synthesizes the complex baseband signal of a Gnss_Scenario.
+ *
+ * The code and carrier phases of each satellite are computed from the absolute
+ * sample index, so any span of samples can be generated independently of the
+ * others. The output is split in chunks of chunk_size samples, aligned to
+ * multiples of chunk_size, which are distributed among the worker threads.
+ * Within a chunk the codes are resampled and the carriers are generated with
+ * VOLK kernels. The noise of each chunk is drawn from a generator seeded with
+ * the scenario seed and the chunk index, so the output does not depend on the
+ * number of threads nor on how the stream is split in calls to generate().
+ *
+ * With noise_flag set, the noise has unit power and the amplitude of each
+ * satellite gives the requested C/N0. Otherwise, each satellite has unit power.
+ */
+class Gnss_Signal_Synthesizer
+{
+public:
+    /*!
+     * \brief Throws std::invalid_argument if a satellite signal is not supported.
+     * n_threads = 0 uses all the hardware threads.
+     */
+    explicit Gnss_Signal_Synthesizer(const Gnss_Scenario& scenario,
+        unsigned int n_threads = 0,
+        size_t chunk_size = 4096);
+
+    ~Gnss_Signal_Synthesizer();
+
+    Gnss_Signal_Synthesizer(const Gnss_Signal_Synthesizer&) = delete;
+    Gnss_Signal_Synthesizer& operator=(const Gnss_Signal_Synthesizer&) = delete;
+
+    /*!
+     * \brief Writes the samples [first_sample, first_sample + num_samples)
+     */
+    void generate(std::complex<float>* out, uint64_t first_sample, size_t num_samples);
+
+    /*!
+     * \brief As above, scaled by gain and saturated to 16 bit I/Q
+     */
+    void generate(std::complex<int16_t>* out, uint64_t first_sample, size_t num_samples, float gain);
+
+    /*!
+     * \brief As above, scaled by gain and saturated to 8 bit I/Q
+     */
+    void generate(std::complex<int8_t>* out, uint64_t first_sample, size_t num_samples, float gain);
+
+    /*!
+     * \brief Writes the first num_samples samples to a file of "gr_complex",
+     * "cshort" / "ishort" or "cbyte" / "ibyte" interleaved I/Q items
+     */
+    bool write_samples(const std::string& filename, const std::string& item_type,
+        uint64_t num_samples, float gain);
+
+    /*!
+     * \brief Writes the true observables of a satellite every period_s seconds,
+     * in the format read by Tracking_True_Obs_Reader
+     */
+    bool write_true_observables(const std::string& filename, size_t satellite,
+        double duration_s, double period_s) const;
+
+    Gnss_Scenario_Observables true_observables(size_t satellite, double t) const;
+
+    inline size_t chunk_size() const
+    {
+        return d_chunk_size;
+    }
+
+    inline unsigned int threads() const
+    {
+        return static_cast<unsigned int>(d_scratch.size());
+    }
+
+private:
+    // One spreading code of a signal and the scalars that modulate it
+    struct Component
+    {
+        std::vector<float> code;
+        std::vector<float> secondary;
+        std::complex<float> weight;
+        bool data;
+    };
+
+    struct Satellite
+    {
+        std::vector<Component> components;
+        std::vector<float> symbols;
+        double amplitude;
+        double carrier_freq_hz;
+        double code_rate_cps;  // of code samples (sub-chips for BOC signals)
+        double code_length;    // in code samples
+        double samples_per_chip;
+        uint32_t periods_per_symbol;
+    };
+
+    struct Scratch
+    {
+        std::vector<std::complex<float>> out;
+        std::vector<std::complex<float>> carrier;
+        std::vector<float> code;
+        std::vector<float> i;
+        std::vector<float> q;
+    };
+
+    enum class Output_Type
+    {
+        gr_complex,
+        cshort,
+        cbyte
+    };
+
+    void init_satellite(const Gnss_Scenario_Satellite& sat, size_t index, Satellite& out) const;
+    void run(void* out, Output_Type type, uint64_t first_sample, size_t num_samples, float gain);
+    void process_chunks(size_t worker);
+    void synthesize_chunk(uint64_t chunk, Scratch& scratch);
+    void worker_loop(size_t worker);
+
+    Gnss_Scenario d_scenario;
+    std::vector<Satellite> d_satellites;
+    std::vector<Scratch> d_scratch;  // one per thread, the caller uses the first one
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_job_ready;
+    std::condition_variable d_job_done;
+
+    // Current job, protected by d_mutex
+    void* d_out;
+    Output_Type d_type;
+    uint64_t d_first_sample;
+    uint64_t d_first_chunk;
+    uint64_t d_end_chunk;
+    uint64_t d_next_chunk;
+    uint64_t d_job;
+    size_t d_num_samples;
+    size_t d_busy;
+    float d_gain;
+
+    size_t d_chunk_size;
+    bool d_stop;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SIGNAL_SYNTHESIZER_H
@@ -86,14 +86,16 @@ Pass_Through::Pass_Through(const ConfigurationInterface* configuration, const st
             item_size_ = sizeof(float);
         }
 
-    kludge_copy_ = gr::blocks::copy::make(item_size_);
+    // Without a block, the flowgraph connects the upstream block directly to
+    // the downstream ones. A copy is only kept to limit the buffer size.
     const uint64_t max_source_buffer_samples = configuration->property("GNSS-SDR.max_source_buffer_samples", 0);
     if (max_source_buffer_samples > 0)
         {
+            kludge_copy_ = gr::blocks::copy::make(item_size_);
             kludge_copy_->set_max_output_buffer(max_source_buffer_samples);
             LOG(INFO) << "Set signal conditioner max output buffer to " << max_source_buffer_samples;
+            DLOG(INFO) << "kludge_copy(" << kludge_copy_->unique_id() << ")";
         }
-    DLOG(INFO) << "kludge_copy(" << kludge_copy_->unique_id() << ")";
     if (in_streams_ > 1)
         {
             LOG(ERROR) << "This implementation only supports one input stream";
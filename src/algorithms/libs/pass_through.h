@@ -38,6 +38,11 @@ class ConfigurationInterface;
 
 /*!
  * \brief This class implements a block that connects input and output (does nothing)
+ *
+ * Unless the spectrum has to be inverted or the output buffer limited, there
+ * is no GNU Radio block behind it and get_left_block() and get_right_block()
+ * return a null pointer, so the samples are not copied. Signal conditioners
+ * and the flowgraph skip it when connecting their blocks.
  */
 class Pass_Through : public GNSSBlockInterface
 {
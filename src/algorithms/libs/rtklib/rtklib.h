@@ -253,6 +253,8 @@ const int MAXSTA = 255;
 const int MAXOBS = 64;  //!<    max number of obs in an epoch
 #endif
 
+const int NORBCOEF = 8;  //!<    number of chebyshev coefficients of the orbit and clock cache
+
 const int MAXRCV = 64;               //!<    max receiver number (1 to MAXRCV)
 const int MAXOBSTYPE = 64;           //!<    max number of obs type in RINEX
 const double MAXDTOE = 7200.0;       //!<    max time difference to GPS Toe (s)
@@ -751,6 +753,24 @@ typedef struct
 } pppcorr_t;
 
 
+typedef struct
+{                             /* short-arc fit of satellite orbit and clock */
+    int valid;                /* arc fitted (0:no,1:yes) */
+    int k;                    /* arc index from toe */
+    eph_t eph;                /* fitted GPS/QZS/GAL/BDS ephemeris */
+    geph_t geph;              /* fitted GLONASS ephemeris */
+    double coef[4][NORBCOEF]; /* chebyshev coefficients {x,y,z (m),clock bias (s)} */
+} orbarc_t;
+
+
+typedef struct
+{                         /* satellite orbit and clock cache type */
+    orbarc_t arc[MAXSAT]; /* current arc of each satellite */
+    unsigned int nfit;    /* number of fitted arcs */
+    unsigned int neval;   /* number of evaluations */
+} orbcache_t;
+
+
 typedef struct
 {                                 /* navigation data type */
     int n, nmax;                  /* number of broadcast ephemeris */
@@ -797,6 +817,7 @@ typedef struct
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
     lexion_t lexion;              /* LEX ionosphere correction */
     pppcorr_t pppcorr;            /* ppp corrections */
+    orbcache_t *orbcache;         /* broadcast orbit and clock cache (nullptr: not used) */
 } nav_t;
 
 
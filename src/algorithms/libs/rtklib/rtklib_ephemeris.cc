@@ -34,6 +34,7 @@
 #include "rtklib_preceph.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_sbas.h"
+#include <glog/logging.h>
 
 /* constants -----------------------------------------------------------------*/
 
@@ -54,6 +55,7 @@ const double COS_5 = 0.9961946980917456;  /* cos(-5.0 deg) */
 const double ERREPH_GLO = 5.0;    /* error of glonass ephemeris (m) */
 const double TSTEP = 60.0;        /* integration step glonass ephemeris (s) */
 const double RTOL_KEPLER = 1e-13; /* relative tolerance for Kepler equation */
+const double ORBARC = TSTEP;      /* arc of the orbit and clock cache (s) */
 
 const double DEFURASSR = 0.15;                       /* default accuracy of ssr corr (m) */
 const double MAXECORSSR = 10.0;                      /* max orbit correction of ssr (m) */
@@ -174,7 +176,10 @@ double eph2clk(gtime_t time, const eph_t *eph)
     double t;
     int i;
 
-    trace(4, "eph2clk : time=%s sat=%2d\n", time_str(time, 3), eph->sat);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "eph2clk : time=%s sat=%2d\n", time_str(time, 3), eph->sat);
+        }
 
     t = timediffweekcrossover(time, eph->toc);
 
@@ -391,7 +396,10 @@ double geph2clk(gtime_t time, const geph_t *geph)
     double t;
     int i;
 
-    trace(4, "geph2clk: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "geph2clk: time=%s sat=%2d\n", time_str(time, 3), geph->sat);
+        }
 
     t = timediff(time, geph->toe);
 
@@ -514,7 +522,10 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
     int i;
     int j = -1;
 
-    trace(4, "seleph  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "seleph  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+        }
 
     switch (satsys(sat, nullptr))
         {
@@ -576,7 +587,10 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav)
     int i;
     int j = -1;
 
-    trace(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
+        }
 
     for (i = 0; i < nav->ng; i++)
         {
@@ -648,6 +662,196 @@ seph_t *selseph(gtime_t time, int sat, const nav_t *nav)
 }
 
 
+/* compare ephemeris parameters used by eph2pos() ---------------------------*/
+int sameeph(const eph_t *eph1, const eph_t *eph2)
+{
+    return eph1->sat == eph2->sat && eph1->iode == eph2->iode &&
+           timediff(eph1->toe, eph2->toe) == 0.0 && timediff(eph1->toc, eph2->toc) == 0.0 &&
+           eph1->A == eph2->A && eph1->e == eph2->e && eph1->i0 == eph2->i0 &&
+           eph1->OMG0 == eph2->OMG0 && eph1->omg == eph2->omg && eph1->M0 == eph2->M0 &&
+           eph1->deln == eph2->deln && eph1->OMGd == eph2->OMGd && eph1->idot == eph2->idot &&
+           eph1->crc == eph2->crc && eph1->crs == eph2->crs && eph1->cuc == eph2->cuc &&
+           eph1->cus == eph2->cus && eph1->cic == eph2->cic && eph1->cis == eph2->cis &&
+           eph1->toes == eph2->toes && eph1->f0 == eph2->f0 && eph1->f1 == eph2->f1 &&
+           eph1->f2 == eph2->f2;
+}
+
+
+/* compare glonass ephemeris parameters used by geph2pos() -------------------*/
+int samegeph(const geph_t *geph1, const geph_t *geph2)
+{
+    int i;
+
+    if (geph1->sat != geph2->sat || timediff(geph1->toe, geph2->toe) != 0.0 ||
+        geph1->taun != geph2->taun || geph1->gamn != geph2->gamn)
+        {
+            return 0;
+        }
+    for (i = 0; i < 3; i++)
+        {
+            if (geph1->pos[i] != geph2->pos[i] || geph1->vel[i] != geph2->vel[i] ||
+                geph1->acc[i] != geph2->acc[i])
+                {
+                    return 0;
+                }
+        }
+    return 1;
+}
+
+
+/* fit orbit and clock arc -----------------------------------------------------
+ * fit chebyshev polynomials to the satellite position and clock bias computed
+ * with eph (or geph, if eph is null) over ORBARC seconds from t0. the values
+ * are interpolated at the NORBCOEF chebyshev nodes of the arc
+ *-----------------------------------------------------------------------------*/
+void orbfit(orbarc_t *arc, gtime_t t0, const eph_t *eph, const geph_t *geph)
+{
+    double f[4][NORBCOEF];
+    double c[NORBCOEF][NORBCOEF];
+    double rs[3];
+    double dts;
+    double var;
+    double a;
+    int i;
+    int j;
+    int k;
+
+    for (j = 0; j < NORBCOEF; j++)
+        {
+            a = GNSS_PI * (j + 0.5) / NORBCOEF;
+            for (k = 0; k < NORBCOEF; k++)
+                {
+                    c[k][j] = cos(k * a);
+                }
+            rs[0] = rs[1] = rs[2] = dts = 0.0;
+            if (eph)
+                {
+                    eph2pos(timeadd(t0, ORBARC * (1.0 + cos(a)) / 2.0), eph, rs, &dts, &var);
+                }
+            else
+                {
+                    geph2pos(timeadd(t0, ORBARC * (1.0 + cos(a)) / 2.0), geph, rs, &dts, &var);
+                }
+            for (i = 0; i < 3; i++)
+                {
+                    f[i][j] = rs[i];
+                }
+            f[3][j] = dts;
+        }
+    for (i = 0; i < 4; i++)
+        {
+            for (k = 0; k < NORBCOEF; k++)
+                {
+                    arc->coef[i][k] = 0.0;
+                    for (j = 0; j < NORBCOEF; j++)
+                        {
+                            arc->coef[i][k] += f[i][j] * c[k][j];
+                        }
+                    arc->coef[i][k] *= (k == 0 ? 1.0 : 2.0) / NORBCOEF;
+                }
+        }
+}
+
+
+/* satellite position and clock by orbit and clock cache -----------------------
+ * compute satellite position, velocity and clock with the arc of the cache
+ * that contains time, fitting it first if it is not in the cache or if it was
+ * fitted with other ephemeris. the arcs are aligned with toe and with the
+ * integration steps of the glonass orbits, so the fitted functions are smooth
+ * over each arc
+ * args   : gtime_t time     I   time (gpst)
+ *          eph_t  *eph      I   broadcast ephemeris (null for glonass)
+ *          geph_t *geph     I   glonass ephemeris (used if eph is null)
+ *          orbcache_t *cache IO orbit and clock cache
+ *          double *rs       O   satellite position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double *dts      O   satellite clock {bias,drift} (s|s/s)
+ * return : none
+ * notes  : the cache is not thread-safe. the approximation errors are below
+ *          0.1 mm in position (see the unit tests)
+ *-----------------------------------------------------------------------------*/
+void orbcachepos(gtime_t time, const eph_t *eph, const geph_t *geph,
+    orbcache_t *cache, double *rs, double *dts)
+{
+    orbarc_t *arc;
+    gtime_t toe;
+    double T[NORBCOEF];
+    double dT[NORBCOEF];
+    double t;
+    double x;
+    double v;
+    double dv;
+    int sat;
+    int i;
+    int k;
+
+    if (eph)
+        {
+            sat = eph->sat;
+            toe = eph->toe;
+            t = timediffweekcrossover(time, toe);
+        }
+    else
+        {
+            sat = geph->sat;
+            toe = geph->toe;
+            t = timediff(time, toe);
+        }
+    arc = cache->arc + sat - 1;
+    k = static_cast<int>(floor(t / ORBARC));
+
+    if (!arc->valid || arc->k != k || (eph ? !sameeph(eph, &arc->eph) : !samegeph(geph, &arc->geph)))
+        {
+            trace(4, "orbcachepos: fit arc sat=%2d k=%d\n", sat, k);
+
+            orbfit(arc, timeadd(toe, k * ORBARC), eph, geph);
+            if (eph)
+                {
+                    arc->eph = *eph;
+                }
+            else
+                {
+                    arc->geph = *geph;
+                }
+            arc->k = k;
+            arc->valid = 1;
+            cache->nfit++;
+        }
+    x = 2.0 * (t - k * ORBARC) / ORBARC - 1.0;
+
+    /* chebyshev polynomials and their derivatives */
+    T[0] = 1.0;
+    T[1] = x;
+    dT[0] = 0.0;
+    dT[1] = 1.0;
+    for (k = 2; k < NORBCOEF; k++)
+        {
+            T[k] = 2.0 * x * T[k - 1] - T[k - 2];
+            dT[k] = 2.0 * T[k - 1] + 2.0 * x * dT[k - 1] - dT[k - 2];
+        }
+    for (i = 0; i < 4; i++)
+        {
+            for (k = 0, v = dv = 0.0; k < NORBCOEF; k++)
+                {
+                    v += arc->coef[i][k] * T[k];
+                    dv += arc->coef[i][k] * dT[k];
+                }
+            dv *= 2.0 / ORBARC;
+            if (i < 3)
+                {
+                    rs[i] = v;
+                    rs[i + 3] = dv;
+                }
+            else
+                {
+                    dts[0] = v;
+                    dts[1] = dv;
+                }
+        }
+    cache->neval++;
+}
+
+
 /* satellite clock with broadcast ephemeris ----------------------------------*/
 int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *dts)
@@ -657,7 +861,10 @@ int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     seph_t *seph;
     int sys;
 
-    trace(4, "ephclk  : time=%s sat=%2d\n", time_str(time, 3), sat);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "ephclk  : time=%s sat=%2d\n", time_str(time, 3), sat);
+        }
 
     sys = satsys(sat, nullptr);
 
@@ -707,7 +914,10 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int i;
     int sys;
 
-    trace(4, "ephpos  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "ephpos  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
+        }
 
     sys = satsys(sat, nullptr);
 
@@ -719,6 +929,13 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
+            if (nav->orbcache && eph->A > 0.0)
+                {
+                    orbcachepos(time, eph, nullptr, nav->orbcache, rs, dts);
+                    *var = var_uraeph(eph->sva);
+                    *svh = eph->svh;
+                    return 1;
+                }
 
             eph2pos(time, eph, rs, dts, var);
             time = timeadd(time, tt);
@@ -731,6 +948,13 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
+            if (nav->orbcache)
+                {
+                    orbcachepos(time, nullptr, geph, nav->orbcache, rs, dts);
+                    *var = std::pow(ERREPH_GLO, 2.0);
+                    *svh = geph->svh;
+                    return 1;
+                }
             geph2pos(time, geph, rs, dts, var);
             time = timeadd(time, tt);
             geph2pos(time, geph, rst, dtst, var);
@@ -964,7 +1188,10 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
     const nav_t *nav, double *rs, double *dts, double *var,
     int *svh)
 {
-    trace(4, "satpos  : time=%s sat=%2d ephopt=%d\n", time_str(time, 3), sat, ephopt);
+    if (VLOG_IS_ON(4))
+        {
+            trace(4, "satpos  : time=%s sat=%2d ephopt=%d\n", time_str(time, 3), sat, ephopt);
+        }
 
     *svh = 0;
 
@@ -1023,7 +1250,7 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
 void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
     int ephopt, double *rs, double *dts, double *var, int *svh)
 {
-    gtime_t time[MAXOBS] = {};
+    gtime_t time[2 * MAXOBS] = {};
     double dt;
     double pr;
     int i;
@@ -1031,7 +1258,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
 
     trace(3, "satposs : teph=%s n=%d ephopt=%d\n", time_str(teph, 3), n, ephopt);
 
-    for (i = 0; i < n && i < MAXOBS; i++)
+    for (i = 0; i < n && i < 2 * MAXOBS; i++)
         {
             for (j = 0; j < 6; j++)
                 {
@@ -1087,7 +1314,7 @@ void satposs(gtime_t teph, const obsd_t *obs, int n, const nav_t *nav,
                     *var = std::pow(STD_BRDCCLK, 2.0);
                 }
         }
-    for (i = 0; i < n && i < MAXOBS; i++)
+    for (i = 0; i < n && i < 2 * MAXOBS && VLOG_IS_ON(4); i++)
         {
             trace(4, "%s sat=%2d rs=%13.3f %13.3f %13.3f dts=%12.3f var=%7.3f svh=%02X\n",
                 time_str(time[i], 6), obs[i].sat, rs[i * 6], rs[1 + i * 6], rs[2 + i * 6],
@@ -55,6 +55,12 @@ void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
 eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav);
 geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav);
 seph_t *selseph(gtime_t time, int sat, const nav_t *nav);
+int sameeph(const eph_t *eph1, const eph_t *eph2);
+int samegeph(const geph_t *geph1, const geph_t *geph2);
+void orbfit(orbarc_t *arc, gtime_t t0, const eph_t *eph, const geph_t *geph);
+// satellite position and clock by orbit and clock cache
+void orbcachepos(gtime_t time, const eph_t *eph, const geph_t *geph,
+    orbcache_t *cache, double *rs, double *dts);
 int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *dts);
 // satellite position and clock by broadcast ephemeris
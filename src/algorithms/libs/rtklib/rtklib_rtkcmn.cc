@@ -2062,11 +2062,11 @@ void time2str(gtime_t t, char *s, int n)
  * args   : gtime_t t        I   gtime_t struct
  *          int    n         I   number of decimals
  * return : time string
- * notes  : not reentrant, do not use multiple in a function
+ * notes  : not reentrant within a thread, do not use multiple in a function
  *-----------------------------------------------------------------------------*/
 char *time_str(gtime_t t, int n)
 {
-    static char buff[64];
+    thread_local char buff[64];
     time2str(t, buff, n);
     return buff;
 }
@@ -2541,14 +2541,14 @@ void nut_iau1980(double t, const double *f, double *dpsi, double *deps)
  *                               (NULL: no output)
  * return : none
  * note   : see ref [3] chap 5
- *          not thread-safe
+ *          the last transformation is cached per thread
  *-----------------------------------------------------------------------------*/
 void eci2ecef(gtime_t tutc, const double *erpv, double *U, double *gmst)
 {
     const double ep2000[] = {2000, 1, 1, 12, 0, 0};
-    static gtime_t tutc_;
-    static double U_[9];
-    static double gmst_;
+    thread_local gtime_t tutc_;
+    thread_local double U_[9];
+    thread_local double gmst_;
     gtime_t tgps;
     double eps;
     double ze;
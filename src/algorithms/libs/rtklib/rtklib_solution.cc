@@ -1514,7 +1514,7 @@ int outenu(unsigned char *buff, const char *s, const sol_t *sol,
 /* output solution in the form of nmea RMC sentence --------------------------*/
 int outnmea_rmc(unsigned char *buff, const sol_t *sol)
 {
-    static double dirp = 0.0;
+    thread_local double dirp = 0.0;
     gtime_t time;
     double ep[6];
     double pos[3];
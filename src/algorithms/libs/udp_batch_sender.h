@@ -0,0 +1,290 @@
+/*!
+ * \file udp_batch_sender.h
+ * \brief Sends batches of UDP datagrams to one or multiple endpoints
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_BATCH_SENDER_H
+#define GNSS_SDR_UDP_BATCH_SENDER_H
+
+#include <boost/asio.hpp>
+#include <boost/system/error_code.hpp>
+#include <glog/logging.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+/*!
+ * \brief Queues datagrams and sends them to all the endpoints at once.
+ *
+ * The sockets are opened once. Each datagram is serialized into a buffer
+ * that is reused for the whole life of the object, and the queued datagrams
+ * are sent with a single sendmmsg() call on Linux. The queue is sent when
+ * it is full, when the oldest datagram has waited max_latency_ms, or on
+ * destruction. If max_latency_ms > 0, a thread sends the queue when it is
+ * due, even if no more datagrams are pushed. Otherwise, the queue is sent at
+ * every call to send_if_due().
+ */
+class Udp_Batch_Sender
+{
+public:
+    Udp_Batch_Sender(const std::vector<boost::asio::ip::udp::endpoint>& endpoints,
+        int max_latency_ms,
+        size_t max_datagrams = 64) : d_socket_v4{d_io_context},
+                                     d_socket_v6{d_io_context},
+                                     d_endpoints(endpoints),
+                                     d_buffers(max_datagrams > 0 ? max_datagrams : 1),
+                                     d_max_latency(std::chrono::milliseconds(max_latency_ms)),
+                                     d_pending(0),
+                                     d_stop(false)
+    {
+        for (const auto& endpoint : d_endpoints)
+            {
+                if (endpoint.protocol() == boost::asio::ip::udp::v4() && !d_socket_v4.is_open())
+                    {
+                        d_socket_v4.open(boost::asio::ip::udp::v4(), d_error);
+                    }
+                if (endpoint.protocol() == boost::asio::ip::udp::v6() && !d_socket_v6.is_open())
+                    {
+                        d_socket_v6.open(boost::asio::ip::udp::v6(), d_error);
+                    }
+                if (d_error)
+                    {
+                        LOG(WARNING) << "Error opening the UDP socket for " << endpoint << ": " << d_error.message();
+                        d_error.clear();
+                    }
+            }
+        if (max_latency_ms > 0)
+            {
+                d_flush_thread = std::thread(&Udp_Batch_Sender::flush_when_due, this);
+            }
+    }
+
+    ~Udp_Batch_Sender()
+    {
+        if (d_flush_thread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(d_mutex);
+                    d_stop = true;
+                }
+                d_cv.notify_one();
+                d_flush_thread.join();
+            }
+        flush();
+    }
+
+    /*!
+     * \brief Empty buffer where the next datagram is serialized. It is not
+     * part of the queue until push() is called.
+     */
+    inline std::string& next_datagram()
+    {
+        d_next.clear();
+        return d_next;
+    }
+
+    /*!
+     * \brief Queues the datagram written in next_datagram(), and sends
+     * the queue if it is full. Returns false if sending failed.
+     */
+    inline bool push()
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        // The buffers are swapped, so their memory is reused
+        d_buffers[d_pending].swap(d_next);
+        d_pending++;
+        if (d_pending == 1)
+            {
+                d_oldest = std::chrono::steady_clock::now();
+                d_cv.notify_one();
+            }
+        if (d_pending == d_buffers.size())
+            {
+                return flush_locked();
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Sends the queue if the oldest datagram has waited max_latency_ms
+     */
+    inline bool send_if_due()
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (d_pending > 0 && std::chrono::steady_clock::now() - d_oldest >= d_max_latency)
+            {
+                return flush_locked();
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Sends all the queued datagrams to all the endpoints
+     */
+    inline bool flush()
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        return flush_locked();
+    }
+
+private:
+    inline bool flush_locked()
+    {
+        if (d_pending == 0)
+            {
+                return true;
+            }
+        bool sent = true;
+#if defined(__linux__)
+        d_iov.resize(d_pending);
+        for (size_t i = 0; i < d_pending; i++)
+            {
+                d_iov[i].iov_base = &d_buffers[i][0];
+                d_iov[i].iov_len = d_buffers[i].size();
+            }
+        sent = send_batch(d_socket_v4, boost::asio::ip::udp::v4()) && sent;
+        sent = send_batch(d_socket_v6, boost::asio::ip::udp::v6()) && sent;
+#else
+        for (size_t i = 0; i < d_pending; i++)
+            {
+                for (const auto& endpoint : d_endpoints)
+                    {
+                        auto& socket = (endpoint.protocol() == boost::asio::ip::udp::v4()) ? d_socket_v4 : d_socket_v6;
+                        socket.send_to(boost::asio::buffer(d_buffers[i]), endpoint, 0, d_error);
+                        if (d_error)
+                            {
+                                LOG(WARNING) << "Error sending a UDP datagram to " << endpoint << ": " << d_error.message();
+                                sent = false;
+                            }
+                    }
+            }
+#endif
+        d_pending = 0;
+        return sent;
+    }
+
+    // Sends the queue when the oldest datagram has waited max_latency_ms
+    void flush_when_due()
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        while (!d_stop)
+            {
+                if (d_pending == 0)
+                    {
+                        d_cv.wait(lock);
+                    }
+                else if (std::chrono::steady_clock::now() - d_oldest >= d_max_latency)
+                    {
+                        flush_locked();
+                    }
+                else
+                    {
+                        d_cv.wait_until(lock, d_oldest + d_max_latency);
+                    }
+            }
+    }
+
+#if defined(__linux__)
+    inline bool send_batch(boost::asio::ip::udp::socket& socket, const boost::asio::ip::udp& protocol)
+    {
+        d_messages.clear();
+        for (size_t i = 0; i < d_pending; i++)
+            {
+                for (auto& endpoint : d_endpoints)
+                    {
+                        if (endpoint.protocol() == protocol)
+                            {
+                                mmsghdr message{};
+                                message.msg_hdr.msg_name = endpoint.data();
+                                message.msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+                                message.msg_hdr.msg_iov = &d_iov[i];
+                                message.msg_hdr.msg_iovlen = 1;
+                                d_messages.push_back(message);
+                            }
+                    }
+            }
+        if (d_messages.empty())
+            {
+                return true;
+            }
+        if (!socket.is_open())
+            {
+                LOG(WARNING) << "The UDP socket is not open, " << d_messages.size() << " datagrams not sent";
+                return false;
+            }
+        size_t sent = 0;
+        while (sent < d_messages.size())
+            {
+                const int ret = ::sendmmsg(socket.native_handle(), &d_messages[sent], static_cast<unsigned int>(d_messages.size() - sent), 0);
+                if (ret < 0)
+                    {
+                        if (errno == EINTR)
+                            {
+                                continue;
+                            }
+                        LOG(WARNING) << "Error sending UDP datagrams with sendmmsg(): " << std::strerror(errno)
+                                     << ". " << d_messages.size() - sent << " datagrams not sent";
+                        return false;
+                    }
+                sent += static_cast<size_t>(ret);
+            }
+        return true;
+    }
+
+    std::vector<mmsghdr> d_messages;
+    std::vector<iovec> d_iov;
+#endif
+
+    b_io_context d_io_context;
+    boost::asio::ip::udp::socket d_socket_v4;
+    boost::asio::ip::udp::socket d_socket_v6;
+    boost::system::error_code d_error;
+    std::vector<boost::asio::ip::udp::endpoint> d_endpoints;
+    std::vector<std::string> d_buffers;
+    std::string d_next;
+    std::chrono::steady_clock::time_point d_oldest;
+    std::chrono::steady_clock::duration d_max_latency;
+    std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::thread d_flush_thread;
+    size_t d_pending;
+    bool d_stop;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_BATCH_SENDER_H
@@ -25,6 +25,7 @@
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <matio.h>
+#include <algorithm>  // for min
 #include <array>
 #include <cmath>      // for round
 #include <cstdlib>    // for size_t, llabs
@@ -70,6 +71,7 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_) : gr::block(
                                                                           gr::io_signature::make(conf_.nchannels_in, conf_.nchannels_in, sizeof(Gnss_Synchro)),
                                                                           gr::io_signature::make(conf_.nchannels_out, conf_.nchannels_out, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("Observables", this->name());
     // PVT input message port
     this->message_port_register_in(pmt::mp("pvt_to_observables"));
     this->set_msg_handler(pmt::mp("pvt_to_observables"),
@@ -379,7 +381,24 @@ bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint3
 {
     int32_t nearest_element = -1;
     int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
-    for (uint32_t i = 0; i < d_gnss_synchro_history->size(ch); i++)
+    // The history of a channel is sorted by Tracking_sample_counter, so the
+    // nearest element is found by bisection (on ties, the oldest one is kept)
+    const uint32_t history_size = d_gnss_synchro_history->size(ch);
+    uint32_t low = 0;
+    uint32_t high = history_size;
+    while (low < high)
+        {
+            const uint32_t mid = low + (high - low) / 2;
+            if (d_gnss_synchro_history->get(ch, mid).Tracking_sample_counter < rx_clock)
+                {
+                    low = mid + 1;
+                }
+            else
+                {
+                    high = mid;
+                }
+        }
+    for (uint32_t i = (low > 0 ? low - 1 : 0); i < std::min(low + 1, history_size); i++)
         {
             const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, i).Tracking_sample_counter));
             if (old_abs_diff > abs_diff)
@@ -469,6 +488,26 @@ bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint3
 }
 
 
+bool hybrid_observables_gs::tracking_history_covers(uint64_t last_rx_clock, uint64_t next_rx_clock) const
+{
+    // Channels whose history ends before the last epoch are not being tracked
+    // anymore, so they do not hold back the next epoch
+    for (uint32_t n = 0; n < d_nchannels_out; n++)
+        {
+            const uint32_t history_size = d_gnss_synchro_history->size(n);
+            if (history_size > 0)
+                {
+                    const uint64_t latest = d_gnss_synchro_history->get(n, history_size - 1).Tracking_sample_counter;
+                    if (latest >= last_rx_clock and latest < next_rx_clock)
+                        {
+                            return false;
+                        }
+                }
+        }
+    return true;
+}
+
+
 void hybrid_observables_gs::forecast(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items_required)
 {
     for (int32_t n = 0; n < static_cast<int32_t>(d_nchannels_in) - 1; n++)
@@ -622,22 +661,14 @@ void hybrid_observables_gs::smooth_pseudoranges(std::vector<Gnss_Synchro> &data)
 }
 
 
-int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)),
+int hybrid_observables_gs::general_work(int noutput_items,
     gr_vector_int &ninput_items, gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[d_nchannels_in - 1]));
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
 
-    // Push receiver clock into history buffer (connected to the last of the input channels)
-    // The clock buffer gives time to the channels to compute the tracking observables
-    if (ninput_items[d_nchannels_in - 1] > 0)
-        {
-            d_Rx_clock_buffer.push_back(in[d_nchannels_in - 1][0].Tracking_sample_counter);
-            // Consume one item from the clock channel (last of the input channels)
-            consume(static_cast<int32_t>(d_nchannels_in) - 1, 1);
-        }
-
     // Push the tracking observables into buffers to allow the observable interpolation at the desired Rx clock
     for (uint32_t n = 0; n < d_nchannels_out; n++)
         {
@@ -662,9 +693,30 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             consume(n, ninput_items[n]);
         }
 
-    if (d_Rx_clock_buffer.size() == d_Rx_clock_buffer.capacity())
+    // Push receiver clock into history buffer (connected to the last of the input channels)
+    // The clock buffer gives time to the channels to compute the tracking observables.
+    // When replaying files faster than real time, several clock items are usually waiting, so all the
+    // epochs that can be interpolated with the tracking history already available are produced here,
+    // instead of returning to the scheduler once per epoch.
+    const int32_t clock_items = ninput_items[d_nchannels_in - 1];
+    int32_t consumed_clock_items = 0;
+    int32_t produced_epochs = 0;
+    std::vector<Gnss_Synchro> epoch_data(d_nchannels_out);
+    while (consumed_clock_items < clock_items and produced_epochs < noutput_items)
         {
-            std::vector<Gnss_Synchro> epoch_data(d_nchannels_out);
+            if (consumed_clock_items > 0 and d_Rx_clock_buffer.full() and
+                !tracking_history_covers(d_Rx_clock_buffer.front(), d_Rx_clock_buffer[1]))
+                {
+                    // the next epoch would need tracking observables not received yet
+                    break;
+                }
+            d_Rx_clock_buffer.push_back(in[d_nchannels_in - 1][consumed_clock_items].Tracking_sample_counter);
+            consumed_clock_items++;
+            if (!d_Rx_clock_buffer.full())
+                {
+                    continue;
+                }
+
             int32_t n_valid = 0;
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
@@ -711,7 +763,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             // output the observables set to the PVT block
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
-                    out[n][0] = epoch_data[n];
+                    out[n][produced_epochs] = epoch_data[n];
                 }
             // report channel status every second
             d_T_status_report_timer_ms += d_T_rx_step_ms;
@@ -734,19 +786,19 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                             double tmp_double;
                             for (uint32_t i = 0; i < d_nchannels_out; i++)
                                 {
-                                    tmp_double = out[i][0].RX_time;
+                                    tmp_double = out[i][produced_epochs].RX_time;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].interp_TOW_ms / 1000.0;
+                                    tmp_double = out[i][produced_epochs].interp_TOW_ms / 1000.0;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_Doppler_hz;
+                                    tmp_double = out[i][produced_epochs].Carrier_Doppler_hz;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_phase_rads / TWO_PI;
+                                    tmp_double = out[i][produced_epochs].Carrier_phase_rads / TWO_PI;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Pseudorange_m;
+                                    tmp_double = out[i][produced_epochs].Pseudorange_m;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].PRN);
+                                    tmp_double = static_cast<double>(out[i][produced_epochs].PRN);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].Flag_valid_pseudorange);
+                                    tmp_double = static_cast<double>(out[i][produced_epochs].Flag_valid_pseudorange);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                                 }
                         }
@@ -759,10 +811,11 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 
             if (n_valid > 0)
                 {
-                    // LOG(INFO) << "OBS: diff time: " << out[0][0].RX_time * 1000.0 - old_time_debug;
-                    // old_time_debug = out[0][0].RX_time * 1000.0;
-                    return 1;
+                    // epochs without any valid observable are not sent to the PVT block
+                    produced_epochs++;
                 }
         }
-    return 0;
+    // Consume the clock items from the clock channel (last of the input channels)
+    consume(static_cast<int32_t>(d_nchannels_in) - 1, consumed_clock_items);
+    return produced_epochs;
 }
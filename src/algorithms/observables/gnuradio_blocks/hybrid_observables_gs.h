@@ -21,6 +21,7 @@
 #define GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 
 #include "gnss_block_interface.h"
+#include "gnss_sdr_block_stats.h"
 #include "obs_conf.h"
 #include <boost/circular_buffer.hpp>  // for boost::circular_buffer
 #include <gnuradio/block.h>           // for block
@@ -72,6 +73,7 @@ private:
     void msg_handler_pvt_to_observables(const pmt::pmt_t& msg);
     double compute_T_rx_s(const Gnss_Synchro& a) const;
     bool interp_trk_obs(Gnss_Synchro& interpolated_obs, uint32_t ch, uint64_t rx_clock) const;
+    bool tracking_history_covers(uint64_t last_rx_clock, uint64_t next_rx_clock) const;
     void update_TOW(const std::vector<Gnss_Synchro>& data);
     void compute_pranges(std::vector<Gnss_Synchro>& data) const;
     void smooth_pseudoranges(std::vector<Gnss_Synchro>& data);
@@ -120,6 +122,7 @@ private:
     bool d_T_rx_TOW_set;  // rx time follow GPST
     bool d_dump;
     bool d_dump_mat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 /** \} */
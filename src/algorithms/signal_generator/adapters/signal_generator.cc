@@ -49,6 +49,43 @@ SignalGenerator::SignalGenerator(const ConfigurationInterface* configuration,
     const bool noise_flag = configuration->property("SignalSource.noise_flag", false);
     const float BW_BB = configuration->property("SignalSource.BW_BB", static_cast<float>(1.0));
     const unsigned int num_satellites = configuration->property("SignalSource.num_satellites", 1);
+    synthesizer_ = configuration->property("SignalSource.synthesizer", false);
+
+    if (synthesizer_)
+        {
+            Gnss_Scenario scenario;
+            scenario.fs_hz = fs_in;
+            scenario.noise_flag = noise_flag;
+            scenario.data_flag = data_flag;
+            scenario.seed = configuration->property("SignalSource.seed", static_cast<uint64_t>(0));
+            for (unsigned int sat_idx = 0; sat_idx < num_satellites; sat_idx++)
+                {
+                    const std::string sat = std::to_string(sat_idx);
+                    Gnss_Scenario_Satellite satellite;
+                    satellite.system = configuration->property("SignalSource.system_" + sat, default_system);
+                    satellite.signal = configuration->property("SignalSource.signal_" + sat, default_signal);
+                    satellite.PRN = configuration->property("SignalSource.PRN_" + sat, 1);
+                    satellite.CN0_dB_Hz = configuration->property("SignalSource.CN0_dB_" + sat, 10.0);
+                    satellite.doppler_Hz = configuration->property("SignalSource.doppler_Hz_" + sat, 0.0);
+                    satellite.doppler_rate_Hz_s = configuration->property("SignalSource.doppler_rate_Hz_s_" + sat, 0.0);
+                    satellite.code_phase_chips = configuration->property("SignalSource.delay_chips_" + sat, 0.0);
+                    satellite.if_Hz = configuration->property("SignalSource.if_Hz_" + sat, 0.0);
+                    satellite.nav_symbols = configuration->property("SignalSource.nav_symbols_" + sat, std::string(""));
+                    scenario.satellites.push_back(satellite);
+                }
+            item_size_ = scenario_signal_source::item_size(item_type_);
+            if (item_size_ == 0)
+                {
+                    LOG(WARNING) << item_type_ << " unrecognized item type for the signal synthesizer, using gr_complex";
+                    item_type_ = default_item_type;
+                    item_size_ = sizeof(gr_complex);
+                }
+            const float gain = configuration->property("SignalSource.gain", item_type_ == "cshort" ? static_cast<float>(2048.0) : static_cast<float>(20.0));
+            const unsigned int threads = configuration->property("SignalSource.synthesizer_threads", 0);
+            const uint64_t samples = configuration->property("SignalSource.samples", static_cast<uint64_t>(0));
+            scenario_source_ = make_scenario_signal_source(scenario, item_type_, gain, threads, samples);
+            DLOG(INFO) << "scenario_signal_source(" << scenario_source_->unique_id() << ")";
+        }
 
     std::vector<std::string> signal1;
     std::vector<std::string> system;
@@ -121,7 +158,11 @@ SignalGenerator::SignalGenerator(const ConfigurationInterface* configuration,
             vector_length = static_cast<unsigned int>(round(static_cast<float>(fs_in) / (BEIDOU_B1I_CODE_RATE_CPS / BEIDOU_B1I_CODE_LENGTH_CHIPS)));
         }
 
-    if (item_type_ == "gr_complex")
+    if (synthesizer_)
+        {
+            DLOG(INFO) << "Item size " << item_size_;
+        }
+    else if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
             DLOG(INFO) << "Item size " << item_size_;
@@ -162,7 +203,15 @@ SignalGenerator::SignalGenerator(const ConfigurationInterface* configuration,
 
 void SignalGenerator::connect(gr::top_block_sptr top_block)
 {
-    if (item_type_ == "gr_complex")
+    if (synthesizer_)
+        {
+            if (dump_)
+                {
+                    top_block->connect(scenario_source_, 0, file_sink_, 0);
+                    DLOG(INFO) << "connected scenario_signal_source to file sink";
+                }
+        }
+    else if (item_type_ == "gr_complex")
         {
             top_block->connect(gen_source_, 0, vector_to_stream_, 0);
             DLOG(INFO) << "connected gen_source to vector_to_stream";
@@ -178,7 +227,14 @@ void SignalGenerator::connect(gr::top_block_sptr top_block)
 
 void SignalGenerator::disconnect(gr::top_block_sptr top_block)
 {
-    if (item_type_ == "gr_complex")
+    if (synthesizer_)
+        {
+            if (dump_)
+                {
+                    top_block->disconnect(scenario_source_, 0, file_sink_, 0);
+                }
+        }
+    else if (item_type_ == "gr_complex")
         {
             top_block->disconnect(gen_source_, 0, vector_to_stream_, 0);
             if (dump_)
@@ -198,5 +254,9 @@ gr::basic_block_sptr SignalGenerator::get_left_block()
 
 gr::basic_block_sptr SignalGenerator::get_right_block()
 {
+    if (synthesizer_)
+        {
+            return scenario_source_;
+        }
     return vector_to_stream_;
 }
@@ -21,6 +21,7 @@
 
 #include "concurrent_queue.h"
 #include "gnss_block_interface.h"
+#include "scenario_signal_source.h"
 #include "signal_generator_c.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/blocks/vector_to_stream.h>
@@ -35,6 +36,9 @@ class ConfigurationInterface;
 /*!
 * \brief This class generates synthesized GNSS signal.
 *
+* With SignalSource.synthesizer=true, the signal is streamed by a
+* scenario_signal_source, which adds Doppler rates, per-satellite carrier
+* offsets and multiple bands, and can output gr_complex, cshort or cbyte items.
 */
 class SignalGenerator : public GNSSBlockInterface
 {
@@ -70,6 +74,7 @@ public:
 
 private:
     gnss_shared_ptr<gr::block> gen_source_;
+    scenario_signal_source_sptr scenario_source_;
     gr::blocks::vector_to_stream::sptr vector_to_stream_;
     gr::blocks::file_sink::sptr file_sink_;
     std::string role_;
@@ -79,6 +84,7 @@ private:
     unsigned int in_stream_;
     unsigned int out_stream_;
     bool dump_;
+    bool synthesizer_;
 };
 
 #endif  // GNSS_SDR_SIGNAL_GENERATOR_H
@@ -0,0 +1,103 @@
+/*!
+ * \file scenario_signal_source.cc
+ * \brief GNU Radio source block that streams a synthesized GNSS scenario
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "scenario_signal_source.h"
+#include "gnss_sdr_make_unique.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+
+
+scenario_signal_source_sptr make_scenario_signal_source(
+    const Gnss_Scenario& scenario,
+    const std::string& item_type,
+    float gain,
+    unsigned int n_threads,
+    uint64_t num_samples)
+{
+    return scenario_signal_source_sptr(new scenario_signal_source(scenario, item_type, gain, n_threads, num_samples));
+}
+
+
+size_t scenario_signal_source::item_size(const std::string& item_type)
+{
+    if (item_type == "gr_complex")
+        {
+            return sizeof(std::complex<float>);
+        }
+    if (item_type == "cshort")
+        {
+            return sizeof(std::complex<int16_t>);
+        }
+    if (item_type == "cbyte")
+        {
+            return sizeof(std::complex<int8_t>);
+        }
+    return 0;
+}
+
+
+scenario_signal_source::scenario_signal_source(const Gnss_Scenario& scenario,
+    const std::string& item_type,
+    float gain,
+    unsigned int n_threads,
+    uint64_t num_samples) : gr::sync_block("scenario_signal_source",
+                                gr::io_signature::make(0, 0, 0),
+                                gr::io_signature::make(1, 1, static_cast<int>(item_size(item_type)))),
+                            d_item_type(item_type),
+                            d_sample_counter(0),
+                            d_num_samples(num_samples),
+                            d_gain(gain)
+{
+    if (item_size(item_type) == 0)
+        {
+            throw std::invalid_argument("scenario_signal_source: unsupported item type " + item_type);
+        }
+    d_synthesizer = std::make_unique<Gnss_Signal_Synthesizer>(scenario, n_threads);
+    // Whole chunks per call, so no chunk is synthesized twice
+    set_output_multiple(static_cast<int>(d_synthesizer->chunk_size()));
+}
+
+
+int scenario_signal_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    auto n = static_cast<uint64_t>(noutput_items);
+    if (d_num_samples > 0)
+        {
+            if (d_sample_counter >= d_num_samples)
+                {
+                    return WORK_DONE;
+                }
+            n = std::min(n, d_num_samples - d_sample_counter);
+        }
+    if (d_item_type == "gr_complex")
+        {
+            d_synthesizer->generate(static_cast<std::complex<float>*>(output_items[0]), d_sample_counter, n);
+        }
+    else if (d_item_type == "cshort")
+        {
+            d_synthesizer->generate(static_cast<std::complex<int16_t>*>(output_items[0]), d_sample_counter, n, d_gain);
+        }
+    else
+        {
+            d_synthesizer->generate(static_cast<std::complex<int8_t>*>(output_items[0]), d_sample_counter, n, d_gain);
+        }
+    d_sample_counter += n;
+    return static_cast<int>(n);
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file scenario_signal_source.h
+ * \brief GNU Radio source block that streams a synthesized GNSS scenario
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SCENARIO_SIGNAL_SOURCE_H
+#define GNSS_SDR_SCENARIO_SIGNAL_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include "gnss_signal_synthesizer.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+class scenario_signal_source;
+
+using scenario_signal_source_sptr = gnss_shared_ptr<scenario_signal_source>;
+
+/*!
+ * \brief Returns a shared_ptr to a new instance of scenario_signal_source.
+ * item_type can be "gr_complex", "cshort" or "cbyte".
+ */
+scenario_signal_source_sptr make_scenario_signal_source(
+    const Gnss_Scenario& scenario,
+    const std::string& item_type,
+    float gain,
+    unsigned int n_threads,
+    uint64_t num_samples);
+
+/*!
+ * \brief Streams the samples of a Gnss_Scenario, scaled by gain for the
+ * integer item types. The stream ends after num_samples samples (never if
+ * num_samples is 0).
+ */
+class scenario_signal_source : public gr::sync_block
+{
+public:
+    ~scenario_signal_source() = default;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+    static size_t item_size(const std::string& item_type);
+
+private:
+    friend scenario_signal_source_sptr make_scenario_signal_source(
+        const Gnss_Scenario& scenario,
+        const std::string& item_type,
+        float gain,
+        unsigned int n_threads,
+        uint64_t num_samples);
+
+    scenario_signal_source(const Gnss_Scenario& scenario,
+        const std::string& item_type,
+        float gain,
+        unsigned int n_threads,
+        uint64_t num_samples);
+
+    std::unique_ptr<Gnss_Signal_Synthesizer> d_synthesizer;
+    std::string d_item_type;
+    uint64_t d_sample_counter;
+    uint64_t d_num_samples;
+    float d_gain;
+};
+
+#endif  // GNSS_SDR_SCENARIO_SIGNAL_SOURCE_H
@@ -25,9 +25,57 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>  // for std::cerr
+#include <sstream>
+#include <stdexcept>
 #include <utility>
 
 
+namespace
+{
+// One capture file per line. Empty lines and lines starting with '#' are skipped
+std::vector<std::string> read_filename_list(const std::string& list_filename)
+{
+    std::vector<std::string> filenames;
+    std::ifstream list(list_filename);
+    if (!list.is_open())
+        {
+            LOG(WARNING) << "Unable to open the list of capture files " << list_filename;
+            return filenames;
+        }
+    std::string line;
+    while (std::getline(list, line))
+        {
+            std::istringstream ss(line);
+            std::string filename;
+            if (!(ss >> filename) || filename[0] == '#')
+                {
+                    continue;
+                }
+            filenames.push_back(filename);
+        }
+    return filenames;
+}
+
+
+File_Io_Mode io_mode_from_string(const std::string& io_mode)
+{
+    if (io_mode == "direct")
+        {
+            return File_Io_Mode::direct;
+        }
+    if (io_mode == "mmap")
+        {
+            return File_Io_Mode::mmap;
+        }
+    if (io_mode != "buffered")
+        {
+            LOG(WARNING) << io_mode << " unrecognized io_mode. Using buffered.";
+        }
+    return File_Io_Mode::buffered;
+}
+}  // namespace
+
+
 FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
     const std::string& role, unsigned int in_streams, unsigned int out_streams,
     Concurrent_Queue<pmt::pmt_t>* queue) : role_(role), in_streams_(in_streams), out_streams_(out_streams)
@@ -41,15 +89,36 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
     samples_ = configuration->property(role + ".samples", static_cast<uint64_t>(0));
     sampling_frequency_ = configuration->property(role + ".sampling_frequency", static_cast<int64_t>(0));
     filename_ = configuration->property(role + ".filename", default_filename);
+    const std::string filename_list = configuration->property(role + ".filename_list", std::string(""));
+    enable_read_ahead_ = configuration->property(role + ".enable_read_ahead", false);
+    const uint32_t read_ahead_buffers = configuration->property(role + ".read_ahead_buffers", 4);
+    const size_t read_ahead_buffer_size = configuration->property(role + ".read_ahead_buffer_size", 4194304);
+    const File_Io_Mode io_mode = io_mode_from_string(configuration->property(role + ".io_mode", std::string("buffered")));
+
+    if (!filename_list.empty())
+        {
+            filenames_ = read_filename_list(filename_list);
+            if (!filenames_.empty())
+                {
+                    filename_ = filenames_.front();
+                }
+            enable_read_ahead_ = true;  // gr::blocks::file_source reads a single file
+        }
 
     // override value with commandline flag, if present
     if (FLAGS_signal_source != "-")
         {
             filename_ = FLAGS_signal_source;
+            filenames_.clear();
         }
     if (FLAGS_s != "-")
         {
             filename_ = FLAGS_s;
+            filenames_.clear();
+        }
+    if (filenames_.empty())
+        {
+            filenames_.push_back(filename_);
         }
 
     item_type_ = configuration->property(role + ".item_type", default_item_type);
@@ -98,8 +167,6 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
         }
     try
         {
-            file_source_ = gr::blocks::file_source::make(item_size_, filename_.c_str(), repeat_);
-
             if (seconds_to_skip > 0)
                 {
                     samples_to_skip = static_cast<int64_t>(seconds_to_skip * sampling_frequency_);
@@ -114,13 +181,32 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
                     samples_to_skip += header_size;
                 }
 
-            if (samples_to_skip > 0)
+            if (enable_read_ahead_)
+                {
+                    if (read_ahead_file_source::total_size(filenames_) == 0)
+                        {
+                            throw std::runtime_error("Unable to open the capture files");
+                        }
+                    if (samples_to_skip > 0)
+                        {
+                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input files";
+                        }
+                    file_block_ = make_read_ahead_file_source(item_size_, filenames_, repeat_,
+                        static_cast<uint64_t>(samples_to_skip) * item_size_,
+                        read_ahead_buffer_size, read_ahead_buffers, io_mode);
+                }
+            else
                 {
-                    LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
-                    if (not file_source_->seek(samples_to_skip, SEEK_SET))
+                    auto file_source = gr::blocks::file_source::make(item_size_, filename_.c_str(), repeat_);
+                    if (samples_to_skip > 0)
                         {
-                            LOG(INFO) << "Error skipping bytes!";
+                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
+                            if (not file_source->seek(samples_to_skip, SEEK_SET))
+                                {
+                                    LOG(INFO) << "Error skipping bytes!";
+                                }
                         }
+                    file_block_ = file_source;
                 }
         }
     catch (const std::exception& e)
@@ -150,7 +236,7 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
             throw(e);
         }
 
-    DLOG(INFO) << "file_source(" << file_source_->unique_id() << ")";
+    DLOG(INFO) << "file_source(" << file_block_->unique_id() << ")";
 
     if (samples_ == 0)  // read all file
         {
@@ -159,22 +245,36 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
              * A possible solution is to compute the file length in samples using file size, excluding the last 100 milliseconds, and enable always the
              * valve block
              */
-            std::ifstream file(filename_.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
-            std::ifstream::pos_type size;
-
-            if (file.is_open())
+            std::ifstream::pos_type size = 0;
+            if (filenames_.size() > 1)
                 {
-                    size = file.tellg();
-                    DLOG(INFO) << "Total samples in the file= " << floor(static_cast<double>(size) / static_cast<double>(item_size_));
+                    size = static_cast<std::streamoff>(read_ahead_file_source::total_size(filenames_));
+                    DLOG(INFO) << "Total samples in the " << filenames_.size() << " files= " << floor(static_cast<double>(size) / static_cast<double>(item_size_));
                 }
             else
                 {
-                    std::cout << "file_signal_source: Unable to open the samples file " << filename_.c_str() << '\n';
-                    LOG(ERROR) << "file_signal_source: Unable to open the samples file " << filename_.c_str();
+                    std::ifstream file(filename_.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+                    if (file.is_open())
+                        {
+                            size = file.tellg();
+                            DLOG(INFO) << "Total samples in the file= " << floor(static_cast<double>(size) / static_cast<double>(item_size_));
+                        }
+                    else
+                        {
+                            std::cout << "file_signal_source: Unable to open the samples file " << filename_.c_str() << '\n';
+                            LOG(ERROR) << "file_signal_source: Unable to open the samples file " << filename_.c_str();
+                        }
                 }
             std::streamsize ss = std::cout.precision();
             std::cout << std::setprecision(16);
-            std::cout << "Processing file " << filename_ << ", which contains " << static_cast<double>(size) << " [bytes]\n";
+            if (filenames_.size() > 1)
+                {
+                    std::cout << "Processing " << filenames_.size() << " files starting with " << filename_ << ", which contain " << static_cast<double>(size) << " [bytes]\n";
+                }
+            else
+                {
+                    std::cout << "Processing file " << filename_ << ", which contains " << static_cast<double>(size) << " [bytes]\n";
+                }
             std::cout.precision(ss);
 
             if (size > 0)
@@ -216,6 +316,7 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
     DLOG(INFO) << "Item type " << item_type_;
     DLOG(INFO) << "Item size " << item_size_;
     DLOG(INFO) << "Repeat " << repeat_;
+    DLOG(INFO) << "Read-ahead " << enable_read_ahead_;
     DLOG(INFO) << "Dump " << dump_;
     DLOG(INFO) << "Dump filename " << dump_filename_;
     if (in_streams_ > 0)
@@ -235,24 +336,24 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->connect(file_source_, 0, throttle_, 0);
+                    top_block->connect(file_block_, 0, throttle_, 0);
                     DLOG(INFO) << "connected file source to throttle";
                     top_block->connect(throttle_, 0, valve_, 0);
                     DLOG(INFO) << "connected throttle to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
             else
                 {
-                    top_block->connect(file_source_, 0, valve_, 0);
+                    top_block->connect(file_block_, 0, valve_, 0);
                     DLOG(INFO) << "connected file source to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(file_block_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
         }
@@ -260,11 +361,11 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->connect(file_source_, 0, throttle_, 0);
+                    top_block->connect(file_block_, 0, throttle_, 0);
                     DLOG(INFO) << "connected file source to throttle";
                     if (dump_)
                         {
-                            top_block->connect(file_source_, 0, sink_, 0);
+                            top_block->connect(file_block_, 0, sink_, 0);
                             DLOG(INFO) << "connected file source to sink";
                         }
                 }
@@ -272,7 +373,7 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
                 {
                     if (dump_)
                         {
-                            top_block->connect(file_source_, 0, sink_, 0);
+                            top_block->connect(file_block_, 0, sink_, 0);
                             DLOG(INFO) << "connected file source to sink";
                         }
                 }
@@ -286,24 +387,24 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->disconnect(file_source_, 0, throttle_, 0);
+                    top_block->disconnect(file_block_, 0, throttle_, 0);
                     DLOG(INFO) << "disconnected file source to throttle";
                     top_block->disconnect(throttle_, 0, valve_, 0);
                     DLOG(INFO) << "disconnected throttle to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
             else
                 {
-                    top_block->disconnect(file_source_, 0, valve_, 0);
+                    top_block->disconnect(file_block_, 0, valve_, 0);
                     DLOG(INFO) << "disconnected file source to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(file_block_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
         }
@@ -311,11 +412,11 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->disconnect(file_source_, 0, throttle_, 0);
+                    top_block->disconnect(file_block_, 0, throttle_, 0);
                     DLOG(INFO) << "disconnected file source to throttle";
                     if (dump_)
                         {
-                            top_block->disconnect(file_source_, 0, sink_, 0);
+                            top_block->disconnect(file_block_, 0, sink_, 0);
                             DLOG(INFO) << "disconnected file source to sink";
                         }
                 }
@@ -323,7 +424,7 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
                 {
                     if (dump_)
                         {
-                            top_block->disconnect(file_source_, 0, sink_, 0);
+                            top_block->disconnect(file_block_, 0, sink_, 0);
                             DLOG(INFO) << "disconnected file source to sink";
                         }
                 }
@@ -340,13 +441,9 @@ gr::basic_block_sptr FileSignalSource::get_left_block()
 
 gr::basic_block_sptr FileSignalSource::get_right_block()
 {
-    if (samples_ > 0)
-        {
-            return valve_;
-        }
     if (enable_throttle_control_ == true)
         {
             return throttle_;
         }
-    return file_source_;
+    return file_block_;
 }
@@ -23,6 +23,7 @@
 
 #include "concurrent_queue.h"
 #include "gnss_block_interface.h"
+#include "read_ahead_file_source.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/throttle.h>
@@ -30,6 +31,7 @@
 #include <pmt/pmt.h>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 /** \addtogroup Signal_Source Signal Source
  * Classes for Signal Source management.
@@ -44,6 +46,9 @@ class ConfigurationInterface;
 /*!
  * \brief Class that reads signals samples from a file
  * and adapts it to a SignalSourceInterface
+ *
+ * With enable_read_ahead=true (or a filename_list), the samples are read by
+ * a read_ahead_file_source, which can play back a sequence of capture files.
  */
 class FileSignalSource : public GNSSBlockInterface
 {
@@ -87,6 +92,11 @@ public:
         return item_type_;
     }
 
+    inline const std::vector<std::string>& filenames() const
+    {
+        return filenames_;
+    }
+
     inline bool repeat() const
     {
         return repeat_;
@@ -103,7 +113,7 @@ public:
     }
 
 private:
-    gr::blocks::file_source::sptr file_source_;
+    gr::basic_block_sptr file_block_;  // gr::blocks::file_source or read_ahead_file_source
     gnss_shared_ptr<gr::block> valve_;
     gr::blocks::file_sink::sptr sink_;
     gr::blocks::throttle::sptr throttle_;
@@ -111,6 +121,7 @@ private:
     std::string role_;
     std::string item_type_;
     std::string filename_;
+    std::vector<std::string> filenames_;
     std::string dump_filename_;
 
     uint64_t samples_;
@@ -121,6 +132,7 @@ private:
     uint32_t out_streams_;
 
     bool enable_throttle_control_;
+    bool enable_read_ahead_;
     bool repeat_;
     bool dump_;
 };
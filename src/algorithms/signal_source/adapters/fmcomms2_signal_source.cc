@@ -362,8 +362,8 @@ void Fmcomms2SignalSource::connect(gr::top_block_sptr top_block)
             DLOG(INFO) << "connected fmcomms2 source to valve";
             if (dump_)
                 {
-                    top_block->connect(valve_, 0, file_sink_, 0);
-                    DLOG(INFO) << "connected valve to file sink";
+                    top_block->connect(fmcomms2_source_f32c_, 0, file_sink_, 0);
+                    DLOG(INFO) << "connected to file sink";
                 }
         }
     else
@@ -384,7 +384,7 @@ void Fmcomms2SignalSource::disconnect(gr::top_block_sptr top_block)
             top_block->disconnect(fmcomms2_source_f32c_, 0, valve_, 0);
             if (dump_)
                 {
-                    top_block->disconnect(valve_, 0, file_sink_, 0);
+                    top_block->disconnect(fmcomms2_source_f32c_, 0, file_sink_, 0);
                 }
         }
     else
@@ -406,12 +406,5 @@ gr::basic_block_sptr Fmcomms2SignalSource::get_left_block()
 
 gr::basic_block_sptr Fmcomms2SignalSource::get_right_block()
 {
-    if (samples_ != 0)
-        {
-            return valve_;
-        }
-    else
-        {
-            return (fmcomms2_source_f32c_);
-        }
+    return fmcomms2_source_f32c_;
 }
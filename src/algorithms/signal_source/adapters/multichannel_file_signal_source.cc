@@ -277,5 +277,17 @@ gr::basic_block_sptr MultichannelFileSignalSource::get_left_block()
 
 gr::basic_block_sptr MultichannelFileSignalSource::get_right_block()
 {
-    return valve_;
+    return get_right_block(0);
+}
+
+
+gr::basic_block_sptr MultichannelFileSignalSource::get_right_block(int RF_channel)
+{
+    // The valve only counts the samples, so each RF channel is taken
+    // directly from its file source
+    if (enable_throttle_control_ == true)
+        {
+            return throttle_vec_.at(RF_channel);
+        }
+    return file_source_vec_.at(RF_channel);
 }
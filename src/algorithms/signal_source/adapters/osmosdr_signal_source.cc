@@ -167,8 +167,8 @@ void OsmosdrSignalSource::connect(gr::top_block_sptr top_block)
             DLOG(INFO) << "connected osmosdr source to valve";
             if (dump_)
                 {
-                    top_block->connect(valve_, 0, file_sink_, 0);
-                    DLOG(INFO) << "connected valve to file sink";
+                    top_block->connect(osmosdr_source_, 0, file_sink_, 0);
+                    DLOG(INFO) << "connected to file sink";
                 }
         }
     else
@@ -189,7 +189,7 @@ void OsmosdrSignalSource::disconnect(gr::top_block_sptr top_block)
             top_block->disconnect(osmosdr_source_, 0, valve_, 0);
             if (dump_)
                 {
-                    top_block->disconnect(valve_, 0, file_sink_, 0);
+                    top_block->disconnect(osmosdr_source_, 0, file_sink_, 0);
                 }
         }
     else
@@ -211,12 +211,5 @@ gr::basic_block_sptr OsmosdrSignalSource::get_left_block()
 
 gr::basic_block_sptr OsmosdrSignalSource::get_right_block()
 {
-    if (samples_ != 0)
-        {
-            return valve_;
-        }
-    else
-        {
-            return osmosdr_source_;
-        }
+    return osmosdr_source_;
 }
@@ -162,8 +162,8 @@ void PlutosdrSignalSource::connect(gr::top_block_sptr top_block)
             DLOG(INFO) << "connected plutosdr source to valve";
             if (dump_)
                 {
-                    top_block->connect(valve_, 0, file_sink_, 0);
-                    DLOG(INFO) << "connected valve to file sink";
+                    top_block->connect(plutosdr_source_, 0, file_sink_, 0);
+                    DLOG(INFO) << "connected to file sink";
                 }
         }
     else
@@ -184,7 +184,7 @@ void PlutosdrSignalSource::disconnect(gr::top_block_sptr top_block)
             top_block->disconnect(plutosdr_source_, 0, valve_, 0);
             if (dump_)
                 {
-                    top_block->disconnect(valve_, 0, file_sink_, 0);
+                    top_block->disconnect(plutosdr_source_, 0, file_sink_, 0);
                 }
         }
     else
@@ -206,12 +206,5 @@ gr::basic_block_sptr PlutosdrSignalSource::get_left_block()
 
 gr::basic_block_sptr PlutosdrSignalSource::get_right_block()
 {
-    if (samples_ != 0)
-        {
-            return valve_;
-        }
-    else
-        {
-            return plutosdr_source_;
-        }
+    return plutosdr_source_;
 }
@@ -150,8 +150,8 @@ void RtlTcpSignalSource::connect(gr::top_block_sptr top_block)
             DLOG(INFO) << "connected rtl tcp source to valve";
             if (dump_)
                 {
-                    top_block->connect(valve_, 0, file_sink_, 0);
-                    DLOG(INFO) << "connected valve to file sink";
+                    top_block->connect(signal_source_, 0, file_sink_, 0);
+                    DLOG(INFO) << "connected to file sink";
                 }
         }
     else if (dump_)
@@ -169,7 +169,7 @@ void RtlTcpSignalSource::disconnect(gr::top_block_sptr top_block)
             top_block->disconnect(signal_source_, 0, valve_, 0);
             if (dump_)
                 {
-                    top_block->disconnect(valve_, 0, file_sink_, 0);
+                    top_block->disconnect(signal_source_, 0, file_sink_, 0);
                 }
         }
     else if (dump_)
@@ -188,9 +188,5 @@ gr::basic_block_sptr RtlTcpSignalSource::get_left_block()
 
 gr::basic_block_sptr RtlTcpSignalSource::get_right_block()
 {
-    if (samples_ != 0ULL)
-        {
-            return valve_;
-        }
     return signal_source_;
 }
@@ -172,8 +172,8 @@ void SpirFileSignalSource::connect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "connected throttle to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
             else
@@ -183,8 +183,8 @@ void SpirFileSignalSource::connect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "connected file source to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(unpack_intspir_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
         }
@@ -228,8 +228,8 @@ void SpirFileSignalSource::disconnect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "disconnected throttle to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
             else
@@ -240,8 +240,8 @@ void SpirFileSignalSource::disconnect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "disconnected unpack_intspir_ to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(unpack_intspir_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
         }
@@ -283,10 +283,6 @@ gr::basic_block_sptr SpirFileSignalSource::get_left_block()
 
 gr::basic_block_sptr SpirFileSignalSource::get_right_block()
 {
-    if (samples_ > 0)
-        {
-            return valve_;
-        }
     if (enable_throttle_control_ == true)
         {
             return throttle_;
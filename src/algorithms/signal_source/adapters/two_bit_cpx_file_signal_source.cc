@@ -178,8 +178,8 @@ void TwoBitCpxFileSignalSource::connect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "connected throttle to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
             else
@@ -190,8 +190,8 @@ void TwoBitCpxFileSignalSource::connect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "connected file source to valve";
                     if (dump_)
                         {
-                            top_block->connect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "connected valve to file sink";
+                            top_block->connect(inter_shorts_to_cpx_, 0, sink_, 0);
+                            DLOG(INFO) << "connected to file sink";
                         }
                 }
         }
@@ -237,8 +237,8 @@ void TwoBitCpxFileSignalSource::disconnect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "disconnected throttle to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(throttle_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
             else
@@ -249,8 +249,8 @@ void TwoBitCpxFileSignalSource::disconnect(gr::top_block_sptr top_block)
                     DLOG(INFO) << "disconnected unpack_byte_ to valve";
                     if (dump_)
                         {
-                            top_block->disconnect(valve_, 0, sink_, 0);
-                            DLOG(INFO) << "disconnected valve to file sink";
+                            top_block->disconnect(unpack_byte_, 0, sink_, 0);
+                            DLOG(INFO) << "disconnected to file sink";
                         }
                 }
         }
@@ -292,13 +292,9 @@ gr::basic_block_sptr TwoBitCpxFileSignalSource::get_left_block()
 
 gr::basic_block_sptr TwoBitCpxFileSignalSource::get_right_block()
 {
-    if (samples_ > 0)
-        {
-            return valve_;
-        }
     if (enable_throttle_control_ == true)
         {
             return throttle_;
         }
-    return unpack_byte_;
+    return inter_shorts_to_cpx_;
 }
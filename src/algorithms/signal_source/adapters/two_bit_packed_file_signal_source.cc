@@ -255,8 +255,8 @@ void TwoBitPackedFileSignalSource::connect(gr::top_block_sptr top_block)
     DLOG(INFO) << "connected to valve";
     if (dump_)
         {
-            top_block->connect(valve_, 0, sink_, 0);
-            DLOG(INFO) << "connected valve to file sink";
+            top_block->connect(left_block, 0, sink_, 0);
+            DLOG(INFO) << "connected to file sink";
         }
 }
 
@@ -287,8 +287,8 @@ void TwoBitPackedFileSignalSource::disconnect(gr::top_block_sptr top_block)
     DLOG(INFO) << "disconnected to valve";
     if (dump_)
         {
-            top_block->disconnect(valve_, 0, sink_, 0);
-            DLOG(INFO) << "disconnected valve to file sink";
+            top_block->disconnect(left_block, 0, sink_, 0);
+            DLOG(INFO) << "disconnected to file sink";
         }
 }
 
@@ -303,5 +303,9 @@ gr::basic_block_sptr TwoBitPackedFileSignalSource::get_left_block()
 
 gr::basic_block_sptr TwoBitPackedFileSignalSource::get_right_block()
 {
-    return valve_;
+    if (enable_throttle_control_)
+        {
+            return throttle_;
+        }
+    return char_to_float_;
 }
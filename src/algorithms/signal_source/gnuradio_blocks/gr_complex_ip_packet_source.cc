@@ -142,6 +142,7 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
     d_sock_raw = 0;
     d_pcap_thread = nullptr;
     descr = nullptr;
+    d_stats = Block_Stats_Registry::instance().make("SignalSource", this->name());
 
     memset(reinterpret_cast<char *>(&si_me), 0, sizeof(si_me));
 }
@@ -308,6 +309,10 @@ void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *
                         {
                             // notify overflow
                             std::cout << "O" << std::flush;
+                            if (Block_Stats::enabled())
+                                {
+                                    d_stats->add_dropped_samples(static_cast<uint64_t>(payload_length_bytes / d_bytes_per_sample));
+                                }
                         }
                 }
         }
@@ -415,6 +420,7 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
 {
     // send samples to next GNU Radio block
     boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(fifo_items / d_bytes_per_sample));
     if (fifo_items == 0)
         {
             return 0;
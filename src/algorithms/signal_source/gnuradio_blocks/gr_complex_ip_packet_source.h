@@ -21,12 +21,14 @@
 #define GNSS_SDR_GR_COMPLEX_IP_PACKET_SOURCE_H
 
 #include "gnss_block_interface.h"
+#include "gnss_sdr_block_stats.h"
 #include <boost/thread.hpp>
 #include <gnuradio/sync_block.h>
 #include <arpa/inet.h>
 #include <net/ethernet.h>
 #include <net/if.h>
 #include <netinet/if_ether.h>
+#include <memory>
 #include <pcap.h>
 #include <string>
 #include <sys/ioctl.h>
@@ -101,6 +103,7 @@ private:
     int d_n_baseband_channels;
     int d_wire_sample_type;
     int d_bytes_per_sample;
+    std::shared_ptr<Block_Stats> d_stats;
     bool d_IQ_swap;
     bool d_fifo_full;
 };
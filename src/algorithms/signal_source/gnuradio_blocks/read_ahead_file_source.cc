@@ -0,0 +1,401 @@
+/*!
+ * \file read_ahead_file_source.cc
+ * \brief GNU Radio source block that reads a sequence of capture files with
+ * asynchronous read-ahead
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "read_ahead_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <fcntl.h>     // for open, O_RDONLY, O_DIRECT, posix_fadvise
+#include <sys/mman.h>  // for mmap, madvise, munmap
+#include <sys/stat.h>  // for stat, fstat
+#include <unistd.h>    // for pread, close
+#include <algorithm>   // for min
+#include <cerrno>      // for errno, EINTR
+#include <cstring>     // for memcpy, strerror
+#include <iostream>    // for cout
+
+namespace
+{
+constexpr size_t PAGE_ALIGNMENT = 4096;  // O_DIRECT offsets, sizes and buffers must be aligned to the block size
+}
+
+
+read_ahead_file_source_sptr make_read_ahead_file_source(size_t item_size,
+    const std::vector<std::string>& filenames,
+    bool repeat,
+    uint64_t bytes_to_skip,
+    size_t buffer_size,
+    uint32_t n_buffers,
+    File_Io_Mode io_mode)
+{
+    return read_ahead_file_source_sptr(new read_ahead_file_source(item_size,
+        filenames,
+        repeat,
+        bytes_to_skip,
+        buffer_size,
+        n_buffers,
+        io_mode));
+}
+
+
+read_ahead_file_source::read_ahead_file_source(size_t item_size,
+    const std::vector<std::string>& filenames,
+    bool repeat,
+    uint64_t bytes_to_skip,
+    size_t buffer_size,
+    uint32_t n_buffers,
+    File_Io_Mode io_mode) : gr::sync_block("read_ahead_file_source",
+                                gr::io_signature::make(0, 0, 0),
+                                gr::io_signature::make(1, 1, item_size)),
+                            d_filenames(filenames),
+                            d_partial_item(item_size),
+                            d_elapsed_s(0.0),
+                            d_bytes_to_skip(bytes_to_skip),
+                            d_bytes_delivered(0),
+                            d_item_size(item_size),
+                            d_partial_bytes(0),
+                            d_head(0),
+                            d_count(0),
+                            d_io_mode(io_mode),
+                            d_repeat(repeat),
+                            d_started(false),
+                            d_end_of_stream(false),
+                            d_stop_reader(false)
+{
+    if (n_buffers < 2)
+        {
+            n_buffers = 2;
+        }
+    d_buffer_size = std::max(buffer_size + PAGE_ALIGNMENT - 1, PAGE_ALIGNMENT) / PAGE_ALIGNMENT * PAGE_ALIGNMENT;
+    d_chunks = std::vector<Chunk>(n_buffers);
+    if (d_io_mode != File_Io_Mode::mmap)
+        {
+            d_storage = std::vector<uint8_t>(n_buffers * d_buffer_size + PAGE_ALIGNMENT);
+            const auto address = reinterpret_cast<uintptr_t>(d_storage.data());
+            uint8_t* aligned = d_storage.data() + (PAGE_ALIGNMENT - address % PAGE_ALIGNMENT) % PAGE_ALIGNMENT;
+            for (uint32_t i = 0; i < n_buffers; i++)
+                {
+                    d_buffers.push_back(aligned + static_cast<size_t>(i) * d_buffer_size);
+                }
+        }
+
+    // Reading starts right away, so the first buffers are ready when the
+    // flowgraph starts
+    d_reader = std::thread(&read_ahead_file_source::reader, this);
+}
+
+
+read_ahead_file_source::~read_ahead_file_source()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop_reader = true;
+    }
+    d_emptied.notify_all();
+    if (d_reader.joinable())
+        {
+            d_reader.join();
+        }
+}
+
+
+uint64_t read_ahead_file_source::total_size(const std::vector<std::string>& filenames)
+{
+    uint64_t size = 0;
+    for (const auto& filename : filenames)
+        {
+            struct stat file_stat
+            {
+            };
+            if (::stat(filename.c_str(), &file_stat) != 0)
+                {
+                    return 0;
+                }
+            size += static_cast<uint64_t>(file_stat.st_size);
+        }
+    return size;
+}
+
+
+double read_ahead_file_source::sustained_rate_MBps() const
+{
+    double elapsed_s = d_elapsed_s;
+    if (d_started && elapsed_s == 0.0)
+        {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - d_start;
+            elapsed_s = elapsed.count();
+        }
+    if (elapsed_s <= 0.0)
+        {
+            return 0.0;
+        }
+    return static_cast<double>(d_bytes_delivered) / elapsed_s / 1e6;
+}
+
+
+bool read_ahead_file_source::stop()
+{
+    if (d_started && d_elapsed_s == 0.0)
+        {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - d_start;
+            d_elapsed_s = elapsed.count();
+            LOG(INFO) << "File source read " << static_cast<double>(d_bytes_delivered) / 1e6
+                      << " MB in " << d_elapsed_s << " s (" << sustained_rate_MBps() << " MB/s)";
+            std::cout << "File source sustained read rate: " << sustained_rate_MBps() << " MB/s\n";
+        }
+    return true;
+}
+
+
+void read_ahead_file_source::reader()
+{
+    bool keep_reading = true;
+    bool any_data = false;
+    do
+        {
+            uint64_t skip = d_bytes_to_skip;
+            for (const auto& filename : d_filenames)
+                {
+                    const uint64_t size = total_size({filename});
+                    if (skip >= size)
+                        {
+                            skip -= size;
+                            continue;
+                        }
+                    DLOG(INFO) << "Reading " << filename;
+                    keep_reading = d_io_mode == File_Io_Mode::mmap ? read_file_mmap(filename, skip) : read_file(filename, skip);
+                    any_data = true;
+                    skip = 0;
+                    if (!keep_reading)
+                        {
+                            break;
+                        }
+                }
+        }
+    while (keep_reading && d_repeat && any_data);
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_end_of_stream = true;
+    d_filled.notify_all();
+}
+
+
+bool read_ahead_file_source::read_file(const std::string& filename, uint64_t offset)
+{
+    int flags = O_RDONLY;
+    uint64_t position = offset;
+#ifdef O_DIRECT
+    if (d_io_mode == File_Io_Mode::direct)
+        {
+            flags |= O_DIRECT;
+            position = offset / PAGE_ALIGNMENT * PAGE_ALIGNMENT;
+        }
+#endif
+    int fd = ::open(filename.c_str(), flags);
+    if (fd < 0 && flags != O_RDONLY)
+        {
+            // e.g. the file system does not support O_DIRECT
+            LOG(WARNING) << "Unable to open " << filename << " with O_DIRECT (" << std::strerror(errno) << "), using buffered reads";
+            d_io_mode = File_Io_Mode::buffered;
+            position = offset;
+            fd = ::open(filename.c_str(), O_RDONLY);
+        }
+    if (fd < 0)
+        {
+            LOG(WARNING) << "Unable to open " << filename << ": " << std::strerror(errno);
+            return true;  // go on with the next file
+        }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    size_t begin = offset - position;
+    size_t slot = 0;
+    bool keep_reading = true;
+    while (keep_reading && wait_free_slot(slot))
+        {
+            const ssize_t n = ::pread(fd, d_buffers[slot], d_buffer_size, static_cast<off_t>(position));
+            if (n < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+            if (n < 0)
+                {
+                    LOG(WARNING) << "Error reading " << filename << ": " << std::strerror(errno);
+                    break;
+                }
+            if (static_cast<size_t>(n) <= begin)
+                {
+                    break;  // end of file
+                }
+            keep_reading = publish(slot, d_buffers[slot], begin, static_cast<size_t>(n));
+            position += static_cast<uint64_t>(n);
+            begin = 0;
+        }
+    ::close(fd);
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return !d_stop_reader;
+}
+
+
+bool read_ahead_file_source::read_file_mmap(const std::string& filename, uint64_t offset)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        {
+            LOG(WARNING) << "Unable to open " << filename << ": " << std::strerror(errno);
+            return true;
+        }
+    struct stat file_stat
+    {
+    };
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+        {
+            ::close(fd);
+            return true;
+        }
+    const auto size = static_cast<uint64_t>(file_stat.st_size);
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        {
+            LOG(WARNING) << "Unable to map " << filename << ": " << std::strerror(errno);
+            return true;
+        }
+    ::madvise(map, size, MADV_SEQUENTIAL);
+
+    // The chunks point to the mapping, so the samples are only copied once,
+    // to the output buffer. The reader thread just asks the kernel to bring
+    // in the pages of the next chunk.
+    const auto* data = static_cast<const uint8_t*>(map);
+    uint64_t position = offset;
+    size_t slot = 0;
+    bool keep_reading = true;
+    while (keep_reading && position < size && wait_free_slot(slot))
+        {
+            const auto length = static_cast<size_t>(std::min(static_cast<uint64_t>(d_buffer_size), size - position));
+            const uint64_t page = position / PAGE_ALIGNMENT * PAGE_ALIGNMENT;
+            ::madvise(static_cast<uint8_t*>(map) + page, static_cast<size_t>(position + length - page), MADV_WILLNEED);
+            keep_reading = publish(slot, data + position, 0, length);
+            position += length;
+        }
+
+    // Wait until all the chunks of this file have been consumed before unmapping it
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_emptied.wait(lock, [this] { return d_count == 0 || d_stop_reader; });
+    }
+    ::munmap(map, size);
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return !d_stop_reader;
+}
+
+
+bool read_ahead_file_source::wait_free_slot(size_t& slot)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_emptied.wait(lock, [this] { return d_count < d_chunks.size() || d_stop_reader; });
+    if (d_stop_reader)
+        {
+            return false;
+        }
+    // Only the reader fills slots, so this one stays free after unlocking
+    slot = (d_head + d_count) % d_chunks.size();
+    return true;
+}
+
+
+bool read_ahead_file_source::publish(size_t slot, const uint8_t* data, size_t begin, size_t end)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_chunks[slot].data = data;
+    d_chunks[slot].begin = begin;
+    d_chunks[slot].end = end;
+    d_count++;
+    d_filled.notify_one();
+    return !d_stop_reader;
+}
+
+
+int read_ahead_file_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    if (!d_started)
+        {
+            d_started = true;
+            d_start = std::chrono::steady_clock::now();
+        }
+    auto* out = static_cast<uint8_t*>(output_items[0]);
+    const size_t wanted = static_cast<size_t>(noutput_items) * d_item_size;
+
+    // bytes of an item split between two reads
+    size_t written = d_partial_bytes;
+    std::memcpy(out, d_partial_item.data(), d_partial_bytes);
+    d_partial_bytes = 0;
+
+    bool end_of_stream = false;
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (written < wanted)
+        {
+            if (d_count == 0)
+                {
+                    if (d_end_of_stream)
+                        {
+                            end_of_stream = true;
+                            break;
+                        }
+                    if (written >= d_item_size)
+                        {
+                            break;  // deliver what is available instead of waiting
+                        }
+                    // Bounded wait, so the scheduler can stop the block
+                    if (!d_filled.wait_for(lock, std::chrono::milliseconds(100), [this] { return d_count > 0 || d_end_of_stream; }))
+                        {
+                            break;
+                        }
+                    continue;
+                }
+            // The chunk at the head is not touched by the reader until it is released
+            Chunk& chunk = d_chunks[d_head];
+            lock.unlock();
+            const size_t n = std::min(chunk.end - chunk.begin, wanted - written);
+            std::memcpy(out + written, chunk.data + chunk.begin, n);
+            chunk.begin += n;
+            written += n;
+            lock.lock();
+            if (chunk.begin == chunk.end)
+                {
+                    d_head = (d_head + 1) % d_chunks.size();
+                    d_count--;
+                    d_emptied.notify_one();
+                }
+        }
+    lock.unlock();
+
+    const size_t produced = written / d_item_size;
+    d_partial_bytes = written - produced * d_item_size;
+    std::memcpy(d_partial_item.data(), out + produced * d_item_size, d_partial_bytes);
+    d_bytes_delivered += produced * d_item_size;
+
+    if (produced == 0 && end_of_stream)
+        {
+            return -1;  // Done!
+        }
+    return static_cast<int>(produced);
+}
@@ -0,0 +1,152 @@
+/*!
+ * \file read_ahead_file_source.h
+ * \brief GNU Radio source block that reads a sequence of capture files with
+ * asynchronous read-ahead
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_READ_AHEAD_FILE_SOURCE_H
+#define GNSS_SDR_READ_AHEAD_FILE_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+class read_ahead_file_source;
+
+using read_ahead_file_source_sptr = gnss_shared_ptr<read_ahead_file_source>;
+
+/*!
+ * \brief How the capture files are read
+ */
+enum class File_Io_Mode
+{
+    buffered,  // read() through the page cache
+    direct,    // read() with O_DIRECT, bypassing the page cache
+    mmap       // memory mapped, with sequential access advice
+};
+
+read_ahead_file_source_sptr make_read_ahead_file_source(
+    size_t item_size,
+    const std::vector<std::string>& filenames,
+    bool repeat,
+    uint64_t bytes_to_skip,
+    size_t buffer_size,
+    uint32_t n_buffers,
+    File_Io_Mode io_mode);
+
+/*!
+ * \brief Reads a sequence of capture files as a single stream of items.
+ *
+ * A reader thread fills a ring of n_buffers buffers of buffer_size bytes
+ * ahead of the flowgraph, so the scheduler thread only copies samples that are
+ * already in memory. The files are concatenated byte by byte, so an item can
+ * be split between two consecutive files. The first bytes_to_skip bytes of the
+ * sequence are skipped (e.g. a header or an initial time span).
+ *
+ * The sustained read rate is logged when the block stops.
+ */
+class read_ahead_file_source : public gr::sync_block
+{
+public:
+    ~read_ahead_file_source();
+
+    bool stop() override;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+    /*!
+     * \brief Total size of the files, in bytes (0 if one of them can not be opened)
+     */
+    static uint64_t total_size(const std::vector<std::string>& filenames);
+
+    /*!
+     * \brief Bytes delivered to the flowgraph per second of running time, in MB/s
+     */
+    double sustained_rate_MBps() const;
+
+private:
+    friend read_ahead_file_source_sptr make_read_ahead_file_source(
+        size_t item_size,
+        const std::vector<std::string>& filenames,
+        bool repeat,
+        uint64_t bytes_to_skip,
+        size_t buffer_size,
+        uint32_t n_buffers,
+        File_Io_Mode io_mode);
+
+    read_ahead_file_source(size_t item_size,
+        const std::vector<std::string>& filenames,
+        bool repeat,
+        uint64_t bytes_to_skip,
+        size_t buffer_size,
+        uint32_t n_buffers,
+        File_Io_Mode io_mode);
+
+    struct Chunk
+    {
+        const uint8_t* data{nullptr};
+        size_t begin{0};  // first valid byte (O_DIRECT reads start at aligned offsets)
+        size_t end{0};    // one past the last valid byte
+    };
+
+    void reader();
+    bool read_file(const std::string& filename, uint64_t offset);
+    bool read_file_mmap(const std::string& filename, uint64_t offset);
+    bool wait_free_slot(size_t& slot);
+    bool publish(size_t slot, const uint8_t* data, size_t begin, size_t end);
+
+    std::vector<std::string> d_filenames;
+    std::vector<uint8_t> d_storage;
+    std::vector<uint8_t*> d_buffers;  // aligned to the page size, for O_DIRECT
+    std::vector<Chunk> d_chunks;
+    std::vector<uint8_t> d_partial_item;
+    std::thread d_reader;
+    std::mutex d_mutex;
+    std::condition_variable d_filled;
+    std::condition_variable d_emptied;
+    std::chrono::steady_clock::time_point d_start;
+    double d_elapsed_s;
+    uint64_t d_bytes_to_skip;
+    uint64_t d_bytes_delivered;
+    size_t d_item_size;
+    size_t d_buffer_size;
+    size_t d_partial_bytes;
+    size_t d_head;   // next chunk to be consumed
+    size_t d_count;  // chunks filled and not consumed yet, protected by d_mutex
+    File_Io_Mode d_io_mode;
+    bool d_repeat;
+    bool d_started;
+    bool d_end_of_stream;
+    bool d_stop_reader;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_READ_AHEAD_FILE_SOURCE_H
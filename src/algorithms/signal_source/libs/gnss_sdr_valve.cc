@@ -29,7 +29,7 @@ Gnss_Sdr_Valve::Gnss_Sdr_Valve(size_t sizeof_stream_item,
     Concurrent_Queue<pmt::pmt_t>* queue,
     bool stop_flowgraph) : gr::sync_block("valve",
                                gr::io_signature::make(1, 20, sizeof_stream_item),
-                               gr::io_signature::make(1, 20, sizeof_stream_item)),
+                               gr::io_signature::make(0, 20, sizeof_stream_item)),
                            d_nitems(nitems),
                            d_ncopied_items(0),
                            d_queue(queue),
@@ -80,7 +80,8 @@ int Gnss_Sdr_Valve::work(int noutput_items,
                 {
                     return 0;
                 }
-            // multichannel support
+            // multichannel support. Without outputs there is nothing to copy
+            // and the valve only counts the samples it consumes
             for (size_t ch = 0; ch < output_items.size(); ch++)
                 {
                     std::memcpy(output_items[ch], input_items[ch], n * input_signature()->sizeof_stream_item(ch));
@@ -50,6 +50,12 @@ gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve(
 /*!
  * \brief Implementation of a GNU Radio block that sends a STOP message to the
  * control queue right after a specific number of samples have passed through it.
+ *
+ * If its outputs are not connected, the valve works as a sink connected in
+ * parallel to the blocks reading the source: it reads the same source buffer
+ * and copies nothing. It only counts the samples it has read itself, and the
+ * other readers can be up to one source buffer ahead of it, so the receiver
+ * may process up to one buffer more than nitems samples before it stops.
  */
 class Gnss_Sdr_Valve : public gr::sync_block
 {
@@ -50,6 +50,7 @@ beidou_b3i_telemetry_decoder_gs::beidou_b3i_telemetry_decoder_gs(
           gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
           gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("TelemetryDecoder", this->name());
     // prevent telemetry symbols accumulation in output buffers
     this->set_max_noutput_items(1);
     // Ephemeris data port out
@@ -81,6 +82,7 @@ beidou_b3i_telemetry_decoder_gs::beidou_b3i_telemetry_decoder_gs(
                     d_preamble_samples[i] = -1;
                 }
         }
+    d_preamble_detector.set_preamble(d_preamble_samples.data(), d_samples_per_preamble);
 
     d_required_symbols = BEIDOU_DNAV_SUBFRAME_SYMBOLS + d_samples_per_preamble;
     d_symbol_history.set_capacity(d_required_symbols);
@@ -348,6 +350,7 @@ void beidou_b3i_telemetry_decoder_gs::set_satellite(
             d_symbol_duration_ms = BEIDOU_B3I_GEO_TELEMETRY_SYMBOLS_PER_BIT * BEIDOU_B3I_CODE_PERIOD_MS;
             d_required_symbols = BEIDOU_DNAV_SUBFRAME_SYMBOLS + d_samples_per_preamble;
             d_symbol_history.set_capacity(d_required_symbols);
+            d_preamble_detector.set_preamble(d_preamble_samples.data(), d_samples_per_preamble);
         }
     else
         {
@@ -372,12 +375,14 @@ void beidou_b3i_telemetry_decoder_gs::set_satellite(
 
             d_required_symbols = BEIDOU_DNAV_SUBFRAME_SYMBOLS + d_samples_per_preamble;
             d_symbol_history.set_capacity(d_required_symbols);
+            d_preamble_detector.set_preamble(d_preamble_samples.data(), d_samples_per_preamble);
         }
 }
 
 
 void beidou_b3i_telemetry_decoder_gs::set_channel(int32_t channel)
 {
+    d_stats->set_channel(channel);
     d_channel = channel;
     LOG(INFO) << "Navigation channel set to " << channel;
     // ############# ENABLE DATA FILE LOG #################
@@ -421,6 +426,7 @@ int beidou_b3i_telemetry_decoder_gs::general_work(
     gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     int32_t corr_value = 0;
     int32_t preamble_diff = 0;
 
@@ -433,24 +439,15 @@ int beidou_b3i_telemetry_decoder_gs::general_work(
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
     d_symbol_history.push_back(current_symbol.Prompt_I);  // add new symbol to the symbol queue
-    d_sample_counter++;                                   // count for the processed samples
+    d_preamble_detector.update(d_symbol_history);
+    d_sample_counter++;  // count for the processed samples
     consume_each(1);
     d_flag_preamble = false;
 
     if (d_symbol_history.size() >= d_required_symbols)
         {
             // ******* preamble correlation ********
-            for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                {
-                    if (d_symbol_history[i] < 0)  // symbols clipping
-                        {
-                            corr_value -= d_preamble_samples[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preamble_samples[i];
-                        }
-                }
+            corr_value = d_preamble_detector.correlation();
         }
     // ******* frame sync ******************
     if (d_stat == 0)  // no preamble information
@@ -20,13 +20,16 @@
 #include "beidou_dnav_navigation_message.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_block_stats.h"
 #include "tlm_conf.h"
+#include "tlm_preamble_detector.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <memory>            // for shared_ptr
 #include <string>
 
 
@@ -77,6 +80,7 @@ private:
 
     // Preamble decoding
     std::array<int32_t, BEIDOU_DNAV_PREAMBLE_LENGTH_SYMBOLS> d_preamble_samples{};
+    Tlm_Preamble_Detector d_preamble_detector;
     std::array<float, BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS> d_subframe_symbols{};
 
     // Storage for incoming data
@@ -116,6 +120,7 @@ private:
     bool d_dump;
     bool d_dump_mat;
     bool d_remove_dat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -58,6 +58,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
     int frame_type) : gr::block("galileo_telemetry_decoder_gs", gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                           gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("TelemetryDecoder", this->name());
     // prevent telemetry symbols accumulation in output buffers
     this->set_max_noutput_items(1);
     // Ephemeris data port out
@@ -88,7 +89,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                 d_preamble_period_symbols = GALILEO_INAV_PREAMBLE_PERIOD_SYMBOLS;
                 d_required_symbols = GALILEO_INAV_PAGE_SYMBOLS + d_samples_per_preamble;
                 // preamble bits to sampled symbols
-                d_preamble_samples.reserve(d_samples_per_preamble);
+                d_preamble_samples.resize(d_samples_per_preamble);
                 d_frame_length_symbols = GALILEO_INAV_PAGE_PART_SYMBOLS - GALILEO_INAV_PREAMBLE_LENGTH_BITS;
                 d_codelength = static_cast<int32_t>(d_frame_length_symbols);
                 d_datalength = (d_codelength / d_nn) - d_mm;
@@ -105,7 +106,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                 d_preamble_period_symbols = GALILEO_FNAV_SYMBOLS_PER_PAGE;
                 d_required_symbols = static_cast<uint32_t>(GALILEO_FNAV_SYMBOLS_PER_PAGE) + d_samples_per_preamble;
                 // preamble bits to sampled symbols
-                d_preamble_samples.reserve(d_samples_per_preamble);
+                d_preamble_samples.resize(d_samples_per_preamble);
                 d_frame_length_symbols = GALILEO_FNAV_SYMBOLS_PER_PAGE - GALILEO_FNAV_PREAMBLE_LENGTH_BITS;
                 d_codelength = static_cast<int32_t>(d_frame_length_symbols);
                 d_datalength = (d_codelength / d_nn) - d_mm;
@@ -119,7 +120,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                 d_samples_per_preamble = GALILEO_CNAV_PREAMBLE_LENGTH_BITS;
                 d_preamble_period_symbols = GALILEO_CNAV_SYMBOLS_PER_PAGE;
                 d_required_symbols = static_cast<uint32_t>(GALILEO_CNAV_SYMBOLS_PER_PAGE) + d_samples_per_preamble;
-                d_preamble_samples.reserve(d_samples_per_preamble);
+                d_preamble_samples.resize(d_samples_per_preamble);
                 d_frame_length_symbols = GALILEO_CNAV_SYMBOLS_PER_PAGE - GALILEO_CNAV_PREAMBLE_LENGTH_BITS;
                 d_codelength = static_cast<int32_t>(d_frame_length_symbols);
                 d_datalength = (d_codelength / d_nn) - d_mm;
@@ -182,6 +183,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                     }
                 }
         }
+    d_preamble_detector.set_preamble(d_preamble_samples.data(), d_samples_per_preamble);
     d_sample_counter = 0ULL;
     d_stat = 0;
     d_preamble_index = 0ULL;
@@ -549,6 +551,7 @@ void galileo_telemetry_decoder_gs::reset()
 
 void galileo_telemetry_decoder_gs::set_channel(int32_t channel)
 {
+    d_stats->set_channel(channel);
     d_channel = channel;
     DLOG(INFO) << "Navigation channel set to " << channel;
     // ############# ENABLE DATA FILE LOG #################
@@ -576,6 +579,7 @@ void galileo_telemetry_decoder_gs::set_channel(int32_t channel)
 int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);            // Get the output buffer pointer
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);  // Get the input buffer pointer
 
@@ -609,6 +613,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 break;
             }
         }
+    d_preamble_detector.update(d_symbol_history);
     d_sample_counter++;  // count for the processed symbols
     consume_each(1);
     d_flag_preamble = false;
@@ -635,17 +640,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 if (d_symbol_history.size() > d_required_symbols)
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                         if (abs(corr_value) >= d_samples_per_preamble)
                             {
                                 d_preamble_index = d_sample_counter;  // record the preamble sample stamp
@@ -663,17 +658,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 if (d_symbol_history.size() > d_required_symbols)
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                         if (abs(corr_value) >= d_samples_per_preamble)
                             {
                                 // check preamble separation
@@ -684,7 +669,8 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                                         DLOG(INFO) << "Starting page decoder for Galileo satellite " << this->d_satellite;
                                         d_preamble_index = d_sample_counter;  // record the preamble sample stamp
                                         d_CRC_error_counter = 0;
-                                        if (corr_value < 0)
+                                        // soft-decision confirmation of the preamble polarity
+                                        if (d_preamble_detector.soft_correlation(d_symbol_history) < 0.0)
                                             {
                                                 d_flag_PLL_180_deg_phase_locked = true;
                                             }
@@ -25,12 +25,15 @@
 #include "galileo_inav_message.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_block_stats.h"
 #include "tlm_conf.h"
+#include "tlm_preamble_detector.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <cstdint>
 #include <fstream>
+#include <memory>            // for shared_ptr
 #include <string>
 #include <vector>
 
@@ -87,6 +90,7 @@ private:
 
     // vars for Viterbi decoder
     std::vector<int32_t> d_preamble_samples;
+    Tlm_Preamble_Detector d_preamble_detector;
     std::vector<float> d_page_part_symbols;
     std::vector<int32_t> d_out0;
     std::vector<int32_t> d_out1;
@@ -139,6 +143,7 @@ private:
     bool d_dump;
     bool d_dump_mat;
     bool d_remove_dat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
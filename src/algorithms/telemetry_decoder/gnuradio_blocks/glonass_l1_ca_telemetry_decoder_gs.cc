@@ -47,6 +47,7 @@ glonass_l1_ca_telemetry_decoder_gs::glonass_l1_ca_telemetry_decoder_gs(
     const Tlm_Conf &conf) : gr::block("glonass_l1_ca_telemetry_decoder_gs", gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("TelemetryDecoder", this->name());
     // prevent telemetry symbols accumulation in output buffers
     this->set_max_noutput_items(1);
     // Ephemeris data port out
@@ -79,6 +80,7 @@ glonass_l1_ca_telemetry_decoder_gs::glonass_l1_ca_telemetry_decoder_gs(
                 }
         }
 
+    d_preamble_detector.set_preamble(d_preambles_symbols.data(), d_symbols_per_preamble);
     d_symbol_history.set_capacity(GLONASS_GNAV_STRING_SYMBOLS);
     d_sample_counter = 0ULL;
     d_stat = 0;
@@ -247,6 +249,7 @@ void glonass_l1_ca_telemetry_decoder_gs::set_satellite(const Gnss_Satellite &sat
 
 void glonass_l1_ca_telemetry_decoder_gs::set_channel(int32_t channel)
 {
+    d_stats->set_channel(channel);
     d_channel = channel;
     LOG(INFO) << "Navigation channel set to " << channel;
     // ############# ENABLE DATA FILE LOG #################
@@ -274,6 +277,7 @@ void glonass_l1_ca_telemetry_decoder_gs::set_channel(int32_t channel)
 int glonass_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     int32_t corr_value = 0;
     int32_t preamble_diff = 0;
 
@@ -284,7 +288,8 @@ int glonass_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribu
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
     d_symbol_history.push_back(current_symbol);  // add new symbol to the symbol queue
-    d_sample_counter++;                          // count for the processed samples
+    d_preamble_detector.update(d_symbol_history);
+    d_sample_counter++;  // count for the processed samples
     consume_each(1);
 
     d_flag_preamble = false;
@@ -292,17 +297,7 @@ int glonass_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribu
     if (static_cast<int32_t>(d_symbol_history.size()) >= d_symbols_per_preamble)
         {
             // ******* preamble correlation ********
-            for (int32_t i = 0; i < d_symbols_per_preamble; i++)
-                {
-                    if (d_symbol_history[i].Prompt_I < 0.0)  // symbols clipping
-                        {
-                            corr_value -= d_preambles_symbols[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preambles_symbols[i];
-                        }
-                }
+            corr_value = d_preamble_detector.correlation();
         }
 
     // ******* frame sync ******************
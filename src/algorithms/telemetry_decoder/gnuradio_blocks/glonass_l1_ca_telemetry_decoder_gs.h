@@ -23,14 +23,17 @@
 #include "glonass_gnav_navigation_message.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_block_stats.h"
 #include "gnss_synchro.h"
 #include "tlm_conf.h"
+#include "tlm_preamble_detector.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
 #include <cstdint>
 #include <fstream>  // for ofstream
+#include <memory>            // for shared_ptr
 #include <string>
 
 /** \addtogroup Telemetry_Decoder
@@ -86,6 +89,7 @@ private:
 
     // Preamble decoding
     std::array<int32_t, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS> d_preambles_symbols{};
+    Tlm_Preamble_Detector d_preamble_detector;
 
     // Storage for incoming data
     boost::circular_buffer<Gnss_Synchro> d_symbol_history;
@@ -118,6 +122,7 @@ private:
     bool d_dump;
     bool d_dump_mat;
     bool d_remove_dat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -20,15 +20,18 @@
 #include "GPS_L1_CA.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_block_stats.h"
 #include "gnss_synchro.h"
 #include "gps_navigation_message.h"
 #include "tlm_conf.h"
+#include "tlm_preamble_detector.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>             // for array
 #include <cstdint>           // for int32_t
 #include <fstream>           // for ofstream
+#include <memory>            // for shared_ptr
 #include <string>            // for string
 
 /** \addtogroup Telemetry_Decoder
@@ -77,6 +80,7 @@ private:
     Gnss_Satellite d_satellite;
 
     std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> d_preamble_samples{};
+    Tlm_Preamble_Detector d_preamble_detector;
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
@@ -110,6 +114,7 @@ private:
     bool d_dump;
     bool d_dump_mat;
     bool d_remove_dat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -48,6 +48,7 @@ gps_l2c_telemetry_decoder_gs::gps_l2c_telemetry_decoder_gs(
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                                 gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("TelemetryDecoder", this->name());
     // prevent telemetry symbols accumulation in output buffers
     this->set_max_noutput_items(1);
     // Ephemeris data port out
@@ -127,6 +128,7 @@ void gps_l2c_telemetry_decoder_gs::set_satellite(const Gnss_Satellite &satellite
 
 void gps_l2c_telemetry_decoder_gs::set_channel(int channel)
 {
+    d_stats->set_channel(channel);
     d_channel = channel;
     LOG(INFO) << "GPS L2C CNAV channel set to " << channel;
     // ############# ENABLE DATA FILE LOG #################
@@ -163,6 +165,7 @@ void gps_l2c_telemetry_decoder_gs::reset()
 int gps_l2c_telemetry_decoder_gs::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     // get pointers on in- and output gnss-synchro objects
     auto *out = reinterpret_cast<Gnss_Synchro *>(output_items[0]);            // Get the output buffer pointer
     const auto *in = reinterpret_cast<const Gnss_Synchro *>(input_items[0]);  // Get the input buffer pointer
@@ -20,6 +20,7 @@
 #include "GPS_L5.h"  // for GPS_L5I_NH_CODE_LENGTH
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"               // for Gnss_Satellite
+#include "gnss_sdr_block_stats.h"
 #include "gps_cnav_navigation_message.h"  // for Gps_CNAV_Navigation_Message
 #include "tlm_conf.h"
 #include <boost/circular_buffer.hpp>
@@ -27,6 +28,7 @@
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <cstdint>
 #include <fstream>
+#include <memory>            // for shared_ptr
 #include <string>
 
 extern "C"
@@ -93,6 +95,7 @@ private:
     bool d_dump;
     bool d_dump_mat;
     bool d_remove_dat;
+    std::shared_ptr<Block_Stats> d_stats;
 };
 
 
@@ -0,0 +1,86 @@
+/*!
+ * \file tlm_preamble_detector.cc
+ * \brief Bit-packed preamble detector shared by the telemetry decoder blocks.
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tlm_preamble_detector.h"
+#include <algorithm>  // for std::fill
+#include <bitset>     // for std::bitset
+
+
+void Tlm_Preamble_Detector::set_preamble(const int32_t* preamble_samples, int32_t length)
+{
+    d_length = length > 0 ? length : 0;
+    d_preamble_samples.assign(preamble_samples, preamble_samples + d_length);
+    const size_t words = (static_cast<size_t>(d_length) + 63) / 64;
+    d_pattern.assign(words, 0ULL);
+    d_register.assign(words, 0ULL);
+    const int32_t top_bits = d_length % 64;
+    d_top_word_mask = top_bits == 0 ? ~0ULL : ((1ULL << top_bits) - 1ULL);
+
+    // the oldest sample ends up in the most significant used bit
+    for (int32_t i = 0; i < d_length; i++)
+        {
+            const int32_t bit = d_length - 1 - i;
+            if (d_preamble_samples[i] < 0)
+                {
+                    d_pattern[bit / 64] |= (1ULL << (bit % 64));
+                }
+        }
+    reset();
+}
+
+
+void Tlm_Preamble_Detector::reset()
+{
+    std::fill(d_register.begin(), d_register.end(), 0ULL);
+    d_symbols_in_register = 0;
+    d_history_size = 0;
+}
+
+
+int32_t Tlm_Preamble_Detector::correlation() const
+{
+    if (d_length == 0 or d_symbols_in_register < d_length)
+        {
+            return 0;
+        }
+    int32_t mismatches = 0;
+    for (size_t w = 0; w < d_register.size(); w++)
+        {
+            mismatches += static_cast<int32_t>(std::bitset<64>(d_register[w] ^ d_pattern[w]).count());
+        }
+    return d_length - 2 * mismatches;
+}
+
+
+void Tlm_Preamble_Detector::shift_in(double symbol)
+{
+    if (d_length == 0)
+        {
+            return;
+        }
+    uint64_t carry = symbol < 0.0 ? 1ULL : 0ULL;  // symbols clipping
+    for (auto& word : d_register)
+        {
+            const uint64_t next_carry = word >> 63;
+            word = (word << 1) | carry;
+            carry = next_carry;
+        }
+    d_register.back() &= d_top_word_mask;
+    if (d_symbols_in_register < d_length)
+        {
+            d_symbols_in_register++;
+        }
+}
@@ -0,0 +1,163 @@
+/*!
+ * \file tlm_preamble_detector.h
+ * \brief Bit-packed preamble detector shared by the telemetry decoder blocks.
+ * \author agent, 2026. agent(at)local
+ *
+ * The hard-decision signs of the symbols at the beginning of the symbol
+ * history are kept in a packed shift register, so the preamble correlation
+ * is computed with a XOR and a population count instead of a loop over the
+ * preamble samples.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TLM_PREAMBLE_DETECTOR_H
+#define GNSS_SDR_TLM_PREAMBLE_DETECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Telemetry_Decoder
+ * \{ */
+/** \addtogroup Telemetry_Decoder_libs
+ * \{ */
+
+
+/*!
+ * \brief Preamble detector based on a packed shift register of symbol signs.
+ *
+ * It mirrors the first length() symbols of the symbol history of a telemetry
+ * decoder (a boost::circular_buffer of float or of Gnss_Synchro items), which
+ * is where the decoders look for the preamble. update() must be called once
+ * after each push_back() on the history. Any other change in the history
+ * (clear(), set_capacity()) is detected and the register is rebuilt.
+ */
+class Tlm_Preamble_Detector
+{
+public:
+    Tlm_Preamble_Detector() = default;
+
+    /*!
+     * \brief Sets the preamble as a sequence of +1 / -1 samples.
+     * Preambles of any length are accepted.
+     */
+    void set_preamble(const int32_t* preamble_samples, int32_t length);
+
+    /*!
+     * \brief Clears the shift register
+     */
+    void reset();
+
+    /*!
+     * \brief Updates the shift register after a push_back() on the symbol history
+     */
+    template <typename Container>
+    void update(const Container& history);
+
+    /*!
+     * \brief Hard-decision correlation of the first length() symbols of
+     * the history with the preamble, in the range [-length(), length()].
+     * Returns 0 if there are not enough symbols yet.
+     */
+    int32_t correlation() const;
+
+    /*!
+     * \brief Soft-decision correlation of the first length() symbols of
+     * the history with the preamble. Intended to confirm a detection
+     * obtained with correlation().
+     */
+    template <typename Container>
+    float soft_correlation(const Container& history) const;
+
+    inline int32_t length() const { return d_length; }
+
+private:
+    static inline double symbol_value(float symbol) { return symbol; }
+
+    template <typename T>
+    static inline double symbol_value(const T& symbol)
+    {
+        return symbol.Prompt_I;
+    }
+
+    template <typename Container>
+    void rebuild(const Container& history);
+
+    void shift_in(double symbol);
+
+    std::vector<int32_t> d_preamble_samples;
+    std::vector<uint64_t> d_pattern;   // bit set for negative preamble samples, oldest symbol in the MSB
+    std::vector<uint64_t> d_register;  // bit set for negative symbols, oldest symbol in the MSB
+    uint64_t d_top_word_mask{0ULL};
+    size_t d_history_size{0};
+    int32_t d_length{0};
+    int32_t d_symbols_in_register{0};
+};
+
+
+template <typename Container>
+void Tlm_Preamble_Detector::update(const Container& history)
+{
+    const size_t history_size = history.size();
+    const auto length = static_cast<size_t>(d_length);
+    if (history_size == d_history_size + 1)
+        {
+            // the history grew: the window only changes while it is being filled
+            if (history_size <= length)
+                {
+                    shift_in(symbol_value(history[history_size - 1]));
+                }
+        }
+    else if (history_size == d_history_size and history.full() and history_size > length)
+        {
+            // the oldest symbol was dropped: the window slides by one symbol
+            shift_in(symbol_value(history[length - 1]));
+        }
+    else
+        {
+            rebuild(history);
+        }
+    d_history_size = history_size;
+}
+
+
+template <typename Container>
+float Tlm_Preamble_Detector::soft_correlation(const Container& history) const
+{
+    double corr_value = 0.0;
+    if (history.size() < static_cast<size_t>(d_length))
+        {
+            return 0.0;
+        }
+    for (int32_t i = 0; i < d_length; i++)
+        {
+            corr_value += static_cast<double>(d_preamble_samples[i]) * symbol_value(history[i]);
+        }
+    return static_cast<float>(corr_value);
+}
+
+
+template <typename Container>
+void Tlm_Preamble_Detector::rebuild(const Container& history)
+{
+    reset();
+    const size_t n = history.size() < static_cast<size_t>(d_length) ? history.size() : static_cast<size_t>(d_length);
+    for (size_t i = 0; i < n; i++)
+        {
+            shift_in(symbol_value(history[i]));
+        }
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TLM_PREAMBLE_DETECTOR_H
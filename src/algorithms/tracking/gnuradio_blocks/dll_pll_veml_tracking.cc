@@ -87,6 +87,7 @@ dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::block("dll_pll_veml_tracking", gr::io_signature::make(1, 1, sizeof(gr_complex)),
                                                                               gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
+    d_stats = Block_Stats_Registry::instance().make("Tracking", this->name());
     // prevent telemetry symbols accumulation in output buffers
     this->set_max_noutput_items(1);
     d_trk_parameters = conf_;
@@ -1652,6 +1653,7 @@ int32_t dll_pll_veml_tracking::save_matfile() const
 
 void dll_pll_veml_tracking::set_channel(uint32_t channel)
 {
+    d_stats->set_channel(static_cast<int32_t>(channel));
     gr::thread::scoped_lock l(d_setlock);
     d_channel = channel;
     LOG(INFO) << "Tracking Channel set to " << d_channel;
@@ -1698,6 +1700,7 @@ void dll_pll_veml_tracking::stop_tracking()
 int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    const Block_Stats_Scope stats_scope(d_stats.get(), static_cast<uint64_t>(ninput_items[0]));
     gr::thread::scoped_lock l(d_setlock);
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
@@ -186,54 +186,38 @@ Gps_L1_Ca_Kf_Tracking_cc::Gps_L1_Ca_Kf_Tracking_cc(
     double sigma2_doppler = 450;
     double sigma2_doppler_rate = pow(4.0 * TWO_PI, 2) / 12.0;
 
-    kf_P_x_ini = arma::zeros(2, 2);
+    kf_P_x_ini.zeros();
     kf_P_x_ini(0, 0) = sigma2_carrier_phase;
     kf_P_x_ini(1, 1) = sigma2_doppler;
 
-    kf_R = arma::zeros(1, 1);
     kf_R(0, 0) = sigma2_phase_detector_cycles2;
 
-    kf_Q = arma::zeros(2, 2);
+    kf_Q.zeros();
     kf_Q(0, 0) = pow(GPS_L1_CA_CODE_PERIOD_S, 4);
     kf_Q(1, 1) = GPS_L1_CA_CODE_PERIOD_S;
 
-    kf_F = arma::zeros(2, 2);
+    kf_F.zeros();
     kf_F(0, 0) = 1.0;
     kf_F(0, 1) = TWO_PI * GPS_L1_CA_CODE_PERIOD_S;
-    kf_F(1, 0) = 0.0;
     kf_F(1, 1) = 1.0;
+    kf_F(2, 2) = 1.0;
 
-    kf_H = arma::zeros(1, 2);
+    kf_H.zeros();
     kf_H(0, 0) = 1.0;
 
-    kf_x = arma::zeros(2, 1);
-    kf_y = arma::zeros(1, 1);
-    kf_P_y = arma::zeros(1, 1);
+    kf_x.zeros();
+    kf_y.zeros();
+    kf_P_y.zeros();
 
     // order three
     if (d_order == 3)
         {
-            kf_P_x_ini = arma::resize(kf_P_x_ini, 3, 3);
             kf_P_x_ini(2, 2) = sigma2_doppler_rate;
-
-            kf_Q = arma::zeros(3, 3);
-            kf_Q(0, 0) = pow(GPS_L1_CA_CODE_PERIOD_S, 4);
-            kf_Q(1, 1) = GPS_L1_CA_CODE_PERIOD_S;
             kf_Q(2, 2) = GPS_L1_CA_CODE_PERIOD_S;
-
-            kf_F = arma::resize(kf_F, 3, 3);
             kf_F(0, 2) = 0.5 * TWO_PI * pow(GPS_L1_CA_CODE_PERIOD_S, 2);
             kf_F(1, 2) = GPS_L1_CA_CODE_PERIOD_S;
-            kf_F(2, 0) = 0.0;
-            kf_F(2, 1) = 0.0;
-            kf_F(2, 2) = 1.0;
-
-            kf_H = arma::resize(kf_H, 1, 3);
-            kf_H(0, 2) = 0.0;
-
-            kf_x = arma::resize(kf_x, 3, 1);
-            kf_x(2, 0) = 0.0;
         }
+    kf.initialize(kf_x, kf_P_x_ini);
 
     // Bayesian covariance estimator initialization
     kf_iter = 0;
@@ -653,14 +637,11 @@ int Gps_L1_Ca_Kf_Tracking_cc::general_work(int noutput_items __attribute__((unus
                     current_synchro_data.correlation_length_ms = 1;
                     *out[0] = current_synchro_data;
                     // Kalman filter initialization reset
-                    kf_P_x = kf_P_x_ini;
                     // Update Kalman states based on acquisition information
                     kf_x(0) = d_carrier_phase_step_rad * samples_offset;
                     kf_x(1) = d_carrier_doppler_hz;
-                    if (kf_x.n_elem > 2)
-                        {
-                            kf_x(2) = d_carrier_dopplerrate_hz2;
-                        }
+                    kf_x(2) = (d_order == 3) ? d_carrier_dopplerrate_hz2 : 0.0;
+                    kf.initialize(kf_x, kf_P_x_ini);
 
                     // Covariance estimation initialization reset
                     kf_iter = 0;
@@ -683,8 +664,7 @@ int Gps_L1_Ca_Kf_Tracking_cc::general_work(int noutput_items __attribute__((unus
             // ################## Kalman Carrier Tracking ######################################
 
             // Kalman state prediction (time update)
-            kf_x_pre = kf_F * kf_x;                        // state prediction
-            kf_P_x_pre = kf_F * kf_P_x * kf_F.t() + kf_Q;  // state error covariance prediction
+            kf.predict(kf_F, kf_Q);  // state and state error covariance prediction
 
             // Update discriminator [rads/Ti]
             d_carr_phase_error_rad = pll_cloop_two_quadrant_atan(d_correlator_outs[1]);  // prompt output
@@ -704,31 +684,22 @@ int Gps_L1_Ca_Kf_Tracking_cc::general_work(int noutput_items __attribute__((unus
             if (bayes_run && (kf_iter >= (bayes_ptrans + bayes_strans)))
                 {
                     // TODO: Resolve segmentation fault
-                    kf_P_y = bayes_estimator.get_Psi_est();
-                    kf_R_est = kf_P_y - kf_H * kf_P_x_pre * kf_H.t();
+                    kf_P_y(0, 0) = bayes_estimator.get_Psi_est()(0, 0);
+                    kf_R_est(0, 0) = kf_P_y(0, 0) - (kf.innovation_covariance(kf_H, kf_R)(0, 0) - kf_R(0, 0));
                 }
             else
                 {
-                    kf_P_y = kf_H * kf_P_x_pre * kf_H.t() + kf_R;  // innovation covariance matrix
+                    kf_P_y = kf.innovation_covariance(kf_H, kf_R);  // innovation covariance matrix
                     kf_R_est = kf_R;
                 }
 
-            // Kalman filter update step
-            kf_K = (kf_P_x_pre * kf_H.t()) * arma::inv(kf_P_y);                 // Kalman gain
-            kf_x = kf_x_pre + kf_K * kf_y;                                      // updated state estimation
-            kf_P_x = (arma::eye(size(kf_P_x_pre)) - kf_K * kf_H) * kf_P_x_pre;  // update state estimation error covariance matrix
+            // Kalman filter update step: gain, state estimation and state estimation error covariance matrix
+            kf.update_innovation(kf_y, kf_H, kf_P_y);
 
             // Store Kalman filter results
-            d_rem_carr_phase_rad = kf_x(0);  // set a new carrier Phase estimation to the NCO
-            d_carrier_doppler_hz = kf_x(1);  // set a new carrier Doppler estimation to the NCO
-            if (kf_x.n_elem > 2)
-                {
-                    d_carrier_dopplerrate_hz2 = kf_x(2);
-                }
-            else
-                {
-                    d_carrier_dopplerrate_hz2 = 0;
-                }
+            d_rem_carr_phase_rad = kf.get_x_est()(0);  // set a new carrier Phase estimation to the NCO
+            d_carrier_doppler_hz = kf.get_x_est()(1);  // set a new carrier Doppler estimation to the NCO
+            d_carrier_dopplerrate_hz2 = kf.get_x_est()(2);
             d_carr_phase_sigma2 = kf_R_est(0, 0);
 
             // ################## DLL ##########################################################
@@ -32,6 +32,7 @@
 
 #include "bayesian_estimation.h"
 #include "cpu_multicorrelator_real_codes.h"
+#include "fixed_size_kalman_filters.h"
 #include "gnss_block_interface.h"
 #include "gnss_synchro.h"
 #include "tracking_2nd_DLL_filter.h"
@@ -131,25 +132,25 @@ private:
     double d_rem_code_phase_chips;
     float d_rem_carr_phase_rad;
 
-    // Kalman filter variables
-    arma::mat kf_P_x_ini;  // initial state error covariance matrix
-    arma::mat kf_P_x;      // state error covariance matrix
-    arma::mat kf_P_x_pre;  // Predicted state error covariance matrix
-    arma::mat kf_P_y;      // innovation covariance matrix
+    // Kalman filter variables. The state is always [phase, Doppler, Doppler
+    // rate]. For the second order model, the Doppler rate entries of the
+    // matrices are zero, so that state stays at zero and does not change the
+    // other two.
+    Fixed_Size_Kalman_Filter<3, 1> kf;
+    arma::mat::fixed<3, 3> kf_P_x_ini;  // initial state error covariance matrix
+    arma::mat::fixed<1, 1> kf_P_y;      // innovation covariance matrix
 
-    arma::mat kf_F;  // state transition matrix
-    arma::mat kf_H;  // system matrix
-    arma::mat kf_R;  // measurement error covariance matrix
-    arma::mat kf_Q;  // system error covariance matrix
+    arma::mat::fixed<3, 3> kf_F;  // state transition matrix
+    arma::mat::fixed<1, 3> kf_H;  // system matrix
+    arma::mat::fixed<1, 1> kf_R;  // measurement error covariance matrix
+    arma::mat::fixed<3, 3> kf_Q;  // system error covariance matrix
 
-    arma::colvec kf_x;      // state vector
-    arma::colvec kf_x_pre;  // predicted state vector
-    arma::colvec kf_y;      // measurement vector
-    arma::mat kf_K;         // Kalman gain matrix
+    arma::vec::fixed<3> kf_x;  // state vector
+    arma::vec::fixed<1> kf_y;  // measurement vector
 
     // Bayesian estimator
     Bayesian_estimator bayes_estimator;
-    arma::mat kf_R_est;  // measurement error covariance
+    arma::mat::fixed<1, 1> kf_R_est;  // measurement error covariance
     uint32_t bayes_ptrans;
     uint32_t bayes_strans;
     int32_t bayes_nu;
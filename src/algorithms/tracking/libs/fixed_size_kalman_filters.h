@@ -0,0 +1,780 @@
+/*!
+ * \file fixed_size_kalman_filters.h
+ * \brief Kalman, cubature and unscented filters with sizes known at compile
+ * time
+ *
+ * The filters in nonlinear_tracking.h work on dynamically sized Armadillo
+ * objects and build temporaries (generator matrices, Cholesky factors,
+ * inverses) at every step. The templates in this file keep all the state in
+ * arma::mat::fixed / arma::vec::fixed members and do the small matrix algebra
+ * with loops whose bounds are known at compile time, so an update does not
+ * allocate memory. They are intended for carrier tracking models (two or
+ * three states, one or two measurements).
+ *
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FIXED_SIZE_KALMAN_FILTERS_H
+#define GNSS_SDR_FIXED_SIZE_KALMAN_FILTERS_H
+
+#if ARMA_NO_BOUND_CHECKING
+#define ARMA_NO_DEBUG 1
+#endif
+
+#include <armadillo>
+#include <cmath>
+#include <utility>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Lower triangular Cholesky factor L of A (A = L * L').
+ * Returns false if A is not positive definite.
+ */
+template <arma::uword N>
+inline bool fixed_size_cholesky(const arma::mat::fixed<N, N>& A, arma::mat::fixed<N, N>& L)
+{
+    L.zeros();
+    for (arma::uword j = 0; j < N; j++)
+        {
+            double diagonal = A(j, j);
+            for (arma::uword k = 0; k < j; k++)
+                {
+                    diagonal -= L(j, k) * L(j, k);
+                }
+            if (!(diagonal > 0.0))
+                {
+                    return false;
+                }
+            L(j, j) = std::sqrt(diagonal);
+            for (arma::uword i = j + 1; i < N; i++)
+                {
+                    double value = A(i, j);
+                    for (arma::uword k = 0; k < j; k++)
+                        {
+                            value -= L(i, k) * L(j, k);
+                        }
+                    L(i, j) = value / L(j, j);
+                }
+        }
+    return true;
+}
+
+
+/*!
+ * \brief Inverse of a small square matrix (Gauss-Jordan elimination with
+ * partial pivoting). Returns false if A is singular.
+ */
+template <arma::uword N>
+inline bool fixed_size_inverse(const arma::mat::fixed<N, N>& A, arma::mat::fixed<N, N>& A_inv)
+{
+    arma::mat::fixed<N, N> work = A;
+    A_inv.zeros();
+    for (arma::uword i = 0; i < N; i++)
+        {
+            A_inv(i, i) = 1.0;
+        }
+    for (arma::uword c = 0; c < N; c++)
+        {
+            arma::uword pivot = c;
+            for (arma::uword r = c + 1; r < N; r++)
+                {
+                    if (std::abs(work(r, c)) > std::abs(work(pivot, c)))
+                        {
+                            pivot = r;
+                        }
+                }
+            if (work(pivot, c) == 0.0)
+                {
+                    return false;
+                }
+            if (pivot != c)
+                {
+                    for (arma::uword k = 0; k < N; k++)
+                        {
+                            std::swap(work(c, k), work(pivot, k));
+                            std::swap(A_inv(c, k), A_inv(pivot, k));
+                        }
+                }
+            const double scale = 1.0 / work(c, c);
+            for (arma::uword k = 0; k < N; k++)
+                {
+                    work(c, k) *= scale;
+                    A_inv(c, k) *= scale;
+                }
+            for (arma::uword r = 0; r < N; r++)
+                {
+                    const double factor = work(r, c);
+                    if (r != c && factor != 0.0)
+                        {
+                            for (arma::uword k = 0; k < N; k++)
+                                {
+                                    work(r, k) -= factor * work(c, k);
+                                    A_inv(r, k) -= factor * A_inv(c, k);
+                                }
+                        }
+                }
+        }
+    return true;
+}
+
+
+template <>
+inline bool fixed_size_inverse<1>(const arma::mat::fixed<1, 1>& A, arma::mat::fixed<1, 1>& A_inv)
+{
+    if (A(0, 0) == 0.0)
+        {
+            return false;
+        }
+    A_inv(0, 0) = 1.0 / A(0, 0);
+    return true;
+}
+
+
+template <>
+inline bool fixed_size_inverse<2>(const arma::mat::fixed<2, 2>& A, arma::mat::fixed<2, 2>& A_inv)
+{
+    const double det = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+    if (det == 0.0)
+        {
+            return false;
+        }
+    const double inv_det = 1.0 / det;
+    A_inv(0, 0) = A(1, 1) * inv_det;
+    A_inv(0, 1) = -A(0, 1) * inv_det;
+    A_inv(1, 0) = -A(1, 0) * inv_det;
+    A_inv(1, 1) = A(0, 0) * inv_det;
+    return true;
+}
+
+
+/*!
+ * \brief Measurement update shared by the sigma point filters:
+ * W = P_xz * inv(P_zz), x_est = x_pred + W * (z - z_pred) and
+ * P_x_est = P_x_pred - W * P_zz * W'. Returns false if P_zz is singular.
+ */
+template <arma::uword Nx, arma::uword Nz>
+inline bool fixed_size_sigma_point_update(const arma::vec::fixed<Nz>& z_upd,
+    const arma::vec::fixed<Nz>& z_pred,
+    const arma::vec::fixed<Nx>& x_pred,
+    const arma::mat::fixed<Nx, Nx>& P_x_pred,
+    const arma::mat::fixed<Nx, Nz>& P_xz_pred,
+    const arma::mat::fixed<Nz, Nz>& P_zz_pred,
+    arma::vec::fixed<Nx>& x_est,
+    arma::mat::fixed<Nx, Nx>& P_x_est)
+{
+    arma::mat::fixed<Nz, Nz> P_zz_inv;
+    if (!fixed_size_inverse<Nz>(P_zz_pred, P_zz_inv))
+        {
+            return false;
+        }
+    arma::mat::fixed<Nx, Nz> W_k;
+    for (arma::uword r = 0; r < Nx; r++)
+        {
+            for (arma::uword c = 0; c < Nz; c++)
+                {
+                    double value = 0.0;
+                    for (arma::uword k = 0; k < Nz; k++)
+                        {
+                            value += P_xz_pred(r, k) * P_zz_inv(k, c);
+                        }
+                    W_k(r, c) = value;
+                }
+        }
+    for (arma::uword r = 0; r < Nx; r++)
+        {
+            double value = x_pred(r);
+            for (arma::uword k = 0; k < Nz; k++)
+                {
+                    value += W_k(r, k) * (z_upd(k) - z_pred(k));
+                }
+            x_est(r) = value;
+        }
+    // W * P_zz * W' = P_xz * W'
+    for (arma::uword r = 0; r < Nx; r++)
+        {
+            for (arma::uword c = 0; c < Nx; c++)
+                {
+                    double value = P_x_pred(r, c);
+                    for (arma::uword k = 0; k < Nz; k++)
+                        {
+                            value -= P_xz_pred(r, k) * W_k(c, k);
+                        }
+                    P_x_est(r, c) = value;
+                }
+        }
+    return true;
+}
+
+
+/*!
+ * \brief Linear Kalman filter with Nx states and Nz measurements
+ */
+template <arma::uword Nx, arma::uword Nz>
+class Fixed_Size_Kalman_Filter
+{
+public:
+    using state_vector = arma::vec::fixed<Nx>;
+    using state_matrix = arma::mat::fixed<Nx, Nx>;
+    using measurement_vector = arma::vec::fixed<Nz>;
+    using measurement_matrix = arma::mat::fixed<Nz, Nz>;
+    using observation_matrix = arma::mat::fixed<Nz, Nx>;
+
+    Fixed_Size_Kalman_Filter()
+    {
+        x_est.zeros();
+        P_x_est.zeros();
+        x_pred = x_est;
+        P_x_pred = P_x_est;
+    }
+
+    void initialize(const state_vector& x_0, const state_matrix& P_x_0)
+    {
+        x_est = x_0;
+        P_x_est = P_x_0;
+        x_pred = x_est;
+        P_x_pred = P_x_est;
+    }
+
+    /*!
+     * \brief x_pred = F * x_est, P_x_pred = F * P_x_est * F' + Q
+     */
+    void predict(const state_matrix& F, const state_matrix& Q)
+    {
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                double value = 0.0;
+                for (arma::uword k = 0; k < Nx; k++)
+                    {
+                        value += F(i, k) * x_est(k);
+                    }
+                x_pred(i) = value;
+            }
+        state_matrix FP;
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                for (arma::uword j = 0; j < Nx; j++)
+                    {
+                        double value = 0.0;
+                        for (arma::uword k = 0; k < Nx; k++)
+                            {
+                                value += F(i, k) * P_x_est(k, j);
+                            }
+                        FP(i, j) = value;
+                    }
+            }
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                for (arma::uword j = 0; j < Nx; j++)
+                    {
+                        double value = Q(i, j);
+                        for (arma::uword k = 0; k < Nx; k++)
+                            {
+                                value += FP(i, k) * F(j, k);
+                            }
+                        P_x_pred(i, j) = value;
+                    }
+            }
+    }
+
+    /*!
+     * \brief Innovation covariance H * P_x_pred * H' + R
+     */
+    measurement_matrix innovation_covariance(const observation_matrix& H, const measurement_matrix& R) const
+    {
+        measurement_matrix P_y;
+        for (arma::uword i = 0; i < Nz; i++)
+            {
+                for (arma::uword j = 0; j < Nz; j++)
+                    {
+                        double value = R(i, j);
+                        for (arma::uword a = 0; a < Nx; a++)
+                            {
+                                for (arma::uword b = 0; b < Nx; b++)
+                                    {
+                                        value += H(i, a) * P_x_pred(a, b) * H(j, b);
+                                    }
+                            }
+                        P_y(i, j) = value;
+                    }
+            }
+        return P_y;
+    }
+
+    /*!
+     * \brief Update with the innovation y = z - H * x_pred and its covariance
+     * P_y. Returns false (and keeps the prediction) if P_y is singular.
+     */
+    bool update_innovation(const measurement_vector& y, const observation_matrix& H, const measurement_matrix& P_y)
+    {
+        measurement_matrix P_y_inv;
+        if (!fixed_size_inverse<Nz>(P_y, P_y_inv))
+            {
+                x_est = x_pred;
+                P_x_est = P_x_pred;
+                return false;
+            }
+        // K = P_x_pred * H' * inv(P_y)
+        arma::mat::fixed<Nx, Nz> PHt;
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                for (arma::uword j = 0; j < Nz; j++)
+                    {
+                        double value = 0.0;
+                        for (arma::uword k = 0; k < Nx; k++)
+                            {
+                                value += P_x_pred(i, k) * H(j, k);
+                            }
+                        PHt(i, j) = value;
+                    }
+            }
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                for (arma::uword j = 0; j < Nz; j++)
+                    {
+                        double value = 0.0;
+                        for (arma::uword k = 0; k < Nz; k++)
+                            {
+                                value += PHt(i, k) * P_y_inv(k, j);
+                            }
+                        K(i, j) = value;
+                    }
+            }
+        // x_est = x_pred + K * y
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                double value = x_pred(i);
+                for (arma::uword k = 0; k < Nz; k++)
+                    {
+                        value += K(i, k) * y(k);
+                    }
+                x_est(i) = value;
+            }
+        // P_x_est = (I - K * H) * P_x_pred
+        for (arma::uword i = 0; i < Nx; i++)
+            {
+                for (arma::uword j = 0; j < Nx; j++)
+                    {
+                        double value = P_x_pred(i, j);
+                        for (arma::uword a = 0; a < Nz; a++)
+                            {
+                                for (arma::uword b = 0; b < Nx; b++)
+                                    {
+                                        value -= K(i, a) * H(a, b) * P_x_pred(b, j);
+                                    }
+                            }
+                        P_x_est(i, j) = value;
+                    }
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Update with the measurement z
+     */
+    bool update(const measurement_vector& z, const observation_matrix& H, const measurement_matrix& R)
+    {
+        measurement_vector y;
+        for (arma::uword i = 0; i < Nz; i++)
+            {
+                double value = z(i);
+                for (arma::uword k = 0; k < Nx; k++)
+                    {
+                        value -= H(i, k) * x_pred(k);
+                    }
+                y(i) = value;
+            }
+        return update_innovation(y, H, innovation_covariance(H, R));
+    }
+
+    inline const state_vector& get_x_pred() const { return x_pred; }
+    inline const state_matrix& get_P_x_pred() const { return P_x_pred; }
+    inline const state_vector& get_x_est() const { return x_est; }
+    inline const state_matrix& get_P_x_est() const { return P_x_est; }
+    inline const arma::mat::fixed<Nx, Nz>& get_K() const { return K; }
+
+private:
+    state_vector x_pred;
+    state_matrix P_x_pred;
+    state_vector x_est;
+    state_matrix P_x_est;
+    arma::mat::fixed<Nx, Nz> K;
+};
+
+
+/*!
+ * \brief Cubature Kalman filter with Nx states and Nz measurements.
+ *
+ * Same algorithm as CubatureFilter. The model functions are callables taking
+ * a state vector and returning a state vector (transition) or a measurement
+ * vector (measurement), both of fixed size.
+ */
+template <arma::uword Nx, arma::uword Nz>
+class Fixed_Size_Cubature_Filter
+{
+public:
+    using state_vector = arma::vec::fixed<Nx>;
+    using state_matrix = arma::mat::fixed<Nx, Nx>;
+    using measurement_vector = arma::vec::fixed<Nz>;
+    using measurement_matrix = arma::mat::fixed<Nz, Nz>;
+
+    Fixed_Size_Cubature_Filter()
+    {
+        x_pred_out.zeros();
+        P_x_pred_out.eye();
+        P_x_pred_out *= static_cast<double>(Nx + 1);
+        x_est = x_pred_out;
+        P_x_est = P_x_pred_out;
+    }
+
+    void initialize(const state_vector& x_pred_0, const state_matrix& P_x_pred_0)
+    {
+        x_pred_out = x_pred_0;
+        P_x_pred_out = P_x_pred_0;
+        x_est = x_pred_out;
+        P_x_est = P_x_pred_out;
+    }
+
+    /*!
+     * \brief Prediction step. Returns false if P_x_post is not positive definite.
+     */
+    template <typename Transition>
+    bool predict_sequential(const state_vector& x_post, const state_matrix& P_x_post, Transition&& transition_fcn, const state_matrix& noise_covariance)
+    {
+        state_matrix Sm_post;
+        if (!fixed_size_cholesky<Nx>(P_x_post, Sm_post))
+            {
+                return false;
+            }
+        const double scale = std::sqrt(static_cast<double>(Nx));
+        state_vector x_sum;
+        state_matrix P_sum;
+        x_sum.zeros();
+        P_sum.zeros();
+        state_vector Xi_post;
+        for (arma::uword i = 0; i < 2 * Nx; i++)
+            {
+                // Cubature point i is x_post +/- sqrt(Nx) times the column i % Nx of Sm_post
+                const double sign = (i < Nx) ? scale : -scale;
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        Xi_post(r) = x_post(r) + sign * Sm_post(r, i % Nx);
+                    }
+                const state_vector Xi_pred = transition_fcn(Xi_post);
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        x_sum(r) += Xi_pred(r);
+                        for (arma::uword c = 0; c < Nx; c++)
+                            {
+                                P_sum(r, c) += Xi_pred(r) * Xi_pred(c);
+                            }
+                    }
+            }
+        const double inv_np = 1.0 / static_cast<double>(2 * Nx);
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                x_pred_out(r) = x_sum(r) * inv_np;
+            }
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                for (arma::uword c = 0; c < Nx; c++)
+                    {
+                        P_x_pred_out(r, c) = P_sum(r, c) * inv_np - x_pred_out(r) * x_pred_out(c) + noise_covariance(r, c);
+                    }
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Update step. Returns false if P_x_pred is not positive definite
+     * or the measurement covariance is singular.
+     */
+    template <typename Measurement>
+    bool update_sequential(const measurement_vector& z_upd, const state_vector& x_pred, const state_matrix& P_x_pred, Measurement&& measurement_fcn, const measurement_matrix& noise_covariance)
+    {
+        state_matrix Sm_pred;
+        if (!fixed_size_cholesky<Nx>(P_x_pred, Sm_pred))
+            {
+                return false;
+            }
+        const double scale = std::sqrt(static_cast<double>(Nx));
+        measurement_vector z_sum;
+        measurement_matrix P_zz_sum;
+        arma::mat::fixed<Nx, Nz> P_xz_sum;
+        z_sum.zeros();
+        P_zz_sum.zeros();
+        P_xz_sum.zeros();
+        state_vector Xi_pred;
+        for (arma::uword i = 0; i < 2 * Nx; i++)
+            {
+                const double sign = (i < Nx) ? scale : -scale;
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        Xi_pred(r) = x_pred(r) + sign * Sm_pred(r, i % Nx);
+                    }
+                const measurement_vector Zi_pred = measurement_fcn(Xi_pred);
+                for (arma::uword r = 0; r < Nz; r++)
+                    {
+                        z_sum(r) += Zi_pred(r);
+                        for (arma::uword c = 0; c < Nz; c++)
+                            {
+                                P_zz_sum(r, c) += Zi_pred(r) * Zi_pred(c);
+                            }
+                    }
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        for (arma::uword c = 0; c < Nz; c++)
+                            {
+                                P_xz_sum(r, c) += Xi_pred(r) * Zi_pred(c);
+                            }
+                    }
+            }
+        const double inv_np = 1.0 / static_cast<double>(2 * Nx);
+        measurement_vector z_pred;
+        for (arma::uword r = 0; r < Nz; r++)
+            {
+                z_pred(r) = z_sum(r) * inv_np;
+            }
+        measurement_matrix P_zz_pred;
+        for (arma::uword r = 0; r < Nz; r++)
+            {
+                for (arma::uword c = 0; c < Nz; c++)
+                    {
+                        P_zz_pred(r, c) = P_zz_sum(r, c) * inv_np - z_pred(r) * z_pred(c) + noise_covariance(r, c);
+                    }
+            }
+        arma::mat::fixed<Nx, Nz> P_xz_pred;
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                for (arma::uword c = 0; c < Nz; c++)
+                    {
+                        P_xz_pred(r, c) = P_xz_sum(r, c) * inv_np - x_pred(r) * z_pred(c);
+                    }
+            }
+        return fixed_size_sigma_point_update<Nx, Nz>(z_upd, z_pred, x_pred, P_x_pred, P_xz_pred, P_zz_pred, x_est, P_x_est);
+    }
+
+    inline const state_vector& get_x_pred() const { return x_pred_out; }
+    inline const state_matrix& get_P_x_pred() const { return P_x_pred_out; }
+    inline const state_vector& get_x_est() const { return x_est; }
+    inline const state_matrix& get_P_x_est() const { return P_x_est; }
+
+private:
+    state_vector x_pred_out;
+    state_matrix P_x_pred_out;
+    state_vector x_est;
+    state_matrix P_x_est;
+};
+
+
+/*!
+ * \brief Unscented Kalman filter with Nx states and Nz measurements.
+ *
+ * Same weights as UnscentedFilter (alpha = 0.001, beta = 2, kappa = 0).
+ * The sigma points are spread along the columns of the Cholesky factor of
+ * the covariance, which is cheaper than the symmetric square root.
+ */
+template <arma::uword Nx, arma::uword Nz>
+class Fixed_Size_Unscented_Filter
+{
+public:
+    using state_vector = arma::vec::fixed<Nx>;
+    using state_matrix = arma::mat::fixed<Nx, Nx>;
+    using measurement_vector = arma::vec::fixed<Nz>;
+    using measurement_matrix = arma::mat::fixed<Nz, Nz>;
+
+    Fixed_Size_Unscented_Filter()
+    {
+        const double alpha = 0.001;
+        const double kappa = 0.0;
+        const double beta = 2.0;
+        const double nx = static_cast<double>(Nx);
+        const double lambda = alpha * alpha * (nx + kappa) - nx;
+        W0_m = lambda / (nx + lambda);
+        W0_c = W0_m + (1.0 - alpha * alpha + beta);
+        Wi_m = 1.0 / (2.0 * (nx + lambda));
+        spread = std::sqrt(nx + lambda);
+
+        x_pred_out.zeros();
+        P_x_pred_out.eye();
+        P_x_pred_out *= nx + 1.0;
+        x_est = x_pred_out;
+        P_x_est = P_x_pred_out;
+    }
+
+    void initialize(const state_vector& x_pred_0, const state_matrix& P_x_pred_0)
+    {
+        x_pred_out = x_pred_0;
+        P_x_pred_out = P_x_pred_0;
+        x_est = x_pred_out;
+        P_x_est = P_x_pred_out;
+    }
+
+    /*!
+     * \brief Prediction step. Returns false if P_x_post is not positive definite.
+     */
+    template <typename Transition>
+    bool predict_sequential(const state_vector& x_post, const state_matrix& P_x_post, Transition&& transition_fcn, const state_matrix& noise_covariance)
+    {
+        state_matrix Sm_post;
+        if (!fixed_size_cholesky<Nx>(P_x_post, Sm_post))
+            {
+                return false;
+            }
+        arma::mat::fixed<Nx, 2 * Nx + 1> Xi_pred;
+        state_vector Xi_post;
+        for (arma::uword i = 0; i < 2 * Nx + 1; i++)
+            {
+                sigma_point(x_post, Sm_post, i, Xi_post);
+                const state_vector Xi = transition_fcn(Xi_post);
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        Xi_pred(r, i) = Xi(r);
+                    }
+            }
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                double sum = 0.0;
+                for (arma::uword i = 1; i < 2 * Nx + 1; i++)
+                    {
+                        sum += Xi_pred(r, i);
+                    }
+                x_pred_out(r) = W0_m * Xi_pred(r, 0) + Wi_m * sum;
+            }
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                for (arma::uword c = 0; c < Nx; c++)
+                    {
+                        double value = W0_c * (Xi_pred(r, 0) - x_pred_out(r)) * (Xi_pred(c, 0) - x_pred_out(c));
+                        for (arma::uword i = 1; i < 2 * Nx + 1; i++)
+                            {
+                                value += Wi_m * (Xi_pred(r, i) - x_pred_out(r)) * (Xi_pred(c, i) - x_pred_out(c));
+                            }
+                        P_x_pred_out(r, c) = value + noise_covariance(r, c);
+                    }
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Update step. Returns false if P_x_pred is not positive definite
+     * or the measurement covariance is singular.
+     */
+    template <typename Measurement>
+    bool update_sequential(const measurement_vector& z_upd, const state_vector& x_pred, const state_matrix& P_x_pred, Measurement&& measurement_fcn, const measurement_matrix& noise_covariance)
+    {
+        state_matrix Sm_pred;
+        if (!fixed_size_cholesky<Nx>(P_x_pred, Sm_pred))
+            {
+                return false;
+            }
+        arma::mat::fixed<Nx, 2 * Nx + 1> Xi_pred;
+        arma::mat::fixed<Nz, 2 * Nx + 1> Zi_pred;
+        state_vector Xi;
+        for (arma::uword i = 0; i < 2 * Nx + 1; i++)
+            {
+                sigma_point(x_pred, Sm_pred, i, Xi);
+                const measurement_vector Zi = measurement_fcn(Xi);
+                for (arma::uword r = 0; r < Nx; r++)
+                    {
+                        Xi_pred(r, i) = Xi(r);
+                    }
+                for (arma::uword r = 0; r < Nz; r++)
+                    {
+                        Zi_pred(r, i) = Zi(r);
+                    }
+            }
+        measurement_vector z_pred;
+        for (arma::uword r = 0; r < Nz; r++)
+            {
+                double sum = 0.0;
+                for (arma::uword i = 1; i < 2 * Nx + 1; i++)
+                    {
+                        sum += Zi_pred(r, i);
+                    }
+                z_pred(r) = W0_m * Zi_pred(r, 0) + Wi_m * sum;
+            }
+        measurement_matrix P_zz_pred;
+        for (arma::uword r = 0; r < Nz; r++)
+            {
+                for (arma::uword c = 0; c < Nz; c++)
+                    {
+                        double value = W0_c * (Zi_pred(r, 0) - z_pred(r)) * (Zi_pred(c, 0) - z_pred(c));
+                        for (arma::uword i = 1; i < 2 * Nx + 1; i++)
+                            {
+                                value += Wi_m * (Zi_pred(r, i) - z_pred(r)) * (Zi_pred(c, i) - z_pred(c));
+                            }
+                        P_zz_pred(r, c) = value + noise_covariance(r, c);
+                    }
+            }
+        arma::mat::fixed<Nx, Nz> P_xz_pred;
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                for (arma::uword c = 0; c < Nz; c++)
+                    {
+                        double value = W0_c * (Xi_pred(r, 0) - x_pred(r)) * (Zi_pred(c, 0) - z_pred(c));
+                        for (arma::uword i = 1; i < 2 * Nx + 1; i++)
+                            {
+                                value += Wi_m * (Xi_pred(r, i) - x_pred(r)) * (Zi_pred(c, i) - z_pred(c));
+                            }
+                        P_xz_pred(r, c) = value;
+                    }
+            }
+        return fixed_size_sigma_point_update<Nx, Nz>(z_upd, z_pred, x_pred, P_x_pred, P_xz_pred, P_zz_pred, x_est, P_x_est);
+    }
+
+    inline const state_vector& get_x_pred() const { return x_pred_out; }
+    inline const state_matrix& get_P_x_pred() const { return P_x_pred_out; }
+    inline const state_vector& get_x_est() const { return x_est; }
+    inline const state_matrix& get_P_x_est() const { return P_x_est; }
+
+private:
+    // Sigma point 0 is the mean, points 1..Nx and Nx+1..2Nx are the mean
+    // plus and minus the scaled columns of the covariance factor
+    inline void sigma_point(const state_vector& mean, const state_matrix& factor, arma::uword i, state_vector& point) const
+    {
+        for (arma::uword r = 0; r < Nx; r++)
+            {
+                if (i == 0)
+                    {
+                        point(r) = mean(r);
+                    }
+                else if (i <= Nx)
+                    {
+                        point(r) = mean(r) + spread * factor(r, i - 1);
+                    }
+                else
+                    {
+                        point(r) = mean(r) - spread * factor(r, i - Nx - 1);
+                    }
+            }
+    }
+
+    state_vector x_pred_out;
+    state_matrix P_x_pred_out;
+    state_vector x_est;
+    state_matrix P_x_est;
+    double W0_m;
+    double W0_c;
+    double Wi_m;
+    double spread;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FIXED_SIZE_KALMAN_FILTERS_H
@@ -28,7 +28,9 @@
 #include "gnss_block_interface.h"
 #include "gps_almanac.h"
 #include "gps_ephemeris.h"
+#include <pmt/pmt.h>
 #include <map>
+#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -55,6 +57,13 @@ public:
     virtual std::map<int, Gps_Almanac> get_gps_almanac() const = 0;
     virtual std::map<int, Galileo_Almanac> get_galileo_almanac() const = 0;
 
+    /*!
+     * \brief All the navigation data held by the PVT block (ephemeris,
+     * almanacs, UTC and ionospheric models of every system), as telemetry
+     * messages that can be sent to another PVT block
+     */
+    virtual std::vector<pmt::pmt_t> get_nav_data_msgs() const = 0;
+
     virtual bool get_latest_PVT(double* longitude_deg,
         double* latitude_deg,
         double* height_m,
@@ -46,8 +46,8 @@ int INIReader::ParseError() const
 
 std::string INIReader::Get(const std::string& section, const std::string& name, const std::string& default_value)
 {
-    std::string key = MakeKey(section, name);
-    return _values.count(key) ? _values[key] : default_value;
+    const auto it = _values.find(MakeKey(section, name));
+    return it != _values.end() ? it->second : default_value;
 }
 
 
@@ -19,6 +19,7 @@
 
 #include "gnss_sdr_supl_client.h"
 #include "GPS_L1_CA.h"
+#include "nav_data_store.h"
 #include <boost/archive/xml_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/serialization/map.hpp>
@@ -1059,3 +1060,49 @@ bool Gnss_Sdr_Supl_Client::save_ref_location_xml(const std::string& file_name, A
         }
     return true;
 }
+
+
+bool Gnss_Sdr_Supl_Client::save_nav_data_store(const std::string& file_name)
+{
+    Nav_Data_Store store(file_name);
+    store.load();
+    bool ok = store.put(gps_ephemeris_map);
+    ok = store.put(gal_ephemeris_map) && ok;
+    ok = store.put(gps_cnav_ephemeris_map) && ok;
+    ok = store.put(glonass_gnav_ephemeris_map) && ok;
+    ok = store.put(gps_almanac_map) && ok;
+    ok = store.put(gal_almanac_map) && ok;
+    if (gps_iono.valid == true)
+        {
+            ok = store.put(gps_iono) && ok;
+        }
+    if (gps_utc.valid == true)
+        {
+            ok = store.put(gps_utc) && ok;
+        }
+    if (gps_cnav_utc.valid == true)
+        {
+            ok = store.put(gps_cnav_utc) && ok;
+        }
+    if (glo_gnav_utc.valid == true)
+        {
+            ok = store.put(glo_gnav_utc) && ok;
+        }
+    if (gps_time.valid == true)
+        {
+            ok = store.put(gps_time) && ok;
+        }
+    if (gps_ref_loc.valid == true)
+        {
+            ok = store.put(gps_ref_loc) && ok;
+        }
+    if (ok)
+        {
+            LOG(INFO) << "Saved assistance data to " << file_name;
+        }
+    else
+        {
+            LOG(WARNING) << "Failed to save assistance data to " << file_name;
+        }
+    return ok;
+}
@@ -249,6 +249,13 @@ public:
     bool save_ref_location_xml(const std::string& file_name,
         Agnss_Ref_Location& ref_location);
 
+    /*!
+     * \brief Append the ephemeris, almanacs and the valid GPS models and
+     * reference time and location to a binary navigation data store (see
+     * Nav_Data_Store). Only the data that changed is written.
+     */
+    bool save_nav_data_store(const std::string& file_name);
+
     /*
      * Prints SUPL data to std::cout. Use it for debug purposes only.
      */
@@ -15,9 +15,60 @@
  * -----------------------------------------------------------------------------
  */
 
-
 #include "string_converter.h"
-#include <sstream>
+#include <cctype>   // for isspace
+#include <cerrno>   // for errno, ERANGE
+#include <cmath>    // for isfinite
+#include <cstdlib>  // for strtoll, strtoull, strtof, strtod
+#include <limits>   // for numeric_limits
+
+
+namespace
+{
+// The values are parsed with the C library, without building a
+// std::stringstream for each one. As with operator>>, leading whitespace
+// is skipped, parsing stops at the first invalid character, and the default
+// value is returned if no number is found or if it does not fit in T.
+template <typename T>
+T convert_signed(const std::string& value, T default_value)
+{
+    const char* begin = value.c_str();
+    char* end = nullptr;
+    errno = 0;
+    const long long result = std::strtoll(begin, &end, 10);  // NOLINT(google-runtime-int)
+    if (end == begin || errno == ERANGE ||
+        result < static_cast<long long>(std::numeric_limits<T>::min()) ||  // NOLINT(google-runtime-int)
+        result > static_cast<long long>(std::numeric_limits<T>::max()))    // NOLINT(google-runtime-int)
+        {
+            return default_value;
+        }
+    return static_cast<T>(result);
+}
+
+
+template <typename T>
+T convert_unsigned(const std::string& value, T default_value)
+{
+    const char* begin = value.c_str();
+    while (std::isspace(static_cast<unsigned char>(*begin)))
+        {
+            begin++;
+        }
+    if (*begin == '-')
+        {
+            return default_value;  // strtoull would wrap negative values
+        }
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long result = std::strtoull(begin, &end, 10);  // NOLINT(google-runtime-int)
+    if (end == begin || errno == ERANGE ||
+        result > static_cast<unsigned long long>(std::numeric_limits<T>::max()))  // NOLINT(google-runtime-int)
+        {
+            return default_value;
+        }
+    return static_cast<T>(result);
+}
+}  // namespace
 
 
 bool StringConverter::convert(const std::string& value, bool default_value)
@@ -37,127 +88,63 @@ bool StringConverter::convert(const std::string& value, bool default_value)
 
 int64_t StringConverter::convert(const std::string& value, int64_t default_value)
 {
-    std::stringstream stream(value);
-
-    int64_t result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_signed(value, default_value);
 }
 
 
 uint64_t StringConverter::convert(const std::string& value, uint64_t default_value)
 {
-    std::stringstream stream(value);
-
-    uint64_t result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_unsigned(value, default_value);
 }
 
 
 int32_t StringConverter::convert(const std::string& value, int32_t default_value)
 {
-    std::stringstream stream(value);
-
-    int result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_signed(value, default_value);
 }
 
 
 uint32_t StringConverter::convert(const std::string& value, uint32_t default_value)
 {
-    std::stringstream stream(value);
-
-    uint32_t result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_unsigned(value, default_value);
 }
 
 
 uint16_t StringConverter::convert(const std::string& value, uint16_t default_value)
 {
-    std::stringstream stream(value);
-
-    uint16_t result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_unsigned(value, default_value);
 }
 
 
 int16_t StringConverter::convert(const std::string& value, int16_t default_value)
 {
-    std::stringstream stream(value);
-
-    int16_t result;
-    stream >> result;
-
-    if (stream.fail())
-        {
-            return default_value;
-        }
-
-    return result;
+    return convert_signed(value, default_value);
 }
 
 
 float StringConverter::convert(const std::string& value, float default_value)
 {
-    std::stringstream stream(value);
-
-    float result;
-    stream >> result;
-
-    if (stream.fail())
+    const char* begin = value.c_str();
+    char* end = nullptr;
+    errno = 0;
+    const float result = std::strtof(begin, &end);
+    if (end == begin || errno == ERANGE || !std::isfinite(result))
         {
             return default_value;
         }
-
     return result;
 }
 
 
 double StringConverter::convert(const std::string& value, double default_value)
 {
-    std::stringstream stream(value);
-
-    double result;
-    stream >> result;
-
-    if (stream.fail())
+    const char* begin = value.c_str();
+    char* end = nullptr;
+    errno = 0;
+    const double result = std::strtod(begin, &end);
+    if (end == begin || errno == ERANGE || !std::isfinite(result))
         {
             return default_value;
         }
-
     return result;
 }
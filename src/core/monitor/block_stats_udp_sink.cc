@@ -0,0 +1,68 @@
+/*!
+ * \file block_stats_udp_sink.cc
+ * \brief Class that sends the counters of the processing blocks over UDP
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "block_stats_udp_sink.h"
+#include "gnss_sdr_make_unique.h"
+#include "udp_batch_sender.h"
+#include <boost/system/error_code.hpp>
+#include <glog/logging.h>
+
+
+Block_Stats_Udp_Sink::Block_Stats_Udp_Sink(const std::vector<std::string>& addresses, uint16_t port, int output_rate_ms)
+    : last_report(std::chrono::steady_clock::now()),
+      output_rate(std::chrono::milliseconds(output_rate_ms)),
+      sequence(0)
+{
+    boost::system::error_code error;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    for (const auto& address : addresses)
+        {
+            const auto ip_address = boost::asio::ip::address::from_string(address, error);
+            if (error)
+                {
+                    LOG(WARNING) << "Invalid block stats monitor address " << address << ": " << error.message();
+                    continue;
+                }
+            endpoints.emplace_back(ip_address, port);
+        }
+    // The parts of each report are queued and sent at once
+    sender = std::make_unique<Udp_Batch_Sender>(endpoints, 0);
+}
+
+
+Block_Stats_Udp_Sink::~Block_Stats_Udp_Sink() = default;
+
+
+bool Block_Stats_Udp_Sink::send_if_due()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_report < output_rate)
+        {
+            return true;
+        }
+    last_report = now;
+    const std::vector<Block_Stats_Snapshot> snaps = Block_Stats_Registry::instance().snapshot();
+    const std::vector<size_t> first = serdes.split(snaps, BLOCK_STATS_MAX_DATAGRAM_SIZE);
+    const auto parts = static_cast<uint32_t>(first.size() - 1);
+    bool sent = true;
+    for (uint32_t part = 0; part < parts; part++)
+        {
+            serdes.createProtobuffer(snaps, first[part], first[part + 1], sequence, part, parts, sender->next_datagram());
+            sent = sender->push() && sent;
+        }
+    sequence++;
+    return sender->flush() && sent;
+}
@@ -0,0 +1,69 @@
+/*!
+ * \file block_stats_udp_sink.h
+ * \brief Class that sends the counters of the processing blocks over UDP
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_BLOCK_STATS_UDP_SINK_H
+#define GNSS_SDR_BLOCK_STATS_UDP_SINK_H
+
+#include "serdes_block_stats.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+class Udp_Batch_Sender;
+
+// Maximum size of each datagram, so that it fits in an Ethernet frame
+constexpr size_t BLOCK_STATS_MAX_DATAGRAM_SIZE = 1472;
+
+/*!
+ * \brief This class sends the counters of all the processing blocks,
+ * serialized as a BlockStatsReport protocol buffer (see
+ * docs/protobuf/block_stats.proto), to one or multiple endpoints every
+ * output_rate_ms. Each report is split into parts of at most
+ * BLOCK_STATS_MAX_DATAGRAM_SIZE bytes, one per datagram.
+ */
+class Block_Stats_Udp_Sink
+{
+public:
+    Block_Stats_Udp_Sink(const std::vector<std::string>& addresses, uint16_t port, int output_rate_ms);
+    ~Block_Stats_Udp_Sink();
+
+    /*!
+     * \brief Sends the counters if output_rate_ms have elapsed since the
+     * last report. Returns false if sending failed.
+     */
+    bool send_if_due();
+
+private:
+    std::unique_ptr<Udp_Batch_Sender> sender;
+    Serdes_Block_Stats serdes;
+    std::chrono::steady_clock::time_point last_report;
+    std::chrono::milliseconds output_rate;
+    uint32_t sequence;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_BLOCK_STATS_UDP_SINK_H
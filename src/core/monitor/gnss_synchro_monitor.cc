@@ -28,13 +28,15 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    int max_latency_ms)
 {
     return gnss_synchro_monitor_sptr(new gnss_synchro_monitor(n_channels,
         decimation_factor,
         udp_port,
         udp_addresses,
-        enable_protobuf));
+        enable_protobuf,
+        max_latency_ms));
 }
 
 
@@ -42,14 +44,16 @@ gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf) : gr::block("gnss_synchro_monitor",
-                                gr::io_signature::make(n_channels, n_channels, sizeof(Gnss_Synchro)),
-                                gr::io_signature::make(0, 0, 0))
+    bool enable_protobuf,
+    int max_latency_ms) : gr::block("gnss_synchro_monitor",
+                              gr::io_signature::make(n_channels, n_channels, sizeof(Gnss_Synchro)),
+                              gr::io_signature::make(0, 0, 0))
 {
     d_decimation_factor = decimation_factor;
     d_nchannels = n_channels;
 
-    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf);
+    d_stocks = std::vector<Gnss_Synchro>(1);
+    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf, max_latency_ms);
 }
 
 void gnss_synchro_monitor::forecast(int noutput_items __attribute__((unused)), gr_vector_int& ninput_items_required)
@@ -78,10 +82,9 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                     count++;
                     if (count >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
-                            std::vector<Gnss_Synchro> stocks;
-                            stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            // Queue the item in the UDP sink
+                            d_stocks[0] = in[channel_index][item_index];
+                            udp_sink_ptr->write_gnss_synchro(d_stocks);
                             // Reset count variable
                             count = 0;
                         }
@@ -90,6 +93,9 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
             consume(channel_index, ninput_items[channel_index]);
         }
 
+    // Send the items of all the channels together
+    udp_sink_ptr->send_pending();
+
     // Not producing any outputs
     return 0;
 }
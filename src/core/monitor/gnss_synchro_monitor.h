@@ -43,7 +43,8 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf);
+    bool enable_protobuf,
+    int max_latency_ms = 0);
 
 /*!
  * \brief This class implements a monitoring block which allows sending
@@ -63,14 +64,17 @@ private:
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        int max_latency_ms);
 
     gnss_synchro_monitor(int n_channels,
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        int max_latency_ms);
 
+    std::vector<Gnss_Synchro> d_stocks;
     int d_nchannels;
     int d_decimation_factor;
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
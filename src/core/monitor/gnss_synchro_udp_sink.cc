@@ -16,53 +16,55 @@
  */
 
 #include "gnss_synchro_udp_sink.h"
+#include "gnss_sdr_make_unique.h"
+#include "udp_batch_sender.h"
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/serialization/vector.hpp>
-#include <iostream>
-#include <sstream>
 
-Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf) : socket{io_context}
+Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, int max_latency_ms)
 {
     use_protobuf = enable_protobuf;
     if (enable_protobuf)
         {
             serdes = Serdes_Gnss_Synchro();
         }
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
     for (const auto& address : addresses)
         {
             boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
             endpoints.push_back(endpoint);
         }
+    sender = std::make_unique<Udp_Batch_Sender>(endpoints, max_latency_ms);
 }
 
 
+Gnss_Synchro_Udp_Sink::~Gnss_Synchro_Udp_Sink() = default;
+
+
 bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
+    std::string& outbound_data = sender->next_datagram();
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
-            oa << stocks;
-            outbound_data = archive_stream.str();
+            boost::iostreams::back_insert_device<std::string> device(outbound_data);
+            boost::iostreams::stream<boost::iostreams::back_insert_device<std::string>> archive_stream(device);
+            {
+                boost::archive::binary_oarchive oa{archive_stream};
+                oa << stocks;
+            }
+            archive_stream.flush();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(stocks);
+            serdes.createProtobuffer(stocks, outbound_data);
         }
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
+    return sender->push();
+}
 
-            try
-                {
-                    socket.send(boost::asio::buffer(outbound_data));
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
-        }
-    return true;
+
+bool Gnss_Synchro_Udp_Sink::send_pending()
+{
+    return sender->send_if_due();
 }
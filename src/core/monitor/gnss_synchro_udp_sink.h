@@ -23,6 +23,7 @@
 #include <boost/asio.hpp>
 #include <boost/system/error_code.hpp>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,21 +39,28 @@ using b_io_context = boost::asio::io_context;
 using b_io_context = boost::asio::io_service;
 #endif
 
+class Udp_Batch_Sender;
+
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
+ *
+ * Each call to write_gnss_synchro() queues one datagram. The queued
+ * datagrams are sent together once the oldest one has waited
+ * max_latency_ms, even if no more datagrams are written. With 0, they are
+ * sent at every call to send_pending().
  */
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, int max_latency_ms = 0);
+    ~Gnss_Synchro_Udp_Sink();
     bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
+    bool send_pending();
 
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
+    std::unique_ptr<Udp_Batch_Sender> sender;
     boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
     Serdes_Gnss_Synchro serdes;
     bool use_protobuf;
 };
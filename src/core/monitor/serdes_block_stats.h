@@ -0,0 +1,149 @@
+/*!
+ * \file serdes_block_stats.h
+ * \brief Serialization / Deserialization of Block_Stats_Snapshot objects
+ * using Protocol Buffers
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SERDES_BLOCK_STATS_H
+#define GNSS_SDR_SERDES_BLOCK_STATS_H
+
+#include "block_stats.pb.h"  // file created by Protocol Buffers at compile time
+#include "gnss_sdr_block_stats.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+/*!
+ * \brief This class implements serialization and deserialization of
+ * Block_Stats_Snapshot objects using Protocol Buffers.
+ */
+class Serdes_Block_Stats
+{
+public:
+    Serdes_Block_Stats()
+    {
+        // Verify that the version of the library that we linked against is
+        // compatible with the version of the headers we compiled against.
+        GOOGLE_PROTOBUF_VERIFY_VERSION;
+    }
+
+    /*!
+     * \brief Splits the snapshots into the parts of a report, so that each
+     * part takes at most max_size bytes once serialized (or a single block,
+     * if it does not fit). Returns the index of the first snapshot of each
+     * part, followed by snaps.size().
+     */
+    inline std::vector<size_t> split(const std::vector<Block_Stats_Snapshot>& snaps, size_t max_size)
+    {
+        std::vector<size_t> first{0};
+        size_t size = REPORT_FIELDS_SIZE;
+        for (size_t i = 0; i < snaps.size(); i++)
+            {
+                stats_.Clear();
+                fill(snaps[i], &stats_);
+                const size_t block_size = stats_.ByteSizeLong() + BLOCK_FIELD_OVERHEAD;
+                if (size + block_size > max_size && i > first.back())
+                    {
+                        first.push_back(i);
+                        size = REPORT_FIELDS_SIZE;
+                    }
+                size += block_size;
+            }
+        first.push_back(snaps.size());
+        return first;
+    }
+
+    //! Serialization of snaps[first, last), the part of report sequence, into a reused string
+    inline void createProtobuffer(const std::vector<Block_Stats_Snapshot>& snaps, size_t first, size_t last,
+        uint32_t sequence, uint32_t part, uint32_t parts, std::string& data)
+    {
+        report_.Clear();
+        report_.set_sequence(sequence);
+        report_.set_part(part);
+        report_.set_parts(parts);
+        for (size_t i = first; i < last; i++)
+            {
+                fill(snaps[i], report_.add_block());
+            }
+        report_.SerializeToString(&data);
+    }
+
+    inline std::vector<Block_Stats_Snapshot> readProtobuffer(const gnss_sdr::BlockStatsReport& report) const  //!< Deserialization
+    {
+        std::vector<Block_Stats_Snapshot> snaps;
+        snaps.reserve(report.block_size());
+        for (int i = 0; i < report.block_size(); ++i)
+            {
+                const gnss_sdr::BlockStats& stats = report.block(i);
+                Block_Stats_Snapshot snap;
+                snap.stage = stats.stage();
+                snap.block = stats.block();
+                snap.channel = stats.channel();
+
+                snap.work_calls = stats.work_calls();
+                snap.work_time_ns = stats.work_time_ns();
+                snap.max_work_time_ns = stats.max_work_time_ns();
+                for (int k = 0; k < stats.latency_histogram_size() && k < static_cast<int>(BLOCK_STATS_HISTOGRAM_BINS); ++k)
+                    {
+                        snap.histogram[static_cast<size_t>(k)] = stats.latency_histogram(k);
+                    }
+
+                snap.input_items = stats.input_items();
+                snap.max_input_items = stats.max_input_items();
+                snap.dropped_samples = stats.dropped_samples();
+                snaps.push_back(snap);
+            }
+        return snaps;
+    }
+
+private:
+    // Worst case of the sequence, part and parts fields: a tag and a 32-bit varint each
+    static constexpr size_t REPORT_FIELDS_SIZE = 3 * 6;
+    // Worst case of the tag and length of each embedded BlockStats message
+    static constexpr size_t BLOCK_FIELD_OVERHEAD = 6;
+
+    inline void fill(const Block_Stats_Snapshot& snap, gnss_sdr::BlockStats* stats) const
+    {
+        stats->set_stage(snap.stage);
+        stats->set_block(snap.block);
+        stats->set_channel(snap.channel);
+
+        stats->set_work_calls(snap.work_calls);
+        stats->set_work_time_ns(snap.work_time_ns);
+        stats->set_max_work_time_ns(snap.max_work_time_ns);
+        for (const auto& bin : snap.histogram)
+            {
+                stats->add_latency_histogram(bin);
+            }
+
+        stats->set_input_items(snap.input_items);
+        stats->set_max_input_items(snap.max_input_items);
+        stats->set_dropped_samples(snap.dropped_samples);
+    }
+
+    gnss_sdr::BlockStatsReport report_{};
+    gnss_sdr::BlockStats stats_{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_SERDES_BLOCK_STATS_H
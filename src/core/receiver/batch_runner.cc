@@ -0,0 +1,543 @@
+/*!
+ * \file batch_runner.cc
+ * \brief Runs several receivers concurrently in the same process, for
+ * batch post-processing of recorded captures
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_runner.h"
+#include "file_configuration.h"
+#include "gnss_sdr_create_directory.h"
+#include <glog/logging.h>  // for LOG
+#include <algorithm>       // for max, min
+#include <array>           // for array
+#include <cerrno>          // for errno, EINTR
+#include <chrono>          // for steady_clock
+#include <cstdlib>         // for getenv
+#include <cstring>         // for strerror
+#include <fstream>         // for ifstream, ofstream
+#include <iomanip>         // for setw, setprecision
+#include <iostream>        // for cout
+#include <map>             // for map
+#include <sstream>         // for istringstream
+#include <thread>          // for hardware_concurrency
+#include <utility>         // for move, pair
+#include <fcntl.h>         // for open, fcntl, O_CLOEXEC
+#include <sys/types.h>     // for pid_t
+#include <sys/wait.h>      // for waitpid, WIFEXITED
+#include <unistd.h>        // for fork, execv, pipe, chdir, dup2
+
+#if defined(__linux__)
+#include <pthread.h>  // for pthread_getaffinity_np, pthread_setaffinity_np
+#include <sched.h>    // for cpu_set_t, CPU_SET, CPU_COUNT
+#endif
+
+
+namespace
+{
+// Server ports and monitor destinations, which are shifted for each job
+const std::array<std::pair<const char*, int>, 7> BATCH_JOB_PORTS{{{"GNSS-SDR.telecommand_tcp_port", 3333},
+    {"PVT.rtcm_tcp_port", 2101},
+    {"PVT.monitor_udp_port", 1234},
+    {"Monitor.udp_port", 1234},
+    {"AcquisitionMonitor.udp_port", 1235},
+    {"TrackingMonitor.udp_port", 1236},
+    {"BlockStatsMonitor.udp_port", 1237}}};
+
+const int BATCH_JOB_PORT_STRIDE = 10;
+
+// Files written by each job in its output path
+const char* BATCH_JOB_CONFIG_FILE = "batch_job.conf";
+const char* BATCH_JOB_LOG_FILE = "batch_job.log";
+
+
+std::string absolute_path(const std::string& path)
+{
+    if (path.empty() || path[0] == '/')
+        {
+            return path;
+        }
+    std::array<char, 4096> cwd{};
+    if (getcwd(cwd.data(), cwd.size()) == nullptr)
+        {
+            return path;
+        }
+    return std::string(cwd.data()) + "/" + path;
+}
+
+
+// Absolute path of an executable, looked up in PATH if name has no '/'
+std::string find_executable(const std::string& name)
+{
+    if (name.find('/') != std::string::npos)
+        {
+            return absolute_path(name);
+        }
+    const char* path_env = std::getenv("PATH");
+    std::istringstream path(path_env != nullptr ? path_env : "");
+    std::string dir;
+    while (std::getline(path, dir, ':'))
+        {
+            const std::string candidate = (dir.empty() ? std::string(".") : dir) + "/" + name;
+            if (access(candidate.c_str(), X_OK) == 0)
+                {
+                    return absolute_path(candidate);
+                }
+        }
+    return name;
+}
+
+
+bool set_close_on_exec(int fd)
+{
+    return fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+}
+
+
+#if defined(__linux__)
+// CPUs that the calling thread is allowed to use (taskset, cgroups, cpusets)
+cpu_set_t allowed_cpus()
+{
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0 || CPU_COUNT(&cpuset) == 0)
+        {
+            CPU_ZERO(&cpuset);
+            for (uint32_t cpu = 0; cpu < std::max(std::thread::hardware_concurrency(), 1U); cpu++)
+                {
+                    CPU_SET(cpu, &cpuset);
+                }
+        }
+    return cpuset;
+}
+#endif
+
+
+uint32_t available_cpus()
+{
+#if defined(__linux__)
+    const cpu_set_t cpuset = allowed_cpus();
+    return static_cast<uint32_t>(CPU_COUNT(&cpuset));
+#else
+    return std::max(std::thread::hardware_concurrency(), 1U);
+#endif
+}
+}  // namespace
+
+
+BatchRunner::BatchRunner(std::vector<Batch_Job> jobs,
+    uint32_t max_jobs,
+    uint32_t cpu_budget,
+    const std::string& receiver,
+    std::vector<std::string> receiver_flags) : jobs_(std::move(jobs)),
+                                               receiver_(find_executable(receiver)),
+                                               receiver_flags_(std::move(receiver_flags)),
+                                               max_jobs_(max_jobs),
+                                               cpu_budget_(cpu_budget)
+{
+    const uint32_t cpus = available_cpus();
+    if (cpu_budget_ == 0 || cpu_budget_ > cpus)
+        {
+            cpu_budget_ = cpus;
+        }
+    if (max_jobs_ == 0)
+        {
+            max_jobs_ = cpu_budget_;
+        }
+}
+
+
+std::vector<Batch_Job> BatchRunner::read_job_list(const std::string& filename)
+{
+    std::vector<Batch_Job> jobs;
+    std::ifstream list(filename);
+    if (!list.is_open())
+        {
+            LOG(WARNING) << "Unable to open the batch job list " << filename;
+            return jobs;
+        }
+    std::string line;
+    while (std::getline(list, line))
+        {
+            std::istringstream ss(line);
+            Batch_Job job;
+            if (!(ss >> job.config_file) || job.config_file[0] == '#')
+                {
+                    continue;
+                }
+            ss >> job.capture_file >> job.output_path;
+            jobs.push_back(std::move(job));
+        }
+    return jobs;
+}
+
+
+int BatchRunner::run()
+{
+    std::cout << "Running " << jobs_.size() << " batch jobs, " << max_jobs_
+              << " at a time on " << cpu_budget_ << " CPU cores\n";
+    LOG(INFO) << "Running " << jobs_.size() << " batch jobs, " << max_jobs_
+              << " at a time on " << cpu_budget_ << " CPU cores";
+
+    // Processes inherit the affinity mask of their parent, so restricting it
+    // here bounds the jobs and all the GNU Radio threads they spawn
+    restrict_cpus();
+
+    struct Running_Job
+    {
+        std::size_t index;
+        int error_fd;  // read end of the pipe reporting exec errors
+        std::chrono::steady_clock::time_point start;
+    };
+    std::map<pid_t, Running_Job> running;
+    std::size_t next_job = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    while (next_job < jobs_.size() || !running.empty())
+        {
+            while (running.size() < max_jobs_ && next_job < jobs_.size())
+                {
+                    const std::size_t index = next_job++;
+                    Batch_Job& job = jobs_[index];
+                    const std::string config_file = prepare_job(index);
+                    if (config_file.empty())
+                        {
+                            LOG(WARNING) << "Batch job " << job.config_file << " failed: " << job.error;
+                            continue;
+                        }
+                    int error_fd = -1;
+                    const pid_t pid = start_receiver(job, config_file, &error_fd);
+                    if (pid < 0)
+                        {
+                            LOG(WARNING) << "Batch job " << job.config_file << " failed: " << job.error;
+                            continue;
+                        }
+                    running[pid] = Running_Job{index, error_fd, std::chrono::steady_clock::now()};
+                }
+            if (running.empty())
+                {
+                    continue;
+                }
+
+            int status = 0;
+            const pid_t pid = waitpid(-1, &status, 0);
+            if (pid < 0)
+                {
+                    if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                    LOG(ERROR) << "Unable to wait for the batch jobs";
+                    break;
+                }
+            const auto it = running.find(pid);
+            if (it == running.end())
+                {
+                    continue;
+                }
+            Batch_Job& job = jobs_[it->second.index];
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - it->second.start;
+            job.wall_time_s = elapsed.count();
+            // The pipe is closed on exec, so it only holds an error if the
+            // receiver could not be started
+            int exec_errno = 0;
+            const bool exec_failed = read(it->second.error_fd, &exec_errno, sizeof(exec_errno)) == static_cast<ssize_t>(sizeof(exec_errno));
+            close(it->second.error_fd);
+            running.erase(it);
+
+            const std::string log_file = job.output_path + "/" + BATCH_JOB_LOG_FILE;
+            if (exec_failed)
+                {
+                    job.return_code = -1;
+                    job.error = "Unable to start " + receiver_ + " in " + job.output_path + ": " + std::strerror(exec_errno);
+                }
+            else if (WIFEXITED(status))
+                {
+                    job.return_code = WEXITSTATUS(status);
+                    if (job.return_code != 0)
+                        {
+                            job.error = "The receiver exited with code " + std::to_string(job.return_code) + ", see " + log_file;
+                        }
+                }
+            else
+                {
+                    job.return_code = -1;
+                    job.error = "The receiver was terminated by signal " + std::to_string(WIFSIGNALED(status) ? WTERMSIG(status) : 0) + ", see " + log_file;
+                }
+            if (!job.error.empty())
+                {
+                    LOG(WARNING) << "Batch job " << job.config_file << " failed: " << job.error;
+                }
+        }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    print_summary(elapsed.count());
+
+    for (const auto& job : jobs_)
+        {
+            if (job.return_code != 0)
+                {
+                    return 1;
+                }
+        }
+    return 0;
+}
+
+
+std::string BatchRunner::prepare_job(std::size_t index)
+{
+    Batch_Job& job = jobs_[index];
+    std::ifstream config_file(job.config_file);
+    if (!config_file.is_open())
+        {
+            job.error = "Unable to open the configuration file";
+            return std::string();
+        }
+
+    if (job.output_path.empty())
+        {
+            job.output_path = "batch_job_" + std::to_string(index);
+        }
+    job.output_path = absolute_path(job.output_path);
+    if (!gnss_sdr_create_directory(job.output_path))
+        {
+            job.error = "Unable to create the output path " + job.output_path;
+            return std::string();
+        }
+
+    // Properties of the job that differ from its configuration file
+    std::vector<std::pair<std::string, std::string>> overrides;
+    auto configuration = std::make_shared<FileConfiguration>(job.config_file);
+    const auto set_property = [&](const std::string& name, const std::string& value) {
+        configuration->set_property(name, value);
+        overrides.emplace_back(name, value);
+    };
+    if (!job.capture_file.empty())
+        {
+            set_property("SignalSource.filename", job.capture_file);
+        }
+    set_property("PVT.output_path", job.output_path);
+    for (const auto& port : BATCH_JOB_PORTS)
+        {
+            const int32_t configured_port = configuration->property(port.first, static_cast<int32_t>(port.second));
+            set_property(port.first, std::to_string(configured_port + BATCH_JOB_PORT_STRIDE * static_cast<int32_t>(index)));
+        }
+    // Several receivers would share the keyboard and the SysV message queue
+    set_property("GNSS-SDR.interactive_listeners", "false");
+
+    // The signal source aborts the process if the capture file is missing
+    // or too short, so that is checked before building the flowgraph. The
+    // receiver runs in the output path, so a relative name is resolved here.
+    const std::string filename = absolute_path(configuration->property("SignalSource.filename", std::string("./example_capture.dat")));
+    set_property("SignalSource.filename", filename);
+    std::ifstream capture(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!capture.is_open())
+        {
+            job.error = "Unable to open the capture file " + filename;
+            return std::string();
+        }
+    const auto file_bytes = static_cast<uint64_t>(capture.tellg());
+    capture.close();
+
+    const std::string item_type = configuration->property("SignalSource.item_type", std::string("short"));
+    uint64_t item_size = 2;
+    uint64_t items_per_sample = 1;
+    if (item_type == "gr_complex")
+        {
+            item_size = 8;
+        }
+    else if (item_type == "float" || item_type == "cshort")
+        {
+            item_size = 4;
+        }
+    else if (item_type == "byte")
+        {
+            item_size = 1;
+        }
+    else if (item_type == "ibyte")
+        {
+            item_size = 1;
+            items_per_sample = 2;
+        }
+    else if (item_type == "ishort")
+        {
+            items_per_sample = 2;
+        }
+    const uint64_t header_size = configuration->property("SignalSource.header_size", static_cast<uint64_t>(0));
+    uint64_t items = file_bytes > header_size * item_size ? file_bytes / item_size - header_size : 0;
+    const uint64_t max_items = configuration->property("SignalSource.samples", static_cast<uint64_t>(0));
+    if (max_items > 0)
+        {
+            items = std::min(items, max_items);
+        }
+    const double fs = configuration->property("SignalSource.sampling_frequency", 0.0);
+    if (items == 0 || fs <= 0.0)
+        {
+            job.error = "Empty capture file or invalid sampling frequency";
+            return std::string();
+        }
+    job.samples = items / items_per_sample;
+    job.signal_duration_s = static_cast<double>(job.samples) / fs;
+
+    // The configuration of the job is a copy of its configuration file,
+    // followed by the overridden properties, which take precedence
+    const std::string job_config_file = job.output_path + "/" + BATCH_JOB_CONFIG_FILE;
+    std::ofstream job_config(job_config_file);
+    if (config_file.peek() != std::ifstream::traits_type::eof())
+        {
+            job_config << config_file.rdbuf();
+        }
+    job_config << "\n\n[GNSS-SDR]\n; Batch job " << index << '\n';
+    for (const auto& property : overrides)
+        {
+            job_config << property.first << '=' << property.second << '\n';
+        }
+    job_config.close();
+    if (job_config.fail())
+        {
+            job.error = "Unable to write " + job_config_file;
+            return std::string();
+        }
+    return job_config_file;
+}
+
+
+pid_t BatchRunner::start_receiver(Batch_Job& job, const std::string& config_file, int* error_fd) const
+{
+    // Everything the child process needs is prepared before fork(). The
+    // parent has running threads, so the child only makes async-signal-safe
+    // calls until it executes the receiver.
+    std::vector<std::string> args{receiver_, "--config_file=" + config_file};
+    args.insert(args.end(), receiver_flags_.begin(), receiver_flags_.end());
+    std::vector<char*> argv;
+    for (auto& arg : args)
+        {
+            argv.push_back(&arg[0]);
+        }
+    argv.push_back(nullptr);
+    const std::string log_file = job.output_path + "/" + BATCH_JOB_LOG_FILE;
+    const int log_fd = open(log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    const int null_fd = open("/dev/null", O_RDONLY);
+    std::array<int, 2> exec_pipe{-1, -1};
+    const bool ready = log_fd >= 0 && null_fd >= 0 && pipe(exec_pipe.data()) == 0 &&
+                       set_close_on_exec(log_fd) && set_close_on_exec(null_fd) &&
+                       set_close_on_exec(exec_pipe[0]) && set_close_on_exec(exec_pipe[1]);
+    pid_t pid = -1;
+    if (ready)
+        {
+            pid = fork();
+            if (pid == 0)
+                {
+                    if (chdir(job.output_path.c_str()) == 0 && dup2(null_fd, 0) == 0 && dup2(log_fd, 1) == 1 && dup2(log_fd, 2) == 2)
+                        {
+                            execv(argv[0], argv.data());
+                        }
+                    const int exec_errno = errno;
+                    const ssize_t reported = write(exec_pipe[1], &exec_errno, sizeof(exec_errno));
+                    _exit(reported < 0 ? 126 : 127);
+                }
+        }
+    for (const int fd : {log_fd, null_fd, exec_pipe[1]})
+        {
+            if (fd >= 0)
+                {
+                    close(fd);
+                }
+        }
+    if (pid < 0)
+        {
+            if (exec_pipe[0] >= 0)
+                {
+                    close(exec_pipe[0]);
+                }
+            job.error = log_fd < 0 ? "Unable to create " + log_file : "Unable to create a process";
+            return -1;
+        }
+    *error_fd = exec_pipe[0];
+    return pid;
+}
+
+
+void BatchRunner::restrict_cpus() const
+{
+#if defined(__linux__)
+    // The first cpu_budget_ CPUs among the ones that the process can use
+    const cpu_set_t allowed = allowed_cpus();
+    if (cpu_budget_ >= static_cast<uint32_t>(CPU_COUNT(&allowed)))
+        {
+            return;
+        }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    uint32_t selected = 0;
+    for (int cpu = 0; cpu < CPU_SETSIZE && selected < cpu_budget_; cpu++)
+        {
+            if (CPU_ISSET(cpu, &allowed))
+                {
+                    CPU_SET(cpu, &cpuset);
+                    selected++;
+                }
+        }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0)
+        {
+            LOG(WARNING) << "Unable to restrict the batch jobs to " << cpu_budget_ << " CPU cores";
+        }
+#else
+    LOG(WARNING) << "The CPU budget of the batch jobs is not enforced on this platform";
+#endif
+}
+
+
+void BatchRunner::print_summary(double total_wall_time_s) const
+{
+    uint32_t failed = 0;
+    double total_signal_s = 0.0;
+    std::stringstream summary;
+    summary << "Batch summary:\n"
+            << std::setw(5) << "Job" << std::setw(8) << "Status"
+            << std::setw(12) << "Signal [s]" << std::setw(12) << "Wall [s]"
+            << std::setw(12) << "MSps" << std::setw(12) << "x realtime"
+            << "  Configuration\n";
+    for (std::size_t i = 0; i < jobs_.size(); i++)
+        {
+            const Batch_Job& job = jobs_[i];
+            const bool ok = job.return_code == 0;
+            if (!ok)
+                {
+                    failed++;
+                }
+            total_signal_s += ok ? job.signal_duration_s : 0.0;
+            const double msps = job.wall_time_s > 0.0 ? static_cast<double>(job.samples) / job.wall_time_s / 1e6 : 0.0;
+            const double realtime = job.wall_time_s > 0.0 ? job.signal_duration_s / job.wall_time_s : 0.0;
+            summary << std::setw(5) << i << std::setw(8) << (ok ? "OK" : "FAILED")
+                    << std::fixed << std::setprecision(2)
+                    << std::setw(12) << job.signal_duration_s << std::setw(12) << job.wall_time_s
+                    << std::setw(12) << msps << std::setw(12) << realtime
+                    << "  " << job.config_file;
+            if (!job.capture_file.empty())
+                {
+                    summary << " (" << job.capture_file << ")";
+                }
+            if (!job.error.empty())
+                {
+                    summary << ": " << job.error;
+                }
+            summary << '\n';
+        }
+    summary << jobs_.size() - failed << " jobs succeeded, " << failed << " failed. "
+            << total_signal_s << " s of signal processed in " << total_wall_time_s << " s ("
+            << (total_wall_time_s > 0.0 ? total_signal_s / total_wall_time_s : 0.0) << " x realtime)\n";
+
+    std::cout << summary.str();
+    LOG(INFO) << summary.str();
+}
@@ -0,0 +1,115 @@
+/*!
+ * \file batch_runner.h
+ * \brief Runs several receivers concurrently, for batch post-processing of
+ * recorded captures
+ * \author agent, 2026. agent(at)local
+ *
+ * Each job is a configuration file, optionally with the capture file and
+ * the output path that override the ones in the configuration. Each job
+ * runs its own ControlThread and GNSSFlowgraph in a child process forked
+ * from the batch process, so the process-wide state of a receiver (RTKLIB
+ * statics, assistance maps, block statistics) is never shared between jobs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_BATCH_RUNNER_H
+#define GNSS_SDR_BATCH_RUNNER_H
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <string>       // for string
+#include <vector>       // for vector
+#include <sys/types.h>  // for pid_t
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+/*!
+ * \brief A batch post-processing job, and its outcome
+ */
+struct Batch_Job
+{
+    std::string config_file;   //!< Receiver configuration file
+    std::string capture_file;  //!< If not empty, overrides SignalSource.filename
+    std::string output_path;   //!< Working directory and PVT.output_path. If empty, batch_job_<index>
+    std::string error;         //!< Reason of the failure, if any
+    uint64_t samples{0};       //!< Samples read from the capture file
+    double signal_duration_s{0.0};
+    double wall_time_s{0.0};
+    int return_code{-1};
+};
+
+
+/*!
+ * \brief This class runs a list of batch jobs, at most max_jobs at a time,
+ * and reports the throughput achieved by each of them.
+ *
+ * The job list is a text file with one job per line:
+ *
+ *   config_file [capture_file [output_path]]
+ *
+ * Empty lines and lines starting with '#' are ignored. Each job runs a new
+ * receiver process, executing the receiver program with the receiver_flags
+ * and the configuration of the job, written as batch_job.conf in its output
+ * path. Its standard output and error go to batch_job.log, also in the output
+ * path, which is its working directory, so the default names of the output
+ * files do not collide. Relative paths in the configuration are relative to
+ * that directory, except the capture file. The ports of the telecommand and
+ * RTCM servers and of the monitors of job i are the configured ones plus
+ * 10 * i. All the processes are restricted to the first cpu_budget of the CPU
+ * cores that the batch process is allowed to use (all of them if 0).
+ */
+class BatchRunner
+{
+public:
+    BatchRunner(std::vector<Batch_Job> jobs, uint32_t max_jobs, uint32_t cpu_budget,
+        const std::string& receiver, std::vector<std::string> receiver_flags = {});
+
+    /*!
+     * \brief Reads a job list. Returns an empty list if the file cannot be read.
+     */
+    static std::vector<Batch_Job> read_job_list(const std::string& filename);
+
+    /*!
+     * \brief Runs all the jobs. Returns 0 if all of them succeeded, 1 otherwise.
+     */
+    int run();
+
+    inline const std::vector<Batch_Job>& jobs() const
+    {
+        return jobs_;
+    }
+
+    inline uint32_t cpu_budget() const
+    {
+        return cpu_budget_;
+    }
+
+private:
+    std::string prepare_job(std::size_t index);
+    pid_t start_receiver(Batch_Job& job, const std::string& config_file, int* error_fd) const;
+    void restrict_cpus() const;
+    void print_summary(double total_wall_time_s) const;
+
+    std::vector<Batch_Job> jobs_;
+    std::string receiver_;
+    std::vector<std::string> receiver_flags_;
+    uint32_t max_jobs_;
+    uint32_t cpu_budget_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_BATCH_RUNNER_H
@@ -23,6 +23,7 @@
 #endif
 
 #include "control_thread.h"
+#include "block_stats_udp_sink.h"
 #include "concurrent_map.h"
 #include "configuration_interface.h"
 #include "file_configuration.h"
@@ -35,7 +36,9 @@
 #include "glonass_gnav_utc_model.h"
 #include "gnss_flowgraph.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_block_stats.h"
 #include "gnss_sdr_flags.h"
+#include "gnss_sdr_make_unique.h"
 #include "gps_acq_assist.h"        // for Gps_Acq_Assist
 #include "gps_almanac.h"           // for Gps_Almanac
 #include "gps_cnav_ephemeris.h"    // for Gps_CNAV_Ephemeris
@@ -43,6 +46,7 @@
 #include "gps_ephemeris.h"         // for Gps_Ephemeris
 #include "gps_iono.h"              // for Gps_Iono
 #include "gps_utc_model.h"         // for Gps_Utc_Model
+#include "nav_data_store.h"        // for Nav_Data_Store
 #include "pvt_interface.h"         // for PvtInterface
 #include "rtklib.h"                // for gtime_t, alm_t
 #include "rtklib_conversions.h"    // for alm_to_rtklib
@@ -101,6 +105,22 @@ void ControlThread::init()
     telecommand_enabled_ = configuration_->property("GNSS-SDR.telecommand_enabled", false);
     // OPTIONAL: specify a custom year to override the system time in order to postprocess old gnss records and avoid wrong week rollover
     pre_2009_file_ = configuration_->property("GNSS-SDR.pre_2009_file", false);
+    // OPTIONAL: collect work() timing, input buffer occupancy and dropped samples of each block (see the 'stats' telecommand)
+    Block_Stats::set_enabled(configuration_->property("GNSS-SDR.block_stats", false));
+    if (configuration_->property("BlockStatsMonitor.enable_monitor", false))
+        {
+            std::vector<std::string> udp_addr_vec;
+            std::stringstream ss(configuration_->property("BlockStatsMonitor.client_addresses", std::string("127.0.0.1")));
+            std::string address;
+            while (std::getline(ss, address, '_'))
+                {
+                    udp_addr_vec.push_back(address);
+                }
+            block_stats_sink_ = std::make_unique<Block_Stats_Udp_Sink>(udp_addr_vec,
+                configuration_->property("BlockStatsMonitor.udp_port", 1237),
+                configuration_->property("BlockStatsMonitor.output_rate_ms", 1000));
+            Block_Stats::set_enabled(true);
+        }
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
     control_queue_ = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
     cmd_interface_.set_msg_queue(control_queue_);  // set also the queue pointer for the telecommand thread
@@ -189,6 +209,17 @@ void ControlThread::init()
         }
 
     receiver_on_standby_ = false;
+
+    interactive_listeners_ = configuration_->property("GNSS-SDR.interactive_listeners", interactive_listeners_);
+
+    restart_in_process_ = configuration_->property("GNSS-SDR.restart_in_process", false);
+#ifdef ENABLE_FPGA
+    if (restart_in_process_)
+        {
+            LOG(WARNING) << "GNSS-SDR.restart_in_process is not supported with FPGA acceleration";
+            restart_in_process_ = false;
+        }
+#endif
 }
 
 
@@ -292,7 +323,7 @@ int ControlThread::run()
     catch (const std::exception &e)
         {
             LOG(ERROR) << e.what();
-            return 0;
+            return 1;
         }
     if (flowgraph_->connected())
         {
@@ -301,7 +332,7 @@ int ControlThread::run()
     else
         {
             LOG(ERROR) << "Unable to connect flowgraph";
-            return 0;
+            return 1;
         }
     // Start the flowgraph
     flowgraph_->start();
@@ -312,14 +343,17 @@ int ControlThread::run()
     else
         {
             LOG(ERROR) << "Unable to start flowgraph";
-            return 0;
+            return 1;
         }
 
     // launch GNSS assistance process AFTER the flowgraph is running because the GNU Radio asynchronous queues must be already running to transport msgs
     assist_GNSS();
     // start the keyboard_listener thread
-    keyboard_thread_ = std::thread(&ControlThread::keyboard_listener, this);
-    sysv_queue_thread_ = std::thread(&ControlThread::sysv_queue_listener, this);
+    if (interactive_listeners_)
+        {
+            keyboard_thread_ = std::thread(&ControlThread::keyboard_listener, this);
+            sysv_queue_thread_ = std::thread(&ControlThread::sysv_queue_listener, this);
+        }
 
     // start the telecommand listener thread
     cmd_interface_.set_pvt(flowgraph_->get_pvt());
@@ -332,17 +366,37 @@ int ControlThread::run()
 #endif
     // Main loop to read and process the control messages
     pmt::pmt_t msg;
-    while (flowgraph_->running() && !stop_)
+    while (true)
         {
-            // read event messages, triggered by event signaling with a 100 ms timeout to perform low priority receiver management tasks
-            bool valid_event = control_queue_->timed_wait_and_pop(msg, 100);
-            // call the new sat dispatcher and receiver controller
-            event_dispatcher(valid_event, msg);
+            while (flowgraph_->running() && !stop_ && !restart_)
+                {
+                    // read event messages, triggered by event signaling with a 100 ms timeout to perform low priority receiver management tasks
+                    bool valid_event = control_queue_->timed_wait_and_pop(msg, 100);
+                    // call the new sat dispatcher and receiver controller
+                    event_dispatcher(valid_event, msg);
+                    if (block_stats_sink_ != nullptr)
+                        {
+                            block_stats_sink_->send_if_due();
+                        }
+                }
+            if (!restart_ || stop_ || !restart_in_process_)
+                {
+                    break;
+                }
+            if (!hot_restart())
+                {
+                    std::cerr << "Unable to restart the receiver flowgraph\n";
+                    restart_ = false;
+                    break;
+                }
         }
     std::cout << "Stopping GNSS-SDR, please wait!\n";
-    flowgraph_->stop();
     stop_ = true;
-    flowgraph_->disconnect();
+    if (flowgraph_ != nullptr)  // a failed in-process restart leaves no flowgraph
+        {
+            flowgraph_->stop();
+            flowgraph_->disconnect();
+        }
 
 #ifdef ENABLE_FPGA
     // trigger a HW reset
@@ -371,7 +425,7 @@ int ControlThread::run()
 
     LOG(INFO) << "Flowgraph stopped";
 
-    if (restart_)
+    if (restart_ && !restart_in_process_)
         {
             return 42;  // signal the gnss-sdr-harness.sh to restart the receiver program
         }
@@ -380,6 +434,96 @@ int ControlThread::run()
 }
 
 
+/*
+ * Tears down the flowgraph and builds a new one in the same process.
+ * The navigation data decoded so far is sent to the new flowgraph, and the
+ * satellites visible from the last position fix are searched first. The
+ * blocks of the new flowgraph are built from scratch (code replicas, FFT
+ * plans), only the VOLK kernel selection and the FFTW wisdom in memory are
+ * reused.
+ */
+bool ControlThread::hot_restart()
+{
+    std::cout << "Restarting GNSS-SDR, please wait!\n";
+    LOG(INFO) << "Restarting the receiver flowgraph";
+
+    // Keep the navigation data, and compute the visible satellites while
+    // the ephemeris are still in the PVT block
+    const std::shared_ptr<PvtInterface> pvt_ptr = flowgraph_->get_pvt();
+    const std::vector<pmt::pmt_t> nav_data_msgs = pvt_ptr->get_nav_data_msgs();
+    double longitude_deg = 0.0;
+    double latitude_deg = 0.0;
+    double height_m = 0.0;
+    double ground_speed_kmh = 0.0;
+    double course_over_ground_deg = 0.0;
+    time_t utc_time = 0;
+    const bool have_fix = pvt_ptr->get_latest_PVT(&longitude_deg, &latitude_deg, &height_m, &ground_speed_kmh, &course_over_ground_deg, &utc_time);
+    const std::array<float, 3> LLH{static_cast<float>(latitude_deg), static_cast<float>(longitude_deg), static_cast<float>(height_m)};
+    std::vector<std::pair<int, Gnss_Satellite>> visible_sats;
+    if (have_fix)
+        {
+            visible_sats = get_visible_sats(utc_time, LLH);
+        }
+
+    flowgraph_->stop();
+    flowgraph_->disconnect();
+
+    // Discard the events of the old flowgraph. The old blocks are released
+    // before building the new ones, so the signal source can be opened again
+    pmt::pmt_t msg;
+    while (control_queue_->try_pop(msg))
+        {
+        }
+    cmd_interface_.set_pvt(nullptr);
+    flowgraph_ = nullptr;
+
+    try
+        {
+            flowgraph_ = std::make_shared<GNSSFlowgraph>(configuration_, control_queue_);
+            flowgraph_->connect();
+        }
+    catch (const std::exception &e)
+        {
+            LOG(ERROR) << e.what();
+            return false;
+        }
+    if (!flowgraph_->connected())
+        {
+            LOG(ERROR) << "Unable to connect flowgraph";
+            return false;
+        }
+    flowgraph_->start();
+    if (!flowgraph_->running())
+        {
+            LOG(ERROR) << "Unable to start flowgraph";
+            return false;
+        }
+    cmd_interface_.set_pvt(flowgraph_->get_pvt());
+    restart_ = false;
+    receiver_on_standby_ = false;
+
+    for (const auto &nav_data_msg : nav_data_msgs)
+        {
+            flowgraph_->send_telemetry_msg(nav_data_msg);
+        }
+
+    if (have_fix)
+        {
+            flowgraph_->set_visibility_reference(utc_time, LLH);
+            // Set the receiver in Standby mode
+            flowgraph_->apply_action(0, 10);
+            // Give priority to visible satellites in the search list
+            flowgraph_->priorize_satellites(visible_sats);
+            // Hot Start
+            flowgraph_->apply_action(0, 12);
+        }
+
+    LOG(INFO) << "Flowgraph restarted with " << nav_data_msgs.size()
+              << " navigation data messages from the previous run";
+    return true;
+}
+
+
 void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue)
 {
     if (flowgraph_->running())
@@ -433,48 +577,59 @@ bool ControlThread::read_assistance_from_XML()
             gps_almanac_xml_filename = configuration_->property("GNSS-SDR.AGNSS_gps_almanac_xml", gps_almanac_default_xml_filename_);
         }
 
-    std::cout << "Trying to read GNSS ephemeris from XML file(s)...\n";
+    // The binary navigation data store, if any, is much faster to read than the XML files
+    Nav_Data_Store nav_data_store(configuration_->property("GNSS-SDR.nav_data_store_file", std::string("")));
+    const bool from_store = !nav_data_store.file_name().empty() && nav_data_store.load();
+    const std::string source = from_store ? std::string("From navigation data store: ") : std::string("From XML file: ");
+    if (from_store)
+        {
+            std::cout << "Reading GNSS assistance data from " << nav_data_store.file_name() << "...\n";
+        }
+    else
+        {
+            std::cout << "Trying to read GNSS ephemeris from XML file(s)...\n";
+        }
 
     if (configuration_->property("Channels_1C.count", 0) > 0)
         {
-            if (supl_client_ephemeris_.load_ephemeris_xml(eph_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.gps_ephemeris_map) : supl_client_ephemeris_.load_ephemeris_xml(eph_xml_filename))
                 {
                     std::map<int, Gps_Ephemeris>::const_iterator gps_eph_iter;
                     for (gps_eph_iter = supl_client_ephemeris_.gps_ephemeris_map.cbegin();
                          gps_eph_iter != supl_client_ephemeris_.gps_ephemeris_map.cend();
                          gps_eph_iter++)
                         {
-                            std::cout << "From XML file: Read NAV ephemeris for satellite " << Gnss_Satellite("GPS", gps_eph_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read NAV ephemeris for satellite " << Gnss_Satellite("GPS", gps_eph_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Gps_Ephemeris> tmp_obj = std::make_shared<Gps_Ephemeris>(gps_eph_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_utc_xml(utc_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gps_utc) : supl_client_acquisition_.load_utc_xml(utc_xml_filename))
                 {
                     const std::shared_ptr<Gps_Utc_Model> tmp_obj = std::make_shared<Gps_Utc_Model>(supl_client_acquisition_.gps_utc);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read GPS UTC model parameters.\n";
+                    std::cout << source << "Read GPS UTC model parameters.\n";
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_iono_xml(iono_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gps_iono) : supl_client_acquisition_.load_iono_xml(iono_xml_filename))
                 {
                     const std::shared_ptr<Gps_Iono> tmp_obj = std::make_shared<Gps_Iono>(supl_client_acquisition_.gps_iono);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read GPS ionosphere model parameters.\n";
+                    std::cout << source << "Read GPS ionosphere model parameters.\n";
                     ret = true;
                 }
 
-            if (supl_client_ephemeris_.load_gps_almanac_xml(gps_almanac_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.gps_almanac_map) : supl_client_ephemeris_.load_gps_almanac_xml(gps_almanac_xml_filename))
                 {
                     std::map<int, Gps_Almanac>::const_iterator gps_alm_iter;
                     for (gps_alm_iter = supl_client_ephemeris_.gps_almanac_map.cbegin();
                          gps_alm_iter != supl_client_ephemeris_.gps_almanac_map.cend();
                          gps_alm_iter++)
                         {
-                            std::cout << "From XML file: Read GPS almanac for satellite " << Gnss_Satellite("GPS", gps_alm_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read GPS almanac for satellite " << Gnss_Satellite("GPS", gps_alm_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Gps_Almanac> tmp_obj = std::make_shared<Gps_Almanac>(gps_alm_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
@@ -484,44 +639,44 @@ bool ControlThread::read_assistance_from_XML()
 
     if ((configuration_->property("Channels_1B.count", 0) > 0) or (configuration_->property("Channels_5X.count", 0) > 0))
         {
-            if (supl_client_ephemeris_.load_gal_ephemeris_xml(eph_gal_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.gal_ephemeris_map) : supl_client_ephemeris_.load_gal_ephemeris_xml(eph_gal_xml_filename))
                 {
                     std::map<int, Galileo_Ephemeris>::const_iterator gal_eph_iter;
                     for (gal_eph_iter = supl_client_ephemeris_.gal_ephemeris_map.cbegin();
                          gal_eph_iter != supl_client_ephemeris_.gal_ephemeris_map.cend();
                          gal_eph_iter++)
                         {
-                            std::cout << "From XML file: Read ephemeris for satellite " << Gnss_Satellite("Galileo", gal_eph_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read ephemeris for satellite " << Gnss_Satellite("Galileo", gal_eph_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Galileo_Ephemeris> tmp_obj = std::make_shared<Galileo_Ephemeris>(gal_eph_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_gal_iono_xml(gal_iono_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gal_iono) : supl_client_acquisition_.load_gal_iono_xml(gal_iono_xml_filename))
                 {
                     const std::shared_ptr<Galileo_Iono> tmp_obj = std::make_shared<Galileo_Iono>(supl_client_acquisition_.gal_iono);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read Galileo ionosphere model parameters.\n";
+                    std::cout << source << "Read Galileo ionosphere model parameters.\n";
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_gal_utc_xml(gal_utc_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gal_utc) : supl_client_acquisition_.load_gal_utc_xml(gal_utc_xml_filename))
                 {
                     const std::shared_ptr<Galileo_Utc_Model> tmp_obj = std::make_shared<Galileo_Utc_Model>(supl_client_acquisition_.gal_utc);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read Galileo UTC model parameters.\n";
+                    std::cout << source << "Read Galileo UTC model parameters.\n";
                     ret = true;
                 }
 
-            if (supl_client_ephemeris_.load_gal_almanac_xml(gal_almanac_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.gal_almanac_map) : supl_client_ephemeris_.load_gal_almanac_xml(gal_almanac_xml_filename))
                 {
                     std::map<int, Galileo_Almanac>::const_iterator gal_alm_iter;
                     for (gal_alm_iter = supl_client_ephemeris_.gal_almanac_map.cbegin();
                          gal_alm_iter != supl_client_ephemeris_.gal_almanac_map.cend();
                          gal_alm_iter++)
                         {
-                            std::cout << "From XML file: Read Galileo almanac for satellite " << Gnss_Satellite("Galileo", gal_alm_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read Galileo almanac for satellite " << Gnss_Satellite("Galileo", gal_alm_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Galileo_Almanac> tmp_obj = std::make_shared<Galileo_Almanac>(gal_alm_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
@@ -531,50 +686,50 @@ bool ControlThread::read_assistance_from_XML()
 
     if ((configuration_->property("Channels_2S.count", 0) > 0) or (configuration_->property("Channels_L5.count", 0) > 0))
         {
-            if (supl_client_ephemeris_.load_cnav_ephemeris_xml(eph_cnav_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.gps_cnav_ephemeris_map) : supl_client_ephemeris_.load_cnav_ephemeris_xml(eph_cnav_xml_filename))
                 {
                     std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_eph_iter;
                     for (gps_cnav_eph_iter = supl_client_ephemeris_.gps_cnav_ephemeris_map.cbegin();
                          gps_cnav_eph_iter != supl_client_ephemeris_.gps_cnav_ephemeris_map.cend();
                          gps_cnav_eph_iter++)
                         {
-                            std::cout << "From XML file: Read CNAV ephemeris for satellite " << Gnss_Satellite("GPS", gps_cnav_eph_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read CNAV ephemeris for satellite " << Gnss_Satellite("GPS", gps_cnav_eph_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Gps_CNAV_Ephemeris> tmp_obj = std::make_shared<Gps_CNAV_Ephemeris>(gps_cnav_eph_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_cnav_utc_xml(cnav_utc_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gps_cnav_utc) : supl_client_acquisition_.load_cnav_utc_xml(cnav_utc_xml_filename))
                 {
                     const std::shared_ptr<Gps_CNAV_Utc_Model> tmp_obj = std::make_shared<Gps_CNAV_Utc_Model>(supl_client_acquisition_.gps_cnav_utc);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read GPS CNAV UTC model parameters.\n";
+                    std::cout << source << "Read GPS CNAV UTC model parameters.\n";
                     ret = true;
                 }
         }
 
     if ((configuration_->property("Channels_1G.count", 0) > 0) or (configuration_->property("Channels_2G.count", 0) > 0))
         {
-            if (supl_client_ephemeris_.load_gnav_ephemeris_xml(eph_glo_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_ephemeris_.glonass_gnav_ephemeris_map) : supl_client_ephemeris_.load_gnav_ephemeris_xml(eph_glo_xml_filename))
                 {
                     std::map<int, Glonass_Gnav_Ephemeris>::const_iterator glo_gnav_eph_iter;
                     for (glo_gnav_eph_iter = supl_client_ephemeris_.glonass_gnav_ephemeris_map.cbegin();
                          glo_gnav_eph_iter != supl_client_ephemeris_.glonass_gnav_ephemeris_map.cend();
                          glo_gnav_eph_iter++)
                         {
-                            std::cout << "From XML file: Read GLONASS GNAV ephemeris for satellite " << Gnss_Satellite("GLONASS", glo_gnav_eph_iter->second.i_satellite_PRN) << '\n';
+                            std::cout << source << "Read GLONASS GNAV ephemeris for satellite " << Gnss_Satellite("GLONASS", glo_gnav_eph_iter->second.i_satellite_PRN) << '\n';
                             const std::shared_ptr<Glonass_Gnav_Ephemeris> tmp_obj = std::make_shared<Glonass_Gnav_Ephemeris>(glo_gnav_eph_iter->second);
                             flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                         }
                     ret = true;
                 }
 
-            if (supl_client_acquisition_.load_glo_utc_xml(glo_utc_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.glo_gnav_utc) : supl_client_acquisition_.load_glo_utc_xml(glo_utc_xml_filename))
                 {
                     const std::shared_ptr<Glonass_Gnav_Utc_Model> tmp_obj = std::make_shared<Glonass_Gnav_Utc_Model>(supl_client_acquisition_.glo_gnav_utc);
                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
-                    std::cout << "From XML file: Read GLONASS UTC model parameters.\n";
+                    std::cout << source << "Read GLONASS UTC model parameters.\n";
                     ret = true;
                 }
         }
@@ -590,7 +745,7 @@ bool ControlThread::read_assistance_from_XML()
     if (enable_gps_supl_assistance == true)
         {
             // Try to read Ref Time from XML
-            if (supl_client_acquisition_.load_ref_time_xml(ref_time_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gps_time) : supl_client_acquisition_.load_ref_time_xml(ref_time_xml_filename))
                 {
                     LOG(INFO) << "SUPL: Read XML Ref Time";
                     const std::shared_ptr<Agnss_Ref_Time> tmp_obj = std::make_shared<Agnss_Ref_Time>(supl_client_acquisition_.gps_time);
@@ -602,7 +757,7 @@ bool ControlThread::read_assistance_from_XML()
                 }
 
             // Try to read Ref Location from XML
-            if (supl_client_acquisition_.load_ref_location_xml(ref_location_xml_filename) == true)
+            if (from_store ? nav_data_store.get(supl_client_acquisition_.gps_ref_loc) : supl_client_acquisition_.load_ref_location_xml(ref_location_xml_filename))
                 {
                     LOG(INFO) << "SUPL: Read XML Ref Location";
                     const std::shared_ptr<Agnss_Ref_Location> tmp_obj = std::make_shared<Agnss_Ref_Location>(supl_client_acquisition_.gps_ref_loc);
@@ -670,6 +825,7 @@ void ControlThread::assist_GNSS()
                 }
 
             const bool SUPL_read_gps_assistance_xml = configuration_->property("GNSS-SDR.SUPL_read_gps_assistance_xml", false);
+            const std::string nav_data_store_file = configuration_->property("GNSS-SDR.nav_data_store_file", std::string(""));
             if (SUPL_read_gps_assistance_xml == true)
                 {
                     // Read assistance from file
@@ -706,6 +862,10 @@ void ControlThread::assist_GNSS()
                                 {
                                     std::cout << "SUPL: Failed to create XML ephemeris data file\n";
                                 }
+                            if (!nav_data_store_file.empty())
+                                {
+                                    supl_client_ephemeris_.save_nav_data_store(nav_data_store_file);
+                                }
                         }
                     else
                         {
@@ -765,6 +925,10 @@ void ControlThread::assist_GNSS()
                                 {
                                     std::cout << "SUPL: Failed to create UTC model data file\n";
                                 }
+                            if (!nav_data_store_file.empty())
+                                {
+                                    supl_client_ephemeris_.save_nav_data_store(nav_data_store_file);
+                                }
                         }
                     else
                         {
@@ -802,6 +966,10 @@ void ControlThread::assist_GNSS()
                                     flowgraph_->send_telemetry_msg(pmt::make_any(tmp_obj));
                                     supl_client_acquisition_.save_ref_time_xml("agnss_ref_time.xml", agnss_ref_time_);
                                 }
+                            if (!nav_data_store_file.empty())
+                                {
+                                    supl_client_acquisition_.save_nav_data_store(nav_data_store_file);
+                                }
                         }
                     else
                         {
@@ -835,6 +1003,10 @@ void ControlThread::assist_GNSS()
                 }
 
             const std::vector<std::pair<int, Gnss_Satellite>> visible_sats = get_visible_sats(ref_rx_utc_time, ref_LLH);
+            if (agnss_ref_time_.valid == true)
+                {
+                    flowgraph_->set_visibility_reference(ref_rx_utc_time, ref_LLH);
+                }
             // Set the receiver in Standby mode
             flowgraph_->apply_action(0, 10);
             // Give priority to visible satellites in the search list
@@ -858,7 +1030,10 @@ void ControlThread::apply_action(unsigned int what)
             break;
         case 1:
             LOG(INFO) << "Received action RESTART";
-            stop_ = true;
+            if (!restart_in_process_)
+                {
+                    stop_ = true;
+                }
             restart_ = true;
             break;
         case 10:  // request standby mode
@@ -878,6 +1053,7 @@ void ControlThread::apply_action(unsigned int what)
         case 12:
             LOG(INFO) << "Receiver action HOTSTART";
             visible_satellites = get_visible_sats(cmd_interface_.get_utc_time(), cmd_interface_.get_LLH());
+            flowgraph_->set_visibility_reference(cmd_interface_.get_utc_time(), cmd_interface_.get_LLH());
             // reorder the satellite queue to acquire first those visible satellites
             flowgraph_->priorize_satellites(visible_satellites);
             // start again the satellite acquisitions
@@ -893,6 +1069,7 @@ void ControlThread::apply_action(unsigned int what)
             // call here the function that computes the set of visible satellites and its elevation
             // for the date and time specified by the warm start command and the assisted position
             get_visible_sats(cmd_interface_.get_utc_time(), cmd_interface_.get_LLH());
+            flowgraph_->set_visibility_reference(cmd_interface_.get_utc_time(), cmd_interface_.get_LLH());
             // reorder the satellite queue to acquire first those visible satellites
             flowgraph_->priorize_satellites(visible_satellites);
             // start again the satellite acquisitions
@@ -31,7 +31,7 @@
 #include <pmt/pmt.h>
 #include <array>     // for array
 #include <cstddef>   // for size_t
-#include <memory>    // for shared_ptr
+#include <memory>    // for shared_ptr, unique_ptr
 #include <string>    // for string
 #include <thread>    // for std::thread
 #include <typeinfo>  // for std::type_info, typeid
@@ -50,6 +50,7 @@
  * \{ */
 
 
+class Block_Stats_Udp_Sink;
 class ConfigurationInterface;
 class GNSSFlowgraph;
 class Gnss_Satellite;
@@ -91,6 +92,9 @@ public:
      *  while (flowgraph_->running() && !stop_){
      *
      *  - Read control messages and process them; }
+     *
+     * Returns 0 on normal shutdown, 1 if the flowgraph could not be connected
+     * or started, and 42 if the receiver program has to be restarted.
      */
     int run();
 
@@ -111,6 +115,16 @@ public:
         return applied_actions_;
     }
 
+    /*!
+     * \brief Disables the keyboard and SysV message queue listeners, so that
+     * several receivers can run at the same time. Must be called before run().
+     * Setting GNSS-SDR.interactive_listeners=false has the same effect.
+     */
+    void disable_interactive_listeners()
+    {
+        interactive_listeners_ = false;
+    }
+
     /*!
      * \brief Instantiates a flowgraph
      *
@@ -126,6 +140,11 @@ private:
 
     void apply_action(unsigned int what);
 
+    /*
+     * Rebuilds the flowgraph in the same process, keeping the navigation data
+     */
+    bool hot_restart();
+
     /*
      * New receiver event dispatcher
      */
@@ -176,6 +195,7 @@ private:
     std::shared_ptr<ConfigurationInterface> configuration_;
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
     std::shared_ptr<GNSSFlowgraph> flowgraph_;
+    std::unique_ptr<Block_Stats_Udp_Sink> block_stats_sink_;
 
     std::thread cmd_interface_thread_;
     std::thread keyboard_thread_;
@@ -204,8 +224,10 @@ private:
     int msqid_;
 
     bool receiver_on_standby_;
+    bool interactive_listeners_{true};
     bool stop_;
     bool restart_;
+    bool restart_in_process_;
     bool telecommand_enabled_;
     bool pre_2009_file_;  // to override the system time to postprocess old gnss records and avoid wrong week rollover
 };
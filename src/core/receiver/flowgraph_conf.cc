@@ -0,0 +1,50 @@
+/*!
+ * \file flowgraph_conf.cc
+ * \brief Class that contains the configuration parameters read by the
+ * GNSSFlowgraph while it is running
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "flowgraph_conf.h"
+#include "configuration_interface.h"
+
+Flowgraph_Conf::Flowgraph_Conf()
+{
+    internal_fs_sps = 0;
+    max_acq_channels = 0;
+    use_acquisition_resampler = false;
+    assist_dual_frequency_acq = false;
+    enable_fpga = false;
+}
+
+
+void Flowgraph_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
+    const std::string &source_role,
+    int32_t channels_count,
+    bool multiband)
+{
+    internal_fs_sps = configuration->property("GNSS-SDR.internal_fs_sps", internal_fs_sps);
+    max_acq_channels = configuration->property("Channels.in_acquisition", channels_count);
+    use_acquisition_resampler = configuration->property("GNSS-SDR.use_acquisition_resampler", use_acquisition_resampler);
+    assist_dual_frequency_acq = configuration->property("GNSS-SDR.assist_dual_frequency_acq", multiband);
+    enable_fpga = configuration->property(source_role + ".enable_FPGA", enable_fpga);
+
+    channel_satellite = std::vector<uint32_t>(channels_count, 0);
+    channel_rf_id = std::vector<int32_t>(channels_count, 0);
+    for (int32_t i = 0; i < channels_count; i++)
+        {
+            const std::string role = "Channel" + std::to_string(i);
+            channel_satellite[i] = configuration->property(role + ".satellite", channel_satellite[i]);
+            channel_rf_id[i] = configuration->property(role + ".RF_channel_ID", channel_rf_id[i]);
+        }
+}
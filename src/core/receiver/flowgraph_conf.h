@@ -0,0 +1,60 @@
+/*!
+ * \file flowgraph_conf.h
+ * \brief Class that contains the configuration parameters read by the
+ * GNSSFlowgraph while it is running
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FLOWGRAPH_CONF_H
+#define GNSS_SDR_FLOWGRAPH_CONF_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Snapshot of the configuration used by the GNSSFlowgraph to connect
+ * the channels and to manage them at every channel event, so it is parsed
+ * once instead of being looked up by name for every channel.
+ */
+class Flowgraph_Conf
+{
+public:
+    Flowgraph_Conf();
+
+    void SetFromConfiguration(const ConfigurationInterface *configuration,
+        const std::string &source_role,
+        int32_t channels_count,
+        bool multiband);
+
+    std::vector<uint32_t> channel_satellite;  // Channel<N>.satellite, or 0 if not fixed
+    std::vector<int32_t> channel_rf_id;       // Channel<N>.RF_channel_ID
+    uint32_t internal_fs_sps;
+    int32_t max_acq_channels;
+    bool use_acquisition_resampler;
+    bool assist_dual_frequency_acq;
+    bool enable_fpga;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FLOWGRAPH_CONF_H
@@ -109,8 +109,12 @@
 #include "two_bit_cpx_file_signal_source.h"
 #include "two_bit_packed_file_signal_source.h"
 #include <glog/logging.h>
-#include <exception>  // for exception
-#include <utility>    // for move
+#include <algorithm>  // for max, min
+#include <atomic>     // for atomic
+#include <chrono>     // for steady_clock
+#include <exception>  // for exception, exception_ptr
+#include <thread>     // for thread
+#include <utility>    // for move, pair
 
 #if RAW_UDP
 #include "custom_udp_signal_source.h"
@@ -428,156 +432,93 @@ std::unique_ptr<std::vector<std::unique_ptr<GNSSBlockInterface>>> GNSSBlockFacto
                                         Channels_7X_count +
                                         Channels_E6_count;
 
-    auto channels = std::make_unique<std::vector<std::unique_ptr<GNSSBlockInterface>>>(total_channels);
-    try
-        {
-            // **************** GPS L1 C/A CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_1C_count << " GPS L1 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_1C_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1C"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GPS L2C (M) CHANNELS ***************************
-            LOG(INFO) << "Getting " << Channels_2S_count << " GPS L2C (M) channels";
-
-            for (unsigned int i = 0; i < Channels_2S_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("2S"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GPS L5 CHANNELS ********************************
-            LOG(INFO) << "Getting " << Channels_L5_count << " GPS L5 channels";
-
-            for (unsigned int i = 0; i < Channels_L5_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("L5"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E1 B (I/NAV OS) CHANNELS ***************
-            LOG(INFO) << "Getting " << Channels_1B_count << " GALILEO E1 B (I/NAV OS) channels";
-
-            for (unsigned int i = 0; i < Channels_1B_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1B"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E5a I (F/NAV OS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_5X_count << " GALILEO E5a I (F/NAV OS) channels";
-
-            for (unsigned int i = 0; i < Channels_5X_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("5X"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E6 (B/C HAS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_E6_count << " GALILEO E6 (B/C HAS) channels";
-
-            for (unsigned int i = 0; i < Channels_E6_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("E6"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GLONASS L1 C/A CHANNELS ************************
-            LOG(INFO) << "Getting " << Channels_1G_count << " GLONASS L1 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_1G_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("1G"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GLONASS L2 C/A CHANNELS ************************
-            LOG(INFO) << "Getting " << Channels_2G_count << " GLONASS L2 C/A channels";
-
-            for (unsigned int i = 0; i < Channels_2G_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("2G"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** BEIDOU B1I CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_B1_count << " BEIDOU B1I channels";
-
-            for (unsigned int i = 0; i < Channels_B1_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("B1"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** BEIDOU B3I CHANNELS ****************************
-            LOG(INFO) << "Getting " << Channels_B3_count << " BEIDOU B3I channels";
-
-            for (unsigned int i = 0; i < Channels_B3_count; i++)
-                {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("B3"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
-                }
-
-            // **************** GALILEO E5b I (I/NAV OS) CHANNELS **************
-            LOG(INFO) << "Getting " << Channels_7X_count << " GALILEO E5b I (I/NAV OS) channels";
+    // Signal of each channel, in the order given by channel_absolute_id
+    std::vector<std::string> channel_signal;
+    channel_signal.reserve(total_channels);
+    const std::vector<std::pair<std::string, unsigned int>> signal_counts = {
+        {"1C", Channels_1C_count},
+        {"2S", Channels_2S_count},
+        {"L5", Channels_L5_count},
+        {"1B", Channels_1B_count},
+        {"5X", Channels_5X_count},
+        {"E6", Channels_E6_count},
+        {"1G", Channels_1G_count},
+        {"2G", Channels_2G_count},
+        {"B1", Channels_B1_count},
+        {"B3", Channels_B3_count},
+        {"7X", Channels_7X_count}};
+    for (const auto& signal_count : signal_counts)
+        {
+            LOG(INFO) << "Getting " << signal_count.second << " " << signal_count.first << " channels";
+            channel_signal.insert(channel_signal.end(), signal_count.second, signal_count.first);
+        }
+
+    // Channels are independent, and most of their construction time is spent
+    // filling the local code replicas and FFT plans of the acquisition blocks,
+    // so they are built concurrently. Each worker writes only the slots it
+    // picks, and the vector keeps the channel_absolute_id order, so the
+    // flowgraph is connected in the same order regardless of the thread count.
+    uint32_t n_threads = configuration->property("GNSS-SDR.channels_init_threads", 0);
+    if (n_threads == 0)
+        {
+            n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+#if ENABLE_FPGA
+    n_threads = 1;  // FPGA blocks open the device files of their channel on construction
+#endif
+    n_threads = std::min(n_threads, std::max(total_channels, 1U));
 
-            for (unsigned int i = 0; i < Channels_7X_count; i++)
+    auto channels = std::make_unique<std::vector<std::unique_ptr<GNSSBlockInterface>>>(total_channels);
+    std::vector<std::exception_ptr> errors(total_channels);
+    std::atomic<unsigned int> next_channel{0};
+    auto build_channels = [&]() {
+        unsigned int channel_absolute_id;
+        while ((channel_absolute_id = next_channel++) < total_channels)
+            {
+                try
+                    {
+                        // Store the channel into the vector of channels
+                        channels->at(channel_absolute_id) = GetChannel(configuration,
+                            channel_signal[channel_absolute_id],
+                            static_cast<int>(channel_absolute_id),
+                            queue);
+                    }
+                catch (...)
+                    {
+                        errors[channel_absolute_id] = std::current_exception();
+                    }
+            }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(n_threads - 1);
+    for (uint32_t i = 1; i < n_threads; i++)
+        {
+            workers.emplace_back(build_channels);
+        }
+    build_channels();
+    for (auto& w : workers)
+        {
+            w.join();
+        }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    LOG(INFO) << total_channels << " channels built in " << elapsed.count() << " s using " << n_threads << " threads";
+
+    for (unsigned int i = 0; i < total_channels; i++)
+        {
+            if (errors[i])
                 {
-                    // Store the channel into the vector of channels
-                    channels->at(channel_absolute_id) = GetChannel(configuration,
-                        std::string("7X"),
-                        channel_absolute_id,
-                        queue);
-                    channel_absolute_id++;
+                    try
+                        {
+                            std::rethrow_exception(errors[i]);
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(WARNING) << "Channel " << i << ": " << e.what();
+                        }
                 }
         }
-    catch (const std::exception& e)
-        {
-            LOG(WARNING) << e.what();
-        }
 
     return channels;
 }
@@ -36,17 +36,21 @@
 #include "gnss_satellite.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
+#include "visibility_predictor.h"
 #include <boost/lexical_cast.hpp>    // for boost::lexical_cast
 #include <boost/tokenizer.hpp>       // for boost::tokenizer
 #include <glog/logging.h>            // for LOG
 #include <gnuradio/basic_block.h>    // for basic_block
+#include <gnuradio/block.h>          // for block
 #include <gnuradio/filter/firdes.h>  // for gr::filter::firdes
 #include <gnuradio/io_signature.h>   // for io_signature
 #include <gnuradio/top_block.h>      // for top_block, make_top_block
 #include <pmt/pmt_sugar.h>           // for mp
-#include <algorithm>                 // for transform, sort, unique
-#include <cmath>                     // for floor
+#include <algorithm>                 // for transform, sort, unique, max, min
+#include <chrono>                    // for steady_clock
+#include <cmath>                     // for floor, abs
 #include <cstddef>                   // for size_t
+#include <cstdint>                   // for int64_t
 #include <exception>                 // for exception
 #include <iostream>                  // for operator<<
 #include <iterator>                  // for insert_iterator, inserter
@@ -72,6 +76,9 @@ GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configurati
 {
     connected_ = false;
     running_ = false;
+    visibility_generation_ = 0;
+    visibility_doppler_window_hz_ = 0;
+    visibility_oscillator_ppm_ = 0.0;
     configuration_ = std::move(configuration);
     queue_ = std::move(queue);
     multiband_ = GNSSFlowgraph::is_multiband();
@@ -116,12 +123,21 @@ void GNSSFlowgraph::start()
         }
 #endif
 
+    if (visibility_predictor_)
+        {
+            visibility_predictor_->start();
+        }
+
     running_ = true;
 }
 
 
 void GNSSFlowgraph::stop()
 {
+    if (visibility_predictor_)
+        {
+            visibility_predictor_->stop();
+        }
     for (const auto& chan : channels_)
         {
             chan->stop_channel();  // stop the acquisition or tracking operation
@@ -131,6 +147,12 @@ void GNSSFlowgraph::stop()
     top_block_->wait();
 #endif
     running_ = false;
+    if (channel_events_ > 0)
+        {
+            LOG(INFO) << "Channel events: " << channel_events_ << " handled in "
+                      << channel_events_total_us_ / static_cast<double>(channel_events_) << " us on average, "
+                      << channel_events_max_us_ << " us at most";
+        }
 }
 
 
@@ -145,6 +167,7 @@ void GNSSFlowgraph::connect()
             LOG(WARNING) << "flowgraph already connected";
             return;
         }
+    const auto connect_start = std::chrono::steady_clock::now();
 
 #ifndef ENABLE_FPGA
     for (int i = 0; i < sources_count_; i++)
@@ -225,6 +248,15 @@ void GNSSFlowgraph::connect()
         }
 
     DLOG(INFO) << "blocks connected internally";
+
+    // The channels are fed by the conditioner output, or directly by the
+    // source output if the conditioner has no blocks
+    sig_conditioner_output_.clear();
+    for (auto& sig : sig_conditioner_)
+        {
+            sig_conditioner_output_.emplace_back(sig->get_right_block(), 0);
+        }
+
 // Signal Source (i) >  Signal conditioner (i) >
 #ifndef ENABLE_FPGA
     int RF_Channels = 0;
@@ -257,14 +289,13 @@ void GNSSFlowgraph::connect()
                                     // Connect the multichannel signal source to multiple signal conditioners
                                     // GNURADIO max_streams=-1 means infinite ports!
                                     DLOG(INFO) << "sig_source_.at(i)->get_right_block()->output_signature()->max_streams()=" << sig_source_.at(i)->get_right_block()->output_signature()->max_streams();
-                                    DLOG(INFO) << "sig_conditioner_.at(signal_conditioner_ID)->get_left_block()->input_signature()=" << sig_conditioner_.at(signal_conditioner_ID)->get_left_block()->input_signature()->max_streams();
 
                                     if (sig_source_.at(i)->get_right_block()->output_signature()->max_streams() > 1 or sig_source_.at(i)->get_right_block()->output_signature()->max_streams() == -1)
                                         {
                                             if (sig_conditioner_.size() > signal_conditioner_ID)
                                                 {
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << j << " to conditioner " << j;
-                                                    top_block_->connect(sig_source_.at(i)->get_right_block(), j, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_signal_conditioner(sig_source_.at(i)->get_right_block(), j, signal_conditioner_ID);
                                                 }
                                         }
                                     else
@@ -273,13 +304,13 @@ void GNSSFlowgraph::connect()
                                                 {
                                                     // RF_channel 0 backward compatibility with single channel sources
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << 0 << " to conditioner " << j;
-                                                    top_block_->connect(sig_source_.at(i)->get_right_block(), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_signal_conditioner(sig_source_.at(i)->get_right_block(), 0, signal_conditioner_ID);
                                                 }
                                             else
                                                 {
                                                     // Multiple channel sources using multiple output blocks of single channel (requires RF_channel selector in call)
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << j << " to conditioner " << j;
-                                                    top_block_->connect(sig_source_.at(i)->get_right_block(j), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_signal_conditioner(sig_source_.at(i)->get_right_block(j), 0, signal_conditioner_ID);
                                                 }
                                         }
                                     signal_conditioner_ID++;
@@ -312,8 +343,9 @@ void GNSSFlowgraph::connect()
                             throw(std::invalid_argument("Set GNSS-SDR.internal_fs_sps in configuration"));
                         }
                     const int observable_interval_ms = configuration_->property("GNSS-SDR.observable_interval_ms", 20);
-                    ch_out_sample_counter_ = gnss_sdr_make_sample_counter(fs, observable_interval_ms, sig_conditioner_.at(0)->get_right_block()->output_signature()->sizeof_stream_item(0));
-                    top_block_->connect(sig_conditioner_.at(0)->get_right_block(), 0, ch_out_sample_counter_, 0);
+                    const auto& counter_input = sig_conditioner_output_.at(0);
+                    ch_out_sample_counter_ = gnss_sdr_make_sample_counter(fs, observable_interval_ms, counter_input.first->output_signature()->sizeof_stream_item(counter_input.second));
+                    top_block_->connect(counter_input.first, counter_input.second, ch_out_sample_counter_, 0);
                     top_block_->connect(ch_out_sample_counter_, 0, observables_->get_left_block(), channels_count_);  // extra port for the sample counter pulse
                 }
             catch (const std::exception& e)
@@ -362,8 +394,9 @@ void GNSSFlowgraph::connect()
                 }
 
             const int observable_interval_ms = configuration_->property("GNSS-SDR.observable_interval_ms", 20);
-            ch_out_sample_counter_ = gnss_sdr_make_sample_counter(fs, observable_interval_ms, sig_conditioner_.at(0)->get_right_block()->output_signature()->sizeof_stream_item(0));
-            top_block_->connect(sig_conditioner_.at(0)->get_right_block(), 0, ch_out_sample_counter_, 0);
+            const auto& counter_input = sig_conditioner_output_.at(0);
+            ch_out_sample_counter_ = gnss_sdr_make_sample_counter(fs, observable_interval_ms, counter_input.first->output_signature()->sizeof_stream_item(counter_input.second));
+            top_block_->connect(counter_input.first, counter_input.second, ch_out_sample_counter_, 0);
             top_block_->connect(ch_out_sample_counter_, 0, observables_->get_left_block(), channels_count_);  // extra port for the sample counter pulse
         }
     catch (const std::exception& e)
@@ -386,20 +419,14 @@ void GNSSFlowgraph::connect()
         {
 #ifndef ENABLE_FPGA
             int selected_signal_conditioner_ID = 0;
-            const bool use_acq_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
-            const uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
-            if (configuration_->property(sig_source_.at(0)->role() + ".enable_FPGA", false) == false)
+            const bool use_acq_resampler = conf_.use_acquisition_resampler;
+            const uint32_t fs = conf_.internal_fs_sps;
+            if (conf_.enable_fpga == false)
                 {
+                    selected_signal_conditioner_ID = conf_.channel_rf_id[i];
                     try
                         {
-                            selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", 0);
-                        }
-                    catch (const std::exception& e)
-                        {
-                            LOG(WARNING) << e.what();
-                        }
-                    try
-                        {
+                            const auto& conditioner_output = sig_conditioner_output_.at(selected_signal_conditioner_ID);
                             // Enable automatic resampler for the acquisition, if required
                             if (use_acq_resampler == true)
                                 {
@@ -469,7 +496,7 @@ void GNSSFlowgraph::connect()
                                                     ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
                                                     if (ret.second == true)
                                                         {
-                                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                                            top_block_->connect(conditioner_output.first, conditioner_output.second,
                                                                 acq_resamplers_.at(map_key), 0);
                                                             LOG(INFO) << "Created "
                                                                       << channels_.at(i)->get_signal().get_signal_str()
@@ -492,23 +519,23 @@ void GNSSFlowgraph::connect()
                                                 {
                                                     LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
                                                     // resampler not required!
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                                    top_block_->connect(conditioner_output.first, conditioner_output.second,
                                                         channels_.at(i)->get_left_block_acq(), 0);
                                                 }
                                         }
                                     else
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                            top_block_->connect(conditioner_output.first, conditioner_output.second,
                                                 channels_.at(i)->get_left_block_acq(), 0);
                                         }
                                 }
                             else
                                 {
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                    top_block_->connect(conditioner_output.first, conditioner_output.second,
                                         channels_.at(i)->get_left_block_acq(), 0);
                                 }
-                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                            top_block_->connect(conditioner_output.first, conditioner_output.second,
                                 channels_.at(i)->get_left_block_trk(), 0);
                         }
                     catch (const std::exception& e)
@@ -545,7 +572,7 @@ void GNSSFlowgraph::connect()
                     if (signal_conditioner_connected.at(n) == false)
                         {
                             null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
-                            top_block_->connect(sig_conditioner_.at(n)->get_right_block(), 0,
+                            top_block_->connect(sig_conditioner_output_.at(n).first, sig_conditioner_output_.at(n).second,
                                 null_sinks_.back(), 0);
                             LOG(INFO) << "Null sink connected to signal conditioner " << n << " due to lack of connection to any channel\n";
                         }
@@ -556,15 +583,7 @@ void GNSSFlowgraph::connect()
     std::vector<unsigned int> vector_of_channels;
     for (int i = 0; i < channels_count_; i++)
         {
-            unsigned int sat = 0;
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(i) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat = conf_.channel_satellite[i];
             if (sat == 0)
                 {
                     vector_of_channels.push_back(i);
@@ -580,15 +599,7 @@ void GNSSFlowgraph::connect()
     for (unsigned int& i : vector_of_channels)
         {
             const std::string gnss_signal = channels_.at(i)->get_signal().get_signal_str();  // use channel's implicit signal
-            unsigned int sat = 0;
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(i) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat = conf_.channel_satellite[i];
             if (sat == 0)
                 {
                     bool assistance_available;
@@ -759,6 +770,9 @@ void GNSSFlowgraph::connect()
                     return;
                 }
         }
+    // Pin channel clusters to CPU cores, if requested
+    set_channels_affinity();
+
 #ifndef ENABLE_FPGA
     // Activate acquisition in enabled channels
     for (int i = 0; i < channels_count_; i++)
@@ -776,11 +790,34 @@ void GNSSFlowgraph::connect()
         }
 #endif
     connected_ = true;
-    LOG(INFO) << "Flowgraph connected";
+    const std::chrono::duration<double> connect_elapsed = std::chrono::steady_clock::now() - connect_start;
+    LOG(INFO) << "Flowgraph connected in " << connect_elapsed.count() << " s";
     top_block_->dump();
 }
 
 
+void GNSSFlowgraph::connect_signal_conditioner(gr::basic_block_sptr source_block, int port, unsigned int conditioner_id)
+{
+    if (sig_conditioner_.at(conditioner_id)->get_left_block() == nullptr)
+        {
+            LOG(INFO) << "Signal conditioner " << conditioner_id << " does nothing, connecting the signal source directly to the channels";
+            sig_conditioner_output_.at(conditioner_id) = std::make_pair(source_block, port);
+            return;
+        }
+    top_block_->connect(source_block, port, sig_conditioner_.at(conditioner_id)->get_left_block(), 0);
+}
+
+
+void GNSSFlowgraph::disconnect_signal_conditioner(gr::basic_block_sptr source_block, int port, unsigned int conditioner_id)
+{
+    if (sig_conditioner_.at(conditioner_id)->get_left_block() == nullptr)
+        {
+            return;
+        }
+    top_block_->disconnect(source_block, port, sig_conditioner_.at(conditioner_id)->get_left_block(), 0);
+}
+
+
 void GNSSFlowgraph::disconnect()
 {
     LOG(INFO) << "Disconnecting flowgraph";
@@ -822,19 +859,19 @@ void GNSSFlowgraph::disconnect()
                                         {
                                             if (sig_source_.at(i)->get_right_block()->output_signature()->max_streams() > 1)
                                                 {
-                                                    top_block_->disconnect(sig_source_.at(i)->get_right_block(), j, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(), j, signal_conditioner_ID);
                                                 }
                                             else
                                                 {
                                                     if (j == 0)
                                                         {
                                                             // RF_channel 0 backward compatibility with single channel sources
-                                                            top_block_->disconnect(sig_source_.at(i)->get_right_block(), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                            disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(), 0, signal_conditioner_ID);
                                                         }
                                                     else
                                                         {
                                                             // Multiple channel sources using multiple output blocks of single channel (requires RF_channel selector in call)
-                                                            top_block_->disconnect(sig_source_.at(i)->get_right_block(j), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                            disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(j), 0, signal_conditioner_ID);
                                                         }
                                                 }
                                             signal_conditioner_ID++;
@@ -875,19 +912,19 @@ void GNSSFlowgraph::disconnect()
                                 {
                                     if (sig_source_.at(i)->get_right_block()->output_signature()->max_streams() > 1 or sig_source_.at(i)->get_right_block()->output_signature()->max_streams() == -1)
                                         {
-                                            top_block_->disconnect(sig_source_.at(i)->get_right_block(), j, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                            disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(), j, signal_conditioner_ID);
                                         }
                                     else
                                         {
                                             if (j == 0)
                                                 {
                                                     // RF_channel 0 backward compatibility with single channel sources
-                                                    top_block_->disconnect(sig_source_.at(i)->get_right_block(), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(), 0, signal_conditioner_ID);
                                                 }
                                             else
                                                 {
                                                     // Multiple channel sources using multiple output blocks of single channel (requires RF_channel selector in call)
-                                                    top_block_->disconnect(sig_source_.at(i)->get_right_block(j), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    disconnect_signal_conditioner(sig_source_.at(i)->get_right_block(j), 0, signal_conditioner_ID);
                                                 }
                                         }
                                     signal_conditioner_ID++;
@@ -910,7 +947,7 @@ void GNSSFlowgraph::disconnect()
             // disconnect the sample counter to Observables
             try
                 {
-                    top_block_->disconnect(sig_conditioner_.at(0)->get_right_block(), 0, ch_out_sample_counter_, 0);
+                    top_block_->disconnect(sig_conditioner_output_.at(0).first, sig_conditioner_output_.at(0).second, ch_out_sample_counter_, 0);
                     top_block_->disconnect(ch_out_sample_counter_, 0, observables_->get_left_block(), channels_count_);  // extra port for the sample counter pulse
                 }
             catch (const std::exception& e)
@@ -940,7 +977,7 @@ void GNSSFlowgraph::disconnect()
     // disconnect the sample counter to Observables
     try
         {
-            top_block_->disconnect(sig_conditioner_.at(0)->get_right_block(), 0, ch_out_sample_counter_, 0);
+            top_block_->disconnect(sig_conditioner_output_.at(0).first, sig_conditioner_output_.at(0).second, ch_out_sample_counter_, 0);
             top_block_->disconnect(ch_out_sample_counter_, 0, observables_->get_left_block(), channels_count_);  // extra port for the sample counter pulse
         }
     catch (const std::exception& e)
@@ -955,20 +992,11 @@ void GNSSFlowgraph::disconnect()
     for (int i = 0; i < channels_count_; i++)
         {
 #ifndef ENABLE_FPGA
-            int selected_signal_conditioner_ID;
-            try
-                {
-                    selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                    top_block_->disconnect_all();
-                    return;
-                }
+            const int selected_signal_conditioner_ID = conf_.channel_rf_id[i];
             try
                 {
-                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    const auto& conditioner_output = sig_conditioner_output_.at(selected_signal_conditioner_ID);
+                    top_block_->disconnect(conditioner_output.first, conditioner_output.second,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -1113,6 +1141,40 @@ bool GNSSFlowgraph::send_telemetry_msg(const pmt::pmt_t& msg)
 }
 
 
+void GNSSFlowgraph::set_channels_affinity()
+{
+    // Under the thread-per-block scheduler, each channel spawns one thread per block.
+    // Channels are grouped into GNSS-SDR.channel_clusters contiguous clusters (channels
+    // of the same signal share the same signal conditioner buffer), and all the blocks
+    // of a cluster are pinned to the same core, starting at GNSS-SDR.channel_clusters_first_core.
+    const int clusters = configuration_->property("GNSS-SDR.channel_clusters", 0);
+    if (clusters <= 0 or channels_count_ == 0)
+        {
+            return;
+        }
+    const int first_core = configuration_->property("GNSS-SDR.channel_clusters_first_core", 0);
+    const int available_cores = static_cast<int>(std::thread::hardware_concurrency());
+    if (available_cores > 0 and first_core + clusters > available_cores)
+        {
+            LOG(WARNING) << "GNSS-SDR.channel_clusters=" << clusters << " starting at core " << first_core
+                         << " exceeds the " << available_cores << " available cores. Channel clustering disabled.";
+            return;
+        }
+
+    for (int i = 0; i < channels_count_; i++)
+        {
+            const int cluster = static_cast<int>((static_cast<int64_t>(i) * clusters) / channels_count_);
+            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+            if (channel_ptr != nullptr)
+                {
+                    channel_ptr->set_processor_affinity(std::vector<int>{first_core + cluster});
+                }
+        }
+    LOG(INFO) << channels_count_ << " channels grouped into " << clusters << " clusters, pinned to cores "
+              << first_core << " to " << first_core + clusters - 1;
+}
+
+
 void GNSSFlowgraph::push_back_signal(const Gnss_Signal& gs)
 {
     switch (mapStringValues_[gs.get_signal_str()])
@@ -1260,19 +1322,12 @@ double GNSSFlowgraph::project_doppler(const std::string& searched_signal, double
 
 void GNSSFlowgraph::acquisition_manager(unsigned int who)
 {
+    apply_visibility_prediction();
     unsigned int current_channel;
     for (int i = 0; i < channels_count_; i++)
         {
             current_channel = (i + who + 1) % channels_count_;
-            unsigned int sat_ = 0;
-            try
-                {
-                    sat_ = configuration_->property("Channel" + std::to_string(current_channel) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            const unsigned int sat_ = conf_.channel_satellite[current_channel];
             if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[current_channel] == 0))
                 {
                     bool is_primary_freq = true;
@@ -1291,7 +1346,7 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                                 estimated_doppler,
                                 RX_time);
                             channels_[current_channel]->set_signal(gnss_signal);
-                            start_acquisition = is_primary_freq or assistance_available or !configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_);
+                            start_acquisition = is_primary_freq or assistance_available or !conf_.assist_dual_frequency_acq;
                         }
                     else
                         {
@@ -1306,10 +1361,14 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                             DLOG(INFO) << "Channel " << current_channel
                                        << " Starting acquisition " << channels_[current_channel]->get_signal().get_satellite()
                                        << ", Signal " << channels_[current_channel]->get_signal().get_signal_str();
-                            if (assistance_available == true and configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_))
+                            if (assistance_available == true and conf_.assist_dual_frequency_acq)
                                 {
                                     channels_[current_channel]->assist_acquisition_doppler(project_doppler(channels_[current_channel]->get_signal().get_signal_str(), estimated_doppler));
                                 }
+                            else if (assist_acquisition_with_prediction(current_channel))
+                                {
+                                    DLOG(INFO) << "Channel " << current_channel << " acquisition assisted with the predicted Doppler";
+                                }
                             else
                                 {
                                     // set Doppler center to 0 Hz
@@ -1364,24 +1423,22 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
     // todo: the acquisition events are initiated from the acquisition success or failure queued msg. If the acquisition is disabled for non-assisted secondary freq channels, the engine stops..
     std::lock_guard<std::mutex> lock(signal_list_mutex_);
     DLOG(INFO) << "Received " << what << " from " << who;
+    const auto start = std::chrono::steady_clock::now();
     unsigned int sat = 0;
     Gnss_Signal gs;
     if (who < 200)
         {
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(who) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            sat = conf_.channel_satellite[who];
         }
     switch (what)
         {
         case 0:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " ACQ FAILED satellite " << gs.get_satellite() << ", Signal " << gs.get_signal_str();
+            if (visibility_predictor_)
+                {
+                    visibility_failed_dwells_[prediction_key(gs)]++;
+                }
             channels_state_[who] = 0;
             if (acq_channels_count_ > 0)
                 {
@@ -1398,6 +1455,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
         case 1:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " ACQ SUCCESS satellite " << gs.get_satellite();
+            visibility_failed_dwells_.erase(prediction_key(gs));
             // If the satellite is in the list of available ones, remove it.
             remove_signal(gs);
 
@@ -1420,6 +1478,10 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                     acq_channels_count_++;
                     DLOG(INFO) << "Channel " << who << " Starting acquisition " << gs.get_satellite() << ", Signal " << gs.get_signal_str();
                     channels_[who]->set_signal(channels_[who]->get_signal());
+                    if (visibility_predictor_ and !assist_acquisition_with_prediction(who))
+                        {
+                            channels_[who]->assist_acquisition_doppler(0);
+                        }
 #ifndef ENABLE_FPGA
                     channels_[who]->start_acquisition();
 #else
@@ -1456,6 +1518,13 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
         default:
             break;
         }
+    if (who < 200)
+        {
+            const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            channel_events_++;
+            channel_events_total_us_ += elapsed.count();
+            channel_events_max_us_ = std::max(channel_events_max_us_, elapsed.count());
+        }
 }
 
 
@@ -1529,6 +1598,161 @@ void GNSSFlowgraph::priorize_satellites(const std::vector<std::pair<int, Gnss_Sa
 }
 
 
+void GNSSFlowgraph::set_visibility_reference(time_t rx_utc_time, const std::array<float, 3>& LLH)
+{
+    if (visibility_predictor_)
+        {
+            visibility_predictor_->set_reference(rx_utc_time, LLH);
+        }
+}
+
+
+std::map<std::string, double> GNSSFlowgraph::stage_work_time() const
+{
+    std::map<std::string, std::vector<gr::basic_block_sptr>> stage_blocks;
+    for (const auto& source : sig_source_)
+        {
+            // Left blocks of sources are not defined
+            stage_blocks["SignalSource"].push_back(source->get_right_block());
+        }
+    for (const auto& conditioner : sig_conditioner_)
+        {
+            stage_blocks["SignalConditioner"].push_back(conditioner->get_left_block());
+            stage_blocks["SignalConditioner"].push_back(conditioner->get_right_block());
+        }
+    for (const auto& channel : channels_)
+        {
+            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channel);
+            if (channel_ptr == nullptr)
+                {
+                    continue;
+                }
+            stage_blocks["Acquisition"].push_back(channel_ptr->acquisition()->get_left_block());
+            stage_blocks["Acquisition"].push_back(channel_ptr->acquisition()->get_right_block());
+            stage_blocks["Tracking"].push_back(channel_ptr->tracking()->get_left_block());
+            stage_blocks["Tracking"].push_back(channel_ptr->tracking()->get_right_block());
+            stage_blocks["TelemetryDecoder"].push_back(channel_ptr->telemetry()->get_left_block());
+            stage_blocks["TelemetryDecoder"].push_back(channel_ptr->telemetry()->get_right_block());
+        }
+    if (observables_ != nullptr)
+        {
+            stage_blocks["Observables"] = {observables_->get_left_block(), observables_->get_right_block()};
+        }
+    if (pvt_ != nullptr)
+        {
+            stage_blocks["PVT"] = {pvt_->get_left_block(), pvt_->get_right_block()};
+        }
+
+    std::map<std::string, double> work_time;
+    for (const auto& stage : stage_blocks)
+        {
+            std::set<gr::block*> counted_blocks;
+            double stage_time = 0.0;
+            for (const auto& basic_block : stage.second)
+                {
+                    // Hierarchical blocks and null pointers are skipped, only gr::block instances have counters
+                    auto* blk = dynamic_cast<gr::block*>(basic_block.get());
+                    if (blk == nullptr or !counted_blocks.insert(blk).second)
+                        {
+                            continue;
+                        }
+                    stage_time += static_cast<double>(blk->pc_work_time_total());
+                }
+            work_time[stage.first] = stage_time;
+        }
+    return work_time;
+}
+
+
+void GNSSFlowgraph::apply_visibility_prediction()
+{
+    if (!visibility_predictor_ or visibility_predictor_->generation() == visibility_generation_)
+        {
+            return;
+        }
+    visibility_generation_ = visibility_predictor_->generation();
+
+    // satellites below the elevation mask are searched last...
+    defer_satellites(visibility_predictor_->get_hidden_sats());
+
+    // ...and the visible ones first, starting from the highest elevation
+    std::vector<std::pair<int, Gnss_Satellite>> visible_satellites = visibility_predictor_->get_visible_sats();
+    std::reverse(visible_satellites.begin(), visible_satellites.end());
+    priorize_satellites(visible_satellites);
+}
+
+
+void GNSSFlowgraph::defer_satellites(const std::vector<Gnss_Satellite>& hidden_satellites)
+{
+    for (const auto& hidden_satellite : hidden_satellites)
+        {
+            std::vector<std::pair<std::list<Gnss_Signal>*, std::string>> signal_lists;
+            if (hidden_satellite.get_system() == "GPS")
+                {
+                    signal_lists = {{&available_GPS_1C_signals_, "1C"}, {&available_GPS_2S_signals_, "2S"}, {&available_GPS_L5_signals_, "L5"}};
+                }
+            else if (hidden_satellite.get_system() == "Galileo")
+                {
+                    signal_lists = {{&available_GAL_1B_signals_, "1B"}, {&available_GAL_5X_signals_, "5X"}, {&available_GAL_7X_signals_, "7X"}, {&available_GAL_E6_signals_, "E6"}};
+                }
+            for (auto& signal_list : signal_lists)
+                {
+                    const Gnss_Signal gs(hidden_satellite, signal_list.second);
+                    const size_t old_size = signal_list.first->size();
+                    signal_list.first->remove(gs);
+                    if (old_size > signal_list.first->size())
+                        {
+                            signal_list.first->push_back(gs);
+                        }
+                }
+        }
+}
+
+
+std::string GNSSFlowgraph::prediction_key(const Gnss_Signal& gs) const
+{
+    return gs.get_satellite().get_system_short() + std::to_string(gs.get_satellite().get_PRN()) + gs.get_signal_str();
+}
+
+
+bool GNSSFlowgraph::assist_acquisition_with_prediction(unsigned int channel_id)
+{
+    if (!visibility_predictor_)
+        {
+            return false;
+        }
+    const Gnss_Signal gs = channels_[channel_id]->get_signal();
+    double doppler_hz = 0.0;
+    double doppler_rate_hz_s = 0.0;
+    if (!visibility_predictor_->get_doppler(gs.get_satellite(), doppler_hz, doppler_rate_hz_s))
+        {
+            return false;
+        }
+    const double signal_doppler_hz = project_doppler(gs.get_signal_str(), doppler_hz);
+    std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_[channel_id]);
+    if (channel_ptr)
+        {
+            uint32_t doppler_window_hz = 0;  // full search range
+            if (visibility_doppler_window_hz_ > 0)
+                {
+                    // The prediction does not include the drift of the receiver clock, so the window
+                    // is widened by the oscillator uncertainty, and doubled after each failed dwell
+                    const double oscillator_hz = std::abs(project_doppler(gs.get_signal_str(), visibility_oscillator_ppm_ * 1e-6 * FREQ1));
+                    const auto failed_dwells = visibility_failed_dwells_.find(prediction_key(gs));
+                    const uint32_t doublings = failed_dwells == visibility_failed_dwells_.end() ? 0 : std::min(failed_dwells->second, 10U);
+                    const double window_hz = (visibility_doppler_window_hz_ + oscillator_hz) * static_cast<double>(1U << doublings);
+                    doppler_window_hz = static_cast<uint32_t>(std::min(window_hz, 1.0e9));
+                }
+            channel_ptr->set_acquisition_doppler_window(signal_doppler_hz, doppler_window_hz);
+        }
+    else
+        {
+            channels_[channel_id]->assist_acquisition_doppler(signal_doppler_hz);
+        }
+    return true;
+}
+
+
 void GNSSFlowgraph::set_configuration(const std::shared_ptr<ConfigurationInterface>& configuration)
 {
     if (running_)
@@ -1582,6 +1806,7 @@ void GNSSFlowgraph::init()
      * Instantiates the receiver blocks
      */
     auto block_factory = std::make_unique<GNSSBlockFactory>();
+    const auto init_start = std::chrono::steady_clock::now();
 
     channels_status_ = channel_status_msg_receiver_make();
 
@@ -1632,11 +1857,26 @@ void GNSSFlowgraph::init()
                 }
         }
 
+    const auto sources_end = std::chrono::steady_clock::now();
+
     observables_ = block_factory->GetObservables(configuration_.get());
 
     pvt_ = block_factory->GetPVT(configuration_.get());
 
+    if (configuration_->property("GNSS-SDR.visibility_prediction", false))
+        {
+            visibility_predictor_ = std::make_shared<VisibilityPredictor>(get_pvt(),
+                configuration_->property("GNSS-SDR.visibility_elevation_mask_deg", 0.0),
+                configuration_->property("GNSS-SDR.visibility_refresh_period_s", 10.0),
+                configuration_->property("GNSS-SDR.pre_2009_file", false));
+            visibility_doppler_window_hz_ = configuration_->property("GNSS-SDR.visibility_doppler_window_hz", 0);
+            visibility_oscillator_ppm_ = configuration_->property("GNSS-SDR.visibility_oscillator_ppm", 2.0);
+        }
+
+    const auto pvt_end = std::chrono::steady_clock::now();
+
     auto channels = block_factory->GetChannels(configuration_.get(), queue_.get());
+    const auto channels_end = std::chrono::steady_clock::now();
 
     channels_count_ = static_cast<int>(channels->size());
     for (int i = 0; i < channels_count_; i++)
@@ -1659,10 +1899,21 @@ void GNSSFlowgraph::init()
     mapStringValues_["B1"] = evBDS_B1;
     mapStringValues_["B3"] = evBDS_B3;
 
+    // parameters needed while running, parsed only once
+    conf_.SetFromConfiguration(configuration_.get(), sig_source_.at(0)->role(), channels_count_, multiband_);
+
     // fill the signals queue with the satellites ID's to be searched by the acquisition
     set_signals_list();
     set_channels_state();
     DLOG(INFO) << "Blocks instantiated. " << channels_count_ << " channels.";
+    const std::chrono::duration<double> sources_elapsed = sources_end - init_start;
+    const std::chrono::duration<double> pvt_elapsed = pvt_end - sources_end;
+    const std::chrono::duration<double> channels_elapsed = channels_end - pvt_end;
+    const std::chrono::duration<double> init_elapsed = std::chrono::steady_clock::now() - init_start;
+    LOG(INFO) << "Startup times: signal sources and conditioners " << sources_elapsed.count()
+              << " s, observables and PVT " << pvt_elapsed.count()
+              << " s, channels " << channels_elapsed.count()
+              << " s, total " << init_elapsed.count() << " s";
 
     /*
      * Instantiate the receiver monitor block, if required
@@ -1685,7 +1936,8 @@ void GNSSFlowgraph::init()
             GnssSynchroMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("Monitor.decimation_factor", 1),
                 configuration_->property("Monitor.udp_port", 1234),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("Monitor.max_latency_ms", 0));
         }
 
     /*
@@ -1708,7 +1960,8 @@ void GNSSFlowgraph::init()
             GnssSynchroAcquisitionMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("AcquisitionMonitor.decimation_factor", 1),
                 configuration_->property("AcquisitionMonitor.udp_port", 1235),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("AcquisitionMonitor.max_latency_ms", 0));
         }
 
     /*
@@ -1731,7 +1984,8 @@ void GNSSFlowgraph::init()
             GnssSynchroTrackingMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("TrackingMonitor.decimation_factor", 1),
                 configuration_->property("TrackingMonitor.udp_port", 1236),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("TrackingMonitor.max_latency_ms", 0));
         }
 }
 
@@ -2136,7 +2390,7 @@ void GNSSFlowgraph::set_signals_list()
 void GNSSFlowgraph::set_channels_state()
 {
     std::lock_guard<std::mutex> lock(signal_list_mutex_);
-    max_acq_channels_ = configuration_->property("Channels.in_acquisition", channels_count_);
+    max_acq_channels_ = conf_.max_acq_channels;
     if (max_acq_channels_ > channels_count_)
         {
             max_acq_channels_ = channels_count_;
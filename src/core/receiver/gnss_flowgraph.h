@@ -26,12 +26,16 @@
 
 #include "channel_status_msg_receiver.h"
 #include "concurrent_queue.h"
+#include "flowgraph_conf.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_signal.h"
 #include "pvt_interface.h"
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
+#include <array>                        // for array
+#include <cstdint>                      // for uint32_t, uint64_t
+#include <ctime>                        // for time_t
 #include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
@@ -53,6 +57,7 @@ class ChannelInterface;
 class ConfigurationInterface;
 class GNSSBlockInterface;
 class Gnss_Satellite;
+class VisibilityPredictor;
 
 /*! \brief This class represents a GNSS flow graph.
  *
@@ -153,6 +158,22 @@ public:
      */
     void priorize_satellites(const std::vector<std::pair<int, Gnss_Satellite>>& visible_satellites);
 
+    /*!
+     * \brief Sets the approximate receiver time and position (latitude [deg],
+     * longitude [deg], height [m]) used by the visibility prediction until
+     * there is a PVT fix. Has no effect if GNSS-SDR.visibility_prediction is disabled.
+     */
+    void set_visibility_reference(time_t rx_utc_time, const std::array<float, 3>& LLH);
+
+    /*!
+     * \brief Returns the accumulated work() time of the blocks exposed by each
+     * receiver stage ("SignalSource", "SignalConditioner", "Acquisition",
+     * "Tracking", "TelemetryDecoder", "Observables" and "PVT"), as reported by
+     * the GNU Radio performance counters. Times are zero unless the counters
+     * are enabled ([PerfCounters] on = True, or GR_CONF_PERFCOUNTERS_ON=True).
+     */
+    std::map<std::string, double> stage_work_time() const;
+
 #ifdef ENABLE_FPGA
     void start_acquisition_helper();
 
@@ -171,6 +192,18 @@ private:
         float& estimated_doppler,
         double& RX_time);
 
+    // Connects a source output to a signal conditioner, or takes it as the
+    // conditioner output if the conditioner has no blocks (e.g. Pass_Through)
+    void connect_signal_conditioner(gr::basic_block_sptr source_block, int port, unsigned int conditioner_id);
+    void disconnect_signal_conditioner(gr::basic_block_sptr source_block, int port, unsigned int conditioner_id);
+
+    void set_channels_affinity();  // Pins the blocks of each channel cluster to its own CPU core, if enabled
+
+    void apply_visibility_prediction();  // Reorders the search lists with the latest visibility table, if it changed
+    void defer_satellites(const std::vector<Gnss_Satellite>& hidden_satellites);
+    bool assist_acquisition_with_prediction(unsigned int channel_id);
+    std::string prediction_key(const Gnss_Signal& gs) const;  // Key of the failed dwells of a signal
+
     void push_back_signal(const Gnss_Signal& gs);
     void remove_signal(const Gnss_Signal& gs);
 
@@ -183,12 +216,15 @@ private:
 
     std::shared_ptr<ConfigurationInterface> configuration_;
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue_;
+    Flowgraph_Conf conf_;
 
     std::vector<std::shared_ptr<GNSSBlockInterface>> sig_source_;
     std::vector<std::shared_ptr<GNSSBlockInterface>> sig_conditioner_;
+    std::vector<std::pair<gr::basic_block_sptr, int>> sig_conditioner_output_;  // block and port feeding the channels of each conditioner
     std::vector<std::shared_ptr<ChannelInterface>> channels_;
     std::shared_ptr<GNSSBlockInterface> observables_;
     std::shared_ptr<GNSSBlockInterface> pvt_;
+    std::shared_ptr<VisibilityPredictor> visibility_predictor_;
 
     std::map<std::string, gr::basic_block_sptr> acq_resamplers_;
     std::vector<gr::blocks::null_sink::sptr> null_sinks_;
@@ -233,11 +269,19 @@ private:
         evBDS_B3
     };
     std::map<std::string, StringValue> mapStringValues_;
+    std::map<std::string, uint32_t> visibility_failed_dwells_;
 
     std::string config_file_;
 
     std::mutex signal_list_mutex_;
 
+    uint64_t visibility_generation_;
+    uint64_t channel_events_{0};
+    double channel_events_total_us_{0.0};
+    double channel_events_max_us_{0.0};
+    uint32_t visibility_doppler_window_hz_;
+    double visibility_oscillator_ppm_;
+
     int sources_count_;
     int channels_count_;
     int acq_channels_count_;
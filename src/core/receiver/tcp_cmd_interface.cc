@@ -17,11 +17,13 @@
 
 #include "tcp_cmd_interface.h"
 #include "command_event.h"
+#include "gnss_sdr_block_stats.h"
 #include "pvt_interface.h"
 #include <boost/asio.hpp>
 #include <cmath>      // for isnan
 #include <exception>  // for exception
 #include <iomanip>    // for setprecision
+#include <memory>     // for atomic_load, atomic_store
 #include <sstream>    // for stringstream
 #include <utility>    // for move
 
@@ -53,6 +55,7 @@ void TcpCmdInterface::register_functions()
     functions_["warmstart"] = [&](auto &s) { return TcpCmdInterface::warmstart(s); };
     functions_["coldstart"] = [&](auto &s) { return TcpCmdInterface::coldstart(s); };
     functions_["set_ch_satellite"] = [&](auto &s) { return TcpCmdInterface::set_ch_satellite(s); };
+    functions_["stats"] = [&](auto &s) { return TcpCmdInterface::stats(s); };
 #else
     functions_["status"] = std::bind(&TcpCmdInterface::status, this, std::placeholders::_1);
     functions_["standby"] = std::bind(&TcpCmdInterface::standby, this, std::placeholders::_1);
@@ -61,13 +64,15 @@ void TcpCmdInterface::register_functions()
     functions_["warmstart"] = std::bind(&TcpCmdInterface::warmstart, this, std::placeholders::_1);
     functions_["coldstart"] = std::bind(&TcpCmdInterface::coldstart, this, std::placeholders::_1);
     functions_["set_ch_satellite"] = std::bind(&TcpCmdInterface::set_ch_satellite, this, std::placeholders::_1);
+    functions_["stats"] = std::bind(&TcpCmdInterface::stats, this, std::placeholders::_1);
 #endif
 }
 
 
 void TcpCmdInterface::set_pvt(std::shared_ptr<PvtInterface> PVT_sptr)
 {
-    PVT_sptr_ = std::move(PVT_sptr);
+    // The control thread replaces the PVT block while the telecommands are served
+    std::atomic_store(&PVT_sptr_, std::move(PVT_sptr));
 }
 
 
@@ -139,7 +144,9 @@ std::string TcpCmdInterface::status(const std::vector<std::string> &commandLine
     double ground_speed_kmh;
     double course_over_ground_deg;
     time_t UTC_time;
-    if (PVT_sptr_->get_latest_PVT(&longitude_deg,
+    // The PVT block is replaced when the receiver restarts in-process
+    const std::shared_ptr<PvtInterface> pvt = std::atomic_load(&PVT_sptr_);
+    if (pvt != nullptr && pvt->get_latest_PVT(&longitude_deg,
             &latitude_deg,
             &height_m,
             &ground_speed_kmh,
@@ -296,6 +303,37 @@ std::string TcpCmdInterface::set_ch_satellite(const std::vector<std::string> &co
 }
 
 
+std::string TcpCmdInterface::stats(const std::vector<std::string> &commandLine)
+{
+    std::string response;
+    if (commandLine.size() == 1)
+        {
+            response = Block_Stats_Registry::instance().report();
+        }
+    else if (commandLine.at(1) == "on")
+        {
+            Block_Stats::set_enabled(true);
+            response = "OK\n";
+        }
+    else if (commandLine.at(1) == "off")
+        {
+            Block_Stats::set_enabled(false);
+            response = "OK\n";
+        }
+    else if (commandLine.at(1) == "reset")
+        {
+            Block_Stats_Registry::instance().reset();
+            response = "OK\n";
+        }
+    else
+        {
+            response = "ERROR\n";
+        }
+
+    return response;
+}
+
+
 void TcpCmdInterface::set_msg_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue)
 {
     control_queue_ = std::move(control_queue);
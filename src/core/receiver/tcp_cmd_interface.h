@@ -68,11 +68,12 @@ private:
     std::string warmstart(const std::vector<std::string> &commandLine);
     std::string coldstart(const std::vector<std::string> &commandLine);
     std::string set_ch_satellite(const std::vector<std::string> &commandLine);
+    std::string stats(const std::vector<std::string> &commandLine);
 
     void register_functions();
 
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
-    std::shared_ptr<PvtInterface> PVT_sptr_;
+    std::shared_ptr<PvtInterface> PVT_sptr_;  // accessed with std::atomic_load and std::atomic_store
 
     float rx_latitude_;
     float rx_longitude_;
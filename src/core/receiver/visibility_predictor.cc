@@ -0,0 +1,348 @@
+/*!
+ * \file visibility_predictor.cc
+ * \brief Background service that predicts satellite visibility and Doppler
+ * for acquisition scheduling
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "visibility_predictor.h"
+#include "MATH_CONSTANTS.h"       // for D2R, R2D, SPEED_OF_LIGHT_M_S
+#include "galileo_almanac.h"      // for Galileo_Almanac
+#include "galileo_ephemeris.h"    // for Galileo_Ephemeris
+#include "gnss_frequencies.h"     // for FREQ1
+#include "gps_almanac.h"          // for Gps_Almanac
+#include "gps_ephemeris.h"        // for Gps_Ephemeris
+#include "pvt_interface.h"        // for PvtInterface
+#include "rtklib_conversions.h"   // for eph_to_rtklib, alm_to_rtklib
+#include "rtklib_ephemeris.h"     // for eph2pos, alm2pos
+#include "rtklib_rtkcmn.h"        // for utc2gpst, timeadd, geodist, satazel
+#include <glog/logging.h>         // for LOG
+#include <algorithm>              // for sort
+#include <cmath>                  // for floor
+#include <string>                 // for string
+#include <utility>                // for move
+
+
+VisibilityPredictor::VisibilityPredictor(std::shared_ptr<PvtInterface> pvt,
+    double elevation_mask_deg,
+    double refresh_period_s,
+    bool pre_2009_file) : pvt_(std::move(pvt)),
+                          elevation_mask_deg_(elevation_mask_deg),
+                          refresh_period_s_(refresh_period_s > 0.0 ? refresh_period_s : 10.0),
+                          pre_2009_file_(pre_2009_file)
+{
+}
+
+
+VisibilityPredictor::~VisibilityPredictor()
+{
+    VisibilityPredictor::stop();
+}
+
+
+void VisibilityPredictor::start()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_ or pvt_ == nullptr)
+        {
+            return;
+        }
+    running_ = true;
+    thread_ = std::thread(&VisibilityPredictor::refresh_thread, this);
+}
+
+
+void VisibilityPredictor::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable())
+        {
+            thread_.join();
+        }
+}
+
+
+void VisibilityPredictor::set_reference(time_t rx_utc_time, const std::array<float, 3>& LLH)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ref_utc_time_ = rx_utc_time;
+        ref_LLH_ = LLH;
+        ref_anchor_ = std::chrono::steady_clock::now();
+        ref_valid_ = true;
+    }
+    cv_.notify_all();  // do not wait for the next period to use the new reference
+}
+
+
+void VisibilityPredictor::refresh_thread()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_)
+        {
+            lock.unlock();
+            refresh();
+            lock.lock();
+            cv_.wait_for(lock, std::chrono::duration<double>(refresh_period_s_));
+        }
+}
+
+
+bool VisibilityPredictor::get_rx_time_and_position(gtime_t& rx_gps_time, std::array<double, 3>& rx_pos_ecef)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::array<double, 3> pos{};  // latitude [rad], longitude [rad], height [m]
+    gtime_t utc_gtime{};
+
+    double longitude_deg = 0.0;
+    double latitude_deg = 0.0;
+    double height_m = 0.0;
+    double ground_speed_kmh = 0.0;
+    double course_over_ground_deg = 0.0;
+    time_t pvt_utc_time = 0;
+    if (pvt_->get_latest_PVT(&longitude_deg, &latitude_deg, &height_m, &ground_speed_kmh, &course_over_ground_deg, &pvt_utc_time) and pvt_utc_time > 0)
+        {
+            // the PVT time only advances with new fixes: propagate it with the local clock
+            if (pvt_utc_time != last_pvt_utc_time_)
+                {
+                    last_pvt_utc_time_ = pvt_utc_time;
+                    pvt_anchor_ = now;
+                }
+            utc_gtime.time = pvt_utc_time;
+            utc_gtime = timeadd(utc_gtime, std::chrono::duration<double>(now - pvt_anchor_).count());
+            pos = {latitude_deg * D2R, longitude_deg * D2R, height_m};
+        }
+    else
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!ref_valid_)
+                {
+                    return false;
+                }
+            utc_gtime.time = ref_utc_time_;
+            utc_gtime = timeadd(utc_gtime, std::chrono::duration<double>(now - ref_anchor_).count());
+            pos = {ref_LLH_[0] * D2R, ref_LLH_[1] * D2R, ref_LLH_[2]};
+        }
+
+    rx_gps_time = utc2gpst(utc_gtime);
+    pos2ecef(pos.data(), rx_pos_ecef.data());
+    return true;
+}
+
+
+bool VisibilityPredictor::predict(const std::array<double, 3>& r_sat_prev,
+    const std::array<double, 3>& r_sat,
+    const std::array<double, 3>& r_sat_next,
+    const std::array<double, 3>& rx_pos_ecef,
+    Visibility_Prediction& prediction) const
+{
+    std::array<double, 3> e{};
+    std::array<double, 3> pos{};
+    std::array<double, 2> azel{};
+    const double range_prev = geodist(r_sat_prev.data(), rx_pos_ecef.data(), e.data());
+    const double range_next = geodist(r_sat_next.data(), rx_pos_ecef.data(), e.data());
+    const double range = geodist(r_sat.data(), rx_pos_ecef.data(), e.data());
+    if (range < 0.0 or range_prev < 0.0 or range_next < 0.0)
+        {
+            return false;
+        }
+    ecef2pos(rx_pos_ecef.data(), pos.data());
+    satazel(pos.data(), e.data(), azel.data());
+
+    // satellite positions are computed 1 s apart
+    const double range_rate_m_s = (range_next - range_prev) / 2.0;
+    const double range_accel_m_s2 = range_next - 2.0 * range + range_prev;
+    prediction.azimuth_deg = azel[0] * R2D;
+    prediction.elevation_deg = azel[1] * R2D;
+    prediction.doppler_hz = -range_rate_m_s * FREQ1 / SPEED_OF_LIGHT_M_S;
+    prediction.doppler_rate_hz_s = -range_accel_m_s2 * FREQ1 / SPEED_OF_LIGHT_M_S;
+    return true;
+}
+
+
+void VisibilityPredictor::refresh()
+{
+    gtime_t rx_gps_time{};
+    std::array<double, 3> rx_pos_ecef{};
+    if (!get_rx_time_and_position(rx_gps_time, rx_pos_ecef))
+        {
+            return;
+        }
+    const gtime_t rx_gps_time_prev = timeadd(rx_gps_time, -1.0);
+    const gtime_t rx_gps_time_next = timeadd(rx_gps_time, 1.0);
+    const auto epoch = std::chrono::steady_clock::now();
+
+    std::map<std::pair<char, uint32_t>, Visibility_Prediction> visible;
+    std::map<std::pair<char, uint32_t>, Visibility_Prediction> hidden;
+    auto classify = [&](char system, uint32_t prn, const std::array<double, 3>& r_sat_prev, const std::array<double, 3>& r_sat, const std::array<double, 3>& r_sat_next) {
+        Visibility_Prediction prediction;
+        prediction.epoch = epoch;
+        if (predict(r_sat_prev, r_sat, r_sat_next, rx_pos_ecef, prediction))
+            {
+                if (prediction.elevation_deg > elevation_mask_deg_)
+                    {
+                        visible[std::make_pair(system, prn)] = prediction;
+                    }
+                else
+                    {
+                        hidden[std::make_pair(system, prn)] = prediction;
+                    }
+            }
+    };
+
+    auto propagate_eph = [&](char system, uint32_t prn, const eph_t& eph) {
+        std::array<double, 3> r_sat_prev{};
+        std::array<double, 3> r_sat{};
+        std::array<double, 3> r_sat_next{};
+        double clock_bias_s;
+        double sat_pos_variance_m2;
+        eph2pos(rx_gps_time_prev, &eph, r_sat_prev.data(), &clock_bias_s, &sat_pos_variance_m2);
+        eph2pos(rx_gps_time, &eph, r_sat.data(), &clock_bias_s, &sat_pos_variance_m2);
+        eph2pos(rx_gps_time_next, &eph, r_sat_next.data(), &clock_bias_s, &sat_pos_variance_m2);
+        classify(system, prn, r_sat_prev, r_sat, r_sat_next);
+    };
+
+    // almanac reference times are expressed as time of week
+    int week = 0;
+    gtime_t rx_tow{};
+    rx_tow.time = static_cast<time_t>(std::floor(time2gpst(rx_gps_time, &week)));
+    auto propagate_alm = [&](char system, uint32_t prn, const alm_t& alm) {
+        std::array<double, 3> r_sat_prev{};
+        std::array<double, 3> r_sat{};
+        std::array<double, 3> r_sat_next{};
+        double clock_bias_s;
+        alm2pos(timeadd(rx_tow, -1.0), &alm, r_sat_prev.data(), &clock_bias_s);
+        alm2pos(rx_tow, &alm, r_sat.data(), &clock_bias_s);
+        alm2pos(timeadd(rx_tow, 1.0), &alm, r_sat_next.data(), &clock_bias_s);
+        classify(system, prn, r_sat_prev, r_sat, r_sat_next);
+    };
+
+    // only the ephemeris records that changed since the last refresh are converted
+    const std::map<int, Gps_Ephemeris> gps_eph_map = pvt_->get_gps_ephemeris();
+    for (const auto& it : gps_eph_map)
+        {
+            auto cached = gps_eph_cache_.find(it.second.i_satellite_PRN);
+            if (cached == gps_eph_cache_.end() or cached->second.toe != it.second.d_Toe or cached->second.iod != it.second.d_IODC)
+                {
+                    gps_eph_cache_[it.second.i_satellite_PRN] = Cached_Eph{it.second.d_Toe, it.second.d_IODC, eph_to_rtklib(it.second, pre_2009_file_)};
+                    cached = gps_eph_cache_.find(it.second.i_satellite_PRN);
+                }
+            propagate_eph('G', it.second.i_satellite_PRN, cached->second.eph);
+        }
+
+    const std::map<int, Galileo_Ephemeris> gal_eph_map = pvt_->get_galileo_ephemeris();
+    for (const auto& it : gal_eph_map)
+        {
+            auto cached = gal_eph_cache_.find(it.second.i_satellite_PRN);
+            if (cached == gal_eph_cache_.end() or cached->second.toe != it.second.t0e_1 or cached->second.iod != it.second.IOD_ephemeris)
+                {
+                    gal_eph_cache_[it.second.i_satellite_PRN] = Cached_Eph{it.second.t0e_1, it.second.IOD_ephemeris, eph_to_rtklib(it.second)};
+                    cached = gal_eph_cache_.find(it.second.i_satellite_PRN);
+                }
+            propagate_eph('E', it.second.i_satellite_PRN, cached->second.eph);
+        }
+
+    // the almanac is only used for satellites without ephemeris
+    const std::map<int, Gps_Almanac> gps_alm_map = pvt_->get_gps_almanac();
+    for (const auto& it : gps_alm_map)
+        {
+            if (gps_eph_map.find(static_cast<int>(it.second.i_satellite_PRN)) == gps_eph_map.end())
+                {
+                    propagate_alm('G', it.second.i_satellite_PRN, alm_to_rtklib(it.second));
+                }
+        }
+
+    const std::map<int, Galileo_Almanac> gal_alm_map = pvt_->get_galileo_almanac();
+    for (const auto& it : gal_alm_map)
+        {
+            if (gal_eph_map.find(static_cast<int>(it.second.i_satellite_PRN)) == gal_eph_map.end())
+                {
+                    propagate_alm('E', it.second.i_satellite_PRN, alm_to_rtklib(it.second));
+                }
+        }
+
+    if (visible.empty() and hidden.empty())
+        {
+            return;
+        }
+
+    DLOG(INFO) << "Visibility prediction: " << visible.size() << " satellites above "
+               << elevation_mask_deg_ << " deg, " << hidden.size() << " below";
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        visible_ = std::move(visible);
+        hidden_ = std::move(hidden);
+    }
+    generation_++;
+}
+
+
+std::vector<std::pair<int, Gnss_Satellite>> VisibilityPredictor::get_visible_sats() const
+{
+    std::vector<std::pair<int, Gnss_Satellite>> visible_sats;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        visible_sats.reserve(visible_.size());
+        for (const auto& it : visible_)
+            {
+                const std::string system = it.first.first == 'G' ? std::string("GPS") : std::string("Galileo");
+                visible_sats.emplace_back(static_cast<int>(std::floor(it.second.elevation_deg)), Gnss_Satellite(system, it.first.second));
+            }
+    }
+    std::sort(visible_sats.begin(), visible_sats.end(), [](const std::pair<int, Gnss_Satellite>& a, const std::pair<int, Gnss_Satellite>& b) {
+        return a.first > b.first;
+    });
+    return visible_sats;
+}
+
+
+std::vector<Gnss_Satellite> VisibilityPredictor::get_hidden_sats() const
+{
+    std::vector<Gnss_Satellite> hidden_sats;
+    std::lock_guard<std::mutex> lock(mutex_);
+    hidden_sats.reserve(hidden_.size());
+    for (const auto& it : hidden_)
+        {
+            const std::string system = it.first.first == 'G' ? std::string("GPS") : std::string("Galileo");
+            hidden_sats.emplace_back(system, it.first.second);
+        }
+    return hidden_sats;
+}
+
+
+bool VisibilityPredictor::get_doppler(const Gnss_Satellite& sat, double& doppler_hz, double& doppler_rate_hz_s) const
+{
+    const std::string system = sat.get_system_short();
+    if (system != "G" and system != "E")
+        {
+            return false;
+        }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = visible_.find(std::make_pair(system[0], sat.get_PRN()));
+    if (it == visible_.end())
+        {
+            return false;
+        }
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - it->second.epoch).count();
+    if (elapsed_s > 4.0 * refresh_period_s_)
+        {
+            return false;  // the refresh thread is not keeping up, do not trust the table
+        }
+    doppler_rate_hz_s = it->second.doppler_rate_hz_s;
+    doppler_hz = it->second.doppler_hz + doppler_rate_hz_s * elapsed_s;
+    return true;
+}
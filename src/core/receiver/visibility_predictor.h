@@ -0,0 +1,161 @@
+/*!
+ * \file visibility_predictor.h
+ * \brief Background service that predicts satellite visibility and Doppler
+ * for acquisition scheduling
+ * \author agent, 2026. agent(at)local
+ *
+ * The table of visible satellites, with their elevation, expected Doppler
+ * and Doppler rate, is propagated from the ephemeris and almanac data
+ * available at the PVT block and refreshed periodically in its own thread,
+ * so the acquisition manager can query it without computing orbits.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_VISIBILITY_PREDICTOR_H
+#define GNSS_SDR_VISIBILITY_PREDICTOR_H
+
+#include "gnss_satellite.h"
+#include "rtklib.h"
+#include <array>               // for array
+#include <atomic>              // for atomic
+#include <chrono>              // for steady_clock
+#include <condition_variable>  // for condition_variable
+#include <cstdint>             // for uint32_t, uint64_t
+#include <ctime>               // for time_t
+#include <map>                 // for map
+#include <memory>              // for shared_ptr
+#include <mutex>               // for mutex
+#include <thread>              // for thread
+#include <utility>             // for pair
+#include <vector>              // for vector
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+class PvtInterface;
+
+/*!
+ * \brief Predicted geometry of a satellite, as seen from the receiver
+ */
+struct Visibility_Prediction
+{
+    std::chrono::steady_clock::time_point epoch;  //!< Local time at which the prediction was computed
+    double elevation_deg{};                       //!< Elevation [deg]
+    double azimuth_deg{};                         //!< Azimuth [deg]
+    double doppler_hz{};                          //!< Expected Doppler at the L1 / E1 carrier [Hz]
+    double doppler_rate_hz_s{};                   //!< Expected Doppler rate at the L1 / E1 carrier [Hz/s]
+};
+
+
+/*!
+ * \brief This class keeps a table of the satellites above the elevation mask,
+ * with their expected Doppler and Doppler rate, propagated from the GPS and
+ * Galileo ephemeris (or almanac, if there is no ephemeris) stored at the PVT block.
+ *
+ * The receiver position and time are taken from the latest PVT fix or,
+ * if there is none yet, from the reference set with set_reference().
+ * Only the ephemeris records that changed since the previous refresh are
+ * converted again, and between refreshes the Doppler returned by
+ * get_doppler() is propagated with the predicted Doppler rate.
+ */
+class VisibilityPredictor
+{
+public:
+    VisibilityPredictor(std::shared_ptr<PvtInterface> pvt,
+        double elevation_mask_deg,
+        double refresh_period_s,
+        bool pre_2009_file = false);
+
+    ~VisibilityPredictor();
+
+    void start();  //!< Starts the refresh thread
+    void stop();   //!< Stops the refresh thread
+
+    /*!
+     * \brief Sets an approximate receiver time and position (latitude [deg],
+     * longitude [deg], height [m]), used until a PVT fix is available
+     */
+    void set_reference(time_t rx_utc_time, const std::array<float, 3>& LLH);
+
+    /*!
+     * \brief Increases every time the visibility table is recomputed
+     */
+    inline uint64_t generation() const { return generation_.load(); }
+
+    /*!
+     * \brief Satellites above the elevation mask, sorted in descending
+     * order of elevation [deg]
+     */
+    std::vector<std::pair<int, Gnss_Satellite>> get_visible_sats() const;
+
+    /*!
+     * \brief Satellites with a valid prediction below the elevation mask
+     */
+    std::vector<Gnss_Satellite> get_hidden_sats() const;
+
+    /*!
+     * \brief Expected Doppler [Hz] and Doppler rate [Hz/s] of a visible
+     * satellite at the L1 / E1 carrier, propagated to the current time.
+     * Returns false if there is no recent prediction for that satellite.
+     */
+    bool get_doppler(const Gnss_Satellite& sat, double& doppler_hz, double& doppler_rate_hz_s) const;
+
+private:
+    struct Cached_Eph
+    {
+        int32_t toe;
+        int32_t iod;
+        eph_t eph;
+    };
+
+    void refresh_thread();
+    void refresh();
+    bool get_rx_time_and_position(gtime_t& rx_gps_time, std::array<double, 3>& rx_pos_ecef);
+    bool predict(const std::array<double, 3>& r_sat_prev,
+        const std::array<double, 3>& r_sat,
+        const std::array<double, 3>& r_sat_next,
+        const std::array<double, 3>& rx_pos_ecef,
+        Visibility_Prediction& prediction) const;
+
+    std::shared_ptr<PvtInterface> pvt_;
+
+    std::map<uint32_t, Cached_Eph> gps_eph_cache_;
+    std::map<uint32_t, Cached_Eph> gal_eph_cache_;
+
+    std::map<std::pair<char, uint32_t>, Visibility_Prediction> visible_;
+    std::map<std::pair<char, uint32_t>, Visibility_Prediction> hidden_;
+
+    std::chrono::steady_clock::time_point pvt_anchor_;
+    std::chrono::steady_clock::time_point ref_anchor_;
+    std::array<float, 3> ref_LLH_{};
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    std::atomic<uint64_t> generation_{0};
+
+    time_t last_pvt_utc_time_{0};
+    time_t ref_utc_time_{0};
+    double elevation_mask_deg_;
+    double refresh_period_s_;
+    bool pre_2009_file_;
+    bool ref_valid_{false};
+    bool running_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_VISIBILITY_PREDICTOR_H
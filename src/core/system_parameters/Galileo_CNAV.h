@@ -70,6 +70,11 @@ constexpr int32_t GALILEO_CNAV_PAGE_HEADER_BITS = 24;
 constexpr int32_t GALILEO_CNAV_PREAMBLE_LENGTH_BITS = 16;
 constexpr int32_t GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS = 255;
 constexpr int32_t GALILEO_CNAV_MT1_HEADER_BITS = 32;
+constexpr int32_t GALILEO_CNAV_OCTETS_IN_SUBPAGE = 53;
+constexpr int32_t GALILEO_CNAV_INFORMATION_VECTOR_LENGTH = 32;
+constexpr uint32_t GALILEO_CNAV_RS_GF_POLY = 0x11D;  // x^8 + x^4 + x^3 + x^2 + 1
+constexpr uint32_t GALILEO_CNAV_RS_FCR = 1;
+constexpr uint32_t GALILEO_CNAV_RS_PRIM = 1;
 
 constexpr int32_t HAS_MSG_MAX_SATS = 40;
 constexpr int32_t HAS_MSG_MAX_SIGNALS = 16;
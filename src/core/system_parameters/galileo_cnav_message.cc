@@ -19,13 +19,30 @@
 #include "galileo_cnav_message.h"
 #include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
 #include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
-#include <algorithm>                 // for reverse, find
-#include <numeric>                   // for accumulate
+#include <algorithm>                 // for count, reverse
+#include <array>                     // for array
+#include <stdexcept>                 // for out_of_range
+#include <utility>                   // for move
 
 
 using CRC_Galileo_CNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
 
 
+namespace
+{
+// The code tables are shared by all the channels
+const Reed_Solomon& get_HAS_code()
+{
+    static const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS,
+        GALILEO_CNAV_INFORMATION_VECTOR_LENGTH,
+        GALILEO_CNAV_RS_GF_POLY,
+        GALILEO_CNAV_RS_FCR,
+        GALILEO_CNAV_RS_PRIM);
+    return code;
+}
+}  // namespace
+
+
 bool Galileo_Cnav_Message::CRC_test(std::bitset<GALILEO_CNAV_BITS_FOR_CRC> bits, uint32_t checksum) const
 {
     CRC_Galileo_CNAV_type CRC_Galileo;
@@ -40,7 +57,8 @@ bool Galileo_Cnav_Message::CRC_test(std::bitset<GALILEO_CNAV_BITS_FOR_CRC> bits,
     boost::to_block_range(frame_bits, std::back_inserter(bytes));
     std::reverse(bytes.begin(), bytes.end());
 
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_CNAV_BYTES_FOR_CRC);
+    // 462 bits fill 58 bytes. Leading zeros do not change the CRC-24Q
+    CRC_Galileo.process_bytes(bytes.data(), bytes.size());
 
     const uint32_t crc_computed = CRC_Galileo.checksum();
     if (checksum == crc_computed)
@@ -53,6 +71,7 @@ bool Galileo_Cnav_Message::CRC_test(std::bitset<GALILEO_CNAV_BITS_FOR_CRC> bits,
 
 void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
 {
+    d_new_message = false;
     const std::string has_page_bits = page_string.substr(0, GALILEO_CNAV_BITS_FOR_CRC);
     const std::string CRC_data = page_string.substr(GALILEO_CNAV_BITS_FOR_CRC, GALILEO_CNAV_CRC_LENGTH);
     const std::bitset<GALILEO_CNAV_BITS_FOR_CRC> Word_for_CRC_bits(has_page_bits);
@@ -62,6 +81,11 @@ void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
             d_flag_CRC_test = true;
             // CRC correct: Read HAS page header
             read_HAS_page_header(page_string.substr(GALILEO_CNAV_PAGE_RESERVED_BITS, GALILEO_CNAV_PAGE_HEADER_BITS));
+            if (d_page_dummy)
+                {
+                    // No header fields in a dummy page, they still hold the previous page's ones
+                    return;
+                }
             bool use_has = false;
             d_test_mode = false;
             switch (d_has_page_status)
@@ -113,64 +137,99 @@ void Galileo_Cnav_Message::read_HAS_page_header(const std::string& page_string)
 
 void Galileo_Cnav_Message::process_HAS_page(const std::string& page_string)
 {
-    if (d_current_message_id == d_received_message_id)
+    d_has_page_counter++;
+    // Only messages of type 1 (satellite corrections) are decoded.
+    // Page IDs start at 1, and each one is a row of the generator matrix
+    if (d_received_message_type != 1 || d_received_message_page_id == 0 || d_received_message_size == 0)
+        {
+            return;
+        }
+
+    auto it = d_pending_messages.find(d_received_message_id);
+    if (it != d_pending_messages.end())
         {
-            // if receiver pid was not there, store it.
-            if (std::find(d_list_pid.begin(), d_list_pid.end(), d_received_message_page_id) == d_list_pid.end())
+            // Message IDs are reused, so an old incomplete message is dropped if
+            // its size changed or if it would need more pages than the code length
+            if (it->second.message_size != d_received_message_size ||
+                d_has_page_counter - it->second.first_page >= GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS)
                 {
-                    if (d_received_message_type == 1)  // contains satellite corrections
-                        {
-                            d_received_encoded_messages++;
-                            d_list_pid.push_back(d_received_message_page_id);
-                            // Store encoded page
-                            d_encoded_message_type_1 += std::string(page_string);
-                        }
+                    d_pending_messages.erase(it);
+                    it = d_pending_messages.end();
                 }
         }
-    else
+    if (it == d_pending_messages.end())
+        {
+            it = d_pending_messages.emplace(d_received_message_id, Pending_HAS_Message(get_HAS_code(), d_received_message_size, d_has_page_counter)).first;
+        }
+
+    // Pages are added as they arrive, so the message is ready right after
+    // the last independent page, without a decoding step over all of them
+    std::array<uint8_t, GALILEO_CNAV_OCTETS_IN_SUBPAGE> page_octets{};
+    for (int32_t i = 0; i < GALILEO_CNAV_MESSAGE_BITS_PER_PAGE; i++)
         {
-            // Start new message
-            d_current_message_id = d_received_message_id;
-            d_received_encoded_messages = 0;
-            d_new_message = false;
-            d_current_message_size = d_received_message_size;
-            // erase stored pages and start storing again
-            d_encoded_message_type_1.clear();
-            d_list_pid.clear();
-            if (d_received_message_type == 1)
+            if (page_string[i] == '1')
                 {
-                    d_encoded_message_type_1.reserve(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS * GALILEO_CNAV_MESSAGE_BITS_PER_PAGE);
-                    d_received_encoded_messages++;
-                    d_list_pid.push_back(d_received_message_page_id);
-                    d_encoded_message_type_1 += std::string(page_string);
+                    page_octets[i / 8] |= static_cast<uint8_t>(0x80U >> static_cast<uint32_t>(i % 8));
                 }
         }
-
-    if (d_received_encoded_messages == d_current_message_size)
+    if (it->second.decoder.add_row(d_received_message_page_id - 1, page_octets.data()))
         {
-            // we have a full encoded message stored in d_encoded_message_type_1
-            d_received_encoded_messages = 0;
-            d_current_message_id = 0;
-            d_new_message = true;
-            decode_message_type1();
+            decode_message_type1(it->second.decoder);
+            d_pending_messages.erase(it);
         }
 }
 
 
-void Galileo_Cnav_Message::decode_message_type1()
+void Galileo_Cnav_Message::decode_message_type1(const Reed_Solomon_Erasure_Decoder& decoder)
 {
-    // TODO: Reed-Solomon decoding of d_encoded_message_type_1
-    // TODO: reordering
-    // decoded_message_type1 = ...
-    // read_HAS_message_type1(decoded_message_type1);
+    d_decoded_message_type_1 = decoder.get_message();
+
+    // The MT1 parser reads the fields from a string of '0' and '1'
+    std::string message_bits;
+    message_bits.reserve(d_decoded_message_type_1.size() * 8);
+    for (const uint8_t octet : d_decoded_message_type_1)
+        {
+            for (int32_t b = 7; b >= 0; b--)
+                {
+                    message_bits.push_back(((octet >> static_cast<uint32_t>(b)) & 1U) ? '1' : '0');
+                }
+        }
+    d_new_message = read_HAS_message_type1(message_bits);
 }
 
 
-void Galileo_Cnav_Message::read_HAS_message_type1(const std::string& message_string)
+bool Galileo_Cnav_Message::read_HAS_message_type1(const std::string& message_string)
 {
+    Galileo_HAS_data previous_data = d_HAS_data;
     d_HAS_data = Galileo_HAS_data();
-    read_MT1_header(message_string);
-    read_MT1_body(message_string);
+    try
+        {
+            read_MT1_header(message_string);
+            if (!d_HAS_data.header.mask_flag)
+                {
+                    // The mask was sent in a previous message with the same mask ID
+                    if (previous_data.gnss_id_mask.empty() || previous_data.header.mask_id != d_HAS_data.header.mask_id)
+                        {
+                            d_HAS_data = std::move(previous_data);
+                            return false;
+                        }
+                    d_HAS_data.Nsys = previous_data.Nsys;
+                    d_HAS_data.gnss_id_mask = previous_data.gnss_id_mask;
+                    d_HAS_data.satellite_mask = previous_data.satellite_mask;
+                    d_HAS_data.signal_mask = previous_data.signal_mask;
+                    d_HAS_data.cell_mask_availability_flag = previous_data.cell_mask_availability_flag;
+                    d_HAS_data.cell_mask = previous_data.cell_mask;
+                    d_HAS_data.nav_message = previous_data.nav_message;
+                }
+            read_MT1_body(message_string);
+        }
+    catch (const std::out_of_range&)
+        {
+            // The fields announced in the message do not fit in it
+            d_HAS_data = std::move(previous_data);
+            return false;
+        }
+    return true;
 }
 
 
@@ -192,281 +251,215 @@ void Galileo_Cnav_Message::read_MT1_header(const std::string& message_string)
 
 void Galileo_Cnav_Message::read_MT1_body(const std::string& message_string)
 {
-    auto message = std::string(message_string.begin() + GALILEO_CNAV_MT1_HEADER_BITS, message_string.end());  // Remove header
-    int Nsat = 0;
+    // Each field is removed from the front of the message once read, and
+    // substr() throws std::out_of_range if it does not fit in what is left
+    auto message = message_string.substr(GALILEO_CNAV_MT1_HEADER_BITS);  // Remove header
+    std::vector<uint8_t> gnss_id_of_sat;                                  // system of each satellite in the mask
+    std::vector<int> signals_of_sat;                                      // signals with corrections of each satellite
     if (d_HAS_data.header.mask_flag)
         {
             // read mask
             d_HAS_data.Nsys = read_has_message_body_uint8(message.substr(0, HAS_MSG_NSYS_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_NSYS_LENGTH, message.end());
-            d_HAS_data.gnss_id_mask.reserve(d_HAS_data.Nsys);
-            d_HAS_data.cell_mask.reserve(d_HAS_data.Nsys);
-            d_HAS_data.cell_mask_availability_flag.reserve(d_HAS_data.Nsys);
-            d_HAS_data.nav_message.reserve(d_HAS_data.Nsys);
+            message = message.substr(HAS_MSG_NSYS_LENGTH);
+            d_HAS_data.gnss_id_mask.resize(d_HAS_data.Nsys);
+            d_HAS_data.satellite_mask.resize(d_HAS_data.Nsys);
+            d_HAS_data.signal_mask.resize(d_HAS_data.Nsys);
+            d_HAS_data.cell_mask_availability_flag.resize(d_HAS_data.Nsys);
+            d_HAS_data.cell_mask.resize(d_HAS_data.Nsys);
+            d_HAS_data.nav_message.resize(d_HAS_data.Nsys);
             for (uint8_t i = 0; i < d_HAS_data.Nsys; i++)
                 {
                     d_HAS_data.gnss_id_mask[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_ID_MASK_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_ID_MASK_LENGTH, message.end());
-                    std::string msg = message.substr(0, HAS_MSG_SATELLITE_MASK_LENGTH);
-                    d_HAS_data.satellite_mask[i] = read_has_message_body_uint64(msg);
-                    int ones_in_satellite_mask = 0;
-                    for (char c : msg)
-                        {
-                            if (c == '1')
-                                {
-                                    ones_in_satellite_mask++;
-                                }
-                        }
-                    Nsat += ones_in_satellite_mask;
-                    message = std::string(message.begin() + HAS_MSG_SATELLITE_MASK_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_ID_MASK_LENGTH);
 
-                    msg = message.substr(0, HAS_MSG_SIGNAL_MASK_LENGTH);
-                    d_HAS_data.signal_mask[i] = read_has_message_body_uint16(msg);
-                    int ones_in_signal_mask = 0;
-                    for (char c : msg)
-                        {
-                            if (c == '1')
-                                {
-                                    ones_in_signal_mask++;
-                                }
-                        }
-                    message = std::string(message.begin() + HAS_MSG_SIGNAL_MASK_LENGTH, message.end());
+                    d_HAS_data.satellite_mask[i] = read_has_message_body_uint64(message.substr(0, HAS_MSG_SATELLITE_MASK_LENGTH));
+                    const int ones_in_satellite_mask = count_ones(d_HAS_data.satellite_mask[i]);
+                    message = message.substr(HAS_MSG_SATELLITE_MASK_LENGTH);
 
-                    if (message.substr(0, 1) == "1")
-                        {
-                            d_HAS_data.cell_mask_availability_flag[i] = true;
-                        }
-                    else
-                        {
-                            d_HAS_data.cell_mask_availability_flag[i] = false;
-                        }
-                    message = std::string(message.begin() + 1, message.end());
-                    int size_cell = ones_in_satellite_mask * ones_in_signal_mask;
+                    d_HAS_data.signal_mask[i] = read_has_message_body_uint16(message.substr(0, HAS_MSG_SIGNAL_MASK_LENGTH));
+                    const int ones_in_signal_mask = count_ones(d_HAS_data.signal_mask[i]);
+                    message = message.substr(HAS_MSG_SIGNAL_MASK_LENGTH);
 
+                    d_HAS_data.cell_mask_availability_flag[i] = (message.at(0) == '1');
+                    message = message.substr(1);
 
-                    d_HAS_data.cell_mask[i].reserve(ones_in_satellite_mask);
+                    // The cell mask tells which signals of each satellite have corrections
+                    d_HAS_data.cell_mask[i].assign(ones_in_satellite_mask, std::vector<bool>(ones_in_signal_mask, true));
                     for (int s = 0; s < ones_in_satellite_mask; s++)
                         {
-                            d_HAS_data.cell_mask[i][s].reserve(ones_in_signal_mask);
-                            for (int sig = 0; sig < ones_in_signal_mask; sig++)
+                            int signals = ones_in_signal_mask;
+                            if (d_HAS_data.cell_mask_availability_flag[i])
                                 {
-                                    d_HAS_data.cell_mask[i][s][sig] = (message[sig] == '1' ? true : false);
+                                    signals = 0;
+                                    for (int sig = 0; sig < ones_in_signal_mask; sig++)
+                                        {
+                                            d_HAS_data.cell_mask[i][s][sig] = (message.at(s * ones_in_signal_mask + sig) == '1');
+                                            signals += d_HAS_data.cell_mask[i][s][sig] ? 1 : 0;
+                                        }
                                 }
+                            gnss_id_of_sat.push_back(d_HAS_data.gnss_id_mask[i]);
+                            signals_of_sat.push_back(signals);
+                        }
+                    if (d_HAS_data.cell_mask_availability_flag[i])
+                        {
+                            message = message.substr(ones_in_satellite_mask * ones_in_signal_mask);
                         }
-                    message = std::string(message.begin() + size_cell, message.end());
 
                     d_HAS_data.nav_message[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_NAV_MESSAGE_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_NAV_MESSAGE_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_NAV_MESSAGE_LENGTH);
                 }
         }
+    else
+        {
+            // mask of a previous message
+            for (uint8_t i = 0; i < d_HAS_data.Nsys; i++)
+                {
+                    const int ones_in_signal_mask = count_ones(d_HAS_data.signal_mask[i]);
+                    for (int s = 0; s < count_ones(d_HAS_data.satellite_mask[i]); s++)
+                        {
+                            const std::vector<bool>& cells = d_HAS_data.cell_mask[i][s];
+                            gnss_id_of_sat.push_back(d_HAS_data.gnss_id_mask[i]);
+                            signals_of_sat.push_back(d_HAS_data.cell_mask_availability_flag[i] ? static_cast<int>(std::count(cells.begin(), cells.end(), true)) : ones_in_signal_mask);
+                        }
+                }
+        }
+    const int Nsat = static_cast<int>(gnss_id_of_sat.size());
     if (d_HAS_data.header.orbit_correction_flag)
         {
             // read orbit corrections
             d_HAS_data.validity_interval_index_orbit_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
-            d_HAS_data.gnss_iod.reserve(Nsat);
-            d_HAS_data.delta_radial.reserve(Nsat);
-            d_HAS_data.delta_along_track.reserve(Nsat);
-            d_HAS_data.delta_cross_track.reserve(Nsat);
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
+            d_HAS_data.gnss_iod.resize(Nsat);
+            d_HAS_data.delta_radial.resize(Nsat);
+            d_HAS_data.delta_along_track.resize(Nsat);
+            d_HAS_data.delta_cross_track.resize(Nsat);
             for (int i = 0; i < Nsat; i++)
                 {
-                    if (d_HAS_data.gnss_id_mask[i] == HAS_MSG_GPS_SYSTEM)
+                    if (gnss_id_of_sat[i] == HAS_MSG_GPS_SYSTEM)
                         {
                             d_HAS_data.gnss_iod[i] = read_has_message_body_uint16(message.substr(0, HAS_MSG_IOD_GPS_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_IOD_GPS_LENGTH, message.end());
+                            message = message.substr(HAS_MSG_IOD_GPS_LENGTH);
                         }
-                    if (d_HAS_data.gnss_id_mask[i] == HAS_MSG_GALILEO_SYSTEM)
+                    if (gnss_id_of_sat[i] == HAS_MSG_GALILEO_SYSTEM)
                         {
                             d_HAS_data.gnss_iod[i] = read_has_message_body_uint16(message.substr(0, HAS_MSG_IOD_GAL_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_IOD_GAL_LENGTH, message.end());
+                            message = message.substr(HAS_MSG_IOD_GAL_LENGTH);
                         }
                     d_HAS_data.delta_radial[i] = read_has_message_body_int16(message.substr(0, HAS_MSG_DELTA_RADIAL_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_DELTA_RADIAL_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_DELTA_RADIAL_LENGTH);
 
                     d_HAS_data.delta_along_track[i] = read_has_message_body_int16(message.substr(0, HAS_MSG_DELTA_ALONG_TRACK_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_DELTA_ALONG_TRACK_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_DELTA_ALONG_TRACK_LENGTH);
 
                     d_HAS_data.delta_cross_track[i] = read_has_message_body_int16(message.substr(0, HAS_MSG_DELTA_CROSS_TRACK_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_DELTA_CROSS_TRACK_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_DELTA_CROSS_TRACK_LENGTH);
                 }
         }
     if (d_HAS_data.header.clock_fullset_flag)
         {
             // read clock full-set corrections
             d_HAS_data.validity_interval_index_clock_fullset_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
 
-            d_HAS_data.delta_clock_c0_multiplier.reserve(d_HAS_data.Nsys);
+            d_HAS_data.delta_clock_c0_multiplier.resize(d_HAS_data.Nsys);
             for (uint8_t i = 0; i < d_HAS_data.Nsys; i++)
                 {
                     if (d_HAS_data.gnss_id_mask[i] != HAS_MSG_GALILEO_SYSTEM)
                         {
                             d_HAS_data.delta_clock_c0_multiplier[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_DELTA_CLOCK_C0_MULTIPLIER_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_DELTA_CLOCK_C0_MULTIPLIER_LENGTH, message.end());
+                            message = message.substr(HAS_MSG_DELTA_CLOCK_C0_MULTIPLIER_LENGTH);
                         }
                 }
-            d_HAS_data.iod_change_flag.reserve(Nsat);
-            d_HAS_data.delta_clock_c0.reserve(Nsat);
+            d_HAS_data.iod_change_flag.resize(Nsat);
+            d_HAS_data.delta_clock_c0.resize(Nsat);
             for (int i = 0; i < Nsat; i++)
                 {
-                    d_HAS_data.iod_change_flag[i] = (message[0] == '1' ? true : false);
-                    message = std::string(message.begin() + 1, message.end());
+                    d_HAS_data.iod_change_flag[i] = (message.at(0) == '1');
+                    message = message.substr(1);
                     d_HAS_data.delta_clock_c0[i] = read_has_message_body_int16(message.substr(0, HAS_MSG_DELTA_CLOCK_C0_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_DELTA_CLOCK_C0_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_DELTA_CLOCK_C0_LENGTH);
                 }
         }
     if (d_HAS_data.header.clock_subset_flag)
         {
             // read clock subset corrections
             d_HAS_data.validity_interval_index_clock_subset_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
 
             d_HAS_data.Nsysprime = read_has_message_body_uint8(message.substr(0, HAS_MSG_NSYSPRIME_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_NSYSPRIME_LENGTH, message.end());
+            message = message.substr(HAS_MSG_NSYSPRIME_LENGTH);
 
-            d_HAS_data.gnss_id_clock_subset.reserve(d_HAS_data.Nsysprime);
-            d_HAS_data.delta_clock_c0_multiplier_clock_subset.reserve(d_HAS_data.Nsysprime);
-            d_HAS_data.satellite_submask.reserve(d_HAS_data.Nsysprime);
-            d_HAS_data.iod_change_flag_clock_subset.reserve(d_HAS_data.Nsysprime);
-            d_HAS_data.delta_clock_c0_clock_subset.reserve(d_HAS_data.Nsysprime);
+            d_HAS_data.gnss_id_clock_subset.resize(d_HAS_data.Nsysprime);
+            d_HAS_data.delta_clock_c0_multiplier_clock_subset.resize(d_HAS_data.Nsysprime);
+            d_HAS_data.satellite_submask.resize(d_HAS_data.Nsysprime);
+            d_HAS_data.iod_change_flag_clock_subset.resize(d_HAS_data.Nsysprime);
+            d_HAS_data.delta_clock_c0_clock_subset.resize(d_HAS_data.Nsysprime);
             for (uint8_t i = 0; i < d_HAS_data.Nsysprime; i++)
                 {
                     d_HAS_data.gnss_id_clock_subset[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_ID_CLOCK_SUBSET_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_ID_CLOCK_SUBSET_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_ID_CLOCK_SUBSET_LENGTH);
                     if (d_HAS_data.gnss_id_clock_subset[i] != HAS_MSG_GALILEO_SYSTEM)
                         {
                             d_HAS_data.delta_clock_c0_multiplier_clock_subset[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_DELTA_CLOCK_MULTIPLIER_SUBSET_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_DELTA_CLOCK_MULTIPLIER_SUBSET_LENGTH, message.end());
+                            message = message.substr(HAS_MSG_DELTA_CLOCK_MULTIPLIER_SUBSET_LENGTH);
                         }
                     int number_sats_this_gnss_id = 0;
                     for (uint8_t j = 0; j < d_HAS_data.Nsys; j++)
                         {
                             if (d_HAS_data.gnss_id_mask[j] == d_HAS_data.gnss_id_clock_subset[i])
                                 {
-                                    uint64_t n = d_HAS_data.satellite_mask[j];
-                                    while (n)
-                                        {
-                                            number_sats_this_gnss_id += n & 1;
-                                            n >>= 1;
-                                        }
+                                    number_sats_this_gnss_id = count_ones(d_HAS_data.satellite_mask[j]);
                                     break;
                                 }
                         }
 
-                    d_HAS_data.satellite_submask[i].reserve(number_sats_this_gnss_id);
+                    d_HAS_data.satellite_submask[i].resize(number_sats_this_gnss_id);
                     for (int j = 0; j < number_sats_this_gnss_id; j++)
                         {
                             d_HAS_data.satellite_submask[i][j] = read_has_message_body_uint64(message.substr(0, 1));
-                            message = std::string(message.begin() + 1, message.end());
+                            message = message.substr(1);
                         }
-                    d_HAS_data.iod_change_flag_clock_subset[i] = (message[0] == '1' ? true : false);
-                    message = std::string(message.begin() + 1, message.end());
+                    d_HAS_data.iod_change_flag_clock_subset[i] = (message.at(0) == '1');
+                    message = message.substr(1);
 
                     d_HAS_data.delta_clock_c0_clock_subset[i] = read_has_message_body_int16(message.substr(0, HAS_MSG_DELTA_CLOCK_C0_SUBSET_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_DELTA_CLOCK_C0_SUBSET_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_DELTA_CLOCK_C0_SUBSET_LENGTH);
                 }
         }
     if (d_HAS_data.header.code_bias_flag)
         {
-            // read code bias
+            // read code bias, for the signals of each satellite in the cell mask
             d_HAS_data.validity_interval_index_code_bias_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
-            std::vector<int> number_sats(d_HAS_data.Nsys, 0);
-            std::vector<int> number_codes(d_HAS_data.Nsys, 0);
-            for (int sys = 0; sys < d_HAS_data.Nsys; sys++)
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
+            d_HAS_data.code_bias.resize(Nsat);
+            for (int sat = 0; sat < Nsat; sat++)
                 {
-                    int number_sats_this_gnss_id = 0;
-                    int number_signals_this_gnss_id = 0;
-                    if (d_HAS_data.cell_mask_availability_flag[sys] == true)
-                        {
-                            uint64_t n = d_HAS_data.satellite_mask[sys];
-                            while (n)
-                                {
-                                    number_sats_this_gnss_id += n & 1;
-                                    n >>= 1;
-                                }
-                            uint64_t m = d_HAS_data.signal_mask[sys];
-                            while (m)
-                                {
-                                    number_signals_this_gnss_id += m & 1;
-                                    m >>= 1;
-                                }
-                        }
-                    else
-                        {
-                            number_sats_this_gnss_id = HAS_MSG_MAX_SATS;
-                            number_signals_this_gnss_id = HAS_MSG_MAX_SIGNALS;
-                        }
-                    number_sats[sys] = number_sats_this_gnss_id;
-                    number_codes[sys] = number_signals_this_gnss_id;
-                }
-            int Nsat_b = std::accumulate(number_sats.begin(), number_sats.end(), 0);
-
-            d_HAS_data.code_bias.reserve(Nsat_b);
-            int sat = 0;
-            for (int sys = 0; sys < d_HAS_data.Nsys; sys++)
-                {
-                    d_HAS_data.code_bias[sat].reserve(number_codes[sys]);
-                    for (int c = 0; c < number_codes[sys]; c++)
+                    d_HAS_data.code_bias[sat].resize(signals_of_sat[sat]);
+                    for (int c = 0; c < signals_of_sat[sat]; c++)
                         {
                             d_HAS_data.code_bias[sat][c] = read_has_message_body_int16(message.substr(0, HAS_MSG_CODE_BIAS_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_CODE_BIAS_LENGTH, message.end());
-                            sat += 1;
+                            message = message.substr(HAS_MSG_CODE_BIAS_LENGTH);
                         }
                 }
         }
     if (d_HAS_data.header.phase_bias_flag)
         {
-            // read phase bias
+            // read phase bias, for the signals of each satellite in the cell mask
             d_HAS_data.validity_interval_index_phase_bias_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
-
-            std::vector<int> number_sats(d_HAS_data.Nsys, 0);
-            std::vector<int> number_phases(d_HAS_data.Nsys, 0);
-            for (int sys = 0; sys < d_HAS_data.Nsys; sys++)
-                {
-                    int number_sats_this_gnss_id = 0;
-                    int number_signals_this_gnss_id = 0;
-                    if (d_HAS_data.cell_mask_availability_flag[sys] == true)
-                        {
-                            uint64_t n = d_HAS_data.satellite_mask[sys];
-                            while (n)
-                                {
-                                    number_sats_this_gnss_id += n & 1;
-                                    n >>= 1;
-                                }
-                            uint64_t m = d_HAS_data.signal_mask[sys];
-                            while (m)
-                                {
-                                    number_signals_this_gnss_id += m & 1;
-                                    m >>= 1;
-                                }
-                        }
-                    else
-                        {
-                            number_sats_this_gnss_id = HAS_MSG_MAX_SATS;
-                            number_signals_this_gnss_id = HAS_MSG_MAX_SIGNALS;
-                        }
-                    number_sats[sys] = number_sats_this_gnss_id;
-                    number_phases[sys] = number_signals_this_gnss_id;
-                }
-            int Nsat_p = std::accumulate(number_sats.begin(), number_sats.end(), 0);
-
-            d_HAS_data.phase_bias.reserve(Nsat_p);
-            d_HAS_data.phase_discontinuity_indicator.reserve(Nsat_p);
-            int sat = 0;
-            for (int sys = 0; sys < d_HAS_data.Nsys; sys++)
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
+            d_HAS_data.phase_bias.resize(Nsat);
+            d_HAS_data.phase_discontinuity_indicator.resize(Nsat);
+            for (int sat = 0; sat < Nsat; sat++)
                 {
-                    d_HAS_data.phase_bias[sat].reserve(number_phases[sys]);
-                    d_HAS_data.phase_discontinuity_indicator[sat].reserve(number_phases[sys]);
-                    for (int p = 0; p < number_phases[sys]; p++)
+                    d_HAS_data.phase_bias[sat].resize(signals_of_sat[sat]);
+                    d_HAS_data.phase_discontinuity_indicator[sat].resize(signals_of_sat[sat]);
+                    for (int p = 0; p < signals_of_sat[sat]; p++)
                         {
                             d_HAS_data.phase_bias[sat][p] = read_has_message_body_int16(message.substr(0, HAS_MSG_PHASE_BIAS_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_PHASE_BIAS_LENGTH, message.end());
+                            message = message.substr(HAS_MSG_PHASE_BIAS_LENGTH);
 
                             d_HAS_data.phase_discontinuity_indicator[sat][p] = read_has_message_body_uint8(message.substr(0, HAS_MSG_PHASE_DISCONTINUITY_INDICATOR_LENGTH));
-                            message = std::string(message.begin() + HAS_MSG_PHASE_DISCONTINUITY_INDICATOR_LENGTH, message.end());
-                            sat += 1;
+                            message = message.substr(HAS_MSG_PHASE_DISCONTINUITY_INDICATOR_LENGTH);
                         }
                 }
         }
@@ -474,12 +467,12 @@ void Galileo_Cnav_Message::read_MT1_body(const std::string& message_string)
         {
             // read URA
             d_HAS_data.validity_interval_index_ura_corrections = read_has_message_body_uint8(message.substr(0, HAS_MSG_VALIDITY_INDEX_LENGTH));
-            message = std::string(message.begin() + HAS_MSG_VALIDITY_INDEX_LENGTH, message.end());
-            d_HAS_data.ura.reserve(Nsat);
+            message = message.substr(HAS_MSG_VALIDITY_INDEX_LENGTH);
+            d_HAS_data.ura.resize(Nsat);
             for (int i = 0; i < Nsat; i++)
                 {
                     d_HAS_data.ura[i] = read_has_message_body_uint8(message.substr(0, HAS_MSG_URA_LENGTH));
-                    message = std::string(message.begin() + HAS_MSG_URA_LENGTH, message.end());
+                    message = message.substr(HAS_MSG_URA_LENGTH);
                 }
         }
 }
@@ -544,12 +537,12 @@ bool Galileo_Cnav_Message::read_has_message_header_parameter_bool(std::bitset<GA
 uint8_t Galileo_Cnav_Message::read_has_message_body_uint8(const std::string& bits) const
 {
     uint8_t value = 0U;
-    size_t len = bits.length();
+    const size_t len = bits.length();
 
     for (size_t j = 0; j < len; j++)
         {
             value <<= 1U;  // shift left
-            if (static_cast<int>(bits[len - 1 - j]) == 1)
+            if (bits[j] == '1')
                 {
                     value += 1;  // insert the bit
                 }
@@ -561,12 +554,12 @@ uint8_t Galileo_Cnav_Message::read_has_message_body_uint8(const std::string& bit
 uint16_t Galileo_Cnav_Message::read_has_message_body_uint16(const std::string& bits) const
 {
     uint16_t value = 0U;
-    size_t len = bits.length();
+    const size_t len = bits.length();
 
     for (size_t j = 0; j < len; j++)
         {
             value <<= 1U;  // shift left
-            if (static_cast<int>(bits[len - 1 - j]) == 1)
+            if (bits[j] == '1')
                 {
                     value += 1;  // insert the bit
                 }
@@ -578,12 +571,12 @@ uint16_t Galileo_Cnav_Message::read_has_message_body_uint16(const std::string& b
 uint64_t Galileo_Cnav_Message::read_has_message_body_uint64(const std::string& bits) const
 {
     uint64_t value = 0U;
-    size_t len = bits.length();
+    const size_t len = bits.length();
 
     for (size_t j = 0; j < len; j++)
         {
             value <<= 1U;  // shift left
-            if (static_cast<int>(bits[len - 1 - j]) == 1)
+            if (bits[j] == '1')
                 {
                     value += 1;  // insert the bit
                 }
@@ -594,28 +587,25 @@ uint64_t Galileo_Cnav_Message::read_has_message_body_uint64(const std::string& b
 
 int16_t Galileo_Cnav_Message::read_has_message_body_int16(const std::string& bits) const
 {
-    int16_t value = 0;
-    size_t len = bits.length();
+    const size_t len = bits.length();
+    uint16_t value = read_has_message_body_uint16(bits);
 
     // read the MSB and perform the sign extension
-    if (static_cast<int>(bits[len - 1]) == 1)
+    if (len > 0 && len < 16 && bits[0] == '1')
         {
-            value ^= 0xFFFF;  // 16 bits variable
-        }
-    else
-        {
-            value &= 0;
+            value |= static_cast<uint16_t>(0xFFFFU << len);
         }
+    return static_cast<int16_t>(value);
+}
 
-    for (size_t j = 0; j < len; j++)
+
+int Galileo_Cnav_Message::count_ones(uint64_t mask) const
+{
+    int ones = 0;
+    while (mask)
         {
-            value *= 2;       // shift left the signed integer
-            value &= 0xFFFE;  // reset the corresponding bit (for the 16 bits variable)
-            if (static_cast<int>(bits[len - 1 - j]) == 1)
-                {
-                    value += 1;  // insert the bit
-                }
+            ones += static_cast<int>(mask & 1U);
+            mask >>= 1U;
         }
-
-    return value;
+    return ones;
 }
@@ -21,10 +21,12 @@
 
 #include "Galileo_CNAV.h"
 #include "galileo_has_data.h"
+#include "reed_solomon.h"
 #include <bitset>
 #include <cstdint>
-#include <list>
+#include <map>
 #include <string>
+#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -36,6 +38,9 @@
  * \brief This class handles the Galileo CNAV Data message, as described in the
  * Galileo High Accuracy Service E6-B Signal-In-Space Message Specification v1.2
  * (April 2020)
+ *
+ * HAS pages are Reed-Solomon erasure decoded as they arrive, keeping one
+ * decoder per message ID, so pages of different messages can be interleaved.
  */
 class Galileo_Cnav_Message
 {
@@ -64,12 +69,30 @@ public:
         return d_HAS_data;
     }
 
+    /*!
+     * \brief Last decoded HAS message, as bytes (message size x 53 octets).
+     * Only valid if have_new_HAS_message()
+     */
+    inline const std::vector<uint8_t>& get_HAS_decoded_message() const
+    {
+        return d_decoded_message_type_1;
+    }
+
 private:
+    // Pages of a HAS message that are still being received
+    struct Pending_HAS_Message
+    {
+        Pending_HAS_Message(const Reed_Solomon& code, uint8_t size, uint64_t page) : decoder(code, size, GALILEO_CNAV_OCTETS_IN_SUBPAGE), message_size(size), first_page(page) {}
+        Reed_Solomon_Erasure_Decoder decoder;
+        uint8_t message_size;
+        uint64_t first_page;
+    };
+
     bool CRC_test(std::bitset<GALILEO_CNAV_BITS_FOR_CRC> bits, uint32_t checksum) const;
     void read_HAS_page_header(const std::string& page_string);
     void process_HAS_page(const std::string& page_string);
-    void decode_message_type1();
-    void read_HAS_message_type1(const std::string& message_string);
+    void decode_message_type1(const Reed_Solomon_Erasure_Decoder& decoder);
+    bool read_HAS_message_type1(const std::string& message_string);
     void read_MT1_header(const std::string& message_string);
     void read_MT1_body(const std::string& message_string);
 
@@ -81,20 +104,19 @@ private:
     uint16_t read_has_message_body_uint16(const std::string& bits) const;
     uint64_t read_has_message_body_uint64(const std::string& bits) const;
     int16_t read_has_message_body_int16(const std::string& bits) const;
+    int count_ones(uint64_t mask) const;
 
     Galileo_HAS_data d_HAS_data{};
 
-    std::string d_encoded_message_type_1;
-    std::list<uint8_t> d_list_pid;
+    std::map<uint8_t, Pending_HAS_Message> d_pending_messages;  // indexed by message ID
+    std::vector<uint8_t> d_decoded_message_type_1;
+    uint64_t d_has_page_counter{};
 
     uint8_t d_has_page_status{};
-    uint8_t d_current_message_id{};
-    uint8_t d_current_message_size{};
 
     uint8_t d_received_message_page_id{};
     uint8_t d_received_message_type{};
     uint8_t d_received_message_id{};
-    uint8_t d_received_encoded_messages{};
     uint8_t d_received_message_size{};
 
     bool d_test_mode{};
@@ -21,8 +21,9 @@
 #define GNSS_SDR_GNSS_SYNCHRO_H
 
 #include <boost/serialization/nvp.hpp>
+#include <cstddef>
 #include <cstdint>
-#include <utility>
+#include <type_traits>
 
 /** \addtogroup Core
  * \{ */
@@ -34,135 +35,56 @@
 /*!
  * \brief This is the class that contains the information that is shared
  * by the processing blocks.
+ *
+ * Objects of this class are copied at every block boundary of the
+ * flowgraph, so it is kept trivially copyable and its members are laid out
+ * without padding holes. The satellite info, flags and tracking outputs
+ * read at every epoch by the Telemetry Decoder, Observables and PVT blocks
+ * take the first 112 bytes, with the sample counter, code and carrier
+ * phases and Doppler in the first 64. The acquisition results, only needed
+ * for the pull-in of the tracking loops, are left at the end. The class is
+ * not aligned to cache lines, since GNU Radio buffers store the objects
+ * contiguously and the padding would add a third to every copy.
  */
 class Gnss_Synchro
 {
 public:
-    Gnss_Synchro() = default;  //!< Default constructor
-
-    ~Gnss_Synchro() = default;  //!< Default destructor
-
     // Satellite and signal info
     char System{};         //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
     char Signal[3]{};      //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
     uint32_t PRN{};        //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
     int32_t Channel_ID{};  //!< Set by Channel constructor
 
-    // Acquisition
-    double Acq_delay_samples{};          //!< Set by Acquisition processing block
-    double Acq_doppler_hz{};             //!< Set by Acquisition processing block
-    uint64_t Acq_samplestamp_samples{};  //!< Set by Acquisition processing block
-    uint32_t Acq_doppler_step{};         //!< Set by Acquisition processing block
-
-    // Tracking
-    int64_t fs{};                        //!< Set by Tracking processing block
-    double Prompt_I{};                   //!< Set by Tracking processing block
-    double Prompt_Q{};                   //!< Set by Tracking processing block
-    double CN0_dB_hz{};                  //!< Set by Tracking processing block
-    double Carrier_Doppler_hz{};         //!< Set by Tracking processing block
-    double Carrier_phase_rads{};         //!< Set by Tracking processing block
-    double Code_phase_samples{};         //!< Set by Tracking processing block
-    uint64_t Tracking_sample_counter{};  //!< Set by Tracking processing block
-    int32_t correlation_length_ms{};     //!< Set by Tracking processing block
-
     // Telemetry Decoder
     uint32_t TOW_at_current_symbol_ms{};  //!< Set by Telemetry Decoder processing block
 
-    // Observables
-    double Pseudorange_m{};  //!< Set by Observables processing block
-    double RX_time{};        //!< Set by Observables processing block
-    double interp_TOW_ms{};  //!< Set by Observables processing block
-
     // Flags
     bool Flag_valid_acquisition{};    //!< Set by Acquisition processing block
     bool Flag_valid_symbol_output{};  //!< Set by Tracking processing block
     bool Flag_valid_word{};           //!< Set by Telemetry Decoder processing block
     bool Flag_valid_pseudorange{};    //!< Set by Observables processing block
 
-    /// Copy constructor
-    Gnss_Synchro(const Gnss_Synchro& other) noexcept
-    {
-        *this = other;
-    };
+    // Tracking
+    int32_t correlation_length_ms{};     //!< Set by Tracking processing block
+    uint64_t Tracking_sample_counter{};  //!< Set by Tracking processing block
+    int64_t fs{};                        //!< Set by Tracking processing block
+    double Code_phase_samples{};         //!< Set by Tracking processing block
+    double Carrier_phase_rads{};         //!< Set by Tracking processing block
+    double Carrier_Doppler_hz{};         //!< Set by Tracking processing block
+    double CN0_dB_hz{};                  //!< Set by Tracking processing block
+    double Prompt_I{};                   //!< Set by Tracking processing block
+    double Prompt_Q{};                   //!< Set by Tracking processing block
 
-    /// Copy assignment operator
-    Gnss_Synchro& operator=(const Gnss_Synchro& rhs) noexcept
-    {
-        // Only do assignment if RHS is a different object from this.
-        if (this != &rhs)
-            {
-                this->System = rhs.System;
-                this->Signal[0] = rhs.Signal[0];
-                this->Signal[1] = rhs.Signal[1];
-                this->Signal[2] = rhs.Signal[2];
-                this->PRN = rhs.PRN;
-                this->Channel_ID = rhs.Channel_ID;
-                this->Acq_delay_samples = rhs.Acq_delay_samples;
-                this->Acq_doppler_hz = rhs.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = rhs.Acq_samplestamp_samples;
-                this->Acq_doppler_step = rhs.Acq_doppler_step;
-                this->fs = rhs.fs;
-                this->Prompt_I = rhs.Prompt_I;
-                this->Prompt_Q = rhs.Prompt_Q;
-                this->CN0_dB_hz = rhs.CN0_dB_hz;
-                this->Carrier_Doppler_hz = rhs.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = rhs.Carrier_phase_rads;
-                this->Code_phase_samples = rhs.Code_phase_samples;
-                this->Tracking_sample_counter = rhs.Tracking_sample_counter;
-                this->correlation_length_ms = rhs.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = rhs.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = rhs.Pseudorange_m;
-                this->RX_time = rhs.RX_time;
-                this->interp_TOW_ms = rhs.interp_TOW_ms;
-                this->Flag_valid_acquisition = rhs.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = rhs.Flag_valid_symbol_output;
-                this->Flag_valid_word = rhs.Flag_valid_word;
-                this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
-
-    /// Move constructor
-    Gnss_Synchro(Gnss_Synchro&& other) noexcept
-    {
-        *this = std::move(other);
-    };
+    // Observables
+    double Pseudorange_m{};  //!< Set by Observables processing block
+    double RX_time{};        //!< Set by Observables processing block
+    double interp_TOW_ms{};  //!< Set by Observables processing block
 
-    /// Move assignment operator
-    Gnss_Synchro& operator=(Gnss_Synchro&& other) noexcept
-    {
-        if (this != &other)
-            {
-                this->System = other.System;
-                this->Signal[0] = other.Signal[0];
-                this->Signal[1] = other.Signal[1];
-                this->Signal[2] = other.Signal[2];
-                this->PRN = other.PRN;
-                this->Channel_ID = other.Channel_ID;
-                this->Acq_delay_samples = other.Acq_delay_samples;
-                this->Acq_doppler_hz = other.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = other.Acq_samplestamp_samples;
-                this->Acq_doppler_step = other.Acq_doppler_step;
-                this->fs = other.fs;
-                this->Prompt_I = other.Prompt_I;
-                this->Prompt_Q = other.Prompt_Q;
-                this->CN0_dB_hz = other.CN0_dB_hz;
-                this->Carrier_Doppler_hz = other.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = other.Carrier_phase_rads;
-                this->Code_phase_samples = other.Code_phase_samples;
-                this->Tracking_sample_counter = other.Tracking_sample_counter;
-                this->correlation_length_ms = other.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = other.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = other.Pseudorange_m;
-                this->RX_time = other.RX_time;
-                this->interp_TOW_ms = other.interp_TOW_ms;
-                this->Flag_valid_acquisition = other.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = other.Flag_valid_symbol_output;
-                this->Flag_valid_word = other.Flag_valid_word;
-                this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
+    // Acquisition
+    double Acq_delay_samples{};          //!< Set by Acquisition processing block
+    double Acq_doppler_hz{};             //!< Set by Acquisition processing block
+    uint64_t Acq_samplestamp_samples{};  //!< Set by Acquisition processing block
+    uint32_t Acq_doppler_step{};         //!< Set by Acquisition processing block
 
     /*!
      * \brief This member function serializes and restores
@@ -210,6 +132,16 @@ public:
 };
 
 
+#if !defined(__GNUC__) || defined(__clang__) || (__GNUC__ >= 5)
+static_assert(std::is_trivially_copyable<Gnss_Synchro>::value,
+    "Gnss_Synchro objects are copied with memcpy by the GNU Radio buffers");
+#endif
+static_assert(offsetof(Gnss_Synchro, Tracking_sample_counter) == 24 && offsetof(Gnss_Synchro, CN0_dB_hz) == 64,
+    "The sample counter, code and carrier phases and Doppler must fill the first 64 bytes of Gnss_Synchro");
+static_assert(offsetof(Gnss_Synchro, Acq_delay_samples) == 112 && offsetof(Gnss_Synchro, Acq_doppler_step) == 136,
+    "The acquisition results must follow the per-epoch fields of Gnss_Synchro, without padding holes");
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_GNSS_SYNCHRO_H
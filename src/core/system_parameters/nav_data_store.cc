@@ -0,0 +1,695 @@
+/*!
+ * \file nav_data_store.cc
+ * \brief Append-only binary store of navigation data (ephemeris, almanacs,
+ * UTC and ionospheric models) for fast warm and hot starts
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "nav_data_store.h"
+#include "agnss_ref_location.h"
+#include "agnss_ref_time.h"
+#include "beidou_dnav_almanac.h"
+#include "beidou_dnav_ephemeris.h"
+#include "beidou_dnav_iono.h"
+#include "beidou_dnav_utc_model.h"
+#include "galileo_almanac.h"
+#include "galileo_ephemeris.h"
+#include "galileo_iono.h"
+#include "galileo_utc_model.h"
+#include "glonass_gnav_ephemeris.h"
+#include "glonass_gnav_utc_model.h"
+#include "gps_almanac.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_cnav_iono.h"
+#include "gps_cnav_utc_model.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/crc.hpp>
+#include <glog/logging.h>
+#include <fcntl.h>     // for open, O_RDONLY, O_RDWR
+#include <sys/file.h>  // for flock
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat, stat
+#include <unistd.h>    // for close, write, fsync, ftruncate
+#include <cerrno>
+#include <cstdio>   // for std::rename, std::remove
+#include <cstring>  // for memcpy, memcmp, strerror
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <utility>
+
+
+namespace
+{
+constexpr char STORE_MAGIC[8] = {'G', 'N', 'S', 'S', 'N', 'A', 'V', 'S'};
+constexpr uint32_t STORE_FORMAT_VERSION = 1;  // Increase it whenever a serialize() method of a supported type changes
+constexpr uint32_t STORE_BYTE_ORDER_MARK = 0x01020304;
+constexpr size_t COMPACTION_MIN_DEAD_RECORDS = 256;
+
+
+struct Store_Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order_mark;
+};
+
+
+struct Record_Header
+{
+    uint16_t type;
+    uint16_t reserved;
+    int32_t key;
+    uint32_t size;
+    uint32_t crc;  // CRC-32 of the previous fields and the payload
+};
+
+
+static_assert(sizeof(Store_Header) == 16, "Unexpected padding in the navigation data store header");
+static_assert(sizeof(Record_Header) == 16, "Unexpected padding in the navigation data store record header");
+
+
+uint32_t record_crc(const Record_Header& header, const char* payload)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(&header, offsetof(Record_Header, crc));
+    crc.process_bytes(payload, header.size);
+    return crc.checksum();
+}
+
+
+bool write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0)
+        {
+            const ssize_t written = ::write(fd, data, size);
+            if (written < 0)
+                {
+                    if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                    return false;
+                }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    return true;
+}
+
+
+std::string store_header()
+{
+    Store_Header header{};
+    std::memcpy(header.magic, STORE_MAGIC, sizeof(STORE_MAGIC));
+    header.version = STORE_FORMAT_VERSION;
+    header.byte_order_mark = STORE_BYTE_ORDER_MARK;
+    return std::string(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+
+void append_record(std::string& buffer, uint16_t type, int32_t key, const char* payload, uint32_t size)
+{
+    Record_Header header{type, 0, key, size, 0};
+    header.crc = record_crc(header, payload);
+    buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    buffer.append(payload, size);
+}
+
+
+// Read-only stream buffer over the mapped file, so that the archives do not copy the records
+class Memory_Streambuf : public std::streambuf
+{
+public:
+    Memory_Streambuf(const char* data, size_t size)
+    {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+
+template <uint16_t TYPE>
+struct Satellite_Record
+{
+    static constexpr uint16_t type = TYPE;
+    template <class T>
+    static int32_t key(const T& nav_data)
+    {
+        return static_cast<int32_t>(nav_data.i_satellite_PRN);
+    }
+};
+
+
+template <uint16_t TYPE>
+struct Model_Record
+{
+    static constexpr uint16_t type = TYPE;
+    template <class T>
+    static int32_t key(const T& /*nav_data*/)
+    {
+        return 0;
+    }
+};
+
+
+// The record types are part of the file format: never renumber nor reuse them
+template <class T>
+struct Record_Traits;
+template <>
+struct Record_Traits<Gps_Ephemeris> : Satellite_Record<1>
+{
+};
+template <>
+struct Record_Traits<Gps_CNAV_Ephemeris> : Satellite_Record<2>
+{
+};
+template <>
+struct Record_Traits<Galileo_Ephemeris> : Satellite_Record<3>
+{
+};
+template <>
+struct Record_Traits<Glonass_Gnav_Ephemeris> : Satellite_Record<4>
+{
+};
+template <>
+struct Record_Traits<Beidou_Dnav_Ephemeris> : Satellite_Record<5>
+{
+};
+template <>
+struct Record_Traits<Gps_Almanac> : Satellite_Record<16>
+{
+};
+template <>
+struct Record_Traits<Galileo_Almanac> : Satellite_Record<17>
+{
+};
+template <>
+struct Record_Traits<Beidou_Dnav_Almanac> : Satellite_Record<18>
+{
+};
+template <>
+struct Record_Traits<Gps_Utc_Model> : Model_Record<32>
+{
+};
+template <>
+struct Record_Traits<Gps_CNAV_Utc_Model> : Model_Record<33>
+{
+};
+template <>
+struct Record_Traits<Galileo_Utc_Model> : Model_Record<34>
+{
+};
+template <>
+struct Record_Traits<Glonass_Gnav_Utc_Model> : Model_Record<35>
+{
+};
+template <>
+struct Record_Traits<Beidou_Dnav_Utc_Model> : Model_Record<36>
+{
+};
+template <>
+struct Record_Traits<Gps_Iono> : Model_Record<48>
+{
+};
+template <>
+struct Record_Traits<Gps_CNAV_Iono> : Model_Record<49>
+{
+};
+template <>
+struct Record_Traits<Galileo_Iono> : Model_Record<50>
+{
+};
+template <>
+struct Record_Traits<Beidou_Dnav_Iono> : Model_Record<51>
+{
+};
+template <>
+struct Record_Traits<Agnss_Ref_Time> : Model_Record<64>
+{
+};
+template <>
+struct Record_Traits<Agnss_Ref_Location> : Model_Record<65>
+{
+};
+
+
+template <class T>
+std::string serialize(const T& nav_data)
+{
+    std::stringbuf buffer;
+    {
+        boost::archive::binary_oarchive archive(buffer, boost::archive::no_header);
+        archive << nav_data;
+    }
+    return buffer.str();
+}
+
+
+template <class T>
+bool deserialize(const char* data, uint32_t size, T& nav_data)
+{
+    try
+        {
+            Memory_Streambuf buffer(data, size);
+            boost::archive::binary_iarchive archive(buffer, boost::archive::no_header);
+            T tmp_obj;
+            archive >> tmp_obj;
+            nav_data = tmp_obj;
+        }
+    catch (const boost::archive::archive_exception& e)
+        {
+            LOG(WARNING) << "Error reading navigation data record: " << e.what();
+            return false;
+        }
+    return true;
+}
+}  // namespace
+
+
+Nav_Data_Store::Nav_Data_Store(std::string file_name) : d_file_name(std::move(file_name))
+{
+}
+
+
+Nav_Data_Store::~Nav_Data_Store()
+{
+    close_file();
+    unmap();
+}
+
+
+bool Nav_Data_Store::load()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    close_file();
+    return load_file();
+}
+
+
+template <class T>
+bool Nav_Data_Store::put(const T& nav_data)
+{
+    const uint16_t type = Record_Traits<T>::type;
+    const Record_Key key(type, Record_Traits<T>::key(nav_data));
+    const std::string payload = serialize(nav_data);
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (!lock_file())
+        {
+            return false;
+        }
+    bool ok = true;
+    const auto it = d_index.find(key);
+    if (it == d_index.cend() || it->second.size != payload.size() || std::memcmp(it->second.data, payload.data(), payload.size()) != 0)
+        {
+            ok = append(key, payload);
+        }
+    unlock_file();
+    return ok;
+}
+
+
+template <class T>
+bool Nav_Data_Store::put(const std::map<int32_t, T>& nav_data_map)
+{
+    bool ok = true;
+    for (const auto& nav_data : nav_data_map)
+        {
+            ok = put(nav_data.second) && ok;
+        }
+    return ok;
+}
+
+
+template <class T>
+bool Nav_Data_Store::get(T& nav_data) const
+{
+    const uint16_t type = Record_Traits<T>::type;
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto it = d_index.find(Record_Key(type, 0));
+    if (it == d_index.cend())
+        {
+            return false;
+        }
+    return deserialize(it->second.data, it->second.size, nav_data);
+}
+
+
+template <class T>
+bool Nav_Data_Store::get(std::map<int32_t, T>& nav_data_map) const
+{
+    const uint16_t type = Record_Traits<T>::type;
+    std::map<int32_t, T> read_map;
+    std::lock_guard<std::mutex> lock(d_mutex);
+    for (auto it = d_index.lower_bound(Record_Key(type, std::numeric_limits<int32_t>::min()));
+         it != d_index.cend() && it->first.first == type;
+         ++it)
+        {
+            T nav_data;
+            if (deserialize(it->second.data, it->second.size, nav_data))
+                {
+                    read_map[it->first.second] = nav_data;
+                }
+        }
+    if (read_map.empty())
+        {
+            return false;
+        }
+    nav_data_map = std::move(read_map);
+    return true;
+}
+
+
+bool Nav_Data_Store::compact()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (!lock_file())
+        {
+            return false;
+        }
+    const bool ok = rewrite();
+    unlock_file();
+    return ok;
+}
+
+
+bool Nav_Data_Store::load_file()
+{
+    unmap();
+    d_index.clear();
+    d_appended.clear();
+    d_dead_records = 0;
+    d_valid_size = 0;
+    d_loaded = false;
+
+    const int fd = ::open(d_file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        {
+            return false;
+        }
+    struct stat file_status
+    {
+    };
+    if (::fstat(fd, &file_status) != 0 || static_cast<size_t>(file_status.st_size) < sizeof(Store_Header))
+        {
+            ::close(fd);
+            if (file_status.st_size != 0)
+                {
+                    LOG(WARNING) << d_file_name << " is not a navigation data store";
+                }
+            return false;
+        }
+    d_map_size = static_cast<size_t>(file_status.st_size);
+    void* map = ::mmap(nullptr, d_map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        {
+            LOG(WARNING) << "Unable to map " << d_file_name << ": " << std::strerror(errno);
+            d_map_size = 0;
+            return false;
+        }
+    d_map = static_cast<const char*>(map);
+
+    Store_Header header{};
+    std::memcpy(&header, d_map, sizeof(header));
+    if (std::memcmp(header.magic, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0 ||
+        header.version != STORE_FORMAT_VERSION ||
+        header.byte_order_mark != STORE_BYTE_ORDER_MARK)
+        {
+            LOG(WARNING) << d_file_name << " is not a navigation data store of version " << STORE_FORMAT_VERSION << " for this machine";
+            unmap();
+            return false;
+        }
+
+    size_t offset = sizeof(Store_Header);
+    while (d_map_size - offset >= sizeof(Record_Header))
+        {
+            Record_Header record{};
+            std::memcpy(&record, d_map + offset, sizeof(record));
+            const char* payload = d_map + offset + sizeof(Record_Header);
+            if (record.size > d_map_size - offset - sizeof(Record_Header) || record_crc(record, payload) != record.crc)
+                {
+                    break;
+                }
+            const auto inserted = d_index.emplace(Record_Key(record.type, record.key), Record_View{payload, record.size});
+            if (!inserted.second)
+                {
+                    inserted.first->second = Record_View{payload, record.size};
+                    d_dead_records++;
+                }
+            offset += sizeof(Record_Header) + record.size;
+        }
+    if (offset != d_map_size)
+        {
+            LOG(WARNING) << "Discarding " << d_map_size - offset << " bytes of damaged data at the end of " << d_file_name;
+        }
+    d_valid_size = offset;
+    d_loaded = true;
+    DLOG(INFO) << "Loaded " << d_index.size() << " navigation data records (" << d_dead_records << " superseded) from " << d_file_name;
+    return true;
+}
+
+
+bool Nav_Data_Store::lock_file()
+{
+    while (true)
+        {
+            bool reopened = false;
+            if (d_fd < 0)
+                {
+                    d_fd = ::open(d_file_name.c_str(), O_RDWR | O_APPEND | O_CREAT, 0644);
+                    if (d_fd < 0)
+                        {
+                            LOG(WARNING) << "Unable to open " << d_file_name << " for writing: " << std::strerror(errno);
+                            return false;
+                        }
+                    reopened = true;
+                }
+            int result;
+            do
+                {
+                    result = ::flock(d_fd, LOCK_EX);
+                }
+            while (result != 0 && errno == EINTR);
+            struct stat fd_status
+            {
+            };
+            struct stat path_status
+            {
+            };
+            if (result != 0 || ::fstat(d_fd, &fd_status) != 0)
+                {
+                    LOG(WARNING) << "Unable to lock " << d_file_name << ": " << std::strerror(errno);
+                    close_file();
+                    return false;
+                }
+            if (::stat(d_file_name.c_str(), &path_status) != 0 || path_status.st_ino != fd_status.st_ino || path_status.st_dev != fd_status.st_dev)
+                {
+                    // Another writer replaced the file while we were waiting for the lock
+                    close_file();
+                    continue;
+                }
+            if (!reopened && d_loaded && static_cast<size_t>(fd_status.st_size) == d_valid_size)
+                {
+                    return true;
+                }
+
+            // The file changed since the last time we indexed it (or we never did):
+            // index the records that other writers have appended in the meantime
+            if (!load_file())
+                {
+                    // No valid store yet: start a new, empty one
+                    const std::string header = store_header();
+                    if (::ftruncate(d_fd, 0) != 0 || !write_all(d_fd, header.data(), header.size()))
+                        {
+                            LOG(WARNING) << "Unable to write " << d_file_name << ": " << std::strerror(errno);
+                            close_file();
+                            return false;
+                        }
+                    d_valid_size = header.size();
+                    d_loaded = true;
+                }
+            else if (d_valid_size < static_cast<size_t>(fd_status.st_size))
+                {
+                    // Drop the damaged tail found by load_file(), so that the new records can be
+                    // read back. No other writer can be in the middle of a write while we hold the lock
+                    if (::ftruncate(d_fd, static_cast<off_t>(d_valid_size)) != 0)
+                        {
+                            LOG(WARNING) << "Unable to truncate " << d_file_name << ": " << std::strerror(errno);
+                            close_file();
+                            return false;
+                        }
+                }
+            return true;
+        }
+}
+
+
+void Nav_Data_Store::unlock_file()
+{
+    if (d_fd >= 0)
+        {
+            ::flock(d_fd, LOCK_UN);
+        }
+}
+
+
+void Nav_Data_Store::close_file()
+{
+    if (d_fd >= 0)
+        {
+            ::close(d_fd);  // also releases the lock
+            d_fd = -1;
+        }
+}
+
+
+bool Nav_Data_Store::append(const Record_Key& key, const std::string& payload)
+{
+    std::string record;
+    record.reserve(sizeof(Record_Header) + payload.size());
+    append_record(record, key.first, key.second, payload.data(), static_cast<uint32_t>(payload.size()));
+    if (!write_all(d_fd, record.data(), record.size()))
+        {
+            LOG(WARNING) << "Unable to write to " << d_file_name << ": " << std::strerror(errno);
+            // The file may end with a partial record now, which the next writer will discard
+            close_file();
+            return false;
+        }
+    d_valid_size += record.size();
+    d_appended.push_back(payload);
+    const auto inserted = d_index.emplace(key, Record_View{d_appended.back().data(), static_cast<uint32_t>(payload.size())});
+    if (!inserted.second)
+        {
+            inserted.first->second = Record_View{d_appended.back().data(), static_cast<uint32_t>(payload.size())};
+            d_dead_records++;
+        }
+    if (d_dead_records >= COMPACTION_MIN_DEAD_RECORDS && d_dead_records > d_index.size())
+        {
+            return rewrite();
+        }
+    return true;
+}
+
+
+bool Nav_Data_Store::rewrite()
+{
+    const std::string tmp_file_name = d_file_name + ".tmp";
+    if (!write_file(tmp_file_name))
+        {
+            std::remove(tmp_file_name.c_str());
+            return false;
+        }
+    if (std::rename(tmp_file_name.c_str(), d_file_name.c_str()) != 0)
+        {
+            LOG(WARNING) << "Unable to replace " << d_file_name << ": " << std::strerror(errno);
+            std::remove(tmp_file_name.c_str());
+            return false;
+        }
+    // Release the lock of the replaced file. Writers waiting for it will open the new one
+    close_file();
+    // Index the new file, which also releases the payloads kept in memory
+    return load_file();
+}
+
+
+bool Nav_Data_Store::write_file(const std::string& file_name) const
+{
+    std::string contents = store_header();
+    for (const auto& record : d_index)
+        {
+            append_record(contents, record.first.first, record.first.second, record.second.data, record.second.size);
+        }
+
+    const int fd = ::open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        {
+            LOG(WARNING) << "Unable to create " << file_name << ": " << std::strerror(errno);
+            return false;
+        }
+    // Make sure that the data is on disk before the file replaces the old one
+    const bool ok = write_all(fd, contents.data(), contents.size()) && ::fsync(fd) == 0;
+    if (!ok)
+        {
+            LOG(WARNING) << "Unable to write " << file_name << ": " << std::strerror(errno);
+        }
+    ::close(fd);
+    return ok;
+}
+
+
+void Nav_Data_Store::unmap()
+{
+    if (d_map != nullptr)
+        {
+            ::munmap(const_cast<char*>(d_map), d_map_size);
+            d_map = nullptr;
+            d_map_size = 0;
+        }
+}
+
+
+template bool Nav_Data_Store::put(const Gps_Ephemeris&);
+template bool Nav_Data_Store::put(const Gps_CNAV_Ephemeris&);
+template bool Nav_Data_Store::put(const Galileo_Ephemeris&);
+template bool Nav_Data_Store::put(const Glonass_Gnav_Ephemeris&);
+template bool Nav_Data_Store::put(const Beidou_Dnav_Ephemeris&);
+template bool Nav_Data_Store::put(const Gps_Almanac&);
+template bool Nav_Data_Store::put(const Galileo_Almanac&);
+template bool Nav_Data_Store::put(const Beidou_Dnav_Almanac&);
+template bool Nav_Data_Store::put(const Gps_Utc_Model&);
+template bool Nav_Data_Store::put(const Gps_CNAV_Utc_Model&);
+template bool Nav_Data_Store::put(const Galileo_Utc_Model&);
+template bool Nav_Data_Store::put(const Glonass_Gnav_Utc_Model&);
+template bool Nav_Data_Store::put(const Beidou_Dnav_Utc_Model&);
+template bool Nav_Data_Store::put(const Gps_Iono&);
+template bool Nav_Data_Store::put(const Gps_CNAV_Iono&);
+template bool Nav_Data_Store::put(const Galileo_Iono&);
+template bool Nav_Data_Store::put(const Beidou_Dnav_Iono&);
+template bool Nav_Data_Store::put(const Agnss_Ref_Time&);
+template bool Nav_Data_Store::put(const Agnss_Ref_Location&);
+
+template bool Nav_Data_Store::put(const std::map<int32_t, Gps_Ephemeris>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Gps_CNAV_Ephemeris>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Galileo_Ephemeris>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Glonass_Gnav_Ephemeris>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Beidou_Dnav_Ephemeris>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Gps_Almanac>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Galileo_Almanac>&);
+template bool Nav_Data_Store::put(const std::map<int32_t, Beidou_Dnav_Almanac>&);
+
+template bool Nav_Data_Store::get(Gps_Utc_Model&) const;
+template bool Nav_Data_Store::get(Gps_CNAV_Utc_Model&) const;
+template bool Nav_Data_Store::get(Galileo_Utc_Model&) const;
+template bool Nav_Data_Store::get(Glonass_Gnav_Utc_Model&) const;
+template bool Nav_Data_Store::get(Beidou_Dnav_Utc_Model&) const;
+template bool Nav_Data_Store::get(Gps_Iono&) const;
+template bool Nav_Data_Store::get(Gps_CNAV_Iono&) const;
+template bool Nav_Data_Store::get(Galileo_Iono&) const;
+template bool Nav_Data_Store::get(Beidou_Dnav_Iono&) const;
+template bool Nav_Data_Store::get(Agnss_Ref_Time&) const;
+template bool Nav_Data_Store::get(Agnss_Ref_Location&) const;
+
+template bool Nav_Data_Store::get(std::map<int32_t, Gps_Ephemeris>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Gps_CNAV_Ephemeris>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Galileo_Ephemeris>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Glonass_Gnav_Ephemeris>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Beidou_Dnav_Ephemeris>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Gps_Almanac>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Galileo_Almanac>&) const;
+template bool Nav_Data_Store::get(std::map<int32_t, Beidou_Dnav_Almanac>&) const;
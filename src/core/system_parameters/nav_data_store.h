@@ -0,0 +1,171 @@
+/*!
+ * \file nav_data_store.h
+ * \brief Append-only binary store of navigation data (ephemeris, almanacs,
+ * UTC and ionospheric models) for fast warm and hot starts
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_NAV_DATA_STORE_H
+#define GNSS_SDR_NAV_DATA_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Binary store of navigation data, intended to replace the Boost XML
+ * archives for the persistence of ephemeris, almanacs, UTC and ionospheric
+ * models.
+ *
+ * The file starts with a header (magic word, format version and byte order
+ * mark) followed by a sequence of records. Each record holds one object,
+ * identified by its type and, for per-satellite data, by its PRN, serialized
+ * with a Boost binary archive and protected by a CRC-32. New data is appended
+ * at the end of the file, and the last record of each object supersedes the
+ * previous ones. Appending an object identical to the stored one is a no-op,
+ * so the whole navigation state can be re-submitted at any time at the cost
+ * of the serialization and a few system calls. When the superseded records outnumber the live
+ * ones, the file is compacted by writing the live records to a temporary
+ * file and renaming it over the original one.
+ *
+ * load() memory-maps the file and only indexes the records, so it runs in
+ * well under a millisecond for a full constellation. Objects are
+ * deserialized from the mapped memory when requested.
+ *
+ * The format follows the host byte order and the layout of the Boost binary
+ * archives, so the files are meant to be used on the machine that wrote
+ * them. Files with a different version or byte order are ignored by load()
+ * and replaced on the next write.
+ *
+ * Several Nav_Data_Store objects, in the same or in different processes, can
+ * write to the same file. Each write takes an advisory lock (flock) on the
+ * file and, if another writer appended records or replaced the file since
+ * the last write, indexes the file again before appending.
+ *
+ * Supported types: Gps_Ephemeris, Gps_CNAV_Ephemeris, Galileo_Ephemeris,
+ * Glonass_Gnav_Ephemeris, Beidou_Dnav_Ephemeris, Gps_Almanac,
+ * Galileo_Almanac, Beidou_Dnav_Almanac, Gps_Utc_Model, Gps_CNAV_Utc_Model,
+ * Galileo_Utc_Model, Glonass_Gnav_Utc_Model, Beidou_Dnav_Utc_Model,
+ * Gps_Iono, Gps_CNAV_Iono, Galileo_Iono, Beidou_Dnav_Iono, Agnss_Ref_Time
+ * and Agnss_Ref_Location.
+ */
+class Nav_Data_Store
+{
+public:
+    explicit Nav_Data_Store(std::string file_name);
+    ~Nav_Data_Store();
+
+    Nav_Data_Store(const Nav_Data_Store&) = delete;
+    Nav_Data_Store& operator=(const Nav_Data_Store&) = delete;
+
+    /*!
+     * \brief Maps the file and indexes its records. Returns false if the
+     * file does not exist or it is not a valid store. A damaged tail (e.g.,
+     * after a crash in the middle of a write) is discarded.
+     */
+    bool load();
+
+    /*!
+     * \brief Appends an object to the store, unless it is identical to the
+     * stored one. The file is created if it does not exist. Returns false on
+     * I/O errors.
+     */
+    template <class T>
+    bool put(const T& nav_data);
+
+    /*!
+     * \brief Appends all the objects of a map. Returns false on I/O errors.
+     */
+    template <class T>
+    bool put(const std::map<int32_t, T>& nav_data_map);
+
+    /*!
+     * \brief Reads a model (UTC, iono, reference time or location). Returns
+     * false, leaving nav_data untouched, if the store does not hold it.
+     */
+    template <class T>
+    bool get(T& nav_data) const;
+
+    /*!
+     * \brief Replaces the contents of nav_data_map with all the per-satellite
+     * objects of a given type, indexed by PRN. Returns false, leaving
+     * nav_data_map untouched, if the store does not hold any of them.
+     */
+    template <class T>
+    bool get(std::map<int32_t, T>& nav_data_map) const;
+
+    /*!
+     * \brief Rewrites the file with the live records only
+     */
+    bool compact();
+
+    inline size_t live_records() const
+    {
+        return d_index.size();
+    }
+
+    inline size_t dead_records() const
+    {
+        return d_dead_records;
+    }
+
+    inline const std::string& file_name() const
+    {
+        return d_file_name;
+    }
+
+private:
+    using Record_Key = std::pair<uint16_t, int32_t>;  // type, PRN (0 for models)
+
+    struct Record_View
+    {
+        const char* data;
+        uint32_t size;
+    };
+
+    bool load_file();
+    bool lock_file();
+    void unlock_file();
+    void close_file();
+    bool append(const Record_Key& key, const std::string& payload);
+    bool rewrite();
+    bool write_file(const std::string& file_name) const;
+    void unmap();
+
+    std::map<Record_Key, Record_View> d_index;
+    std::deque<std::string> d_appended;  // payloads written after load(). A deque never moves its elements
+    std::string d_file_name;
+    mutable std::mutex d_mutex;
+    const char* d_map{nullptr};
+    size_t d_map_size{0};
+    size_t d_valid_size{0};  // bytes of the file holding valid records
+    size_t d_dead_records{0};
+    int d_fd{-1};
+    bool d_loaded{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_DATA_STORE_H
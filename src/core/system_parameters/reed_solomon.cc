@@ -0,0 +1,279 @@
+/*!
+ * \file reed_solomon.cc
+ * \brief Reed-Solomon erasure decoding over GF(2^8), as used by the Galileo
+ * High Accuracy Service
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "reed_solomon.h"
+#include <algorithm>  // for copy, min
+#if defined(__SSSE3__)
+#include <tmmintrin.h>  // for _mm_shuffle_epi8
+#endif
+
+
+#if defined(__SSSE3__)
+namespace
+{
+// Products of 16 symbols by the constant whose low and high nibble product
+// tables are given, looking up both nibbles of each symbol with pshufb
+inline __m128i mul_16(__m128i symbols, __m128i low_products, __m128i high_products)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i low = _mm_shuffle_epi8(low_products, _mm_and_si128(symbols, nibble_mask));
+    const __m128i high = _mm_shuffle_epi8(high_products, _mm_and_si128(_mm_srli_epi64(symbols, 4), nibble_mask));
+    return _mm_xor_si128(low, high);
+}
+}  // namespace
+#endif
+
+
+Reed_Solomon::Reed_Solomon(uint32_t n,
+    uint32_t k,
+    uint32_t gfpoly,
+    uint32_t fcr,
+    uint32_t prim) : d_n(n),
+                     d_k(k)
+{
+    // log / antilog tables. alpha_to is duplicated to skip the modulo 255
+    uint32_t sr = 1;
+    for (uint32_t i = 0; i < 255; i++)
+        {
+            d_alpha_to[i] = static_cast<uint8_t>(sr);
+            d_alpha_to[i + 255] = static_cast<uint8_t>(sr);
+            d_index_of[sr] = static_cast<uint8_t>(i);
+            sr <<= 1U;
+            if (sr & 0x100U)
+                {
+                    sr ^= gfpoly;
+                }
+        }
+    d_alpha_to[510] = d_alpha_to[0];
+    d_alpha_to[511] = d_alpha_to[1];
+    d_index_of[0] = 255;  // log(0) is undefined, never used
+
+    d_mul_table = std::vector<uint8_t>(256 * 256, 0);
+    for (uint32_t a = 1; a < 256; a++)
+        {
+            for (uint32_t b = 1; b < 256; b++)
+                {
+                    d_mul_table[(a << 8U) + b] = d_alpha_to[d_index_of[a] + d_index_of[b]];
+                }
+        }
+
+    // c * x = c * (x & 0x0F) + c * (x & 0xF0), so 16 + 16 products per constant
+    d_nibble_table = std::vector<uint8_t>(256 * 32, 0);
+    for (uint32_t c = 0; c < 256; c++)
+        {
+            for (uint32_t x = 0; x < 16; x++)
+                {
+                    d_nibble_table[(c << 5U) + x] = d_mul_table[(c << 8U) + x];
+                    d_nibble_table[(c << 5U) + 16 + x] = d_mul_table[(c << 8U) + (x << 4U)];
+                }
+        }
+
+    // Generator polynomial, g[j] is the coefficient of x^j
+    const uint32_t nroots = n - k;
+    std::vector<uint8_t> g(nroots + 1, 0);
+    g[0] = 1;
+    for (uint32_t i = 0; i < nroots; i++)
+        {
+            const uint8_t root = d_alpha_to[(prim * (fcr + i)) % 255];
+            // g(x) = g(x) * (x + root)
+            for (uint32_t j = i + 1; j > 0; j--)
+                {
+                    g[j] = g[j - 1] ^ mul(g[j], root);
+                }
+            g[0] = mul(g[0], root);
+        }
+
+    // Systematic generator matrix. Information symbol i is the coefficient
+    // of x^(n - 1 - i), and the parity symbols are the remainder of the
+    // division by g(x), so the parity row r for the information symbol i is
+    // the coefficient of x^(nroots - 1 - r) in x^(nroots + k - 1 - i) mod g(x)
+    d_generator_matrix = std::vector<uint8_t>(static_cast<std::size_t>(n) * k, 0);
+    for (uint32_t i = 0; i < k; i++)
+        {
+            d_generator_matrix[static_cast<std::size_t>(i) * k + i] = 1;
+        }
+    std::vector<uint8_t> rem(nroots, 0);
+    rem[0] = 1;  // x^0 mod g(x)
+    for (uint32_t e = 1; e < nroots + k; e++)
+        {
+            // rem = rem * x mod g(x)
+            const uint8_t carry = rem[nroots - 1];
+            for (uint32_t j = nroots - 1; j > 0; j--)
+                {
+                    rem[j] = rem[j - 1] ^ mul(carry, g[j]);
+                }
+            rem[0] = mul(carry, g[0]);
+            if (e >= nroots)
+                {
+                    const uint32_t i = nroots + k - 1 - e;
+                    for (uint32_t r = 0; r < nroots; r++)
+                        {
+                            d_generator_matrix[static_cast<std::size_t>(k + r) * k + i] = rem[nroots - 1 - r];
+                        }
+                }
+        }
+}
+
+
+std::vector<uint8_t> Reed_Solomon::encode(const std::vector<uint8_t>& information) const
+{
+    std::vector<uint8_t> codeword(d_n, 0);
+    for (uint32_t j = 0; j < d_n; j++)
+        {
+            const uint8_t* row = generator_row(j);
+            uint8_t symbol = 0;
+            for (uint32_t i = 0; i < d_k && i < information.size(); i++)
+                {
+                    symbol ^= mul(row[i], information[i]);
+                }
+            codeword[j] = symbol;
+        }
+    return codeword;
+}
+
+
+void Reed_Solomon::mul_add_region(uint8_t* dst, const uint8_t* src, uint8_t c, std::size_t length) const
+{
+    if (c == 0)
+        {
+            return;
+        }
+    if (c == 1)
+        {
+            for (std::size_t i = 0; i < length; i++)
+                {
+                    dst[i] ^= src[i];
+                }
+            return;
+        }
+    std::size_t i = 0;
+#if defined(__SSSE3__)
+    const uint8_t* nibble_products = &d_nibble_table[static_cast<std::size_t>(c) << 5U];
+    const __m128i low_products = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_products));
+    const __m128i high_products = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_products + 16));
+    for (; i + 16 <= length; i += 16)
+        {
+            const __m128i symbols = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(previous, mul_16(symbols, low_products, high_products)));
+        }
+#endif
+    const uint8_t* product = &d_mul_table[static_cast<std::size_t>(c) << 8U];
+    for (; i < length; i++)
+        {
+            dst[i] ^= product[src[i]];
+        }
+}
+
+
+void Reed_Solomon::mul_region(uint8_t* dst, uint8_t c, std::size_t length) const
+{
+    std::size_t i = 0;
+#if defined(__SSSE3__)
+    const uint8_t* nibble_products = &d_nibble_table[static_cast<std::size_t>(c) << 5U];
+    const __m128i low_products = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_products));
+    const __m128i high_products = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_products + 16));
+    for (; i + 16 <= length; i += 16)
+        {
+            const __m128i symbols = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), mul_16(symbols, low_products, high_products));
+        }
+#endif
+    const uint8_t* product = &d_mul_table[static_cast<std::size_t>(c) << 8U];
+    for (; i < length; i++)
+        {
+            dst[i] = product[dst[i]];
+        }
+}
+
+
+Reed_Solomon_Erasure_Decoder::Reed_Solomon_Erasure_Decoder(const Reed_Solomon& code,
+    uint32_t message_size,
+    uint32_t row_length) : d_code(&code),
+                           d_message_size(std::min(message_size, code.k())),
+                           d_row_length(row_length),
+                           d_rank(0)
+{
+    d_width = d_message_size + d_row_length;
+    d_rows = std::vector<uint8_t>(static_cast<std::size_t>(d_message_size) * d_width, 0);
+    d_scratch = std::vector<uint8_t>(d_width, 0);
+    d_pivot_row = std::vector<int32_t>(d_message_size, -1);
+}
+
+
+bool Reed_Solomon_Erasure_Decoder::add_row(uint32_t index, const uint8_t* row)
+{
+    if (is_complete() || index >= d_code->n())
+        {
+            return is_complete();
+        }
+
+    // The information vector is zero-padded, so only the first
+    // message_size columns of the generator matrix are needed
+    uint8_t* scratch = d_scratch.data();
+    const uint8_t* g = d_code->generator_row(index);
+    std::copy(g, g + d_message_size, scratch);
+    std::copy(row, row + d_row_length, scratch + d_message_size);
+
+    // Remove the columns already solved. The stored rows are fully reduced,
+    // so eliminating one column does not bring back the previous ones
+    for (uint32_t c = 0; c < d_message_size; c++)
+        {
+            if (scratch[c] != 0 && d_pivot_row[c] >= 0)
+                {
+                    d_code->mul_add_region(scratch, &d_rows[static_cast<std::size_t>(d_pivot_row[c]) * d_width], scratch[c], d_width);
+                }
+        }
+
+    uint32_t pivot = 0;
+    while (pivot < d_message_size && scratch[pivot] == 0)
+        {
+            pivot++;
+        }
+    if (pivot == d_message_size)
+        {
+            return false;  // repeated or linearly dependent row
+        }
+    d_code->mul_region(scratch, d_code->inv(scratch[pivot]), d_width);
+
+    // Keep the stored rows fully reduced
+    for (uint32_t r = 0; r < d_rank; r++)
+        {
+            uint8_t* stored = &d_rows[static_cast<std::size_t>(r) * d_width];
+            d_code->mul_add_region(stored, scratch, stored[pivot], d_width);
+        }
+    std::copy(scratch, scratch + d_width, &d_rows[static_cast<std::size_t>(d_rank) * d_width]);
+    d_pivot_row[pivot] = static_cast<int32_t>(d_rank);
+    d_rank++;
+    return is_complete();
+}
+
+
+std::vector<uint8_t> Reed_Solomon_Erasure_Decoder::get_message() const
+{
+    std::vector<uint8_t> message(static_cast<std::size_t>(d_message_size) * d_row_length, 0);
+    if (!is_complete())
+        {
+            return message;
+        }
+    for (uint32_t i = 0; i < d_message_size; i++)
+        {
+            const uint8_t* stored = &d_rows[static_cast<std::size_t>(d_pivot_row[i]) * d_width] + d_message_size;
+            std::copy(stored, stored + d_row_length, &message[static_cast<std::size_t>(i) * d_row_length]);
+        }
+    return message;
+}
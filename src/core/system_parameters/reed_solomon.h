@@ -0,0 +1,158 @@
+/*!
+ * \file reed_solomon.h
+ * \brief Reed-Solomon erasure decoding over GF(2^8), as used by the Galileo
+ * High Accuracy Service
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_REED_SOLOMON_H
+#define GNSS_SDR_REED_SOLOMON_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Systematic Reed-Solomon code RS(n, k) over GF(2^8).
+ *
+ * The code is defined by the field generator polynomial gfpoly and by the
+ * roots of its generator polynomial, alpha^(prim * (fcr + i)) for
+ * i = 0, ..., n - k - 1. Symbol j of a codeword is the scalar product of row j
+ * of the n x k generator matrix and the information vector, so the first k
+ * symbols are the information symbols themselves.
+ *
+ * Arithmetic uses log / antilog tables, and a full 256 x 256 product table
+ * for the multiply-and-add of whole rows, which is the inner loop of the
+ * decoder. If the build targets SSSE3, rows are multiplied 16 symbols at a
+ * time by looking up the products of their low and high nibbles with
+ * pshufb, and the product table only handles the tail of each row.
+ */
+class Reed_Solomon
+{
+public:
+    Reed_Solomon(uint32_t n, uint32_t k, uint32_t gfpoly, uint32_t fcr, uint32_t prim);
+
+    inline uint32_t n() const
+    {
+        return d_n;
+    }
+
+    inline uint32_t k() const
+    {
+        return d_k;
+    }
+
+    /*!
+     * \brief Row of the generator matrix for the codeword symbol index
+     * (0 <= index < n), with k elements.
+     */
+    inline const uint8_t* generator_row(uint32_t index) const
+    {
+        return &d_generator_matrix[static_cast<std::size_t>(index) * d_k];
+    }
+
+    /*!
+     * \brief Encodes a k-symbol information vector into an n-symbol codeword
+     */
+    std::vector<uint8_t> encode(const std::vector<uint8_t>& information) const;
+
+    inline uint8_t mul(uint8_t a, uint8_t b) const
+    {
+        return d_mul_table[(static_cast<std::size_t>(a) << 8) + b];
+    }
+
+    inline uint8_t inv(uint8_t a) const
+    {
+        return d_alpha_to[255 - d_index_of[a]];
+    }
+
+    /*!
+     * \brief dst[i] ^= c * src[i], for i = 0, ..., length - 1
+     */
+    void mul_add_region(uint8_t* dst, const uint8_t* src, uint8_t c, std::size_t length) const;
+
+    /*!
+     * \brief dst[i] = c * dst[i], for i = 0, ..., length - 1
+     */
+    void mul_region(uint8_t* dst, uint8_t c, std::size_t length) const;
+
+private:
+    std::vector<uint8_t> d_generator_matrix;
+    std::vector<uint8_t> d_mul_table;
+    std::vector<uint8_t> d_nibble_table;  // for each constant, products of x and of (x << 4), x < 16
+    std::array<uint8_t, 512> d_alpha_to{};
+    std::array<uint8_t, 256> d_index_of{};
+    uint32_t d_n;
+    uint32_t d_k;
+};
+
+
+/*!
+ * \brief Incremental erasure decoder of a Reed_Solomon code.
+ *
+ * A message of message_size rows of row_length symbols is encoded column by
+ * column, padding each column with zeros up to the k information symbols.
+ * The decoder receives the encoded rows (each one with its codeword index)
+ * in any order, and reduces them on arrival with Gauss-Jordan elimination,
+ * so the message is available right after the message_size-th linearly
+ * independent row is added, without a final decoding step.
+ */
+class Reed_Solomon_Erasure_Decoder
+{
+public:
+    Reed_Solomon_Erasure_Decoder(const Reed_Solomon& code, uint32_t message_size, uint32_t row_length);
+
+    /*!
+     * \brief Adds the encoded row with codeword symbol index (0 <= index < n).
+     * Returns true if the message is complete.
+     */
+    bool add_row(uint32_t index, const uint8_t* row);
+
+    inline bool is_complete() const
+    {
+        return d_rank == d_message_size;
+    }
+
+    inline uint32_t message_size() const
+    {
+        return d_message_size;
+    }
+
+    /*!
+     * \brief Decoded message, row after row. Only valid if is_complete()
+     */
+    std::vector<uint8_t> get_message() const;
+
+private:
+    const Reed_Solomon* d_code;
+    // Each stored row holds message_size coefficients followed by row_length data symbols
+    std::vector<uint8_t> d_rows;
+    std::vector<uint8_t> d_scratch;
+    std::vector<int32_t> d_pivot_row;  // stored row with its pivot in each column, or -1
+    uint32_t d_message_size;
+    uint32_t d_row_length;
+    uint32_t d_width;
+    uint32_t d_rank;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_REED_SOLOMON_H
@@ -25,9 +25,11 @@
 #define GOOGLE_STRIP_LOG 0
 #endif
 
+#include "batch_runner.h"
 #include "concurrent_map.h"
 #include "concurrent_queue.h"
 #include "control_thread.h"
+#include "gnss_sdr_flags.h"
 #include "gnss_sdr_make_unique.h"
 #include "gps_acq_assist.h"
 #include <boost/exception/diagnostic_information.hpp>  // for diagnostic_information
@@ -40,6 +42,8 @@
 #include <iostream>                                    // for operator<<
 #include <memory>                                      // for unique_ptr
 #include <string>                                      // for string
+#include <utility>                                     // for move
+#include <vector>                                      // for vector
 
 #if CUDA_GPU_ACCEL
 // For the CUDA runtime routines (prefixed with "cuda_")
@@ -144,10 +148,46 @@ int main(int argc, char** argv)
     int return_code = 0;
     try
         {
-            auto control_thread = std::make_unique<ControlThread>();
-            // record startup time
-            start = std::chrono::system_clock::now();
-            return_code = control_thread->run();
+            if (!FLAGS_batch_file.empty())
+                {
+                    // several receivers, one gnss-sdr process per job
+                    auto jobs = BatchRunner::read_job_list(FLAGS_batch_file);
+                    if (jobs.empty())
+                        {
+                            std::cerr << "No jobs found in " << FLAGS_batch_file << ". GNSS-SDR program ended.\n";
+                            gflags::ShutDownCommandLineFlags();
+                            return 1;
+                        }
+                    if (FLAGS_s != "-" or FLAGS_signal_source != "-")
+                        {
+                            std::cout << "Warning: the signal source flag overrides the capture files of all the batch jobs.\n";
+                        }
+                    // Each job runs a new receiver process, which is given
+                    // these flags in addition to its configuration file
+                    std::vector<std::string> receiver_flags;
+                    if (!FLAGS_log_dir.empty())
+                        {
+                            receiver_flags.push_back("--log_dir=" + fs::absolute(FLAGS_log_dir).string());
+                        }
+                    if (FLAGS_signal_source != "-")
+                        {
+                            receiver_flags.push_back("--signal_source=" + fs::absolute(FLAGS_signal_source).string());
+                        }
+                    if (FLAGS_s != "-")
+                        {
+                            receiver_flags.push_back("--s=" + fs::absolute(FLAGS_s).string());
+                        }
+                    auto batch_runner = std::make_unique<BatchRunner>(std::move(jobs), FLAGS_batch_jobs, FLAGS_batch_cpu_budget, argv[0], std::move(receiver_flags));
+                    start = std::chrono::system_clock::now();
+                    return_code = batch_runner->run();
+                }
+            else
+                {
+                    auto control_thread = std::make_unique<ControlThread>();
+                    // record startup time
+                    start = std::chrono::system_clock::now();
+                    return_code = control_thread->run();
+                }
         }
     catch (const boost::thread_resource_error& e)
         {
@@ -0,0 +1,328 @@
+/*!
+ * \file benchmark_receiver.cc
+ * \brief End-to-end throughput benchmark of receiver flowgraphs
+ * \author agent, 2026. agent(at)local
+ *
+ * Instantiates complete GNSSFlowgraph pipelines, fed by a synthetic GPS L1 C/A
+ * scenario or by the recorded signal of a configuration file, and measures
+ * the processed samples per second, the real-time factor and the share of
+ * work() time of each receiver stage, for several numbers of channels and
+ * sample types. Also measures the cost of a single correlation step.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "MATH_CONSTANTS.h"
+#include "channel_event.h"
+#include "command_event.h"
+#include "concurrent_queue.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "file_configuration.h"
+#include "gnss_flowgraph.h"
+#include "gnss_signal_synthesizer.h"
+#include "gps_sdr_signal_replica.h"
+#include "in_memory_configuration.h"
+#include <benchmark/benchmark.h>
+#include <boost/any.hpp>
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <pmt/pmt.h>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <cstdio>   // for std::remove
+#include <cstdlib>  // for setenv
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>  // for typeid
+#include <vector>
+
+DEFINE_string(receiver_config, "", "Configuration file of a receiver fed by a recorded signal. If set, it is benchmarked as is. It must set SignalSource.samples.");
+DEFINE_double(receiver_signal_s, 2.0, "Duration of the synthetic signal processed in each iteration [s].");
+
+namespace
+{
+constexpr double BENCHMARK_FS_HZ = 4e6;
+const std::array<std::string, 3> BENCHMARK_ITEM_TYPES{"cbyte", "cshort", "gr_complex"};
+std::vector<std::string> generated_files;
+
+
+// Writes (once) the synthetic scenario as interleaved I/Q samples of item_type
+std::string synthetic_signal_file(const std::string& item_type, uint64_t num_samples)
+{
+    const std::string filename = "./benchmark_receiver_" + item_type + ".dat";
+    for (const auto& file : generated_files)
+        {
+            if (file == filename)
+                {
+                    return filename;
+                }
+        }
+    Gnss_Scenario scenario;
+    scenario.fs_hz = BENCHMARK_FS_HZ;
+    scenario.seed = 1;
+    const std::array<double, 8> doppler_Hz{1250.0, -2300.0, 3100.0, -450.0, 800.0, -3600.0, 2050.0, -1500.0};
+    for (uint32_t prn = 1; prn <= doppler_Hz.size(); prn++)
+        {
+            Gnss_Scenario_Satellite sat;
+            sat.PRN = prn;
+            sat.CN0_dB_Hz = 45.0;
+            sat.doppler_Hz = doppler_Hz[prn - 1];
+            sat.code_phase_chips = 120.5 * static_cast<double>(prn);
+            scenario.satellites.push_back(sat);
+        }
+    Gnss_Signal_Synthesizer synthesizer(scenario);
+    const float gain = (item_type == "cshort") ? 2048.0F : ((item_type == "cbyte") ? 20.0F : 1.0F);
+    if (!synthesizer.write_samples(filename, item_type, num_samples, gain))
+        {
+            return std::string();
+        }
+    generated_files.push_back(filename);
+    return filename;
+}
+
+
+std::shared_ptr<ConfigurationInterface> synthetic_configuration(const std::string& item_type,
+    const std::string& filename,
+    uint64_t num_samples,
+    int64_t channels)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(static_cast<int64_t>(BENCHMARK_FS_HZ)));
+    config->set_property("SignalSource.implementation", "File_Signal_Source");
+    config->set_property("SignalSource.filename", filename);
+    config->set_property("SignalSource.sampling_frequency", std::to_string(static_cast<int64_t>(BENCHMARK_FS_HZ)));
+    config->set_property("SignalSource.samples", std::to_string(num_samples));
+    if (item_type == "gr_complex")
+        {
+            config->set_property("SignalSource.item_type", "gr_complex");
+            config->set_property("SignalConditioner.implementation", "Pass_Through");
+        }
+    else
+        {
+            // Interleaved I/Q files, converted to gr_complex as in the sample configurations
+            config->set_property("SignalSource.item_type", item_type == "cbyte" ? "ibyte" : "ishort");
+            config->set_property("SignalConditioner.implementation", "Signal_Conditioner");
+            config->set_property("DataTypeAdapter.implementation", item_type == "cbyte" ? "Ibyte_To_Complex" : "Ishort_To_Complex");
+            config->set_property("InputFilter.implementation", "Pass_Through");
+            config->set_property("InputFilter.item_type", "gr_complex");
+            config->set_property("Resampler.implementation", "Pass_Through");
+            config->set_property("Resampler.item_type", "gr_complex");
+        }
+    config->set_property("Channels_1C.count", std::to_string(channels));
+    config->set_property("Channels.in_acquisition", "1");
+    config->set_property("Channel.signal", "1C");
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.item_type", "gr_complex");
+    config->set_property("Acquisition_1C.pfa", "0.01");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Acquisition_1C.doppler_step", "250");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("Tracking_1C.item_type", "gr_complex");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+    config->set_property("PVT.output_enabled", "false");
+    return config;
+}
+
+
+// Dispatches the control messages, as ControlThread does, until the source sends the stop command
+void process_control_messages(const std::shared_ptr<GNSSFlowgraph>& flowgraph,
+    const std::shared_ptr<Concurrent_Queue<pmt::pmt_t>>& queue)
+{
+    const size_t channel_event_type_hash_code = typeid(channel_event_sptr).hash_code();
+    const size_t command_event_type_hash_code = typeid(command_event_sptr).hash_code();
+    while (flowgraph->running())
+        {
+            pmt::pmt_t msg;
+            if (!queue->timed_wait_and_pop(msg, 100))
+                {
+                    flowgraph->acquisition_manager(0);
+                    continue;
+                }
+            const size_t msg_type_hash_code = pmt::any_ref(msg).type().hash_code();
+            if (msg_type_hash_code == channel_event_type_hash_code)
+                {
+                    const auto new_event = boost::any_cast<channel_event_sptr>(pmt::any_ref(msg));
+                    flowgraph->apply_action(new_event->channel_id, new_event->event_type);
+                }
+            else if (msg_type_hash_code == command_event_type_hash_code)
+                {
+                    const auto new_event = boost::any_cast<command_event_sptr>(pmt::any_ref(msg));
+                    if (new_event->command_id == 200)
+                        {
+                            return;
+                        }
+                }
+        }
+}
+
+
+void run_receiver(benchmark::State& state,
+    const std::shared_ptr<ConfigurationInterface>& config,
+    uint64_t num_samples,
+    double fs_hz)
+{
+    std::map<std::string, double> work_time;
+    while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+            auto flowgraph = std::make_shared<GNSSFlowgraph>(config, queue);
+            flowgraph->connect();
+            if (!flowgraph->connected())
+                {
+                    state.ResumeTiming();
+                    state.SkipWithError("Unable to connect the flowgraph");
+                    break;
+                }
+            state.ResumeTiming();
+
+            flowgraph->start();
+            process_control_messages(flowgraph, queue);
+            const auto stage_time = flowgraph->stage_work_time();
+            flowgraph->stop();
+
+            state.PauseTiming();
+            for (const auto& stage : stage_time)
+                {
+                    work_time[stage.first] += stage.second;
+                }
+            flowgraph->disconnect();
+            state.ResumeTiming();
+        }
+
+    const auto processed_samples = static_cast<double>(state.iterations() * num_samples);
+    state.counters["samples_per_second"] = benchmark::Counter(processed_samples, benchmark::Counter::kIsRate);
+    state.counters["realtime_factor"] = benchmark::Counter(processed_samples / fs_hz, benchmark::Counter::kIsRate);
+    double total_time = 0.0;
+    for (const auto& stage : work_time)
+        {
+            total_time += stage.second;
+        }
+    for (const auto& stage : work_time)
+        {
+            // Zero unless GNU Radio was built with performance counters
+            state.counters["cpu_share_" + stage.first] = total_time > 0.0 ? stage.second / total_time : 0.0;
+        }
+}
+}  // namespace
+
+
+// Synthetic scenario: state.range(0) channels, sample type BENCHMARK_ITEM_TYPES[state.range(1)]
+void bm_receiver(benchmark::State& state)
+{
+    const std::string item_type = BENCHMARK_ITEM_TYPES.at(state.range(1));
+    const auto num_samples = static_cast<uint64_t>(FLAGS_receiver_signal_s * BENCHMARK_FS_HZ);
+    const std::string filename = synthetic_signal_file(item_type, num_samples);
+    if (filename.empty())
+        {
+            state.SkipWithError("Unable to write the synthetic signal file");
+            return;
+        }
+    state.SetLabel(item_type);
+    state.counters["channels"] = static_cast<double>(state.range(0));
+    run_receiver(state, synthetic_configuration(item_type, filename, num_samples, state.range(0)), num_samples, BENCHMARK_FS_HZ);
+}
+
+
+// Recorded signal described by --receiver_config
+void bm_receiver_config(benchmark::State& state)
+{
+    if (FLAGS_receiver_config.empty())
+        {
+            state.SkipWithError("Set --receiver_config to benchmark a recorded signal");
+            return;
+        }
+    auto config = std::make_shared<FileConfiguration>(FLAGS_receiver_config);
+    const auto num_samples = config->property("SignalSource.samples", static_cast<uint64_t>(0));
+    const auto fs_hz = config->property("GNSS-SDR.internal_fs_sps", 0.0);
+    if (num_samples == 0 or fs_hz <= 0.0)
+        {
+            state.SkipWithError("The configuration must set SignalSource.samples and GNSS-SDR.internal_fs_sps");
+            return;
+        }
+    state.SetLabel(FLAGS_receiver_config);
+    run_receiver(state, config, num_samples, fs_hz);
+}
+
+
+// One integration of a GPS L1 C/A tracking channel with state.range(0) correlators
+void bm_correlation_step(benchmark::State& state)
+{
+    const int n_correlators = static_cast<int>(state.range(0));
+    const auto samples = static_cast<int>(BENCHMARK_FS_HZ * GPS_L1_CA_CODE_PERIOD_S);
+    std::vector<float> code(static_cast<size_t>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    gps_l1_ca_code_gen_float(code, 1, 0);
+    std::vector<float> shifts_chips(n_correlators);
+    for (int i = 0; i < n_correlators; i++)
+        {
+            shifts_chips[i] = 0.5F * static_cast<float>(i - n_correlators / 2);
+        }
+    std::vector<std::complex<float>> input(samples, std::complex<float>(0.5, -0.5));
+    std::vector<std::complex<float>> output(n_correlators);
+
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.init(samples, n_correlators);
+    correlator.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), code.data(), shifts_chips.data());
+    correlator.set_input_output_vectors(output.data(), input.data());
+    const auto code_phase_step_chips = static_cast<float>(GPS_L1_CA_CODE_RATE_CPS / BENCHMARK_FS_HZ);
+    const auto phase_step_rad = static_cast<float>(TWO_PI * 1250.0 / BENCHMARK_FS_HZ);
+
+    while (state.KeepRunning())
+        {
+            correlator.Carrier_wipeoff_multicorrelator_resampler(0.3F, phase_step_rad, 0.0F, 0.25F, code_phase_step_chips, 0.0F, samples);
+            benchmark::DoNotOptimize(output.data());
+        }
+    correlator.free();
+    state.counters["samples_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * samples), benchmark::Counter::kIsRate);
+}
+
+
+void receiver_arguments(benchmark::internal::Benchmark* b)
+{
+    for (int64_t channels : {8, 16, 32, 64, 128})
+        {
+            for (int64_t item_type = 0; item_type < static_cast<int64_t>(BENCHMARK_ITEM_TYPES.size()); item_type++)
+                {
+                    b->Args({channels, item_type});
+                }
+        }
+}
+
+
+BENCHMARK(bm_receiver)
+    ->Apply(receiver_arguments)
+    ->ArgNames({"channels", "item_type"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(bm_receiver_config)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_correlation_step)->Arg(3)->Arg(5)->ArgName("correlators")->Unit(benchmark::kMicrosecond);
+
+
+int main(int argc, char** argv)
+{
+    // Per-block work times are only collected with the performance counters on
+    setenv("GR_CONF_PERFCOUNTERS_ON", "True", 0);
+    benchmark::Initialize(&argc, argv);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+    benchmark::RunSpecifiedBenchmarks();
+    for (const auto& file : generated_files)
+        {
+            std::remove(file.c_str());
+        }
+    gflags::ShutDownCommandLineFlags();
+    return 0;
+}
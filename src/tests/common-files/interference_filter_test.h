@@ -0,0 +1,333 @@
+/*!
+ * \file interference_filter_test.h
+ * \brief Helper file for the unit tests of the pulse blanking and notch filters
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_INTERFERENCE_FILTER_TEST_H
+#define GNSS_SDR_INTERFERENCE_FILTER_TEST_H
+
+#include "gnss_block_interface.h"
+#include "gnss_sdr_make_unique.h"
+#include <boost/math/distributions/chi_squared.hpp>
+#include <gnuradio/fft/fft.h>
+#include <gnuradio/gr_complex.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_sink_s.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+
+// Test signal: noise, and a CW interference in its second half
+constexpr int32_t INTERFERENCE_TEST_SAMPLES = 200000;
+constexpr int32_t INTERFERENCE_TEST_CW_START = 100000;
+constexpr float INTERFERENCE_TEST_CW_AMPLITUDE = 8000.0;
+
+// Segments for the noise power estimation, shorter than the default so that
+// the detection starts long before the interference
+constexpr int32_t INTERFERENCE_TEST_SEGMENTS_EST = 1000;
+
+
+/*!
+ * \brief Gaussian noise with a standard deviation of 100 per component, and
+ * the CW interference from INTERFERENCE_TEST_CW_START on. The samples are
+ * rounded, so that the same signal is represented exactly as cshort.
+ */
+inline std::vector<gr_complex> make_cw_interference_signal()
+{
+    std::vector<gr_complex> samples(INTERFERENCE_TEST_SAMPLES);
+    std::mt19937 gen(1);
+    std::normal_distribution<float> noise(0.0, 100.0);
+    for (int32_t i = 0; i < INTERFERENCE_TEST_SAMPLES; i++)
+        {
+            const float i_sample = noise(gen);
+            const float q_sample = noise(gen);
+            gr_complex sample(i_sample, q_sample);
+            if (i >= INTERFERENCE_TEST_CW_START)
+                {
+                    sample += INTERFERENCE_TEST_CW_AMPLITUDE * std::exp(gr_complex(0.0, 0.3F * static_cast<float>(i)));
+                }
+            samples[i] = gr_complex(std::round(sample.real()), std::round(sample.imag()));
+        }
+    return samples;
+}
+
+
+/*!
+ * \brief Interleaved int16_t I/Q samples
+ */
+inline std::vector<int16_t> to_cshort(const std::vector<gr_complex>& samples)
+{
+    std::vector<int16_t> interleaved(2 * samples.size());
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            interleaved[2 * i] = static_cast<int16_t>(samples[i].real());
+            interleaved[2 * i + 1] = static_cast<int16_t>(samples[i].imag());
+        }
+    return interleaved;
+}
+
+
+inline std::vector<gr_complex> to_gr_complex(const std::vector<int16_t>& interleaved)
+{
+    std::vector<gr_complex> samples(interleaved.size() / 2);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = gr_complex(interleaved[2 * i], interleaved[2 * i + 1]);
+        }
+    return samples;
+}
+
+
+/*!
+ * \brief Filters samples until the end of the stream, and returns the output
+ */
+inline std::vector<gr_complex> run_interference_filter(GNSSBlockInterface* filter, const std::vector<gr_complex>& samples)
+{
+    auto top_block = gr::make_top_block("Interference filter test");
+    auto source = gr::blocks::vector_source_c::make(samples, false);
+    auto sink = gr::blocks::vector_sink_c::make();
+    filter->connect(top_block);
+    top_block->connect(source, 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+/*!
+ * \brief Filters interleaved int16_t I/Q samples until the end of the
+ * stream, and returns the output
+ */
+inline std::vector<int16_t> run_interference_filter(GNSSBlockInterface* filter, const std::vector<int16_t>& samples)
+{
+    auto top_block = gr::make_top_block("Interference filter test");
+    auto source = gr::blocks::vector_source_s::make(samples, false, 2);
+    auto sink = gr::blocks::vector_sink_s::make(2);
+    filter->connect(top_block);
+    top_block->connect(source, 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+/*!
+ * \brief Reference implementation of pulse_blanking_cc, as it was before the
+ * detector was shared with the notch filters and the cshort variants were
+ * added. Returns the output for all the complete segments of the input.
+ */
+inline std::vector<gr_complex> reference_pulse_blanking(const std::vector<gr_complex>& in,
+    float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset)
+{
+    const int32_t n_deg_fred = 2 * length;
+    boost::math::chi_squared_distribution<float> my_dist(n_deg_fred);
+    const float thres = boost::math::quantile(boost::math::complement(my_dist, pfa));
+    volk_gnsssdr::vector<float> magnitude(in.size());
+    volk_32fc_magnitude_squared_32f(magnitude.data(), in.data(), in.size());
+    std::vector<gr_complex> out;
+    float noise_power_estimation = 0.0;
+    int32_t n_segments = 0;
+    bool last_filtered = false;
+    for (int32_t sample_index = 0; (sample_index + length) < static_cast<int32_t>(in.size()); sample_index += length)
+        {
+            float segment_energy;
+            volk_32f_accumulator_s32f(&segment_energy, magnitude.data() + sample_index, length);
+            if ((n_segments < n_segments_est) && (last_filtered == false))
+                {
+                    noise_power_estimation = (static_cast<float>(n_segments) * noise_power_estimation + segment_energy / static_cast<float>(n_deg_fred)) / static_cast<float>(n_segments + 1);
+                }
+            else
+                {
+                    last_filtered = (segment_energy / noise_power_estimation) > thres;
+                    if (!last_filtered && (n_segments > n_segments_reset))
+                        {
+                            n_segments = 0;
+                        }
+                }
+            for (int32_t i = 0; i < length; i++)
+                {
+                    out.push_back(last_filtered ? gr_complex(0.0, 0.0) : in[sample_index + i]);
+                }
+            n_segments++;
+        }
+    return out;
+}
+
+
+/*!
+ * \brief Reference implementation of Notch (n_segments_coeff = 0, one
+ * coefficient per sample) and NotchLite (one coefficient every
+ * n_segments_coeff segments), as they were before the detector was shared
+ * and the cshort variants were added. If history is false, as in Notch, the
+ * first input sample is only used as the one before the first segment.
+ */
+inline std::vector<gr_complex> reference_notch(const std::vector<gr_complex>& in, bool history,
+    float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset,
+    int32_t n_segments_coeff)
+{
+    std::vector<gr_complex> x;
+    if (history)
+        {
+            x.emplace_back(0.0, 0.0);
+        }
+    x.insert(x.end(), in.cbegin(), in.cend());
+    const int32_t n_deg_fred = 2 * length;
+    boost::math::chi_squared_distribution<float> my_dist(n_deg_fred);
+    const float thres = boost::math::quantile(boost::math::complement(my_dist, pfa));
+#if GNURADIO_FFT_USES_TEMPLATES
+    auto fft = std::make_unique<gr::fft::fft_complex_fwd>(length);
+#else
+    auto fft = std::make_unique<gr::fft::fft_complex>(length, true);
+#endif
+    volk_gnsssdr::vector<float> power_spect(length);
+    volk_gnsssdr::vector<gr_complex> c_samples(length);
+    volk_gnsssdr::vector<float> angle(length);
+    const gr_complex p_c(p_c_factor, 0.0);
+    gr_complex z_0(0.0, 0.0);
+    gr_complex last_out(0.0, 0.0);
+    float noise_pow_est = 0.0;
+    int32_t n_segments = 0;
+    int32_t n_segments_coeff_count = 0;
+    bool filter_state = false;
+    std::vector<gr_complex> out;
+    for (int32_t index = 0; (index + length) < static_cast<int32_t>(in.size()); index += length)
+        {
+            const gr_complex* segment = x.data() + index + 1;
+            if ((n_segments < n_segments_est) && (filter_state == false))
+                {
+                    float sig2dB = 0.0;
+                    memcpy(fft->get_inbuf(), segment, sizeof(gr_complex) * length);
+                    fft->execute();
+                    volk_32fc_s32f_power_spectrum_32f(power_spect.data(), fft->get_outbuf(), 1.0, length);
+                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect.data(), 15.0, length);
+                    const float sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / static_cast<float>(n_deg_fred);
+                    noise_pow_est = (static_cast<float>(n_segments) * noise_pow_est + sig2lin) / static_cast<float>(n_segments + 1);
+                    out.insert(out.end(), segment, segment + length);
+                }
+            else
+                {
+                    lv_32fc_t dot_prod;
+                    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod, segment, segment, length);
+                    if ((lv_creal(dot_prod) / noise_pow_est) > thres)
+                        {
+                            if (filter_state == false)
+                                {
+                                    filter_state = true;
+                                    last_out = gr_complex(0.0, 0.0);
+                                    n_segments_coeff_count = 0;
+                                }
+                            if (n_segments_coeff == 0)
+                                {
+                                    volk_32fc_x2_multiply_conjugate_32fc(c_samples.data(), segment, segment - 1, length);
+                                    volk_32fc_s32f_atan2_32f(angle.data(), c_samples.data(), 1.0, length);
+                                }
+                            else if (n_segments_coeff_count == 0)
+                                {
+                                    gr_complex c_samples1;
+                                    gr_complex c_samples2;
+                                    float angle1;
+                                    float angle2;
+                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples1, segment + 1, segment, 1);
+                                    volk_32fc_s32f_atan2_32f(&angle1, &c_samples1, 1.0, 1);
+                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples2, segment + length - 1, segment + length - 2, 1);
+                                    volk_32fc_s32f_atan2_32f(&angle2, &c_samples2, 1.0, 1);
+                                    z_0 = std::exp(gr_complex(0.0, 1.0) * ((angle1 + angle2) / 2.0F));
+                                }
+                            for (int32_t aux = 0; aux < length; aux++)
+                                {
+                                    if (n_segments_coeff == 0)
+                                        {
+                                            z_0 = std::exp(gr_complex(0.0, 1.0) * angle[aux]);
+                                        }
+                                    last_out = segment[aux] - z_0 * segment[aux - 1] + p_c * z_0 * last_out;
+                                    out.push_back(last_out);
+                                }
+                            if (n_segments_coeff > 0)
+                                {
+                                    n_segments_coeff_count = (n_segments_coeff_count + 1) % n_segments_coeff;
+                                }
+                        }
+                    else
+                        {
+                            if (n_segments > n_segments_reset)
+                                {
+                                    n_segments = 0;
+                                }
+                            filter_state = false;
+                            out.insert(out.end(), segment, segment + length);
+                        }
+                }
+            n_segments++;
+        }
+    return out;
+}
+
+
+/*!
+ * \brief Checks that the filter does not wipe out the noise, suppresses the CW
+ * interference to less than max_cw_power_ratio of its input power, and
+ * matches the reference implementation within tolerance (zero for
+ * bit-identical outputs)
+ */
+inline void check_interference_filter_output(const std::vector<gr_complex>& input,
+    const std::vector<gr_complex>& output,
+    const std::vector<gr_complex>& reference,
+    float max_cw_power_ratio,
+    float tolerance)
+{
+    ASSERT_EQ(output.size(), reference.size());
+    ASSERT_GT(output.size(), input.size() - 64);
+
+    const auto mean_power = [](const std::vector<gr_complex>& samples, size_t first, size_t last) {
+        double power = 0.0;
+        for (size_t i = first; i < last; i++)
+            {
+                power += std::norm(samples[i]);
+            }
+        return power / static_cast<double>(last - first);
+    };
+    // Segments of 32 samples, well after the noise power estimation
+    const size_t noise_start = 2 * 32 * INTERFERENCE_TEST_SEGMENTS_EST;
+    const size_t cw_start = INTERFERENCE_TEST_CW_START + 64;
+    // The notch filters also remove part of the noise in the segments that
+    // are false alarms of the detector
+    EXPECT_GT(mean_power(output, noise_start, INTERFERENCE_TEST_CW_START), 0.25 * mean_power(input, noise_start, INTERFERENCE_TEST_CW_START));
+    EXPECT_LT(mean_power(output, cw_start, output.size()), max_cw_power_ratio * mean_power(input, cw_start, output.size()));
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < output.size(); i++)
+        {
+            if (std::abs(output[i].real() - reference[i].real()) > tolerance || std::abs(output[i].imag() - reference[i].imag()) > tolerance)
+                {
+                    mismatches++;
+                }
+        }
+    EXPECT_EQ(mismatches, 0U);
+}
+
+#endif  // GNSS_SDR_INTERFERENCE_FILTER_TEST_H
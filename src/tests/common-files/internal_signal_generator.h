@@ -0,0 +1,67 @@
+/*!
+ * \file internal_signal_generator.h
+ * \brief Helper file for unit testing with the built-in signal synthesizer
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_INTERNAL_SIGNAL_GENERATOR_H
+#define GNSS_SDR_INTERNAL_SIGNAL_GENERATOR_H
+
+#include "gnss_signal_synthesizer.h"
+#include "signal_generator_flags.h"
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+/*!
+ * \brief Writes the same files as generator_binary for a single satellite:
+ * int8_t I/Q samples in signal_file, and its true observables (every
+ * millisecond) in ./gps_l1_ca_obs_prn<PRN>.dat. Each call draws a new noise
+ * realization.
+ */
+inline bool generate_internal_signal(char system, const std::string& signal, uint32_t PRN,
+    double CN0_dBHz, double fs_hz, double duration_s, const std::string& signal_file)
+{
+    Gnss_Scenario scenario;
+    scenario.fs_hz = fs_hz;
+    scenario.noise_flag = true;
+    scenario.data_flag = true;
+    scenario.seed = std::random_device()();
+    Gnss_Scenario_Satellite sat;
+    sat.system = std::string(1, system);
+    sat.signal = signal;
+    sat.PRN = PRN;
+    sat.CN0_dB_Hz = CN0_dBHz;
+    sat.doppler_Hz = FLAGS_internal_generator_doppler_Hz;
+    sat.doppler_rate_Hz_s = FLAGS_internal_generator_doppler_rate_Hz_s;
+    sat.code_phase_chips = FLAGS_internal_generator_delay_chips;
+    scenario.satellites.push_back(sat);
+    try
+        {
+            Gnss_Signal_Synthesizer synthesizer(scenario, FLAGS_internal_generator_threads);
+            const auto num_samples = static_cast<uint64_t>(std::round(fs_hz * duration_s));
+            // Noise standard deviation of ~14 units per component, far from saturation
+            return synthesizer.write_samples(signal_file, "ibyte", num_samples, 20.0) &&
+                   synthesizer.write_true_observables("./gps_l1_ca_obs_prn" + std::to_string(PRN) + ".dat", 0, duration_s, 0.001);
+        }
+    catch (const std::invalid_argument& e)
+        {
+            std::cerr << e.what() << '\n';
+            return false;
+        }
+}
+
+#endif  // GNSS_SDR_INTERNAL_SIGNAL_GENERATOR_H
@@ -34,5 +34,10 @@ DEFINE_int32(test_satellite_PRN, 1, "PRN of the satellite under test (must be vi
 DEFINE_int32(test_satellite_PRN2, 2, "PRN of the satellite under test (must be visible during the observation time)");
 DEFINE_string(test_satellite_PRN_list, "1,2,3,6,9,10,12,17,20,23,28", "List of PRN of the satellites under test (must be visible during the observation time)");
 DEFINE_double(CN0_dBHz, std::numeric_limits<double>::infinity(), "Enable noise generator and set the CN0 [dB-Hz]");
+DEFINE_bool(internal_generator, false, "Synthesize the signal of the satellite under test with the built-in generator instead of generator_binary");
+DEFINE_double(internal_generator_doppler_Hz, 1250.0, "Initial Doppler of the satellite synthesized by the built-in generator [Hz]");
+DEFINE_double(internal_generator_doppler_rate_Hz_s, -0.5, "Doppler rate of the satellite synthesized by the built-in generator [Hz/s]");
+DEFINE_double(internal_generator_delay_chips, 300.25, "Initial code phase of the satellite synthesized by the built-in generator [chips]");
+DEFINE_int32(internal_generator_threads, 0, "Number of threads of the built-in generator (0: all the hardware threads)");
 
 #endif
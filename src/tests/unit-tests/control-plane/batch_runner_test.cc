@@ -0,0 +1,187 @@
+/*!
+ * \file batch_runner_test.cc
+ * \brief Tests for the batch post-processing mode
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_runner.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+class BatchRunnerTest : public ::testing::Test
+{
+protected:
+    BatchRunnerTest()
+    {
+        std::ofstream config(config_file);
+        config << "[GNSS-SDR]\n"
+               << "GNSS-SDR.internal_fs_sps=4000000\n"
+               << "SignalSource.implementation=File_Signal_Source\n"
+               << "SignalSource.item_type=gr_complex\n"
+               << "SignalSource.sampling_frequency=4000000\n"
+               << "PVT.rtcm_tcp_port=2200\n";
+    }
+
+    ~BatchRunnerTest() override
+    {
+        std::remove(config_file.c_str());
+        std::remove(receiver.c_str());
+    }
+
+    // Writes a receiver program that runs the given shell commands
+    void write_receiver(const std::string& commands)
+    {
+        std::ofstream script(receiver);
+        script << "#!/bin/sh\n"
+               << commands << '\n';
+        script.close();
+        chmod(receiver.c_str(), 0755);
+    }
+
+    static std::string read_file(const std::string& filename)
+    {
+        std::ifstream file(filename);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    const std::string capture = std::string(TEST_PATH) + "signal_samples/GSoC_CTTC_capture_2012_07_26_4Msps_4ms.dat";
+    const std::string config_file = "./batch_runner_test.conf";
+    const std::string receiver = "./batch_runner_test_receiver.sh";
+};
+
+
+TEST_F(BatchRunnerTest, RunsTheReceiverInTheOutputPath)
+{
+    // The receiver records its working directory and arguments
+    write_receiver("pwd > receiver_args.txt\necho \"$@\" >> receiver_args.txt");
+    std::vector<Batch_Job> jobs(2);
+    for (auto& job : jobs)
+        {
+            job.config_file = config_file;
+            job.capture_file = capture;
+        }
+
+    BatchRunner batch_runner(jobs, 2, 0, receiver, {"--log_dir=/tmp"});
+    EXPECT_EQ(batch_runner.run(), 0);
+
+    for (size_t i = 0; i < 2; i++)
+        {
+            const Batch_Job& job = batch_runner.jobs()[i];
+            EXPECT_EQ(job.return_code, 0);
+            EXPECT_TRUE(job.error.empty());
+            const std::string job_config = job.output_path + "/batch_job.conf";
+            EXPECT_EQ(read_file(job.output_path + "/receiver_args.txt"),
+                job.output_path + "\n--config_file=" + job_config + " --log_dir=/tmp\n");
+
+            // The overridden properties follow the original configuration
+            const std::string config = read_file(job_config);
+            EXPECT_EQ(config.find("[GNSS-SDR]\nGNSS-SDR.internal_fs_sps=4000000\n"), 0U);
+            EXPECT_NE(config.find("\nPVT.output_path=" + job.output_path + "\n"), std::string::npos);
+            EXPECT_NE(config.find("\nPVT.rtcm_tcp_port=" + std::to_string(2200 + 10 * i) + "\n"), std::string::npos);
+            EXPECT_NE(config.find("\nGNSS-SDR.interactive_listeners=false\n"), std::string::npos);
+        }
+}
+
+
+TEST_F(BatchRunnerTest, ReportsFailedJobs)
+{
+    write_receiver("echo 'Unable to connect' >&2\nexit 3");
+    std::vector<Batch_Job> jobs(3);
+    jobs[0].config_file = config_file;
+    jobs[0].capture_file = capture;
+    jobs[1].config_file = config_file;
+    jobs[1].capture_file = "./i_dont_exist.dat";
+    jobs[2].config_file = "./i_dont_exist.conf";
+
+    BatchRunner batch_runner(jobs, 2, 0, receiver);
+    EXPECT_EQ(batch_runner.run(), 1);
+
+    // The receiver of the first job runs, and fails
+    const Batch_Job& failed_receiver = batch_runner.jobs()[0];
+    EXPECT_EQ(failed_receiver.return_code, 3);
+    EXPECT_NE(failed_receiver.error.find("batch_job.log"), std::string::npos);
+    EXPECT_GT(failed_receiver.wall_time_s, 0.0);
+    EXPECT_EQ(read_file(failed_receiver.output_path + "/batch_job.log"), "Unable to connect\n");
+    struct stat output_path_info;
+    EXPECT_EQ(stat(failed_receiver.output_path.c_str(), &output_path_info), 0);
+    EXPECT_TRUE(S_ISDIR(output_path_info.st_mode));
+
+    // The other two are rejected before starting a receiver
+    for (size_t i = 1; i < 3; i++)
+        {
+            EXPECT_NE(batch_runner.jobs()[i].return_code, 0);
+            EXPECT_FALSE(batch_runner.jobs()[i].error.empty());
+            EXPECT_EQ(batch_runner.jobs()[i].wall_time_s, 0.0);
+        }
+}
+
+
+TEST_F(BatchRunnerTest, ReportsMissingReceiver)
+{
+    std::vector<Batch_Job> jobs(1);
+    jobs[0].config_file = config_file;
+    jobs[0].capture_file = capture;
+
+    BatchRunner batch_runner(jobs, 1, 0, "./i_dont_exist_receiver");
+    EXPECT_EQ(batch_runner.run(), 1);
+    EXPECT_NE(batch_runner.jobs()[0].return_code, 0);
+    EXPECT_NE(batch_runner.jobs()[0].error.find("Unable to start"), std::string::npos);
+}
+
+
+#if defined(__linux__)
+TEST_F(BatchRunnerTest, UsesTheCpusTheProcessIsAllowedToUse)
+{
+    // Restrict the test to the last CPU it is allowed to use, as taskset would
+    cpu_set_t previous_cpus;
+    CPU_ZERO(&previous_cpus);
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous_cpus), 0);
+    int last_cpu = 0;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &previous_cpus))
+                {
+                    last_cpu = cpu;
+                }
+        }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(last_cpu, &cpuset);
+    ASSERT_EQ(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset), 0);
+
+    write_receiver("grep Cpus_allowed_list /proc/self/status | cut -f2 > receiver_cpus.txt");
+    std::vector<Batch_Job> jobs(1);
+    jobs[0].config_file = config_file;
+    jobs[0].capture_file = capture;
+
+    BatchRunner batch_runner(jobs, 1, 4, receiver);
+    EXPECT_EQ(batch_runner.cpu_budget(), 1U);
+    EXPECT_EQ(batch_runner.run(), 0);
+    EXPECT_EQ(read_file(batch_runner.jobs()[0].output_path + "/receiver_cpus.txt"), std::to_string(last_cpu) + "\n");
+
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous_cpus);
+}
+#endif
@@ -250,3 +250,32 @@ TEST_F(ControlThreadTest /*unused*/, StopReceiverProgrammatically /*unused*/)
     stop_receiver_thread.join();
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
 }
+
+
+TEST_F(ControlThreadTest /*unused*/, ReturnsErrorIfUnableToConnect /*unused*/)
+{
+    std::shared_ptr<InMemoryConfiguration> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("SignalSource.implementation", "File_Signal_Source");
+    std::string path = std::string(TEST_PATH);
+    std::string file = path + "signal_samples/GSoC_CTTC_capture_2012_07_26_4Msps_4ms.dat";
+    config->set_property("SignalSource.filename", file);
+    config->set_property("SignalSource.item_type", "gr_complex");
+    config->set_property("SignalSource.sampling_frequency", "4000000");
+    config->set_property("SignalConditioner.implementation", "Pass_Through");
+    config->set_property("SignalConditioner.item_type", "gr_complex");
+    config->set_property("Channels_1C.count", "1");
+    config->set_property("Channels.in_acquisition", "1");
+    // The channel expects samples of a different size than the source delivers
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.item_type", "cshort");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("Tracking_1C.item_type", "cshort");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+    config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
+
+    auto control_thread = std::make_unique<ControlThread>(config);
+    control_thread->disable_interactive_listeners();
+    EXPECT_NE(control_thread->run(), 0);
+}
@@ -1,6 +1,6 @@
 /*!
  * \file protobuf_test.cc
- * \brief This file implements tests for Serdes_Gnss_Synchro
+ * \brief This file implements tests for Serdes_Gnss_Synchro and Serdes_Block_Stats
  * \author Carles Fernandez-Prades, 2019. cfernandez(at)cttc.es
  *
  * -----------------------------------------------------------------------------
@@ -15,6 +15,8 @@
  */
 
 
+#include "block_stats_udp_sink.h"
+#include "serdes_block_stats.h"
 #include "serdes_gnss_synchro.h"
 
 TEST(Protobuf, Works)
@@ -96,3 +98,66 @@ TEST(Protobuf, Works)
     EXPECT_EQ(prn_read, prn_read3);
     EXPECT_EQ(2, obs_size);
 }
+
+
+TEST(Protobuf, BlockStatsReportIsSplitIntoDatagrams)
+{
+    // Acquisition, tracking and telemetry decoder blocks of 128 channels
+    std::vector<Block_Stats_Snapshot> snaps;
+    for (int32_t channel = 0; channel < 128; channel++)
+        {
+            for (const std::string stage : {"Acquisition", "Tracking", "TelemetryDecoder"})
+                {
+                    Block_Stats_Snapshot snap;
+                    snap.stage = stage;
+                    snap.block = stage + "_block";
+                    snap.channel = channel;
+                    snap.work_calls = 123456789012ULL + channel;
+                    snap.work_time_ns = 987654321098765ULL;
+                    snap.max_work_time_ns = 12345678901ULL;
+                    for (auto& bin : snap.histogram)
+                        {
+                            bin = 123456789012ULL;
+                        }
+                    snap.input_items = 98765432109876ULL;
+                    snap.max_input_items = 65536;
+                    snaps.push_back(snap);
+                }
+        }
+
+    Serdes_Block_Stats serdes;
+    const std::vector<size_t> first = serdes.split(snaps, BLOCK_STATS_MAX_DATAGRAM_SIZE);
+    ASSERT_GT(first.size(), 2U);
+    ASSERT_EQ(first.back(), snaps.size());
+    const auto parts = static_cast<uint32_t>(first.size() - 1);
+
+    std::vector<Block_Stats_Snapshot> received;
+    std::string data;
+    for (uint32_t part = 0; part < parts; part++)
+        {
+            serdes.createProtobuffer(snaps, first[part], first[part + 1], 7, part, parts, data);
+            EXPECT_LE(data.size(), BLOCK_STATS_MAX_DATAGRAM_SIZE);
+
+            gnss_sdr::BlockStatsReport report;
+            ASSERT_TRUE(report.ParseFromString(data));
+            EXPECT_EQ(report.sequence(), 7U);
+            EXPECT_EQ(report.part(), part);
+            EXPECT_EQ(report.parts(), parts);
+            for (const auto& snap : serdes.readProtobuffer(report))
+                {
+                    received.push_back(snap);
+                }
+        }
+
+    ASSERT_EQ(received.size(), snaps.size());
+    for (size_t i = 0; i < snaps.size(); i++)
+        {
+            EXPECT_EQ(received[i].stage, snaps[i].stage);
+            EXPECT_EQ(received[i].channel, snaps[i].channel);
+            EXPECT_EQ(received[i].work_calls, snaps[i].work_calls);
+            EXPECT_EQ(received[i].histogram, snaps[i].histogram);
+        }
+
+    // A report without blocks is sent as a single empty part
+    EXPECT_EQ(serdes.split({}, BLOCK_STATS_MAX_DATAGRAM_SIZE), std::vector<size_t>({0, 0}));
+}
@@ -18,6 +18,8 @@
 
 #include "gnss_sdr_make_unique.h"
 #include "string_converter.h"
+#include <cstdint>
+#include <limits>
 
 
 TEST(StringConverterTest, StringToBool)
@@ -57,3 +59,33 @@ TEST(StringConverterTest, StringToSizeTFail)
     unsigned int expected1 = 1;
     EXPECT_EQ(expected1, conversion_result);
 }
+
+
+TEST(StringConverterTest, StringToNumbers)
+{
+    StringConverter converter;
+    EXPECT_EQ(converter.convert(" 42", int32_t(0)), 42);
+    EXPECT_EQ(converter.convert("-7 Hz", int32_t(0)), -7);
+    EXPECT_EQ(converter.convert("4000000000", uint32_t(0)), 4000000000U);
+    EXPECT_EQ(converter.convert("-9000000000", int64_t(0)), -9000000000LL);
+    EXPECT_EQ(converter.convert("18446744073709551615", uint64_t(0)), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(converter.convert("-32768", int16_t(0)), -32768);
+    EXPECT_EQ(converter.convert("65535", uint16_t(0)), 65535);
+    EXPECT_FLOAT_EQ(converter.convert("2.5e6", 0.0F), 2.5e6F);
+    EXPECT_DOUBLE_EQ(converter.convert("-0.125", 0.0), -0.125);
+}
+
+
+TEST(StringConverterTest, StringToNumbersFail)
+{
+    StringConverter converter;
+    EXPECT_EQ(converter.convert("", int32_t(3)), 3);
+    EXPECT_EQ(converter.convert("abc", int64_t(3)), 3);
+    EXPECT_EQ(converter.convert("3000000000", int32_t(3)), 3);
+    EXPECT_EQ(converter.convert("-1", uint32_t(3)), 3U);
+    EXPECT_EQ(converter.convert("70000", int16_t(3)), 3);
+    EXPECT_EQ(converter.convert("65536", uint16_t(3)), 3);
+    EXPECT_FLOAT_EQ(converter.convert("1e50", 3.0F), 3.0F);
+    EXPECT_DOUBLE_EQ(converter.convert("1e400", 3.0), 3.0);
+    EXPECT_DOUBLE_EQ(converter.convert("nan", 3.0), 3.0);
+}
@@ -16,7 +16,7 @@
  */
 
 #include "GPS_L1_CA.h"
-#include "acquisition_dump_reader.h"
+#include "configuration_interface.h"
 #include "display.h"
 #include "file_configuration.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
@@ -24,24 +24,31 @@
 #include "glonass_l1_ca_pcps_acquisition.h"
 #include "glonass_l2_ca_pcps_acquisition.h"
 #include "gnss_block_interface.h"
-#include "gnss_sdr_valve.h"
+#include "gnss_synchro.h"
 #include "gnuplot_i.h"
 #include "gps_l1_ca_pcps_acquisition.h"
 #include "gps_l1_ca_pcps_acquisition_fine_doppler.h"
 #include "gps_l2_m_pcps_acquisition.h"
 #include "gps_l5i_pcps_acquisition.h"
 #include "in_memory_configuration.h"
+#include "internal_signal_generator.h"
 #include "signal_generator_flags.h"
 #include "test_flags.h"
 #include "tracking_true_obs_reader.h"
 #include "true_observables_reader.h"
-#include <gnuradio/blocks/file_source.h>
-#include <gnuradio/blocks/interleaved_char_to_complex.h>
-#include <gnuradio/blocks/skiphead.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/sync_block.h>
 #include <gnuradio/top_block.h>
 #include <pmt/pmt.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #if HAS_GENERIC_LAMBDA
 #else
@@ -98,7 +105,8 @@ DEFINE_int32(acq_test_iterations, 1, "Number of iterations (same signal, differe
 DEFINE_bool(plot_acq_test, false, "Plots results with gnuplot, if available");
 DEFINE_int32(acq_test_skiphead, 0, "Number of samples to skip in the input file");
 
-DEFINE_bool(acq_test_dump, false, "Dump the results of an acquisition block into .mat files.");
+DEFINE_bool(acq_test_dump, false, "Dump the results of an acquisition block into .mat files. The receiver runs are then executed one at a time.");
+DEFINE_int32(acq_test_workers, 0, "Number of receiver runs executed in parallel. 0 means one per available core.");
 
 // ######## GNURADIO BLOCK MESSAGE RECEVER #########
 class AcqPerfTest_msg_rx;
@@ -162,6 +170,205 @@ AcqPerfTest_msg_rx::AcqPerfTest_msg_rx(Concurrent_Queue<int>& queue) : gr::block
 
 AcqPerfTest_msg_rx::~AcqPerfTest_msg_rx() = default;
 
+
+// ######## GNURADIO BLOCK SHARED MEMORY SOURCE #########
+class AcqPerfTest_memory_source;
+
+using AcqPerfTest_memory_source_sptr = gnss_shared_ptr<AcqPerfTest_memory_source>;
+
+AcqPerfTest_memory_source_sptr AcqPerfTest_memory_source_make(std::shared_ptr<const std::vector<int8_t>> samples);
+
+/*!
+ * \brief Plays interleaved int8_t I/Q samples kept in memory as gr_complex
+ * samples. All the receiver runs over a signal realization share its buffer.
+ */
+class AcqPerfTest_memory_source : public gr::sync_block
+{
+private:
+    friend AcqPerfTest_memory_source_sptr AcqPerfTest_memory_source_make(std::shared_ptr<const std::vector<int8_t>> samples);
+    explicit AcqPerfTest_memory_source(std::shared_ptr<const std::vector<int8_t>> samples);
+    std::shared_ptr<const std::vector<int8_t>> d_samples;
+    size_t d_offset;
+
+public:
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+};
+
+
+AcqPerfTest_memory_source_sptr AcqPerfTest_memory_source_make(std::shared_ptr<const std::vector<int8_t>> samples)
+{
+    return AcqPerfTest_memory_source_sptr(new AcqPerfTest_memory_source(std::move(samples)));
+}
+
+
+AcqPerfTest_memory_source::AcqPerfTest_memory_source(std::shared_ptr<const std::vector<int8_t>> samples) : gr::sync_block("AcqPerfTest_memory_source", gr::io_signature::make(0, 0, 0), gr::io_signature::make(1, 1, sizeof(gr_complex))), d_samples(std::move(samples)), d_offset(0)
+{
+}
+
+
+int AcqPerfTest_memory_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    const size_t remaining = d_samples->size() / 2 - d_offset;
+    if (remaining == 0)
+        {
+            return WORK_DONE;
+        }
+    const size_t n = std::min(static_cast<size_t>(noutput_items), remaining);
+    const int8_t* in = d_samples->data() + 2 * d_offset;
+    auto* out = static_cast<gr_complex*>(output_items[0]);
+    for (size_t i = 0; i < n; i++)
+        {
+            out[i] = gr_complex(in[2 * i], in[2 * i + 1]);
+        }
+    d_offset += n;
+    return static_cast<int>(n);
+}
+
+
+// ######## RECEIVER RUN #########
+/*!
+ * \brief Result of one execution of the acquisition block
+ */
+struct AcqPerfTest_measurement
+{
+    bool positive;
+    uint64_t sample_stamp;
+    double doppler_hz;
+    double delay_samples;
+};
+
+
+/*!
+ * \brief Runs an acquisition block over a signal until it has made a given
+ * number of measurements. Each run owns its flowgraph and message queue, so
+ * several of them can be executed at the same time. The measurements are
+ * kept in memory instead of being read back from the dump files, since the
+ * .mat files are written and read with libraries that are not thread-safe.
+ */
+class AcqPerfTest_receiver
+{
+public:
+    AcqPerfTest_receiver(std::shared_ptr<AcquisitionInterface> acquisition, const Gnss_Synchro* gnss_synchro, unsigned int num_of_measurements);
+    void run(const gr::basic_block_sptr& source);
+
+    inline const std::vector<AcqPerfTest_measurement>& measurements() const
+    {
+        return d_measurements;
+    }
+
+private:
+    void wait_message();
+
+    Concurrent_Queue<int> channel_internal_queue;
+    gr::top_block_sptr top_block;
+    std::shared_ptr<AcquisitionInterface> acquisition;
+    const Gnss_Synchro* gnss_synchro;
+    std::vector<AcqPerfTest_measurement> d_measurements;
+    unsigned int num_of_measurements;
+    unsigned int measurement_counter;
+};
+
+
+AcqPerfTest_receiver::AcqPerfTest_receiver(std::shared_ptr<AcquisitionInterface> acquisition_, const Gnss_Synchro* gnss_synchro_, unsigned int num_of_measurements_) : acquisition(std::move(acquisition_)), gnss_synchro(gnss_synchro_), num_of_measurements(num_of_measurements_), measurement_counter(0)
+{
+}
+
+
+void AcqPerfTest_receiver::run(const gr::basic_block_sptr& source)
+{
+    top_block = gr::make_top_block("Acquisition test");
+    auto msg_rx = AcqPerfTest_msg_rx_make(channel_internal_queue);
+
+    acquisition->set_state(1);  // Ensure that acquisition starts at the first sample
+    acquisition->connect(top_block);
+
+    acquisition->reset();
+    top_block->connect(source, 0, acquisition->get_left_block(), 0);
+    top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+
+    std::thread ch_thread(&AcqPerfTest_receiver::wait_message, this);
+
+    top_block->run();  // Start threads and wait
+
+    channel_internal_queue.push(-1);  // wakes up wait_message() if the signal ended before the last measurement
+    ch_thread.join();
+}
+
+
+void AcqPerfTest_receiver::wait_message()
+{
+    int message = 0;
+    while (measurement_counter < num_of_measurements)
+        {
+            channel_internal_queue.wait_and_pop(message);
+            if (message < 0)
+                {
+                    break;
+                }
+            // The acquisition block does not touch gnss_synchro again until it is reset
+            d_measurements.push_back({message == 1,
+                gnss_synchro->Acq_samplestamp_samples,
+                gnss_synchro->Acq_doppler_hz,
+                gnss_synchro->Acq_delay_samples});
+            measurement_counter++;
+            acquisition->reset();
+            acquisition->set_state(1);
+            if (measurement_counter == num_of_measurements)
+                {
+                    top_block->stop();
+                }
+        }
+}
+
+
+/*!
+ * \brief True observables of a satellite, as written by the signal generator
+ */
+struct AcqPerfTest_true_obs
+{
+    arma::vec timestamp_s;
+    arma::vec doppler_hz;
+    arma::vec prn_delay_chips;
+};
+
+
+/*!
+ * \brief Signal realization shared by all the receiver runs of a given C/N0
+ * and iteration, with the true observables of the present (0) and the
+ * non-present (1) satellites
+ */
+struct AcqPerfTest_signal
+{
+    std::shared_ptr<const std::vector<int8_t>> samples;
+    std::array<AcqPerfTest_true_obs, 2> true_obs;
+};
+
+
+/*!
+ * \brief Point of the sweep: one receiver run for a C/N0, a threshold, an
+ * iteration and a satellite (0: present, 1: non-present)
+ */
+struct AcqPerfTest_point
+{
+    size_t cn0_index;
+    size_t pfa_index;
+    unsigned int iter;
+    unsigned int satellite;
+};
+
+
+struct AcqPerfTest_result
+{
+    int num_executions{0};
+    double detected{0.0};
+    int num_clean_executions{0};
+    double correctly_detected{0.0};
+};
+
 // -----------------------------------------
 
 
@@ -172,10 +379,8 @@ protected:
     {
         config = std::make_shared<InMemoryConfiguration>();
         item_size = sizeof(gr_complex);
-        gnss_synchro = Gnss_Synchro();
         doppler_max = static_cast<unsigned int>(FLAGS_acq_test_doppler_max);
         doppler_step = static_cast<unsigned int>(FLAGS_acq_test_doppler_step);
-        stop = false;
         if (FLAGS_acq_test_input_file.empty())
             {
                 cn0_vector.push_back(FLAGS_acq_test_cn0_init);
@@ -268,7 +473,6 @@ protected:
                 min_integration_ms = 1;
             }
 
-        init();
 
         if (FLAGS_acq_test_pfa_init > 0.0)
             {
@@ -308,17 +512,17 @@ protected:
         Pd.resize(cn0_vector.size());
         for (int i = 0; i < static_cast<int>(cn0_vector.size()); i++)
             {
-                Pd[i].reserve(num_thresholds);
+                Pd[i].resize(num_thresholds);
             }
         Pfa.resize(cn0_vector.size());
         for (int i = 0; i < static_cast<int>(cn0_vector.size()); i++)
             {
-                Pfa[i].reserve(num_thresholds);
+                Pfa[i].resize(num_thresholds);
             }
         Pd_correct.resize(cn0_vector.size());
         for (int i = 0; i < static_cast<int>(cn0_vector.size()); i++)
             {
-                Pd_correct[i].reserve(num_thresholds);
+                Pd_correct[i].resize(num_thresholds);
             }
     }
 
@@ -328,35 +532,21 @@ protected:
     std::vector<float> pfa_vector;
 
     int N_iterations = FLAGS_acq_test_iterations;
-    void init();
 
     int configure_generator(double cn0);
     int generate_signal();
-    int configure_receiver(double cn0, float pfa, unsigned int iter);
-    void start_queue();
-    void wait_message();
-    void process_message();
-    void stop_queue();
-    int run_receiver();
-    int count_executions(const std::string& basename, unsigned int sat);
-    void check_results();
+    std::shared_ptr<ConfigurationInterface> configure_receiver(double cn0, float pfa, unsigned int iter) const;
+    std::shared_ptr<const std::vector<int8_t>> load_samples(const std::string& file, int64_t nsamples) const;
+    AcqPerfTest_true_obs read_true_obs(unsigned int sat) const;
+    std::shared_ptr<AcquisitionInterface> make_acquisition(const ConfigurationInterface* configuration) const;
+    AcqPerfTest_result run_point(const AcqPerfTest_point& point, const AcqPerfTest_signal& signal) const;
+    std::vector<AcqPerfTest_result> run_points(const std::vector<AcqPerfTest_point>& points, const std::vector<AcqPerfTest_signal>& signals) const;
     void plot_results();
 
-    Concurrent_Queue<int> channel_internal_queue;
-
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
-    gr::top_block_sptr top_block;
-    std::shared_ptr<AcquisitionInterface> acquisition;
-    std::shared_ptr<InMemoryConfiguration> config;
-    std::shared_ptr<FileConfiguration> config_f;
-    Gnss_Synchro gnss_synchro;
+    std::shared_ptr<ConfigurationInterface> config;
     size_t item_size;
     unsigned int doppler_max;
     unsigned int doppler_step;
-    bool stop;
-
-    int message;
-    std::thread ch_thread;
 
     std::string implementation = FLAGS_acq_test_implementation;
 
@@ -367,9 +557,7 @@ protected:
 
     int generated_signal_duration_s = FLAGS_acq_test_signal_duration_s;
     unsigned int num_of_measurements;
-    unsigned int measurement_counter = 0;
 
-    unsigned int observed_satellite = FLAGS_acq_test_PRN;
     std::string path_str = "./acq-perf-test";
 
     int num_thresholds;
@@ -389,6 +577,7 @@ private:
     std::string p4;
     std::string p5;
     std::string p6;
+    double generator_CN0_dBHz{};
 
     std::string filename_rinex_obs = FLAGS_filename_rinex_obs;
     std::string filename_raw_data = FLAGS_filename_raw_data;
@@ -398,60 +587,11 @@ private:
     double compute_stdev_accuracy(const std::vector<double>& vec, double ref);
 };
 
-
-void AcquisitionPerformanceTest::init()
-{
-    gnss_synchro.Channel_ID = 0;
-    gnss_synchro.System = system_id;
-    std::string signal = signal_id;
-    signal.copy(gnss_synchro.Signal, 2, 0);
-    gnss_synchro.PRN = observed_satellite;
-    message = 0;
-    measurement_counter = 0;
-}
-
-
-void AcquisitionPerformanceTest::start_queue()
-{
-    stop = false;
-    ch_thread = std::thread(&AcquisitionPerformanceTest::wait_message, this);
-}
-
-
-void AcquisitionPerformanceTest::wait_message()
-{
-    while (!stop)
-        {
-            channel_internal_queue.wait_and_pop(message);
-            process_message();
-        }
-}
-
-
-void AcquisitionPerformanceTest::process_message()
-{
-    measurement_counter++;
-    acquisition->reset();
-    acquisition->set_state(1);
-    std::cout << "Progress: " << round(static_cast<float>(measurement_counter) / static_cast<float>(num_of_measurements) * 100.0) << "% \r" << std::flush;
-    if (measurement_counter == num_of_measurements)
-        {
-            stop_queue();
-            top_block->stop();
-        }
-}
-
-
-void AcquisitionPerformanceTest::stop_queue()
-{
-    stop = true;
-}
-
-
 int AcquisitionPerformanceTest::configure_generator(double cn0)
 {
     // Configure signal generator
     generator_binary = FLAGS_generator_binary;
+    generator_CN0_dBHz = cn0;
 
     p1 = std::string("-rinex_nav_file=") + FLAGS_rinex_nav_file;
     if (FLAGS_dynamic_position.empty())
@@ -475,6 +615,15 @@ int AcquisitionPerformanceTest::generate_signal()
     pid_t wait_result;
     int child_status;
     std::cout << "Generating signal for " << p6 << "...\n";
+    if (FLAGS_internal_generator)
+        {
+            if (!generate_internal_signal(system_id, signal_id, FLAGS_acq_test_PRN, generator_CN0_dBHz,
+                    baseband_sampling_freq, generated_signal_duration_s, filename_raw_data))
+                {
+                    std::cout << "The built-in generator could not write " << filename_raw_data << '\n';
+                }
+            return 0;
+        }
     char* const parmList[] = {&generator_binary[0], &generator_binary[0], &p1[0], &p2[0], &p3[0], &p4[0], &p5[0], &p6[0], nullptr};
 
     int pid;
@@ -498,192 +647,307 @@ int AcquisitionPerformanceTest::generate_signal()
 }
 
 
-int AcquisitionPerformanceTest::configure_receiver(double cn0, float pfa, unsigned int iter)
+std::shared_ptr<ConfigurationInterface> AcquisitionPerformanceTest::configure_receiver(double cn0, float pfa, unsigned int iter) const
 {
-    if (FLAGS_config_file_ptest.empty())
+    if (!FLAGS_config_file_ptest.empty())
         {
-            config = std::make_shared<InMemoryConfiguration>();
-            const int sampling_rate_internal = baseband_sampling_freq;
-
-            config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(sampling_rate_internal));
+            return std::make_shared<FileConfiguration>(FLAGS_config_file_ptest);
+        }
 
-            // Set Acquisition
-            config->set_property("Acquisition.implementation", implementation);
-            config->set_property("Acquisition.item_type", "gr_complex");
-            config->set_property("Acquisition.doppler_max", std::to_string(doppler_max));
-            config->set_property("Acquisition.doppler_min", std::to_string(-doppler_max));
-            config->set_property("Acquisition.doppler_step", std::to_string(doppler_step));
+    auto configuration = std::make_shared<InMemoryConfiguration>();
+    const int sampling_rate_internal = baseband_sampling_freq;
 
-            config->set_property("Acquisition.threshold", std::to_string(pfa));
-            // if (FLAGS_acq_test_pfa_init > 0.0) config->supersede_property("Acquisition.pfa", std::to_string(pfa));
-            if (FLAGS_acq_test_pfa_init > 0.0)
-                {
-                    config->supersede_property("Acquisition.pfa", std::to_string(pfa));
-                }
+    configuration->set_property("GNSS-SDR.internal_fs_sps", std::to_string(sampling_rate_internal));
 
-            config->set_property("Acquisition.coherent_integration_time_ms", std::to_string(coherent_integration_time_ms));
-            if (FLAGS_acq_test_bit_transition_flag)
-                {
-                    config->set_property("Acquisition.bit_transition_flag", "true");
-                }
-            else
-                {
-                    config->set_property("Acquisition.bit_transition_flag", "false");
-                }
+    // Set Acquisition
+    configuration->set_property("Acquisition.implementation", implementation);
+    configuration->set_property("Acquisition.item_type", "gr_complex");
+    configuration->set_property("Acquisition.doppler_max", std::to_string(doppler_max));
+    configuration->set_property("Acquisition.doppler_min", std::to_string(-doppler_max));
+    configuration->set_property("Acquisition.doppler_step", std::to_string(doppler_step));
 
-            config->set_property("Acquisition.max_dwells", std::to_string(FLAGS_acq_test_max_dwells));
+    configuration->set_property("Acquisition.threshold", std::to_string(pfa));
+    if (FLAGS_acq_test_pfa_init > 0.0)
+        {
+            configuration->supersede_property("Acquisition.pfa", std::to_string(pfa));
+        }
 
-            config->set_property("Acquisition.repeat_satellite", "true");
+    configuration->set_property("Acquisition.coherent_integration_time_ms", std::to_string(coherent_integration_time_ms));
+    if (FLAGS_acq_test_bit_transition_flag)
+        {
+            configuration->set_property("Acquisition.bit_transition_flag", "true");
+        }
+    else
+        {
+            configuration->set_property("Acquisition.bit_transition_flag", "false");
+        }
 
-            config->set_property("Acquisition.blocking", "true");
-            if (FLAGS_acq_test_make_two_steps)
-                {
-                    config->set_property("Acquisition.make_two_steps", "true");
-                    config->set_property("Acquisition.second_nbins", std::to_string(FLAGS_acq_test_second_nbins));
-                    config->set_property("Acquisition.second_doppler_step", std::to_string(FLAGS_acq_test_second_doppler_step));
-                }
-            else
-                {
-                    config->set_property("Acquisition.make_two_steps", "false");
-                }
+    configuration->set_property("Acquisition.max_dwells", std::to_string(FLAGS_acq_test_max_dwells));
 
-            if (FLAGS_acq_test_dump)
-                {
-                    config->set_property("Acquisition.dump", "true");
-                }
-            else
-                {
-                    config->set_property("Acquisition.dump", "false");
-                }
+    configuration->set_property("Acquisition.repeat_satellite", "true");
 
-            std::string dump_file = path_str + std::string("/acquisition_") + std::to_string(cn0) + "_" + std::to_string(iter) + "_" + std::to_string(pfa);
-            config->set_property("Acquisition.dump_filename", dump_file);
-            config->set_property("Acquisition.dump_channel", std::to_string(dump_channel));
-            config->set_property("Acquisition.blocking_on_standby", "true");
+    configuration->set_property("Acquisition.blocking", "true");
+    if (FLAGS_acq_test_make_two_steps)
+        {
+            configuration->set_property("Acquisition.make_two_steps", "true");
+            configuration->set_property("Acquisition.second_nbins", std::to_string(FLAGS_acq_test_second_nbins));
+            configuration->set_property("Acquisition.second_doppler_step", std::to_string(FLAGS_acq_test_second_doppler_step));
+        }
+    else
+        {
+            configuration->set_property("Acquisition.make_two_steps", "false");
+        }
 
-            config_f = nullptr;
+    if (FLAGS_acq_test_dump)
+        {
+            configuration->set_property("Acquisition.dump", "true");
         }
     else
         {
-            config_f = std::make_shared<FileConfiguration>(FLAGS_config_file_ptest);
-            config = nullptr;
+            configuration->set_property("Acquisition.dump", "false");
         }
-    return 0;
+
+    std::string dump_file = path_str + std::string("/acquisition_") + std::to_string(cn0) + "_" + std::to_string(iter) + "_" + std::to_string(pfa);
+    configuration->set_property("Acquisition.dump_filename", dump_file);
+    configuration->set_property("Acquisition.dump_channel", std::to_string(dump_channel));
+    configuration->set_property("Acquisition.blocking_on_standby", "true");
+
+    return configuration;
 }
 
 
-int AcquisitionPerformanceTest::run_receiver()
+std::shared_ptr<const std::vector<int8_t>> AcquisitionPerformanceTest::load_samples(const std::string& file, int64_t nsamples) const
 {
-    std::string file;
-    if (FLAGS_acq_test_input_file.empty())
+    // Interleaved int8_t I/Q samples, skipping the first acq_test_skiphead ones
+    auto samples = std::make_shared<std::vector<int8_t>>();
+    std::ifstream input(file, std::ios::in | std::ios::binary);
+    if (!input.is_open())
         {
-            file = "./" + filename_raw_data;
+            std::cout << "Unable to open " << file << '\n';
+            return samples;
         }
-    else
-        {
-            file = FLAGS_acq_test_input_file;
-        }
-    const char* file_name = file.c_str();
-    gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(int8_t), file_name, false);
+    input.seekg(static_cast<std::streamoff>(FLAGS_acq_test_skiphead) * 2, std::ios::beg);
+    samples->resize(static_cast<size_t>(nsamples) * 2);
+    input.read(reinterpret_cast<char*>(samples->data()), static_cast<std::streamsize>(samples->size()));
+    samples->resize(static_cast<size_t>(input.gcount()) / 2 * 2);
+    return samples;
+}
 
-    gr::blocks::interleaved_char_to_complex::sptr gr_interleaved_char_to_complex = gr::blocks::interleaved_char_to_complex::make();
 
-    top_block = gr::make_top_block("Acquisition test");
-    auto msg_rx = AcqPerfTest_msg_rx_make(channel_internal_queue);
-    gr::blocks::skiphead::sptr skiphead = gr::blocks::skiphead::make(sizeof(gr_complex), FLAGS_acq_test_skiphead);
+AcqPerfTest_true_obs AcquisitionPerformanceTest::read_true_obs(unsigned int sat) const
+{
+    Tracking_True_Obs_Reader true_trk_data;
+    std::string true_trk_file = std::string("./gps_l1_ca_obs_prn");
+    true_trk_file.append(std::to_string(sat));
+    true_trk_file.append(".dat");
+    true_trk_data.open_obs_file(true_trk_file);
+
+    // load the true values
+    const int64_t n_true_epochs = true_trk_data.num_epochs();
+    AcqPerfTest_true_obs true_obs;
+    true_obs.timestamp_s = arma::zeros(n_true_epochs, 1);
+    true_obs.doppler_hz = arma::zeros(n_true_epochs, 1);
+    true_obs.prn_delay_chips = arma::zeros(n_true_epochs, 1);
+
+    int64_t epoch_counter = 0;
+    while (epoch_counter < n_true_epochs and true_trk_data.read_binary_obs())
+        {
+            true_obs.timestamp_s(epoch_counter) = true_trk_data.signal_timestamp_s;
+            true_obs.doppler_hz(epoch_counter) = true_trk_data.doppler_l1_hz;
+            true_obs.prn_delay_chips(epoch_counter) = GPS_L1_CA_CODE_LENGTH_CHIPS - true_trk_data.prn_delay_chips;
+            epoch_counter++;
+        }
+    true_obs.timestamp_s.resize(epoch_counter);
+    true_obs.doppler_hz.resize(epoch_counter);
+    true_obs.prn_delay_chips.resize(epoch_counter);
+    true_trk_data.close_obs_file();
+    return true_obs;
+}
 
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
-    gnss_synchro = Gnss_Synchro();
-    init();
 
-    int nsamples = floor(config->property("GNSS-SDR.internal_fs_sps", 2000000) * generated_signal_duration_s);
-    auto valve = gnss_sdr_make_valve(sizeof(gr_complex), nsamples, queue.get());
+std::shared_ptr<AcquisitionInterface> AcquisitionPerformanceTest::make_acquisition(const ConfigurationInterface* configuration) const
+{
     if (implementation == "GPS_L1_CA_PCPS_Acquisition")
         {
-            acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GpsL1CaPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "GPS_L1_CA_PCPS_Acquisition_Fine_Doppler")
+    if (implementation == "GPS_L1_CA_PCPS_Acquisition_Fine_Doppler")
         {
-            acquisition = std::make_shared<GpsL1CaPcpsAcquisitionFineDoppler>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GpsL1CaPcpsAcquisitionFineDoppler>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "Galileo_E1_PCPS_Ambiguous_Acquisition")
+    if (implementation == "Galileo_E1_PCPS_Ambiguous_Acquisition")
         {
-            acquisition = std::make_shared<GalileoE1PcpsAmbiguousAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GalileoE1PcpsAmbiguousAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "GLONASS_L1_CA_PCPS_Acquisition")
+    if (implementation == "GLONASS_L1_CA_PCPS_Acquisition")
         {
-            acquisition = std::make_shared<GlonassL1CaPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GlonassL1CaPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "GLONASS_L2_CA_PCPS_Acquisition")
+    if (implementation == "GLONASS_L2_CA_PCPS_Acquisition")
         {
-            acquisition = std::make_shared<GlonassL2CaPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GlonassL2CaPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "GPS_L2_M_PCPS_Acquisition")
+    if (implementation == "GPS_L2_M_PCPS_Acquisition")
         {
-            acquisition = std::make_shared<GpsL2MPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GpsL2MPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "Galileo_E5a_Pcps_Acquisition")
+    if (implementation == "Galileo_E5a_Pcps_Acquisition")
         {
-            acquisition = std::make_shared<GalileoE5aPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GalileoE5aPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else if (implementation == "GPS_L5i_PCPS_Acquisition")
+    if (implementation == "GPS_L5i_PCPS_Acquisition")
         {
-            acquisition = std::make_shared<GpsL5iPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+            return std::make_shared<GpsL5iPcpsAcquisition>(configuration, "Acquisition", 1, 0);
         }
-    else
+    return nullptr;
+}
+
+
+AcqPerfTest_result AcquisitionPerformanceTest::run_point(const AcqPerfTest_point& point, const AcqPerfTest_signal& signal) const
+{
+    AcqPerfTest_result result;
+    const double cn0 = cn0_vector[point.cn0_index];
+    const float pfa = pfa_vector[point.pfa_index];
+    const unsigned int observed_satellite = point.satellite == 0 ? FLAGS_acq_test_PRN : FLAGS_acq_test_fake_PRN;
+
+    // Configure the receiver
+    const auto configuration = configure_receiver(cn0, pfa, point.iter);
+    Gnss_Synchro gnss_synchro = Gnss_Synchro();
+    gnss_synchro.Channel_ID = 0;
+    gnss_synchro.System = system_id;
+    signal_id.copy(gnss_synchro.Signal, 2, 0);
+    gnss_synchro.PRN = observed_satellite;
+
+    auto acquisition = make_acquisition(configuration.get());
+    if (acquisition == nullptr)
         {
-            bool aux = false;
-            EXPECT_EQ(true, aux);
+            ADD_FAILURE() << "Unknown acquisition implementation " << implementation;
+            return result;
         }
-
     acquisition->set_gnss_synchro(&gnss_synchro);
     acquisition->set_channel(0);
-    acquisition->set_doppler_max(config->property("Acquisition.doppler_max", 10000));
-    acquisition->set_doppler_step(config->property("Acquisition.doppler_step", 500));
-    acquisition->set_threshold(config->property("Acquisition.threshold", 0.0));
+    acquisition->set_doppler_max(configuration->property("Acquisition.doppler_max", 10000));
+    acquisition->set_doppler_step(configuration->property("Acquisition.doppler_step", 500));
+    acquisition->set_threshold(configuration->property("Acquisition.threshold", 0.0));
     acquisition->init();
     acquisition->set_local_code();
 
-    acquisition->set_state(1);  // Ensure that acquisition starts at the first sample
-    acquisition->connect(top_block);
-
-    acquisition->reset();
-    top_block->connect(file_source, 0, gr_interleaved_char_to_complex, 0);
-    top_block->connect(gr_interleaved_char_to_complex, 0, skiphead, 0);
-    top_block->connect(skiphead, 0, valve, 0);
-    top_block->connect(valve, 0, acquisition->get_left_block(), 0);
-    top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
-
-    start_queue();
-
-    top_block->run();  // Start threads and wait
+    // Run it
+    AcqPerfTest_receiver receiver(acquisition, &gnss_synchro, num_of_measurements);
+    receiver.run(AcqPerfTest_memory_source_make(signal.samples));
+
+    // Read measured data
+    const std::vector<AcqPerfTest_measurement>& measurements = receiver.measurements();
+    const int num_executions = static_cast<int>(measurements.size());
+    result.num_executions = num_executions;
+    arma::vec meas_timestamp_s = arma::zeros(num_executions, 1);
+    arma::vec meas_doppler = arma::zeros(num_executions, 1);
+    arma::vec positive_acq = arma::zeros(num_executions, 1);
+    arma::vec meas_acq_delay_chips = arma::zeros(num_executions, 1);
+    for (int execution = 0; execution < num_executions; execution++)
+        {
+            const AcqPerfTest_measurement& measurement = measurements[execution];
+            if (measurement.positive)
+                {
+                    meas_timestamp_s(execution) = static_cast<double>(measurement.sample_stamp) / baseband_sampling_freq;
+                    meas_doppler(execution) = measurement.doppler_hz;
+                    meas_acq_delay_chips(execution) = measurement.delay_samples / (baseband_sampling_freq * GPS_L1_CA_CODE_PERIOD_S / GPS_L1_CA_CODE_LENGTH_CHIPS);
+                    positive_acq(execution) = 1.0;
+                }
+            else
+                {
+                    meas_timestamp_s(execution) = arma::datum::inf;
+                    meas_doppler(execution) = arma::datum::inf;
+                    meas_acq_delay_chips(execution) = arma::datum::inf;
+                    positive_acq(execution) = 0.0;
+                }
+        }
+    result.detected = arma::accu(positive_acq);
+
+    // Process results
+    const AcqPerfTest_true_obs& true_obs = signal.true_obs[point.satellite];
+    arma::vec clean_doppler_estimation_error;
+    arma::vec clean_delay_estimation_error;
+    int num_clean_executions = 0;
+    if (true_obs.timestamp_s.n_elem > 2)
+        {
+            arma::vec true_interpolated_doppler = arma::zeros(num_executions, 1);
+            arma::vec true_interpolated_prn_delay_chips = arma::zeros(num_executions, 1);
+            interp1(true_obs.timestamp_s, true_obs.doppler_hz, meas_timestamp_s, true_interpolated_doppler);
+            interp1(true_obs.timestamp_s, true_obs.prn_delay_chips, meas_timestamp_s, true_interpolated_prn_delay_chips);
 
-    ch_thread.join();
+            arma::vec doppler_estimation_error = true_interpolated_doppler - meas_doppler;
+            arma::vec delay_estimation_error = true_interpolated_prn_delay_chips - (meas_acq_delay_chips - ((1.0 / baseband_sampling_freq) / GPS_L1_CA_CHIP_PERIOD_S));  // compensate 1 sample delay
 
-    return 0;
+            // Cut measurements without reference
+            for (int i = 0; i < num_executions; i++)
+                {
+                    if (!std::isnan(doppler_estimation_error(i)) and !std::isnan(delay_estimation_error(i)))
+                        {
+                            num_clean_executions++;
+                        }
+                }
+            clean_doppler_estimation_error = arma::zeros(num_clean_executions, 1);
+            clean_delay_estimation_error = arma::zeros(num_clean_executions, 1);
+            num_clean_executions = 0;
+            for (int i = 0; i < num_executions; i++)
+                {
+                    if (!std::isnan(doppler_estimation_error(i)) and !std::isnan(delay_estimation_error(i)))
+                        {
+                            clean_doppler_estimation_error(num_clean_executions) = doppler_estimation_error(i);
+                            clean_delay_estimation_error(num_clean_executions) = delay_estimation_error(i);
+                            num_clean_executions++;
+                        }
+                }
+        }
+    result.num_clean_executions = num_clean_executions;
+    for (int i = 0; i < num_clean_executions - 1; i++)
+        {
+            if (abs(clean_delay_estimation_error(i)) < 0.5 and abs(clean_doppler_estimation_error(i)) < static_cast<float>(configuration->property("Acquisition.doppler_step", 1)) / 2.0)
+                {
+                    result.correctly_detected = result.correctly_detected + 1.0;
+                }
+        }
+    return result;
 }
 
 
-int AcquisitionPerformanceTest::count_executions(const std::string& basename, unsigned int sat)
+std::vector<AcqPerfTest_result> AcquisitionPerformanceTest::run_points(const std::vector<AcqPerfTest_point>& points, const std::vector<AcqPerfTest_signal>& signals) const
 {
-    FILE* fp;
-    std::string argum2 = std::string("/usr/bin/find ") + path_str + std::string(" -maxdepth 1 -name ") + basename.substr(path_str.length() + 1, basename.length() - path_str.length()) + std::string("* | grep sat_") + std::to_string(sat) + std::string(" | wc -l");
-    char buffer[1024];
-    fp = popen(&argum2[0], "r");
-    int num_executions = 1;
-    if (fp == nullptr)
+    // Each worker takes the next pending point and stores its result in the
+    // slot of that point, so the merge does not depend on the execution order
+    std::vector<AcqPerfTest_result> results(points.size());
+    std::atomic<size_t> next_point{0};
+    std::atomic<size_t> finished_points{0};
+    std::mutex progress_mutex;
+    auto worker = [&]() {
+        for (size_t i = next_point++; i < points.size(); i = next_point++)
+            {
+                results[i] = run_point(points[i], signals[points[i].iter]);
+                const size_t finished = ++finished_points;
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                std::cout << "Progress: " << round(static_cast<float>(finished) / static_cast<float>(points.size()) * 100.0) << "% \r" << std::flush;
+            }
+    };
+
+    size_t n_workers = FLAGS_acq_test_workers > 0 ? static_cast<size_t>(FLAGS_acq_test_workers) : std::max(std::thread::hardware_concurrency(), 1U);
+    if (FLAGS_acq_test_dump)
         {
-            std::cout << "Failed to run command: " << argum2 << '\n';
-            return 0;
+            // The .mat files are written through matio and HDF5, which are not thread-safe
+            n_workers = 1;
+        }
+    n_workers = std::min(n_workers, points.size());
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < n_workers; w++)
+        {
+            workers.emplace_back(worker);
         }
-    while (fgets(buffer, sizeof(buffer), fp) != nullptr)
+    for (auto& w : workers)
         {
-            std::string aux = std::string(buffer);
-            EXPECT_EQ(aux.empty(), false);
-            num_executions = std::stoi(aux);
+            w.join();
         }
-    pclose(fp);
-    return num_executions;
+    std::cout << '\n';
+    return results;
 }
 
 
@@ -790,8 +1054,6 @@ void AcquisitionPerformanceTest::plot_results()
 
 TEST_F(AcquisitionPerformanceTest, ROC)
 {
-    Tracking_True_Obs_Reader true_trk_data;
-
     if (fs::exists(path_str))
         {
             fs::remove_all(path_str);
@@ -799,198 +1061,84 @@ TEST_F(AcquisitionPerformanceTest, ROC)
     errorlib::error_code ec;
     ASSERT_TRUE(fs::create_directory(path_str, ec)) << "Could not create the " << path_str << " folder.";
 
-    unsigned int cn0_index = 0;
-    for (double it : cn0_vector)
+    std::shared_ptr<const std::vector<int8_t>> input_file_samples;
+    for (size_t cn0_index = 0; cn0_index < cn0_vector.size(); cn0_index++)
         {
-            std::vector<double> meas_Pd_;
-            std::vector<double> meas_Pd_correct_;
-            std::vector<double> meas_Pfa_;
-
+            const double it = cn0_vector[cn0_index];
             if (FLAGS_acq_test_input_file.empty())
                 {
                     std::cout << "Execution for CN0 = " << it << " dB-Hz\n";
+                    // Configure the signal generator
+                    configure_generator(it);
                 }
 
-            // Do N_iterations of the experiment
-            for (int pfa_iter = 0; pfa_iter < static_cast<int>(pfa_vector.size()); pfa_iter++)
+            // Generate the N_iterations signal realizations (same signal, different noise)
+            // once, and keep them in memory for all the thresholds
+            config = configure_receiver(it, pfa_vector[0], 0);
+            const auto nsamples = static_cast<int64_t>(floor(config->property("GNSS-SDR.internal_fs_sps", 2000000) * generated_signal_duration_s));
+            std::vector<AcqPerfTest_signal> signals(N_iterations);
+            for (int iter = 0; iter < N_iterations; iter++)
                 {
-                    if (FLAGS_acq_test_pfa_init > 0.0)
+                    if (FLAGS_acq_test_input_file.empty())
                         {
-                            std::cout << "Setting threshold for Pfa = " << pfa_vector[pfa_iter] << '\n';
+                            // Generate signal raw signal samples and observations RINEX file
+                            generate_signal();
+                            signals[iter].samples = load_samples("./" + filename_raw_data, nsamples);
                         }
                     else
                         {
-                            std::cout << "Setting threshold to " << pfa_vector[pfa_iter] << '\n';
-                        }
-
-                    // Configure the signal generator
-                    if (FLAGS_acq_test_input_file.empty())
-                        {
-                            configure_generator(it);
+                            if (input_file_samples == nullptr)
+                                {
+                                    input_file_samples = load_samples(FLAGS_acq_test_input_file, nsamples);
+                                }
+                            signals[iter].samples = input_file_samples;
                         }
+                    signals[iter].true_obs[0] = read_true_obs(FLAGS_acq_test_PRN);
+                    signals[iter].true_obs[1] = read_true_obs(FLAGS_acq_test_fake_PRN);
+                }
 
+            // Run all the thresholds, iterations and satellites of this CN0 in parallel
+            std::vector<AcqPerfTest_point> points;
+            for (size_t pfa_iter = 0; pfa_iter < pfa_vector.size(); pfa_iter++)
+                {
                     for (int iter = 0; iter < N_iterations; iter++)
                         {
-                            // Generate signal raw signal samples and observations RINEX file
-                            if (FLAGS_acq_test_input_file.empty())
-                                {
-                                    generate_signal();
-                                }
-
                             for (unsigned k = 0; k < 2; k++)
                                 {
-                                    if (k == 0)
-                                        {
-                                            observed_satellite = FLAGS_acq_test_PRN;
-                                        }
-                                    else
-                                        {
-                                            observed_satellite = FLAGS_acq_test_fake_PRN;
-                                        }
-                                    init();
-
-                                    // Configure the receiver
-                                    configure_receiver(it, pfa_vector[pfa_iter], iter);
-
-                                    // Run it
-                                    run_receiver();
-
-                                    // count executions
-                                    std::string basename = path_str + std::string("/acquisition_") + std::to_string(it) + "_" + std::to_string(iter) + "_" + std::to_string(pfa_vector[pfa_iter]) + "_" + gnss_synchro.System + "_" + signal_id;
-                                    int num_executions = count_executions(basename, observed_satellite);
+                                    points.push_back({cn0_index, pfa_iter, static_cast<unsigned int>(iter), k});
+                                }
+                        }
+                }
+            const std::vector<AcqPerfTest_result> results = run_points(points, signals);
 
-                                    // Read measured data
-                                    int ch = config->property("Acquisition.dump_channel", 0);
-                                    arma::vec meas_timestamp_s = arma::zeros(num_executions, 1);
-                                    arma::vec meas_doppler = arma::zeros(num_executions, 1);
-                                    arma::vec positive_acq = arma::zeros(num_executions, 1);
-                                    arma::vec meas_acq_delay_chips = arma::zeros(num_executions, 1);
+            // Merge the results in the order of the sweep
+            size_t point_index = 0;
+            for (int pfa_iter = 0; pfa_iter < static_cast<int>(pfa_vector.size()); pfa_iter++)
+                {
+                    std::vector<double> meas_Pd_;
+                    std::vector<double> meas_Pd_correct_;
+                    std::vector<double> meas_Pfa_;
 
-                                    double coh_time_ms = config->property("Acquisition.coherent_integration_time_ms", 1);
+                    if (FLAGS_acq_test_pfa_init > 0.0)
+                        {
+                            std::cout << "Threshold set for Pfa = " << pfa_vector[pfa_iter] << '\n';
+                        }
+                    else
+                        {
+                            std::cout << "Threshold set to " << pfa_vector[pfa_iter] << '\n';
+                        }
 
+                    for (int iter = 0; iter < N_iterations; iter++)
+                        {
+                            for (unsigned k = 0; k < 2; k++)
+                                {
+                                    const AcqPerfTest_result& result = results[point_index++];
+                                    const int num_executions = result.num_executions;
+                                    const int ch = config->property("Acquisition.dump_channel", 0);
                                     std::cout << "Num executions: " << num_executions << '\n';
-
-                                    unsigned int fft_size = 0;
-                                    unsigned int d_consumed_samples = coh_time_ms * config->property("GNSS-SDR.internal_fs_sps", 0) * 0.001;  // * (config->property("Acquisition.bit_transition_flag", false) ? 2 : 1);
-                                    if (coh_time_ms == min_integration_ms)
-                                        {
-                                            fft_size = d_consumed_samples;
-                                        }
-                                    else
-                                        {
-                                            fft_size = d_consumed_samples * 2;
-                                        }
-
-                                    for (int execution = 1; execution <= num_executions; execution++)
-                                        {
-                                            Acquisition_Dump_Reader acq_dump(basename,
-                                                observed_satellite,
-                                                config->property("Acquisition.doppler_max", 0),
-                                                config->property("Acquisition.doppler_step", 0),
-                                                fft_size,
-                                                ch,
-                                                execution);
-                                            acq_dump.read_binary_acq();
-                                            if (acq_dump.positive_acq)
-                                                {
-                                                    // std::cout << "Meas acq_delay_samples: " << acq_dump.acq_delay_samples << " chips: " << acq_dump.acq_delay_samples / (baseband_sampling_freq * GPS_L1_CA_CODE_PERIOD_S / GPS_L1_CA_CODE_LENGTH_CHIPS) << '\n';
-                                                    meas_timestamp_s(execution - 1) = acq_dump.sample_counter / baseband_sampling_freq;
-                                                    meas_doppler(execution - 1) = acq_dump.acq_doppler_hz;
-                                                    meas_acq_delay_chips(execution - 1) = acq_dump.acq_delay_samples / (baseband_sampling_freq * GPS_L1_CA_CODE_PERIOD_S / GPS_L1_CA_CODE_LENGTH_CHIPS);
-                                                    positive_acq(execution - 1) = acq_dump.positive_acq;
-                                                }
-                                            else
-                                                {
-                                                    // std::cout << "Failed acquisition.\n";
-                                                    meas_timestamp_s(execution - 1) = arma::datum::inf;
-                                                    meas_doppler(execution - 1) = arma::datum::inf;
-                                                    meas_acq_delay_chips(execution - 1) = arma::datum::inf;
-                                                    positive_acq(execution - 1) = acq_dump.positive_acq;
-                                                }
-                                        }
-
-                                    // Read reference data
-                                    std::string true_trk_file = std::string("./gps_l1_ca_obs_prn");
-                                    true_trk_file.append(std::to_string(observed_satellite));
-                                    true_trk_file.append(".dat");
-                                    true_trk_data.close_obs_file();
-                                    true_trk_data.open_obs_file(true_trk_file);
-
-                                    // load the true values
-                                    int64_t n_true_epochs = true_trk_data.num_epochs();
-                                    arma::vec true_timestamp_s = arma::zeros(n_true_epochs, 1);
-                                    arma::vec true_acc_carrier_phase_cycles = arma::zeros(n_true_epochs, 1);
-                                    arma::vec true_Doppler_Hz = arma::zeros(n_true_epochs, 1);
-                                    arma::vec true_prn_delay_chips = arma::zeros(n_true_epochs, 1);
-                                    arma::vec true_tow_s = arma::zeros(n_true_epochs, 1);
-
-                                    int64_t epoch_counter = 0;
-                                    int num_clean_executions = 0;
-                                    while (true_trk_data.read_binary_obs())
-                                        {
-                                            true_timestamp_s(epoch_counter) = true_trk_data.signal_timestamp_s;
-                                            true_acc_carrier_phase_cycles(epoch_counter) = true_trk_data.acc_carrier_phase_cycles;
-                                            true_Doppler_Hz(epoch_counter) = true_trk_data.doppler_l1_hz;
-                                            true_prn_delay_chips(epoch_counter) = GPS_L1_CA_CODE_LENGTH_CHIPS - true_trk_data.prn_delay_chips;
-                                            true_tow_s(epoch_counter) = true_trk_data.tow;
-                                            epoch_counter++;
-                                            // std::cout << "True PRN_Delay chips = " << GPS_L1_CA_CODE_LENGTH_CHIPS - true_trk_data.prn_delay_chips << " at " << true_trk_data.signal_timestamp_s << '\n';
-                                        }
-
-                                    // Process results
-                                    arma::vec clean_doppler_estimation_error;
-                                    arma::vec clean_delay_estimation_error;
-
-                                    if (epoch_counter > 2)
-                                        {
-                                            arma::vec true_interpolated_doppler = arma::zeros(num_executions, 1);
-                                            arma::vec true_interpolated_prn_delay_chips = arma::zeros(num_executions, 1);
-                                            interp1(true_timestamp_s, true_Doppler_Hz, meas_timestamp_s, true_interpolated_doppler);
-                                            interp1(true_timestamp_s, true_prn_delay_chips, meas_timestamp_s, true_interpolated_prn_delay_chips);
-
-                                            arma::vec doppler_estimation_error = true_interpolated_doppler - meas_doppler;
-                                            arma::vec delay_estimation_error = true_interpolated_prn_delay_chips - (meas_acq_delay_chips - ((1.0 / baseband_sampling_freq) / GPS_L1_CA_CHIP_PERIOD_S));  // compensate 1 sample delay
-
-                                            // Cut measurements without reference
-                                            for (int i = 0; i < num_executions; i++)
-                                                {
-                                                    if (!std::isnan(doppler_estimation_error(i)) and !std::isnan(delay_estimation_error(i)))
-                                                        {
-                                                            num_clean_executions++;
-                                                        }
-                                                }
-                                            clean_doppler_estimation_error = arma::zeros(num_clean_executions, 1);
-                                            clean_delay_estimation_error = arma::zeros(num_clean_executions, 1);
-                                            num_clean_executions = 0;
-                                            for (int i = 0; i < num_executions; i++)
-                                                {
-                                                    if (!std::isnan(doppler_estimation_error(i)) and !std::isnan(delay_estimation_error(i)))
-                                                        {
-                                                            clean_doppler_estimation_error(num_clean_executions) = doppler_estimation_error(i);
-                                                            clean_delay_estimation_error(num_clean_executions) = delay_estimation_error(i);
-                                                            num_clean_executions++;
-                                                        }
-                                                }
-
-                                            /* std::cout << "Doppler estimation error [Hz]: ";
-                                            for (int i = 0; i < num_executions - 1; i++)
-                                                {
-                                                    std::cout << doppler_estimation_error(i) << " ";
-                                                }
-                                            std::cout << '\n';
-
-                                            std::cout << "Delay estimation error [chips]: ";
-                                            for (int i = 0; i < num_executions - 1; i++)
-                                                {
-                                                    std::cout << delay_estimation_error(i) << " ";
-
-                                                }
-                                            std::cout << '\n'; */
-                                        }
                                     if (k == 0)
                                         {
-                                            double detected = arma::accu(positive_acq);
-                                            double computed_Pd = detected / static_cast<double>(num_executions);
+                                            double computed_Pd = result.detected / static_cast<double>(num_executions);
                                             if (num_executions > 0)
                                                 {
                                                     meas_Pd_.push_back(computed_Pd);
@@ -1002,30 +1150,18 @@ TEST_F(AcquisitionPerformanceTest, ROC)
                                             std::cout << TEXT_BOLD_BLACK << "Probability of detection for channel=" << ch << ", CN0=" << it << " dBHz"
                                                       << ": " << (num_executions > 0 ? computed_Pd : 0.0) << TEXT_RESET << '\n';
                                         }
-                                    if (num_clean_executions > 0)
+                                    if (result.num_clean_executions > 0)
                                         {
-                                            arma::vec correct_acq = arma::zeros(num_executions, 1);
-                                            double correctly_detected = 0.0;
-                                            for (int i = 0; i < num_clean_executions - 1; i++)
-
-                                                {
-                                                    if (abs(clean_delay_estimation_error(i)) < 0.5 and abs(clean_doppler_estimation_error(i)) < static_cast<float>(config->property("Acquisition.doppler_step", 1)) / 2.0)
-                                                        {
-                                                            correctly_detected = correctly_detected + 1.0;
-                                                        }
-                                                }
-                                            double computed_Pd_correct = correctly_detected / static_cast<double>(num_clean_executions);
+                                            double computed_Pd_correct = result.correctly_detected / static_cast<double>(result.num_clean_executions);
                                             meas_Pd_correct_.push_back(computed_Pd_correct);
                                             std::cout << TEXT_BOLD_BLACK << "Probability of correct detection for channel=" << ch << ", CN0=" << it << " dBHz"
                                                       << ": " << computed_Pd_correct << TEXT_RESET << '\n';
                                         }
                                     else
                                         {
-                                            // std::cout << "No reference data has been found. Maybe a non-present satellite?" << num_executions << '\n';
                                             if (k == 1)
                                                 {
-                                                    double wrongly_detected = arma::accu(positive_acq);
-                                                    double computed_Pfa = wrongly_detected / static_cast<double>(num_executions);
+                                                    double computed_Pfa = result.detected / static_cast<double>(num_executions);
                                                     if (num_executions > 0)
                                                         {
                                                             meas_Pfa_.push_back(computed_Pfa);
@@ -1038,10 +1174,8 @@ TEST_F(AcquisitionPerformanceTest, ROC)
                                                               << ": " << (num_executions > 0 ? computed_Pfa : 0.0) << TEXT_RESET << '\n';
                                                 }
                                         }
-                                    true_trk_data.restart();
                                 }
                         }
-                    true_trk_data.close_obs_file();
                     float sum_pd = static_cast<float>(std::accumulate(meas_Pd_.begin(), meas_Pd_.end(), 0.0));
                     float sum_pd_correct = static_cast<float>(std::accumulate(meas_Pd_correct_.begin(), meas_Pd_correct_.end(), 0.0));
                     float sum_pfa = static_cast<float>(std::accumulate(meas_Pfa_.begin(), meas_Pfa_.end(), 0.0));
@@ -1077,11 +1211,7 @@ TEST_F(AcquisitionPerformanceTest, ROC)
                         {
                             Pd_correct[cn0_index][pfa_iter] = 0.0;
                         }
-                    meas_Pd_.clear();
-                    meas_Pfa_.clear();
-                    meas_Pd_correct_.clear();
                 }
-            cn0_index++;
         }
 
     // Compute results
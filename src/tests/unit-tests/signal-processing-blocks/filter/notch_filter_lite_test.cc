@@ -21,6 +21,7 @@
 #include <complex>
 #include <cstdint>
 #include <thread>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
 #else
@@ -33,6 +34,7 @@
 #include "gnss_sdr_make_unique.h"
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
+#include "interference_filter_test.h"
 #include "notch_filter_lite.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
@@ -62,6 +64,7 @@ protected:
 
     void init();
     void configure_gr_complex_gr_complex();
+    void configure_cshort_cshort();
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<InMemoryConfiguration> config;
@@ -117,6 +120,14 @@ void NotchFilterLiteTest::configure_gr_complex_gr_complex()
 }
 
 
+void NotchFilterLiteTest::configure_cshort_cshort()
+{
+    config->set_property("InputFilter.item_type", "cshort");
+    config->set_property("InputFilter.input_item_type", "cshort");
+    config->set_property("InputFilter.output_item_type", "cshort");
+}
+
+
 TEST_F(NotchFilterLiteTest, InstantiateGrComplexGrComplex)
 {
     init();
@@ -207,3 +218,29 @@ TEST_F(NotchFilterLiteTest, ConnectAndRunGrcomplex)
     ch_thread.join();
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST_F(NotchFilterLiteTest, SuppressesCwGrComplex)
+{
+    init();
+    configure_gr_complex_gr_complex();
+    config->set_property("InputFilter.segments_est", std::to_string(INTERFERENCE_TEST_SEGMENTS_EST));
+    auto filter = std::make_shared<NotchFilterLite>(config.get(), "InputFilter", 1, 1);
+    const std::vector<gr_complex> input = make_cw_interference_signal();
+    const std::vector<gr_complex> output = run_interference_filter(filter.get(), input);
+    // With the default coeff_rate, the coefficient is computed on every segment
+    check_interference_filter_output(input, output, reference_notch(input, true, 0.01, 0.9, 32, INTERFERENCE_TEST_SEGMENTS_EST, 5000000, 1), 0.1, 0.0);
+}
+
+
+TEST_F(NotchFilterLiteTest, SuppressesCwCshort)
+{
+    init();
+    configure_cshort_cshort();
+    config->set_property("InputFilter.segments_est", std::to_string(INTERFERENCE_TEST_SEGMENTS_EST));
+    auto filter = std::make_shared<NotchFilterLite>(config.get(), "InputFilter", 1, 1);
+    const std::vector<gr_complex> input = make_cw_interference_signal();
+    const std::vector<gr_complex> output = to_gr_complex(run_interference_filter(filter.get(), to_cshort(input)));
+    // With the default coeff_rate, the coefficient is computed on every segment
+    check_interference_filter_output(input, output, reference_notch(input, true, 0.01, 0.9, 32, INTERFERENCE_TEST_SEGMENTS_EST, 5000000, 1), 0.1, 2.0);
+}
@@ -0,0 +1,101 @@
+/*!
+ * \file block_stats_test.cc
+ * \brief Unit tests for the run-time instrumentation of the processing blocks
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_block_stats.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+
+TEST(BlockStatsTest, CountersAndHistogram)
+{
+    Block_Stats stats("Tracking", "dll_pll_veml_tracking");
+    stats.set_channel(3);
+    stats.record_work(500, 10);        // bin 0, < 1 us
+    stats.record_work(1500, 30);       // bin 1, [1, 2) us
+    stats.record_work(3000, 20);       // bin 2, [2, 4) us
+    stats.record_work(1000000, 0);     // bin 10, [512, 1024) us
+    stats.add_dropped_samples(7);
+
+    const auto snap = stats.snapshot();
+    EXPECT_EQ(snap.stage, "Tracking");
+    EXPECT_EQ(snap.channel, 3);
+    EXPECT_EQ(snap.work_calls, 4U);
+    EXPECT_EQ(snap.work_time_ns, 1005000U);
+    EXPECT_EQ(snap.max_work_time_ns, 1000000U);
+    EXPECT_EQ(snap.max_input_items, 30U);
+    EXPECT_DOUBLE_EQ(snap.mean_input_items(), 15.0);
+    EXPECT_EQ(snap.dropped_samples, 7U);
+    EXPECT_EQ(snap.histogram[0], 1U);
+    EXPECT_EQ(snap.histogram[1], 1U);
+    EXPECT_EQ(snap.histogram[2], 1U);
+    EXPECT_EQ(snap.histogram[10], 1U);
+    EXPECT_DOUBLE_EQ(snap.work_time_percentile_us(0.5), 2.0);
+    EXPECT_DOUBLE_EQ(snap.work_time_percentile_us(0.99), 1024.0);
+
+    stats.reset();
+    EXPECT_EQ(stats.snapshot().work_calls, 0U);
+    EXPECT_EQ(stats.snapshot().histogram[10], 0U);
+}
+
+
+TEST(BlockStatsTest, ScopeOnlyRecordsWhenEnabled)
+{
+    Block_Stats stats("PVT", "rtklib_pvt_gs");
+    Block_Stats::set_enabled(false);
+    {
+        Block_Stats_Scope scope(&stats, 5);
+    }
+    EXPECT_EQ(stats.snapshot().work_calls, 0U);
+
+    Block_Stats::set_enabled(true);
+    {
+        Block_Stats_Scope scope(&stats, 5);
+    }
+    Block_Stats::set_enabled(false);
+    EXPECT_EQ(stats.snapshot().work_calls, 1U);
+    EXPECT_EQ(stats.snapshot().input_items, 5U);
+}
+
+
+TEST(BlockStatsTest, Registry)
+{
+    auto& registry = Block_Stats_Registry::instance();
+    const auto blocks_before = registry.snapshot().size();
+    auto tracking = registry.make("Tracking", "trk");
+    {
+        auto acquisition = registry.make("Acquisition", "acq");
+        const auto snaps = registry.snapshot();
+        ASSERT_EQ(snaps.size(), blocks_before + 2);
+        EXPECT_NE(registry.report().find("acq"), std::string::npos);
+    }
+    // Destroyed counters are no longer reported
+    EXPECT_EQ(registry.snapshot().size(), blocks_before + 1);
+
+    // Reads while the owner thread is writing
+    std::thread writer([&tracking]() {
+        for (int i = 0; i < 100000; i++)
+            {
+                tracking->record_work(2000, 1);
+            }
+    });
+    for (int i = 0; i < 100; i++)
+        {
+            registry.snapshot();
+        }
+    writer.join();
+    EXPECT_EQ(tracking->snapshot().work_calls, 100000U);
+}
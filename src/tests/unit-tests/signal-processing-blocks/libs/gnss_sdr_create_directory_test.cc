@@ -0,0 +1,64 @@
+/*!
+ * \file gnss_sdr_create_directory_test.cc
+ * \brief Tests for the creation of output directories
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_create_directory.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if HAS_STD_FILESYSTEM
+#if HAS_STD_FILESYSTEM_EXPERIMENTAL
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#include <filesystem>
+namespace fs = std::filesystem;
+#endif
+#else
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+#endif
+
+
+TEST(GnssSdrCreateDirectoryTest, ConcurrentCalls)
+{
+    // As the dump directories created by the channels when they are built in parallel
+    const std::string folder("./create_directory_test/dumps/acquisition");
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 16; i++)
+        {
+            threads.emplace_back([&]() {
+                for (int j = 0; j < 20; j++)
+                    {
+                        if (!gnss_sdr_create_directory(folder))
+                            {
+                                failures++;
+                            }
+                    }
+            });
+        }
+    for (auto& t : threads)
+        {
+            t.join();
+        }
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_TRUE(fs::is_directory(folder));
+    fs::remove_all("./create_directory_test");
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file gnss_signal_synthesizer_test.cc
+ * \brief Unit tests for the multi-satellite GNSS signal synthesizer
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_synthesizer.h"
+#include "gps_sdr_signal_replica.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+Gnss_Scenario gps_scenario(bool noise_flag)
+{
+    Gnss_Scenario scenario;
+    scenario.fs_hz = 4e6;
+    scenario.noise_flag = noise_flag;
+    scenario.data_flag = false;
+    scenario.seed = 7;
+    Gnss_Scenario_Satellite sat;
+    sat.PRN = 1;
+    sat.CN0_dB_Hz = 50.0;
+    sat.doppler_Hz = 1250.0;
+    sat.doppler_rate_Hz_s = -0.6;
+    sat.code_phase_chips = 100.5;
+    scenario.satellites.push_back(sat);
+    return scenario;
+}
+
+
+// Correlation of x with the GPS L1 C/A PRN 1 replica at the true code and carrier phases
+std::complex<double> correlate(const Gnss_Signal_Synthesizer& synthesizer, const std::vector<std::complex<float>>& x,
+    double fs, double doppler_error_Hz)
+{
+    std::array<float, 1023> code{};
+    gps_l1_ca_code_gen_float(code, 1, 0);
+    std::complex<double> acc(0.0, 0.0);
+    for (size_t k = 0; k < x.size(); k++)
+        {
+            const double t = static_cast<double>(k) / fs;
+            const auto obs = synthesizer.true_observables(0, t);
+            const double phase = 2.0 * M_PI * (obs.carrier_phase_cycles + doppler_error_Hz * t);
+            const auto chip = static_cast<size_t>(std::floor(obs.code_phase_chips)) % 1023;
+            acc += std::complex<double>(x[k]) * std::polar(1.0, -phase) * static_cast<double>(code[chip]);
+        }
+    return acc / static_cast<double>(x.size());
+}
+}  // namespace
+
+
+TEST(GnssSignalSynthesizerTest, CodeAndCarrier)
+{
+    const auto scenario = gps_scenario(false);
+    Gnss_Signal_Synthesizer synthesizer(scenario, 1);
+    std::vector<std::complex<float>> x(40000);
+    synthesizer.generate(x.data(), 0, x.size());
+
+    // Unit power and aligned with the true observables
+    EXPECT_NEAR(std::abs(correlate(synthesizer, x, scenario.fs_hz, 0.0)), 1.0, 0.02);
+    // A 1 kHz Doppler error over 10 ms cancels the correlation
+    EXPECT_LT(std::abs(correlate(synthesizer, x, scenario.fs_hz, 1000.0)), 0.05);
+}
+
+
+TEST(GnssSignalSynthesizerTest, CN0)
+{
+    const auto scenario = gps_scenario(true);
+    Gnss_Signal_Synthesizer synthesizer(scenario, 2);
+    std::vector<std::complex<float>> x(400000);
+    synthesizer.generate(x.data(), 0, x.size());
+
+    double power = 0.0;
+    for (const auto& sample : x)
+        {
+            power += std::norm(sample);
+        }
+    power /= static_cast<double>(x.size());
+    const double expected_amplitude = std::sqrt(std::pow(10.0, scenario.satellites[0].CN0_dB_Hz / 10.0) / scenario.fs_hz);
+    EXPECT_NEAR(power, 1.0 + expected_amplitude * expected_amplitude, 0.01);
+    EXPECT_NEAR(std::abs(correlate(synthesizer, x, scenario.fs_hz, 0.0)), expected_amplitude, 0.1 * expected_amplitude);
+}
+
+
+TEST(GnssSignalSynthesizerTest, ThreadsAndSplitsDoNotChangeTheOutput)
+{
+    Gnss_Scenario scenario = gps_scenario(true);
+    scenario.data_flag = true;
+    Gnss_Scenario_Satellite galileo;
+    galileo.system = "E";
+    galileo.signal = "1B";
+    galileo.PRN = 11;
+    galileo.doppler_Hz = -2300.0;
+    galileo.doppler_rate_Hz_s = 0.8;
+    galileo.code_phase_chips = 2000.25;
+    scenario.satellites.push_back(galileo);
+    Gnss_Scenario_Satellite e5a = galileo;
+    e5a.signal = "5X";
+    e5a.if_Hz = 1e6;
+    scenario.satellites.push_back(e5a);
+
+    const size_t n = 50000;
+    std::vector<std::complex<float>> reference(n);
+    Gnss_Signal_Synthesizer single(scenario, 1, 1000);
+    single.generate(reference.data(), 0, n);
+
+    std::vector<std::complex<float>> split(n);
+    Gnss_Signal_Synthesizer multi(scenario, 4, 1000);
+    multi.generate(split.data(), 0, 1234);
+    multi.generate(split.data() + 1234, 1234, 30000);
+    multi.generate(split.data() + 31234, 31234, n - 31234);
+    EXPECT_EQ(reference, split);
+
+    std::vector<std::complex<int8_t>> bytes(n);
+    multi.generate(bytes.data(), 0, n, 40.0);
+    for (size_t k = 0; k < n; k++)
+        {
+            const float re = std::max(-128.0F, std::min(127.0F, std::rint(reference[k].real() * 40.0F)));
+            const float im = std::max(-128.0F, std::min(127.0F, std::rint(reference[k].imag() * 40.0F)));
+            ASSERT_EQ(bytes[k], std::complex<int8_t>(static_cast<int8_t>(re), static_cast<int8_t>(im)));
+        }
+}
+
+
+TEST(GnssSignalSynthesizerTest, UnsupportedSignal)
+{
+    Gnss_Scenario scenario;
+    Gnss_Scenario_Satellite sat;
+    sat.system = "R";
+    sat.signal = "1G";
+    scenario.satellites.push_back(sat);
+    EXPECT_THROW(Gnss_Signal_Synthesizer synthesizer(scenario, 1), std::invalid_argument);
+}
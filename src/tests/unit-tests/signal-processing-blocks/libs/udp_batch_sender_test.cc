@@ -0,0 +1,127 @@
+/*!
+ * \file udp_batch_sender_test.cc
+ * \brief Unit tests for the batched sending of UDP datagrams
+ * \author agent, 2026. agent(at)local
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_make_unique.h"
+#include "udp_batch_sender.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+class UdpBatchSenderTest : public ::testing::Test
+{
+protected:
+    UdpBatchSenderTest() : receiver{io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)}
+    {
+    }
+
+    // Datagrams received until none arrives for timeout
+    std::vector<std::string> receive(std::chrono::milliseconds timeout = std::chrono::milliseconds(200))
+    {
+        std::vector<std::string> datagrams;
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline)
+            {
+                if (receiver.available() > 0)
+                    {
+                        std::string datagram(receiver.available(), '\0');
+                        datagram.resize(receiver.receive(boost::asio::buffer(&datagram[0], datagram.size())));
+                        datagrams.push_back(datagram);
+                        deadline = std::chrono::steady_clock::now() + timeout;
+                    }
+                else
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+            }
+        return datagrams;
+    }
+
+    void push(Udp_Batch_Sender& sender, const std::string& datagram)
+    {
+        sender.next_datagram() = datagram;
+        EXPECT_TRUE(sender.push());
+    }
+
+    b_io_context io_context;
+    boost::asio::ip::udp::socket receiver;
+};
+
+
+TEST_F(UdpBatchSenderTest, SendsFullBatches)
+{
+    // Two endpoints, so each datagram is received twice
+    const std::vector<boost::asio::ip::udp::endpoint> endpoints(2, receiver.local_endpoint());
+    Udp_Batch_Sender sender(endpoints, 10000, 3);
+    push(sender, "a");
+    push(sender, "b");
+    EXPECT_TRUE(sender.send_if_due());
+    EXPECT_TRUE(receive().empty());
+
+    push(sender, "c");
+    const std::vector<std::string> received = receive();
+    ASSERT_EQ(received.size(), 6U);
+    EXPECT_EQ(received[0], "a");
+    EXPECT_EQ(received[1], "a");
+    EXPECT_EQ(received[4], "c");
+    EXPECT_EQ(received[5], "c");
+}
+
+
+TEST_F(UdpBatchSenderTest, SendsAfterMaxLatency)
+{
+    Udp_Batch_Sender sender({receiver.local_endpoint()}, 50);
+    const auto start = std::chrono::steady_clock::now();
+    push(sender, "a");
+    push(sender, "b");
+
+    // Nothing else is pushed, nor send_if_due() called
+    const std::vector<std::string> received = receive(std::chrono::milliseconds(500));
+    ASSERT_EQ(received.size(), 2U);
+    EXPECT_EQ(received[0], "a");
+    EXPECT_EQ(received[1], "b");
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    push(sender, "c");
+    ASSERT_EQ(receive(std::chrono::milliseconds(500)).size(), 1U);
+}
+
+
+TEST_F(UdpBatchSenderTest, SendsWithoutLatency)
+{
+    Udp_Batch_Sender sender({receiver.local_endpoint()}, 0);
+    push(sender, "a");
+    push(sender, "b");
+    EXPECT_TRUE(receive().empty());
+    EXPECT_TRUE(sender.send_if_due());
+    EXPECT_EQ(receive().size(), 2U);
+}
+
+
+TEST_F(UdpBatchSenderTest, SendsOnDestruction)
+{
+    auto sender = std::make_unique<Udp_Batch_Sender>(std::vector<boost::asio::ip::udp::endpoint>{receiver.local_endpoint()}, 10000);
+    push(*sender, "a");
+    push(*sender, "b");
+    EXPECT_TRUE(receive().empty());
+    sender.reset();
+    const std::vector<std::string> received = receive();
+    ASSERT_EQ(received.size(), 2U);
+    EXPECT_EQ(received[1], "b");
+}
@@ -0,0 +1,63 @@
+/*!
+ * \file pvt_worker_pool_test.cc
+ * \brief Tests for the pool of threads that solve the positioning modes
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_worker_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+
+TEST(PvtWorkerPoolTest, RunsEachTaskOnce)
+{
+    for (size_t n_workers = 0; n_workers < 4; n_workers++)
+        {
+            Pvt_Worker_Pool pool(n_workers);
+            EXPECT_EQ(pool.size(), n_workers);
+            // Several batches on the same workers, with more and fewer tasks than threads
+            for (size_t n_tasks = 0; n_tasks < 9; n_tasks++)
+                {
+                    std::vector<std::atomic<int>> runs(n_tasks);
+                    pool.run(n_tasks, [&runs](size_t i) { runs[i]++; });
+                    for (size_t i = 0; i < n_tasks; i++)
+                        {
+                            EXPECT_EQ(runs[i].load(), 1) << n_workers << " workers, task " << i << " of " << n_tasks;
+                        }
+                }
+        }
+}
+
+
+TEST(PvtWorkerPoolTest, RunsTasksConcurrently)
+{
+    Pvt_Worker_Pool pool(2);
+    std::vector<std::thread::id> ids(3);
+    std::atomic<int> arrived{0};
+    // Each task waits for the others, so the batch finishes only if they run in parallel
+    pool.run(3, [&](size_t i) {
+        ids[i] = std::this_thread::get_id();
+        arrived++;
+        while (arrived.load() < 3)
+            {
+                std::this_thread::yield();
+            }
+    });
+    EXPECT_NE(ids[0], ids[1]);
+    EXPECT_NE(ids[0], ids[2]);
+    EXPECT_NE(ids[1], ids[2]);
+}
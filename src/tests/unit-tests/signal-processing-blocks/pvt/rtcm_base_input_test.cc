@@ -0,0 +1,208 @@
+/*!
+ * \file rtcm_base_input_test.cc
+ * \brief Tests for the RTCM 3 input of base station observations
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include "gps_ephemeris.h"
+#include "rtcm.h"
+#include "rtcm_base_input.h"
+#include "rtklib_rtkcmn.h"
+#include <boost/asio.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+const uint32_t BASE_STATION_ID = 2003;
+const std::array<double, 3> BASE_POSITION{1114104.5999, -4850729.7108, 3975521.4643};
+
+
+double base_pseudorange(int32_t prn, double tow)
+{
+    return 2.0e7 + 1.0e5 * prn + 10.0 * std::fmod(tow, 100.0);
+}
+
+
+// Station coordinates (MT1005) followed by one MT1002 message per epoch, at 1 s intervals
+std::string make_base_stream(double first_tow, int epochs)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    const Gps_Ephemeris gps_eph;
+    std::string stream = rtcm->print_MT1005(BASE_STATION_ID, BASE_POSITION[0], BASE_POSITION[1], BASE_POSITION[2], true, false, false, false, false, 0);
+    for (int k = 0; k < epochs; k++)
+        {
+            const double tow = first_tow + k;
+            std::map<int32_t, Gnss_Synchro> observables;
+            for (int32_t prn : {17, 3, 28, 9, 12})  // not sorted on purpose
+                {
+                    Gnss_Synchro gnss_synchro{};
+                    gnss_synchro.System = 'G';
+                    std::memcpy(static_cast<void*>(gnss_synchro.Signal), "1C", 3);
+                    gnss_synchro.PRN = prn;
+                    gnss_synchro.Pseudorange_m = base_pseudorange(prn, tow);
+                    gnss_synchro.CN0_dB_hz = 45.0;
+                    observables[prn] = gnss_synchro;
+                }
+            stream += rtcm->print_MT1002(gps_eph, tow, observables, BASE_STATION_ID);
+        }
+    return stream;
+}
+
+
+bool wait_for_base_epoch(Rtcm_Base_Input& input, const gtime_t& rover_time, double max_age_s, Rtcm_Base_Epoch& epoch)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        {
+            if (input.get_base_epoch(rover_time, max_age_s, epoch))
+                {
+                    return true;
+                }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    return false;
+}
+
+
+void check_base_epoch(const Rtcm_Base_Epoch& epoch, double tow)
+{
+    int week = 0;
+    EXPECT_NEAR(time2gpst(epoch.time, &week), tow, 1e-6);
+    EXPECT_EQ(epoch.station_id, static_cast<int>(BASE_STATION_ID));
+    ASSERT_EQ(epoch.n_obs, 5);
+    for (int i = 0; i < epoch.n_obs; i++)
+        {
+            const obsd_t& obs = epoch.obs[i];
+            EXPECT_EQ(obs.rcv, 2);
+            if (i > 0)
+                {
+                    EXPECT_LT(epoch.obs[i - 1].sat, obs.sat);
+                }
+            int prn = 0;
+            EXPECT_EQ(satsys(obs.sat, &prn), SYS_GPS);
+            EXPECT_NEAR(obs.P[0], base_pseudorange(prn, tow), 0.02);
+        }
+    for (int k = 0; k < 3; k++)
+        {
+            EXPECT_NEAR(epoch.position[k], BASE_POSITION[k], 1e-3);
+        }
+}
+}  // namespace
+
+
+TEST(RtcmBaseInputTest, FileReplay)
+{
+    const std::string file_name("rtcm_base_input_test.rtcm3");
+    const int week = 2150;
+    const double first_tow = 345600.0;
+    {
+        std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+        file << make_base_stream(first_tow, 20);
+    }
+
+    Rtcm_Base_Input input("file://" + file_name);
+    EXPECT_FALSE(input.is_real_time());
+    Rtcm_Base_Epoch epoch;
+
+    // Nearest base epoch to the rover epoch
+    ASSERT_TRUE(wait_for_base_epoch(input, gpst2time(week, first_tow + 2.3), 1.0, epoch));
+    check_base_epoch(epoch, first_tow + 2.0);
+    ASSERT_TRUE(wait_for_base_epoch(input, gpst2time(week, first_tow + 2.6), 0.45, epoch));
+    check_base_epoch(epoch, first_tow + 3.0);
+
+    // The file is replayed at the pace of the rover
+    EXPECT_LT(input.get_stats().epochs_decoded, 20U);
+
+    // Too old
+    ASSERT_TRUE(wait_for_base_epoch(input, gpst2time(week, first_tow + 19.0), 0.5, epoch));
+    check_base_epoch(epoch, first_tow + 19.0);
+    EXPECT_FALSE(input.get_base_epoch(gpst2time(week, first_tow + 20.8), 0.5, epoch));
+    EXPECT_TRUE(input.get_base_epoch(gpst2time(week, first_tow + 20.8), 2.0, epoch));
+
+    const Rtcm_Base_Stats stats = input.get_stats();
+    EXPECT_EQ(stats.epochs_decoded, 20U);
+    EXPECT_EQ(stats.bytes, static_cast<uint64_t>(make_base_stream(first_tow, 20).size()));
+    EXPECT_GE(stats.epochs_used, 4U);
+    EXPECT_GE(stats.epochs_missing, 1U);
+    EXPECT_NEAR(stats.max_age_s, 1.8, 1e-3);
+    std::remove(file_name.c_str());
+}
+
+
+TEST(RtcmBaseInputTest, TcpServerStandIn)
+{
+    // Local stand-in for a base station caster, streaming the last epochs
+    b_io_context io_context;
+    boost::asio::ip::tcp::acceptor acceptor(io_context, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    const uint16_t port = acceptor.local_endpoint().port();
+    int week = 0;
+    const double first_tow = std::floor(time2gpst(utc2gpst(timeget()), &week)) - 2.0;
+    std::atomic<bool> done{false};
+    std::thread server([&]() {
+        boost::asio::ip::tcp::socket socket(io_context);
+        boost::system::error_code ec;
+        acceptor.accept(socket, ec);
+        if (ec)
+            {
+                return;
+            }
+        const std::string stream = make_base_stream(first_tow, 3);
+        boost::asio::write(socket, boost::asio::buffer(stream), ec);
+        while (!done.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+    });
+
+    {
+        Rtcm_Base_Input input("tcp://127.0.0.1:" + std::to_string(port));
+        EXPECT_TRUE(input.is_real_time());
+        Rtcm_Base_Epoch epoch;
+        // No ASSERT here: the server thread must be released before leaving the test
+        const bool received = wait_for_base_epoch(input, gpst2time(week, first_tow + 2.0), 0.5, epoch);
+        EXPECT_TRUE(received);
+        if (received)
+            {
+                check_base_epoch(epoch, first_tow + 2.0);
+            }
+
+        const Rtcm_Base_Stats stats = input.get_stats();
+        EXPECT_EQ(stats.epochs_decoded, 3U);
+        EXPECT_EQ(stats.epochs_used, 1U);
+        EXPECT_GT(stats.mean_arrival_latency_ms, 0.0);
+        EXPECT_LT(stats.mean_arrival_latency_ms, 4000.0);
+        EXPECT_GE(stats.max_latency_ms, stats.mean_latency_ms);
+        EXPECT_GE(stats.max_queue_delay_ms, stats.mean_queue_delay_ms);
+        std::cout << "Base epoch arrival latency " << stats.mean_arrival_latency_ms << " ms, end to end "
+                  << stats.mean_latency_ms << " ms, queue delay " << stats.mean_queue_delay_ms << " ms\n";
+        done.store(true);
+    }
+    server.join();
+
+    // Invalid sources do not block
+    Rtcm_Base_Input invalid("tcp://base.station:2101");
+    Rtcm_Base_Epoch epoch;
+    EXPECT_FALSE(invalid.get_base_epoch(gpst2time(week, first_tow), 1.0, epoch));
+}
@@ -172,6 +172,43 @@ TEST(RtcmTest, CheckCRC)
 }
 
 
+TEST(RtcmTest, BitWriter)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    const std::string bits("0011111011011011110100110000001000000010100110");
+
+    Rtcm_Bit_Writer writer;
+    writer.put(std::bitset<12>("001111101101"));
+    writer.put(0x2F4, 10);
+    writer.put(std::string("110000001000000010"));
+    Rtcm_Bit_Writer tail;
+    tail.put(0x26, 6);
+    writer.append(tail);
+    EXPECT_EQ(bits.length(), writer.size_bits());
+
+    const std::string frame = writer.frame();
+    EXPECT_EQ(bits.length() / 8 + 7, frame.length());
+    EXPECT_EQ(true, rtcm->check_CRC(frame));
+    EXPECT_EQ(0, rtcm->binary_data_to_bin(frame).substr(0, 24).compare("110100110000000000000110"));
+    EXPECT_EQ(0, rtcm->binary_data_to_bin(frame).substr(24, bits.length()).compare(bits));
+}
+
+
+TEST(RtcmTest, BitWriterMaxLength)
+{
+    Rtcm_Bit_Writer writer;
+    for (int i = 0; i < 1023; i++)
+        {
+            writer.put(0xA5, 8);
+        }
+    EXPECT_EQ(1029U, writer.frame().length());
+
+    // the 10-bit message length field cannot hold a longer payload
+    writer.put(1, 1);
+    EXPECT_TRUE(writer.frame().empty());
+}
+
+
 TEST(RtcmTest, MT1001)
 {
     auto rtcm = std::make_shared<Rtcm>();
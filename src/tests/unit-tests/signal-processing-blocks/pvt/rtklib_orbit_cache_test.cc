@@ -0,0 +1,297 @@
+/*!
+ * \file rtklib_orbit_cache_test.cc
+ * \brief Tests for the short-arc cache of broadcast satellite orbits and clocks
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+const int EPH_WEEK = 2150;
+const double EPH_TOE = 345600.0;
+
+
+eph_t make_eph(int sys, int prn, double A, double e, double i0)
+{
+    eph_t eph{};
+    eph.sat = satno(sys, prn);
+    eph.iode = 42;
+    eph.iodc = 42;
+    eph.toe = gpst2time(EPH_WEEK, EPH_TOE);
+    eph.toc = eph.toe;
+    eph.toes = EPH_TOE;
+    eph.A = A;
+    eph.e = e;
+    eph.i0 = i0;
+    eph.OMG0 = -2.1 + 0.3 * prn;
+    eph.omg = 0.85;
+    eph.M0 = 1.2 - 0.2 * prn;
+    eph.deln = 4.6e-9;
+    eph.OMGd = -8.1e-9;
+    eph.idot = 2.0e-10;
+    eph.crc = 230.0;
+    eph.crs = -60.0;
+    eph.cuc = -3.1e-6;
+    eph.cus = 7.9e-6;
+    eph.cic = 1.1e-7;
+    eph.cis = -4.0e-8;
+    eph.f0 = -2.5e-4;
+    eph.f1 = -7.0e-12;
+    eph.f2 = 1.0e-19;
+    return eph;
+}
+
+
+geph_t make_geph(int prn)
+{
+    geph_t geph{};
+    geph.sat = satno(SYS_GLO, prn);
+    geph.iode = 12;
+    geph.toe = gpst2time(EPH_WEEK, EPH_TOE + 900.0);
+    geph.pos[0] = 1.0e7;
+    geph.pos[1] = -1.5e7;
+    geph.pos[2] = 1.806e7;
+    geph.vel[0] = 2500.0;
+    geph.vel[1] = 2800.0;
+    geph.vel[2] = 941.3;
+    geph.acc[0] = 1.0e-6;
+    geph.acc[1] = -2.0e-6;
+    geph.acc[2] = -3.0e-6;
+    geph.taun = 1.2e-5;
+    geph.gamn = 9.1e-13;
+    return geph;
+}
+
+
+struct Orbit_Errors
+{
+    double pos{0.0};
+    double vel{0.0};
+    double clk{0.0};
+    double drift{0.0};
+};
+
+
+// Maximum differences between ephpos() with and without cache
+Orbit_Errors compare_ephpos(nav_t& nav, orbcache_t& cache, int sat, gtime_t teph, double span_s, double step_s)
+{
+    Orbit_Errors errors;
+    for (double t = -span_s; t < span_s; t += step_s)
+        {
+            // times of transmission are not aligned with the arcs
+            const gtime_t time = timeadd(teph, t - 0.0713);
+            std::array<double, 6> rs{};
+            std::array<double, 6> rs_cache{};
+            std::array<double, 2> dts{};
+            std::array<double, 2> dts_cache{};
+            double var = 0.0;
+            double var_cache = 0.0;
+            int svh = 0;
+            int svh_cache = 0;
+            nav.orbcache = nullptr;
+            EXPECT_EQ(ephpos(time, teph, sat, &nav, -1, rs.data(), dts.data(), &var, &svh), 1);
+            nav.orbcache = &cache;
+            EXPECT_EQ(ephpos(time, teph, sat, &nav, -1, rs_cache.data(), dts_cache.data(), &var_cache, &svh_cache), 1);
+            EXPECT_EQ(var, var_cache);
+            EXPECT_EQ(svh, svh_cache);
+            for (int i = 0; i < 3; i++)
+                {
+                    errors.pos = std::max(errors.pos, std::fabs(rs[i] - rs_cache[i]));
+                    errors.vel = std::max(errors.vel, std::fabs(rs[i + 3] - rs_cache[i + 3]));
+                }
+            errors.clk = std::max(errors.clk, std::fabs(dts[0] - dts_cache[0]));
+            errors.drift = std::max(errors.drift, std::fabs(dts[1] - dts_cache[1]));
+        }
+    return errors;
+}
+
+
+void check_errors(const Orbit_Errors& errors, const char* name)
+{
+    std::cout << name << ": max errors " << errors.pos * 1e3 << " mm, " << errors.vel * 1e3 << " mm/s, "
+              << errors.clk * 1e12 << " ps, " << errors.drift * 1e15 << " ps/ks\n";
+    // The velocity and clock drift without cache are finite differences over 1 ms
+    EXPECT_LT(errors.pos, 1e-4);
+    EXPECT_LT(errors.vel, 1e-3);
+    EXPECT_LT(errors.clk, 1e-13);
+    EXPECT_LT(errors.drift, 1e-14);
+}
+}  // namespace
+
+
+TEST(RtklibOrbitCacheTest, BroadcastEphemerisAccuracy)
+{
+    std::vector<eph_t> eph;
+    eph.push_back(make_eph(SYS_GPS, 7, 26560.0e3, 0.012, 0.958));
+    eph.push_back(make_eph(SYS_GAL, 11, 29600.0e3, 3.0e-4, 0.977));
+    eph.push_back(make_eph(SYS_BDS, 3, 42162.0e3, 5.0e-4, 0.02));  // GEO
+    eph.push_back(make_eph(SYS_BDS, 21, 27906.0e3, 1.0e-3, 0.96));
+    std::vector<geph_t> geph{make_geph(5)};
+
+    auto nav = std::make_unique<nav_t>();
+    nav->eph = eph.data();
+    nav->n = static_cast<int>(eph.size());
+    nav->geph = geph.data();
+    nav->ng = static_cast<int>(geph.size());
+    auto cache = std::make_unique<orbcache_t>();
+
+    const gtime_t teph = gpst2time(EPH_WEEK, EPH_TOE);
+    check_errors(compare_ephpos(*nav, *cache, eph[0].sat, teph, 3600.0, 0.05), "GPS");
+    check_errors(compare_ephpos(*nav, *cache, eph[1].sat, teph, 3600.0, 0.05), "Galileo");
+    check_errors(compare_ephpos(*nav, *cache, eph[2].sat, teph, 3600.0, 0.05), "BeiDou GEO");
+    check_errors(compare_ephpos(*nav, *cache, eph[3].sat, teph, 3600.0, 0.05), "BeiDou MEO");
+    check_errors(compare_ephpos(*nav, *cache, geph[0].sat, geph[0].toe, 1800.0, 0.05), "GLONASS");
+
+    // One fit per satellite and arc, including the arcs partially covered at both ends
+    EXPECT_EQ(cache->nfit, 4U * (2U * 3600U / 60U + 1U) + (2U * 1800U / 60U + 1U));
+}
+
+
+TEST(RtklibOrbitCacheTest, Refresh)
+{
+    std::vector<eph_t> eph{make_eph(SYS_GPS, 7, 26560.0e3, 0.012, 0.958)};
+    auto nav = std::make_unique<nav_t>();
+    nav->eph = eph.data();
+    nav->n = 1;
+    auto cache = std::make_unique<orbcache_t>();
+    nav->orbcache = cache.get();
+
+    const int sat = eph[0].sat;
+    const gtime_t t0 = gpst2time(EPH_WEEK, EPH_TOE + 10.0);
+    std::array<double, 6> rs{};
+    std::array<double, 2> dts{};
+    double var = 0.0;
+    int svh = 0;
+
+    // Arc expiry
+    for (int k = 0; k < 12000; k++)
+        {
+            ASSERT_EQ(ephpos(timeadd(t0, k * 0.01), t0, sat, nav.get(), -1, rs.data(), dts.data(), &var, &svh), 1);
+        }
+    EXPECT_EQ(cache->nfit, 3U);
+    EXPECT_EQ(cache->neval, 12000U);
+
+    // New ephemeris within the last arc
+    const gtime_t t1 = timeadd(t0, 115.0);
+    eph[0].iode = 43;
+    eph[0].f0 += 1.0e-6;
+    eph[0].svh = 1;
+    ASSERT_EQ(ephpos(t1, t0, sat, nav.get(), -1, rs.data(), dts.data(), &var, &svh), 1);
+    EXPECT_EQ(cache->nfit, 4U);
+    EXPECT_EQ(svh, 1);
+    std::array<double, 3> rs_eph{};
+    double dts_eph = 0.0;
+    eph2pos(t1, eph.data(), rs_eph.data(), &dts_eph, &var);
+    EXPECT_NEAR(dts[0], dts_eph, 1e-15);
+    for (int i = 0; i < 3; i++)
+        {
+            EXPECT_NEAR(rs[i], rs_eph[i], 1e-4);
+        }
+
+    // Same ephemeris, copied into a new navigation data structure
+    std::vector<eph_t> eph_copy = eph;
+    nav->eph = eph_copy.data();
+    ASSERT_EQ(ephpos(timeadd(t1, 1.0), t0, sat, nav.get(), -1, rs.data(), dts.data(), &var, &svh), 1);
+    EXPECT_EQ(cache->nfit, 4U);
+}
+
+
+TEST(RtklibOrbitCacheTest, SatellitePositionsThroughput)
+{
+    // 24 GPS and 8 GLONASS satellites at 100 Hz over one minute
+    std::vector<eph_t> eph;
+    std::vector<geph_t> geph;
+    std::vector<obsd_t> obs;
+    for (int prn = 1; prn <= 24; prn++)
+        {
+            eph.push_back(make_eph(SYS_GPS, prn, 26560.0e3, 0.012, 0.958));
+        }
+    for (int prn = 1; prn <= 8; prn++)
+        {
+            geph.push_back(make_geph(prn));
+        }
+    for (const auto& e : eph)
+        {
+            obsd_t o{};
+            o.sat = e.sat;
+            o.P[0] = 2.2e7;
+            obs.push_back(o);
+        }
+    for (const auto& g : geph)
+        {
+            obsd_t o{};
+            o.sat = g.sat;
+            o.P[0] = 2.2e7;
+            obs.push_back(o);
+        }
+    const int n = static_cast<int>(obs.size());
+
+    auto nav = std::make_unique<nav_t>();
+    nav->eph = eph.data();
+    nav->n = static_cast<int>(eph.size());
+    nav->geph = geph.data();
+    nav->ng = static_cast<int>(geph.size());
+    auto cache = std::make_unique<orbcache_t>();
+
+    std::vector<double> rs(6 * n);
+    std::vector<double> dts(2 * n);
+    std::vector<double> var(n);
+    std::vector<int> svh(n);
+    std::vector<double> rs_ref(6 * n);
+    std::vector<double> dts_ref(2 * n);
+    std::chrono::duration<double> elapsed{};
+    std::chrono::duration<double> elapsed_cache{};
+    double max_pos_error = 0.0;
+
+    const gtime_t t0 = gpst2time(EPH_WEEK, EPH_TOE + 100.0);
+    for (int k = 0; k < 6000; k++)
+        {
+            const gtime_t time = timeadd(t0, k * 0.01);
+            for (auto& o : obs)
+                {
+                    o.time = time;
+                }
+            nav->orbcache = nullptr;
+            auto start = std::chrono::steady_clock::now();
+            satposs(time, obs.data(), n, nav.get(), EPHOPT_BRDC, rs_ref.data(), dts_ref.data(), var.data(), svh.data());
+            elapsed += std::chrono::steady_clock::now() - start;
+
+            nav->orbcache = cache.get();
+            start = std::chrono::steady_clock::now();
+            satposs(time, obs.data(), n, nav.get(), EPHOPT_BRDC, rs.data(), dts.data(), var.data(), svh.data());
+            elapsed_cache += std::chrono::steady_clock::now() - start;
+
+            for (int i = 0; i < 6 * n; i++)
+                {
+                    if (i % 6 < 3)
+                        {
+                            max_pos_error = std::max(max_pos_error, std::fabs(rs[i] - rs_ref[i]));
+                        }
+                }
+        }
+    EXPECT_LT(max_pos_error, 1e-4);
+    std::cout << "satposs() for " << n << " satellites: " << elapsed.count() / 6000.0 * 1e6 << " us without cache, "
+              << elapsed_cache.count() / 6000.0 * 1e6 << " us with cache\n";
+}
@@ -55,3 +55,39 @@ TEST(FileSignalSource, InstantiateFileNotExists)
 
     EXPECT_THROW({ auto uptr = std::make_shared<FileSignalSource>(config.get(), "Test", 0, 1, queue.get()); }, std::exception);
 }
+
+TEST(FileSignalSource, InstantiateReadAhead)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    auto config = std::make_shared<InMemoryConfiguration>();
+
+    config->set_property("Test.samples", "0");
+    config->set_property("Test.sampling_frequency", "0");
+    std::string path = std::string(TEST_PATH);
+    std::string filename = path + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+    config->set_property("Test.filename", filename);
+    config->set_property("Test.item_type", "gr_complex");
+    config->set_property("Test.repeat", "false");
+    config->set_property("Test.enable_read_ahead", "true");
+    config->set_property("Test.io_mode", "mmap");
+
+    auto signal_source = std::make_unique<FileSignalSource>(config.get(), "Test", 0, 1, queue.get());
+
+    EXPECT_EQ(signal_source->filenames().size(), 1U);
+    EXPECT_TRUE(signal_source->get_right_block() != nullptr);
+}
+
+TEST(FileSignalSource, InstantiateReadAheadFileNotExists)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    auto config = std::make_shared<InMemoryConfiguration>();
+
+    config->set_property("Test.samples", "0");
+    config->set_property("Test.sampling_frequency", "0");
+    config->set_property("Test.filename", "./signal_samples/i_dont_exist.dat");
+    config->set_property("Test.item_type", "gr_complex");
+    config->set_property("Test.repeat", "false");
+    config->set_property("Test.enable_read_ahead", "true");
+
+    EXPECT_THROW({ auto uptr = std::make_shared<FileSignalSource>(config.get(), "Test", 0, 1, queue.get()); }, std::exception);
+}
@@ -52,3 +52,27 @@ TEST(ValveTest, CheckEventSentAfter100Samples)
     bool expected1 = true;
     EXPECT_EQ(expected1, queue->timed_wait_and_pop(msg, 100));
 }
+
+
+TEST(ValveTest, CheckEventSentAfter100SamplesWithoutOutputs)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+
+    auto top_block = gr::make_top_block("gnss_sdr_valve_tap_test");
+
+    auto source = gr::analog::sig_source_f::make(100, gr::analog::GR_CONST_WAVE, 100, 1, 0);
+    auto valve = gnss_sdr_make_valve(sizeof(float), 100, queue.get());
+    auto sink = gr::blocks::null_sink::make(sizeof(float));
+
+    // The valve only counts the samples read by the sink
+    top_block->connect(source, 0, valve, 0);
+    top_block->connect(source, 0, sink, 0);
+
+    top_block->start();
+    pmt::pmt_t msg;
+    const bool event_received = queue->timed_wait_and_pop(msg, 1000);
+    top_block->stop();
+    top_block->wait();
+
+    EXPECT_TRUE(event_received);
+}
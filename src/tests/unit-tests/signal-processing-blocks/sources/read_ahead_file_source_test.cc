@@ -0,0 +1,102 @@
+/*!
+ * \file read_ahead_file_source_test.cc
+ * \brief Tests for the read-ahead file source block
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "read_ahead_file_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_s.h>
+#endif
+
+class ReadAheadFileSourceTest : public ::testing::Test
+{
+protected:
+    ReadAheadFileSourceTest() : filenames{"./read_ahead_test_0.dat", "./read_ahead_test_1.dat", "./read_ahead_test_2.dat"}
+    {
+        // 100000 int16_t samples split in three files, the second cut in the
+        // middle of a sample
+        samples = std::vector<int16_t>(100000);
+        std::iota(samples.begin(), samples.end(), 0);
+        const auto* bytes = reinterpret_cast<const char*>(samples.data());
+        const size_t cuts[4] = {0, 33333, 33334, samples.size() * sizeof(int16_t)};
+        for (size_t i = 0; i < filenames.size(); i++)
+            {
+                std::ofstream file(filenames[i], std::ios::out | std::ios::binary);
+                file.write(bytes + cuts[i], cuts[i + 1] - cuts[i]);
+            }
+    }
+
+    ~ReadAheadFileSourceTest() override
+    {
+        for (const auto& filename : filenames)
+            {
+                std::remove(filename.c_str());
+            }
+    }
+
+    std::vector<int16_t> run(File_Io_Mode io_mode, uint64_t bytes_to_skip)
+    {
+        auto top_block = gr::make_top_block("ReadAheadFileSourceTest");
+        auto source = make_read_ahead_file_source(sizeof(int16_t), filenames, false, bytes_to_skip, 8192, 3, io_mode);
+        auto sink = gr::blocks::vector_sink_s::make();
+        top_block->connect(source, 0, sink, 0);
+        top_block->run();
+        top_block->stop();
+        EXPECT_GT(source->sustained_rate_MBps(), 0.0);
+        return sink->data();
+    }
+
+    std::vector<std::string> filenames;
+    std::vector<int16_t> samples;
+};
+
+
+TEST_F(ReadAheadFileSourceTest, TotalSize)
+{
+    EXPECT_EQ(read_ahead_file_source::total_size(filenames), samples.size() * sizeof(int16_t));
+    EXPECT_EQ(read_ahead_file_source::total_size({"./read_ahead_i_dont_exist.dat"}), 0U);
+}
+
+
+TEST_F(ReadAheadFileSourceTest, ReadsTheSequenceOfFiles)
+{
+    for (auto io_mode : {File_Io_Mode::buffered, File_Io_Mode::direct, File_Io_Mode::mmap})
+        {
+            EXPECT_EQ(run(io_mode, 0), samples);
+        }
+}
+
+
+TEST_F(ReadAheadFileSourceTest, SkipsAcrossFiles)
+{
+    for (auto io_mode : {File_Io_Mode::buffered, File_Io_Mode::direct, File_Io_Mode::mmap})
+        {
+            // Skip the whole first file and the first sample of the second one
+            const std::vector<int16_t> read = run(io_mode, 33334);
+            ASSERT_EQ(read.size(), samples.size() - 16667);
+            EXPECT_TRUE(std::equal(read.begin(), read.end(), samples.begin() + 16667));
+        }
+}
@@ -0,0 +1,168 @@
+/*!
+ * \file tlm_preamble_detector_test.cc
+ * \brief Tests for the bit-packed preamble detector
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GLONASS_L1_L2_CA.h"
+#include "GPS_L1_CA.h"
+#include "tlm_preamble_detector.h"
+#include <boost/circular_buffer.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+template <typename Container>
+int32_t reference_correlation(const Container& history, const std::vector<int32_t>& preamble)
+{
+    int32_t corr_value = 0;
+    if (history.size() < preamble.size())
+        {
+            return corr_value;
+        }
+    for (size_t i = 0; i < preamble.size(); i++)
+        {
+            if (history[i] < 0.0)  // symbols clipping
+                {
+                    corr_value -= preamble[i];
+                }
+            else
+                {
+                    corr_value += preamble[i];
+                }
+        }
+    return corr_value;
+}
+}  // namespace
+
+
+TEST(TlmPreambleDetectorTest, MatchesLoopCorrelation)
+{
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+
+    // GPS L1 C/A, Galileo INAV and FNAV, a full 64-bit word, and the GLONASS time mark
+    const std::array<int32_t, 5> lengths{{GPS_CA_PREAMBLE_LENGTH_BITS, 10, 12, 64, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS}};
+    for (const auto length : lengths)
+        {
+            std::vector<int32_t> preamble(length);
+            std::generate(preamble.begin(), preamble.end(), [&dist, &e2]() { return (dist(e2) < 0.0 ? -1 : 1); });
+
+            Tlm_Preamble_Detector detector;
+            detector.set_preamble(preamble.data(), length);
+            EXPECT_EQ(detector.length(), length);
+
+            boost::circular_buffer<float> symbol_history(length + 300);
+            for (int32_t n = 0; n < 5000; n++)
+                {
+                    symbol_history.push_back(dist(e2));
+                    if (n == 2500)
+                        {
+                            // emulate a telemetry decoder reset
+                            symbol_history.clear();
+                            symbol_history.push_back(dist(e2));
+                        }
+                    detector.update(symbol_history);
+                    ASSERT_EQ(detector.correlation(), reference_correlation(symbol_history, preamble)) << "length " << length << ", symbol " << n;
+                }
+        }
+}
+
+
+TEST(TlmPreambleDetectorTest, DetectsPreambleAndPolarity)
+{
+    std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> preamble{};
+    std::generate(preamble.begin(), preamble.end(), [n = 0]() mutable { return (GPS_CA_PREAMBLE[n++] == '1' ? 1 : -1); });
+
+    Tlm_Preamble_Detector detector;
+    detector.set_preamble(preamble.data(), GPS_CA_PREAMBLE_LENGTH_BITS);
+
+    boost::circular_buffer<float> symbol_history(GPS_SUBFRAME_BITS);
+    for (int32_t polarity : {1, -1})
+        {
+            symbol_history.clear();
+            detector.reset();
+            for (int32_t i = 0; i < GPS_SUBFRAME_BITS; i++)
+                {
+                    const float amplitude = 0.5F + static_cast<float>(i % 3) * 0.25F;
+                    const int32_t bit = i < GPS_CA_PREAMBLE_LENGTH_BITS ? preamble[i] : ((i % 5) == 0 ? 1 : -1);
+                    symbol_history.push_back(static_cast<float>(polarity * bit) * amplitude);
+                    detector.update(symbol_history);
+                }
+            EXPECT_EQ(detector.correlation(), polarity * GPS_CA_PREAMBLE_LENGTH_BITS);
+            EXPECT_EQ(detector.soft_correlation(symbol_history) < 0.0, polarity < 0);
+
+            // one more symbol slides the window out of the preamble
+            symbol_history.push_back(1.0);
+            detector.update(symbol_history);
+            EXPECT_NE(std::abs(detector.correlation()), GPS_CA_PREAMBLE_LENGTH_BITS);
+        }
+}
+
+
+TEST(TlmPreambleDetectorTest, Speed)
+{
+    const int64_t n_iter = 100000;
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+
+    std::vector<int32_t> preamble(GPS_CA_PREAMBLE_LENGTH_BITS);
+    std::generate(preamble.begin(), preamble.end(), [n = 0]() mutable { return (GPS_CA_PREAMBLE[n++] == '1' ? 1 : -1); });
+    Tlm_Preamble_Detector detector;
+    detector.set_preamble(preamble.data(), GPS_CA_PREAMBLE_LENGTH_BITS);
+
+    boost::circular_buffer<float> symbol_history(GPS_SUBFRAME_BITS);
+    std::vector<float> symbols(n_iter);
+    std::generate(symbols.begin(), symbols.end(), [&dist, &e2]() { return dist(e2); });
+
+    int64_t sum_corr1 = 0;
+    int64_t sum_corr2 = 0;
+    std::chrono::time_point<std::chrono::system_clock> start, end, start2, end2;
+
+    start = std::chrono::system_clock::now();
+    for (int64_t iter = 0; iter < n_iter; iter++)
+        {
+            symbol_history.push_back(symbols[iter]);
+            sum_corr1 += reference_correlation(symbol_history, preamble);
+        }
+    end = std::chrono::system_clock::now();
+
+    symbol_history.clear();
+    start2 = std::chrono::system_clock::now();
+    for (int64_t iter = 0; iter < n_iter; iter++)
+        {
+            symbol_history.push_back(symbols[iter]);
+            detector.update(symbol_history);
+            sum_corr2 += detector.correlation();
+        }
+    end2 = std::chrono::system_clock::now();
+
+    EXPECT_EQ(sum_corr1, sum_corr2);
+
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    std::chrono::duration<double> elapsed_seconds2 = end2 - start2;
+    std::cout << "Preamble correlation with 'C for'  : done in " << elapsed_seconds.count() * 1.0e9 / n_iter << " nanoseconds per symbol\n";
+    std::cout << "Preamble correlation with popcount : done in " << elapsed_seconds2.count() * 1.0e9 / n_iter << " nanoseconds per symbol\n";
+}
@@ -0,0 +1,123 @@
+/*!
+ * \file fixed_size_kalman_filters_test.cc
+ * \brief Tests for the fixed-size Kalman, cubature and unscented filters
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fixed_size_kalman_filters.h"
+#include <armadillo>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace
+{
+template <arma::uword Nx, arma::uword Nz>
+void check_against_dynamic_kalman_filter(double ukf_tolerance)
+{
+    for (int trial = 0; trial < 100; trial++)
+        {
+            const arma::mat A = arma::randu<arma::mat>(Nx, Nx);
+            const arma::mat::fixed<Nx, Nx> P_x = A * A.t() + 0.5 * arma::eye(Nx, Nx);
+            const arma::vec::fixed<Nx> x = arma::randn<arma::vec>(Nx);
+            const arma::mat::fixed<Nx, Nx> F = arma::randu<arma::mat>(Nx, Nx);
+            const arma::mat::fixed<Nx, Nx> Q = arma::diagmat(arma::randu<arma::vec>(Nx));
+            const arma::mat::fixed<Nz, Nx> H = arma::randu<arma::mat>(Nz, Nx);
+            const arma::mat::fixed<Nz, Nz> R = arma::diagmat(arma::randu<arma::vec>(Nz));
+            const arma::vec::fixed<Nz> z = arma::randn<arma::vec>(Nz);
+
+            // Reference
+            const arma::vec x_pre = F * x;
+            const arma::mat P_x_pre = F * P_x * F.t() + Q;
+            const arma::mat K = P_x_pre * H.t() * arma::inv(H * P_x_pre * H.t() + R);
+            const arma::vec x_post = x_pre + K * (z - H * x_pre);
+            const arma::mat P_x_post = (arma::eye(Nx, Nx) - K * H) * P_x_pre;
+
+            Fixed_Size_Kalman_Filter<Nx, Nz> kf;
+            kf.initialize(x, P_x);
+            kf.predict(F, Q);
+            ASSERT_TRUE(kf.update(z, H, R));
+            EXPECT_TRUE(arma::approx_equal(kf.get_x_pred(), x_pre, "reldiff", 1e-9));
+            EXPECT_TRUE(arma::approx_equal(kf.get_P_x_pred(), P_x_pre, "reldiff", 1e-9));
+            EXPECT_TRUE(arma::approx_equal(kf.get_x_est(), x_post, "absdiff", 1e-9));
+            EXPECT_TRUE(arma::approx_equal(kf.get_P_x_est(), P_x_post, "absdiff", 1e-9));
+
+            // Sigma point filters are exact for linear models
+            auto transition = [&F](const arma::vec::fixed<Nx>& in) -> arma::vec::fixed<Nx> { return F * in; };
+            auto measurement = [&H](const arma::vec::fixed<Nx>& in) -> arma::vec::fixed<Nz> { return H * in; };
+
+            Fixed_Size_Cubature_Filter<Nx, Nz> ckf;
+            ASSERT_TRUE(ckf.predict_sequential(x, P_x, transition, Q));
+            EXPECT_TRUE(arma::approx_equal(ckf.get_x_pred(), x_pre, "absdiff", 1e-9));
+            EXPECT_TRUE(arma::approx_equal(ckf.get_P_x_pred(), P_x_pre, "absdiff", 1e-9));
+            ASSERT_TRUE(ckf.update_sequential(z, kf.get_x_pred(), kf.get_P_x_pred(), measurement, R));
+            EXPECT_TRUE(arma::approx_equal(ckf.get_x_est(), x_post, "absdiff", 1e-9));
+            EXPECT_TRUE(arma::approx_equal(ckf.get_P_x_est(), P_x_post, "absdiff", 1e-9));
+
+            Fixed_Size_Unscented_Filter<Nx, Nz> ukf;
+            ASSERT_TRUE(ukf.predict_sequential(x, P_x, transition, Q));
+            EXPECT_TRUE(arma::approx_equal(ukf.get_x_pred(), x_pre, "absdiff", ukf_tolerance));
+            EXPECT_TRUE(arma::approx_equal(ukf.get_P_x_pred(), P_x_pre, "absdiff", ukf_tolerance));
+            ASSERT_TRUE(ukf.update_sequential(z, kf.get_x_pred(), kf.get_P_x_pred(), measurement, R));
+            EXPECT_TRUE(arma::approx_equal(ukf.get_x_est(), x_post, "absdiff", ukf_tolerance));
+            EXPECT_TRUE(arma::approx_equal(ukf.get_P_x_est(), P_x_post, "absdiff", ukf_tolerance));
+        }
+}
+}  // namespace
+
+
+TEST(FixedSizeKalmanFiltersTest, MatchDynamicKalmanFilter)
+{
+    arma::arma_rng::set_seed(7);
+    check_against_dynamic_kalman_filter<2, 1>(1e-4);
+    check_against_dynamic_kalman_filter<3, 1>(1e-4);
+    check_against_dynamic_kalman_filter<2, 2>(1e-4);
+    check_against_dynamic_kalman_filter<3, 2>(1e-4);
+}
+
+
+TEST(FixedSizeKalmanFiltersTest, SecondOrderModelInThreeStates)
+{
+    // A second order carrier model embedded in three states, with zero
+    // Doppler rate entries, must give the same estimates as the 2-state filter
+    const double T = 0.001;
+    arma::mat::fixed<2, 2> F2 = {{1.0, 2.0 * arma::datum::pi * T}, {0.0, 1.0}};
+    arma::mat::fixed<2, 2> Q2 = {{std::pow(T, 4), 0.0}, {0.0, T}};
+    arma::mat::fixed<2, 2> P2 = {{arma::datum::pi / 2.0, 0.0}, {0.0, 450.0}};
+    arma::mat::fixed<1, 2> H2 = {{1.0, 0.0}};
+    arma::mat::fixed<3, 3> F3 = arma::zeros(3, 3);
+    arma::mat::fixed<3, 3> Q3 = arma::zeros(3, 3);
+    arma::mat::fixed<3, 3> P3 = arma::zeros(3, 3);
+    arma::mat::fixed<1, 3> H3 = {{1.0, 0.0, 0.0}};
+    F3.submat(0, 0, 1, 1) = F2;
+    F3(2, 2) = 1.0;
+    Q3.submat(0, 0, 1, 1) = Q2;
+    P3.submat(0, 0, 1, 1) = P2;
+    arma::mat::fixed<1, 1> R = {{0.05}};
+
+    Fixed_Size_Kalman_Filter<2, 1> kf2;
+    Fixed_Size_Kalman_Filter<3, 1> kf3;
+    kf2.initialize(arma::vec::fixed<2>{0.1, 1000.0}, P2);
+    kf3.initialize(arma::vec::fixed<3>{0.1, 1000.0, 0.0}, P3);
+    for (int k = 0; k < 1000; k++)
+        {
+            const arma::vec::fixed<1> y = 0.1 * arma::randn<arma::vec>(1);
+            kf2.predict(F2, Q2);
+            kf3.predict(F3, Q3);
+            kf2.update_innovation(y, H2, kf2.innovation_covariance(H2, R));
+            kf3.update_innovation(y, H3, kf3.innovation_covariance(H3, R));
+        }
+    EXPECT_TRUE(arma::approx_equal(kf2.get_x_est(), arma::vec(kf3.get_x_est().head(2)), "absdiff", 1e-12));
+    EXPECT_TRUE(arma::approx_equal(kf2.get_P_x_est(), arma::mat(kf3.get_P_x_est().submat(0, 0, 1, 1)), "absdiff", 1e-12));
+    EXPECT_EQ(kf3.get_x_est()(2), 0.0);
+}
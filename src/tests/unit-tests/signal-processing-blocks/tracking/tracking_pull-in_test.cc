@@ -35,6 +35,7 @@
 #include "gps_l2_m_pcps_acquisition.h"
 #include "gps_l5i_pcps_acquisition.h"
 #include "in_memory_configuration.h"
+#include "internal_signal_generator.h"
 #include "signal_generator_flags.h"
 #include "test_flags.h"
 #include "tracking_dump_reader.h"
@@ -168,6 +169,8 @@ public:
     std::string p4;
     std::string p5;
     std::string p6;
+    std::string generator_signal_file;
+    double generator_CN0_dBHz{};
     std::string implementation = FLAGS_trk_test_implementation;
 
     const int baseband_sampling_freq = FLAGS_fs_gen_sps;
@@ -238,6 +241,8 @@ int TrackingPullInTest::configure_generator(double CN0_dBHz, int file_idx)
 {
     // Configure signal generator
     generator_binary = FLAGS_generator_binary;
+    generator_signal_file = FLAGS_signal_file + std::to_string(file_idx);
+    generator_CN0_dBHz = CN0_dBHz;
 
     p1 = std::string("-rinex_nav_file=") + FLAGS_rinex_nav_file;
     if (FLAGS_dynamic_position.empty())
@@ -258,6 +263,32 @@ int TrackingPullInTest::configure_generator(double CN0_dBHz, int file_idx)
 
 int TrackingPullInTest::generate_signal()
 {
+    if (FLAGS_internal_generator)
+        {
+            char system = 'G';
+            std::string signal = "1C";
+            if (implementation.find("Galileo_E1") == 0)
+                {
+                    system = 'E';
+                    signal = "1B";
+                }
+            else if (implementation.find("Galileo_E5a") == 0)
+                {
+                    system = 'E';
+                    signal = "5X";
+                }
+            else if (implementation.find("GPS_L5") == 0)
+                {
+                    signal = "L5";
+                }
+            if (!generate_internal_signal(system, signal, FLAGS_test_satellite_PRN, generator_CN0_dBHz,
+                    baseband_sampling_freq, FLAGS_duration, generator_signal_file))
+                {
+                    std::cout << "The built-in generator could not write " << generator_signal_file << '\n';
+                }
+            return 0;
+        }
+
     int child_status;
 
     char* const parmList[] = {&generator_binary[0], &generator_binary[0], &p1[0], &p2[0], &p3[0], &p4[0], &p5[0], &p6[0], nullptr};
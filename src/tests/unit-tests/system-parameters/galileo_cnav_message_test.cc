@@ -0,0 +1,160 @@
+/*!
+ * \file galileo_cnav_message_test.cc
+ * \brief Tests for the decoding of Galileo HAS messages from E6-B pages
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_CNAV.h"
+#include "galileo_cnav_message.h"
+#include "reed_solomon.h"
+#include <boost/crc.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Two's complement, MSB first
+std::string to_bits(int64_t value, uint32_t length)
+{
+    std::string bits(length, '0');
+    for (uint32_t i = 0; i < length; i++)
+        {
+            if ((static_cast<uint64_t>(value) >> (length - 1 - i)) & 1U)
+                {
+                    bits[i] = '1';
+                }
+        }
+    return bits;
+}
+
+
+// MT1 with the mask of Galileo E1 and E5a of satellites 3 and 7, and their
+// orbit and clock corrections
+std::string make_mt1(uint32_t toh, uint32_t mask_id, bool with_mask)
+{
+    std::string bits = to_bits(toh, 12) + (with_mask ? "1" : "0") + "11" + "0000" + "000" + to_bits(mask_id, 5) + to_bits(9, 5);
+    if (with_mask)
+        {
+            bits += to_bits(1, 4) + to_bits(HAS_MSG_GALILEO_SYSTEM, 4);
+            bits += to_bits((1ULL << 37U) | (1ULL << 33U), 40);  // satellites 3 and 7
+            bits += to_bits(0x8400, 16) + "0" + to_bits(0, 3);
+        }
+    bits += to_bits(5, 4);  // orbit corrections
+    bits += to_bits(101, 10) + to_bits(-1234, 14) + to_bits(77, 12) + to_bits(-5, 12);
+    bits += to_bits(102, 10) + to_bits(321, 14) + to_bits(-2048, 12) + to_bits(2047, 12);
+    bits += to_bits(3, 4);  // clock full-set corrections
+    bits += "0" + to_bits(-8000, 14) + "1" + to_bits(4567, 14);
+    bits.resize(GALILEO_CNAV_MESSAGE_BITS_PER_PAGE, '0');
+    return bits;
+}
+
+
+// Page with reserved bits, header, encoded message and CRC
+std::string make_page(const std::string& header, const std::string& data)
+{
+    const std::string page = std::string(GALILEO_CNAV_PAGE_RESERVED_BITS, '0') + header + data;
+    // The CRC is computed over whole octets, with zeros at the start of the page
+    const std::string padded = std::string(GALILEO_CNAV_BYTES_FOR_CRC * 8 - GALILEO_CNAV_BITS_FOR_CRC, '0') + page;
+    std::vector<uint8_t> bytes(GALILEO_CNAV_BYTES_FOR_CRC, 0);
+    for (size_t i = 0; i < padded.size(); i++)
+        {
+            if (padded[i] == '1')
+                {
+                    bytes[i / 8] |= static_cast<uint8_t>(0x80U >> (i % 8));
+                }
+        }
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+    crc.process_bytes(bytes.data(), bytes.size());
+    return page + to_bits(crc.checksum(), GALILEO_CNAV_CRC_LENGTH);
+}
+
+
+// Encoded page with page ID pid of a one-page message
+std::string make_has_page(const std::string& message, uint32_t message_id, uint32_t pid)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    std::string encoded;
+    for (int32_t octet = 0; octet < GALILEO_CNAV_OCTETS_IN_SUBPAGE; octet++)
+        {
+            std::vector<uint8_t> information(code.k(), 0);
+            information[0] = static_cast<uint8_t>(std::stoul(message.substr(octet * 8, 8), nullptr, 2));
+            encoded += to_bits(code.encode(information)[pid - 1], 8);
+        }
+    // Operational mode, message type 1, message size 1
+    const std::string header = to_bits(1, 2) + "00" + to_bits(1, 2) + to_bits(message_id, 5) + to_bits(1, 5) + to_bits(pid, 8);
+    return make_page(header, encoded);
+}
+}  // namespace
+
+
+TEST(GalileoCnavMessageTest, DecodesHasCorrections)
+{
+    Galileo_Cnav_Message cnav;
+    cnav.read_HAS_page(make_has_page(make_mt1(1234, 3, true), 17, 40));
+    ASSERT_TRUE(cnav.have_new_HAS_message());
+
+    const Galileo_HAS_data has_data = cnav.get_HAS_data();
+    EXPECT_EQ(has_data.header.toh, 1234);
+    EXPECT_EQ(has_data.header.mask_id, 3);
+    EXPECT_EQ(has_data.header.iod_id, 9);
+    ASSERT_EQ(has_data.Nsys, 1);
+    EXPECT_EQ(has_data.gnss_id_mask[0], HAS_MSG_GALILEO_SYSTEM);
+    EXPECT_EQ(has_data.satellite_mask[0], (1ULL << 37U) | (1ULL << 33U));
+    EXPECT_EQ(has_data.signal_mask[0], 0x8400);
+    EXPECT_EQ(has_data.validity_interval_index_orbit_corrections, 5);
+    ASSERT_EQ(has_data.delta_radial.size(), 2U);
+    EXPECT_EQ(has_data.gnss_iod[0], 101);
+    EXPECT_EQ(has_data.delta_radial[0], -1234);
+    EXPECT_EQ(has_data.delta_along_track[0], 77);
+    EXPECT_EQ(has_data.delta_cross_track[0], -5);
+    EXPECT_EQ(has_data.gnss_iod[1], 102);
+    EXPECT_EQ(has_data.delta_radial[1], 321);
+    EXPECT_EQ(has_data.delta_along_track[1], -2048);
+    EXPECT_EQ(has_data.delta_cross_track[1], 2047);
+    EXPECT_EQ(has_data.validity_interval_index_clock_fullset_corrections, 3);
+    ASSERT_EQ(has_data.delta_clock_c0.size(), 2U);
+    EXPECT_FALSE(has_data.iod_change_flag[0]);
+    EXPECT_EQ(has_data.delta_clock_c0[0], -8000);
+    EXPECT_TRUE(has_data.iod_change_flag[1]);
+    EXPECT_EQ(has_data.delta_clock_c0[1], 4567);
+
+    // Corrections referring to the mask of the previous message
+    cnav.read_HAS_page(make_has_page(make_mt1(1250, 3, false), 18, 33));
+    ASSERT_TRUE(cnav.have_new_HAS_message());
+    EXPECT_EQ(cnav.get_HAS_data().header.toh, 1250);
+    EXPECT_EQ(cnav.get_HAS_data().delta_radial[0], -1234);
+    EXPECT_EQ(cnav.get_HAS_data().satellite_mask[0], (1ULL << 37U) | (1ULL << 33U));
+
+    // and to an unknown mask
+    cnav.read_HAS_page(make_has_page(make_mt1(1260, 4, false), 19, 200));
+    EXPECT_FALSE(cnav.have_new_HAS_message());
+    EXPECT_EQ(cnav.get_HAS_data().header.toh, 1250);
+}
+
+
+TEST(GalileoCnavMessageTest, IgnoresDummyPages)
+{
+    Galileo_Cnav_Message cnav;
+    cnav.read_HAS_page(make_has_page(make_mt1(1234, 3, true), 17, 1));
+    ASSERT_TRUE(cnav.have_new_HAS_message());
+
+    // A dummy page must not be taken as another page of the previous message,
+    // even if its content would decode as one
+    cnav.read_HAS_page(make_page("101011110011101111000011", make_mt1(999, 3, true)));
+    EXPECT_TRUE(cnav.is_HAS_message_dummy());
+    EXPECT_FALSE(cnav.have_new_HAS_message());
+    EXPECT_EQ(cnav.get_HAS_data().header.toh, 1234);
+    EXPECT_EQ(cnav.get_HAS_data().delta_radial[0], -1234);
+}
@@ -0,0 +1,249 @@
+/*!
+ * \file nav_data_store_test.cc
+ * \brief Tests for the binary store of navigation data
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "galileo_ephemeris.h"
+#include "galileo_utc_model.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include "nav_data_store.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace
+{
+Gps_Ephemeris make_gps_ephemeris(uint32_t prn, int32_t toe)
+{
+    Gps_Ephemeris eph;
+    eph.i_satellite_PRN = prn;
+    eph.d_Toe = toe;
+    eph.d_sqrt_A = 5153.6 + prn;
+    eph.d_e_eccentricity = 0.001 * prn;
+    eph.i_GPS_week = 2150;
+    return eph;
+}
+
+
+size_t file_size(const std::string& file_name)
+{
+    std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+    return file ? static_cast<size_t>(file.tellg()) : 0;
+}
+}  // namespace
+
+
+TEST(NavDataStoreTest, RoundTrip)
+{
+    const std::string file_name("nav_data_store_test.bin");
+    std::remove(file_name.c_str());
+
+    std::map<int32_t, Gps_Ephemeris> eph_map;
+    for (uint32_t prn = 1; prn <= 31; prn++)
+        {
+            eph_map[prn] = make_gps_ephemeris(prn, 7200);
+        }
+    Gps_Iono iono;
+    iono.d_alpha0 = 1.1e-8;
+    iono.d_beta3 = -6.5e5;
+    iono.valid = true;
+    Galileo_Utc_Model gal_utc;
+    gal_utc.A0_6 = 2.3e-9;
+    gal_utc.Delta_tLS_6 = 18;
+    {
+        Nav_Data_Store store(file_name);
+        EXPECT_FALSE(store.load());
+        EXPECT_TRUE(store.put(eph_map));
+        EXPECT_TRUE(store.put(iono));
+        EXPECT_TRUE(store.put(gal_utc));
+        EXPECT_EQ(store.live_records(), 33U);
+    }
+
+    Nav_Data_Store store(file_name);
+    ASSERT_TRUE(store.load());
+    EXPECT_EQ(store.live_records(), 33U);
+    EXPECT_EQ(store.dead_records(), 0U);
+
+    std::map<int32_t, Gps_Ephemeris> read_map;
+    ASSERT_TRUE(store.get(read_map));
+    ASSERT_EQ(read_map.size(), eph_map.size());
+    for (const auto& eph : eph_map)
+        {
+            EXPECT_EQ(read_map[eph.first].i_satellite_PRN, eph.second.i_satellite_PRN);
+            EXPECT_EQ(read_map[eph.first].d_Toe, eph.second.d_Toe);
+            EXPECT_DOUBLE_EQ(read_map[eph.first].d_sqrt_A, eph.second.d_sqrt_A);
+            EXPECT_DOUBLE_EQ(read_map[eph.first].d_e_eccentricity, eph.second.d_e_eccentricity);
+        }
+    Gps_Iono read_iono;
+    ASSERT_TRUE(store.get(read_iono));
+    EXPECT_DOUBLE_EQ(read_iono.d_alpha0, iono.d_alpha0);
+    EXPECT_DOUBLE_EQ(read_iono.d_beta3, iono.d_beta3);
+    Galileo_Utc_Model read_gal_utc;
+    ASSERT_TRUE(store.get(read_gal_utc));
+    EXPECT_DOUBLE_EQ(read_gal_utc.A0_6, gal_utc.A0_6);
+    EXPECT_EQ(read_gal_utc.Delta_tLS_6, gal_utc.Delta_tLS_6);
+
+    // Not in the store
+    Gps_Utc_Model gps_utc;
+    EXPECT_FALSE(store.get(gps_utc));
+    std::map<int32_t, Galileo_Ephemeris> gal_map;
+    EXPECT_FALSE(store.get(gal_map));
+    EXPECT_TRUE(gal_map.empty());
+    std::remove(file_name.c_str());
+}
+
+
+TEST(NavDataStoreTest, IncrementalUpdates)
+{
+    const std::string file_name("nav_data_store_test.bin");
+    std::remove(file_name.c_str());
+    Nav_Data_Store store(file_name);
+    ASSERT_TRUE(store.put(make_gps_ephemeris(5, 7200)));
+    const size_t size = file_size(file_name);
+
+    // Identical data is not appended
+    ASSERT_TRUE(store.put(make_gps_ephemeris(5, 7200)));
+    EXPECT_EQ(file_size(file_name), size);
+    EXPECT_EQ(store.dead_records(), 0U);
+
+    // New data supersedes the old one
+    ASSERT_TRUE(store.put(make_gps_ephemeris(5, 14400)));
+    EXPECT_GT(file_size(file_name), size);
+    EXPECT_EQ(store.live_records(), 1U);
+    EXPECT_EQ(store.dead_records(), 1U);
+
+    Nav_Data_Store reader(file_name);
+    ASSERT_TRUE(reader.load());
+    EXPECT_EQ(reader.dead_records(), 1U);
+    std::map<int32_t, Gps_Ephemeris> read_map;
+    ASSERT_TRUE(reader.get(read_map));
+    EXPECT_EQ(read_map[5].d_Toe, 14400);
+
+    ASSERT_TRUE(store.compact());
+    EXPECT_EQ(store.dead_records(), 0U);
+    EXPECT_EQ(file_size(file_name), size);
+    std::remove(file_name.c_str());
+}
+
+
+TEST(NavDataStoreTest, AutomaticCompaction)
+{
+    const std::string file_name("nav_data_store_test.bin");
+    std::remove(file_name.c_str());
+    Nav_Data_Store store(file_name);
+    for (int32_t toe = 0; toe < 2000; toe++)
+        {
+            ASSERT_TRUE(store.put(make_gps_ephemeris(1 + toe % 4, toe)));
+        }
+    EXPECT_EQ(store.live_records(), 4U);
+    EXPECT_LT(store.dead_records(), 1000U);
+
+    Nav_Data_Store reader(file_name);
+    ASSERT_TRUE(reader.load());
+    std::map<int32_t, Gps_Ephemeris> read_map;
+    ASSERT_TRUE(reader.get(read_map));
+    ASSERT_EQ(read_map.size(), 4U);
+    EXPECT_EQ(read_map[4].d_Toe, 1999);
+    EXPECT_EQ(read_map[1].d_Toe, 1996);
+    std::remove(file_name.c_str());
+}
+
+
+TEST(NavDataStoreTest, DamagedFiles)
+{
+    const std::string file_name("nav_data_store_test.bin");
+    std::remove(file_name.c_str());
+    {
+        Nav_Data_Store store(file_name);
+        ASSERT_TRUE(store.put(make_gps_ephemeris(7, 7200)));
+        ASSERT_TRUE(store.put(make_gps_ephemeris(8, 7200)));
+    }
+    const size_t size = file_size(file_name);
+
+    // A partial record at the end, as left by an interrupted write
+    {
+        std::ofstream file(file_name, std::ios::binary | std::ios::app);
+        file << "partial record";
+    }
+    {
+        Nav_Data_Store store(file_name);
+        ASSERT_TRUE(store.load());
+        EXPECT_EQ(store.live_records(), 2U);
+        // The damaged tail is dropped before appending
+        ASSERT_TRUE(store.put(make_gps_ephemeris(9, 7200)));
+    }
+    Nav_Data_Store reader(file_name);
+    ASSERT_TRUE(reader.load());
+    EXPECT_EQ(reader.live_records(), 3U);
+    EXPECT_GT(file_size(file_name), size);
+
+    // Not a store at all: ignored, and replaced on the next write
+    {
+        std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+        file << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>";
+    }
+    Nav_Data_Store store(file_name);
+    EXPECT_FALSE(store.load());
+    ASSERT_TRUE(store.put(make_gps_ephemeris(10, 7200)));
+    Nav_Data_Store new_reader(file_name);
+    ASSERT_TRUE(new_reader.load());
+    EXPECT_EQ(new_reader.live_records(), 1U);
+    std::remove(file_name.c_str());
+}
+
+
+TEST(NavDataStoreTest, SeveralWriters)
+{
+    const std::string file_name("nav_data_store_test.bin");
+    std::remove(file_name.c_str());
+    {
+        Nav_Data_Store store(file_name);
+        ASSERT_TRUE(store.put(make_gps_ephemeris(1, 7200)));
+    }
+
+    // As the PVT block, which loads the store at start-up and writes later on
+    Nav_Data_Store pvt_store(file_name);
+    ASSERT_TRUE(pvt_store.load());
+
+    // Meanwhile, the assistance data is written through another object
+    {
+        Nav_Data_Store supl_store(file_name);
+        ASSERT_TRUE(supl_store.put(make_gps_ephemeris(2, 7200)));
+    }
+    // The records of the other writer are kept
+    ASSERT_TRUE(pvt_store.put(make_gps_ephemeris(3, 7200)));
+    EXPECT_EQ(pvt_store.live_records(), 3U);
+
+    // Also when the other writer replaces the file while compacting it
+    Nav_Data_Store supl_store(file_name);
+    ASSERT_TRUE(supl_store.put(make_gps_ephemeris(1, 14400)));
+    ASSERT_TRUE(supl_store.put(make_gps_ephemeris(4, 7200)));
+    ASSERT_TRUE(supl_store.compact());
+    ASSERT_TRUE(pvt_store.put(make_gps_ephemeris(5, 7200)));
+    ASSERT_TRUE(supl_store.put(make_gps_ephemeris(6, 7200)));
+
+    Nav_Data_Store reader(file_name);
+    ASSERT_TRUE(reader.load());
+    std::map<int32_t, Gps_Ephemeris> read_map;
+    ASSERT_TRUE(reader.get(read_map));
+    ASSERT_EQ(read_map.size(), 6U);
+    EXPECT_EQ(read_map[1].d_Toe, 14400);
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,242 @@
+/*!
+ * \file reed_solomon_test.cc
+ * \brief Tests for the Reed-Solomon erasure decoder used by Galileo HAS
+ * \author agent, 2026. agent(at)local
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_CNAV.h"
+#include "reed_solomon.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Encodes a message of message_size rows column by column, padding each
+// column with zeros up to the k information symbols
+std::vector<std::vector<uint8_t>> encode_message(const Reed_Solomon& code, const std::vector<uint8_t>& message, uint32_t message_size, uint32_t row_length)
+{
+    std::vector<std::vector<uint8_t>> encoded(code.n(), std::vector<uint8_t>(row_length, 0));
+    for (uint32_t c = 0; c < row_length; c++)
+        {
+            std::vector<uint8_t> information(code.k(), 0);
+            for (uint32_t r = 0; r < message_size; r++)
+                {
+                    information[r] = message[r * row_length + c];
+                }
+            const std::vector<uint8_t> codeword = code.encode(information);
+            for (uint32_t j = 0; j < code.n(); j++)
+                {
+                    encoded[j][c] = codeword[j];
+                }
+        }
+    return encoded;
+}
+
+
+// RS(255, 32) codeword of the information vector "Galileo HAS RS(255,32) erasures!",
+// computed by long division by g(x) = (x + alpha)(x + alpha^2)...(x + alpha^223)
+// over GF(2^8) with field polynomial 0x11D, information symbols first
+const std::vector<uint8_t> KNOWN_CODEWORD = {
+    0x47, 0x61, 0x6C, 0x69, 0x6C, 0x65, 0x6F, 0x20, 0x48, 0x41, 0x53, 0x20, 0x52, 0x53, 0x28, 0x32,
+    0x35, 0x35, 0x2C, 0x33, 0x32, 0x29, 0x20, 0x65, 0x72, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x21,
+    0x85, 0x10, 0x81, 0xC6, 0xB4, 0xED, 0xF6, 0x94, 0x73, 0xE1, 0xDE, 0xE9, 0xBA, 0xAC, 0xBD, 0xA6,
+    0x95, 0xA2, 0xC9, 0xCC, 0x46, 0xB8, 0x3A, 0x0E, 0xF4, 0xC3, 0x48, 0x04, 0x54, 0x79, 0x22, 0x98,
+    0x24, 0x99, 0x20, 0xF2, 0x83, 0xA0, 0x81, 0x02, 0x77, 0xAA, 0x82, 0xD4, 0x4E, 0x1B, 0x1C, 0x73,
+    0x42, 0x33, 0x0C, 0xEA, 0x26, 0x29, 0x06, 0x80, 0xE1, 0xF6, 0x55, 0xDE, 0x6B, 0x8A, 0x7A, 0x25,
+    0x9F, 0x2F, 0xA6, 0xE8, 0x80, 0x73, 0x3E, 0x5F, 0xA1, 0x0B, 0xEA, 0x09, 0x24, 0xF2, 0x9A, 0x63,
+    0x23, 0x88, 0xA3, 0x65, 0x0D, 0x5F, 0x7C, 0xF3, 0xA7, 0x35, 0x8C, 0x8F, 0x32, 0x3A, 0x9D, 0xD1,
+    0xA6, 0x39, 0x2F, 0x4F, 0x14, 0xF9, 0x81, 0xD9, 0x32, 0xAE, 0x14, 0xD1, 0x8E, 0x84, 0xDF, 0xFE,
+    0x0B, 0xB7, 0x4F, 0xD7, 0xA3, 0xE2, 0xFD, 0xC2, 0xFD, 0x51, 0xD5, 0xA5, 0xE6, 0x1D, 0x98, 0x9C,
+    0xAD, 0x3F, 0x86, 0x96, 0x73, 0xFD, 0x9F, 0xB8, 0x05, 0x50, 0x47, 0x66, 0x20, 0xA1, 0xB2, 0xF8,
+    0xAD, 0x29, 0xCA, 0x8F, 0x91, 0xFB, 0x1A, 0x62, 0xDB, 0x1F, 0x20, 0x49, 0x5C, 0x01, 0x8B, 0xC9,
+    0xB6, 0x11, 0x04, 0xA3, 0x9E, 0x3B, 0xBE, 0xD4, 0x60, 0x00, 0x8C, 0x5E, 0xC2, 0xEE, 0xC8, 0xCC,
+    0x1A, 0xEE, 0x97, 0x34, 0xD0, 0x71, 0x9D, 0x53, 0xF4, 0xC0, 0xB1, 0xC7, 0x95, 0x74, 0x9B, 0x83,
+    0xB5, 0xFA, 0x47, 0x4C, 0xBC, 0xB0, 0x19, 0xE4, 0xAC, 0xD0, 0x19, 0x9C, 0x9D, 0xA3, 0x5B, 0xBC,
+    0xA7, 0xE4, 0xCA, 0x59, 0xB4, 0xA3, 0x79, 0x63, 0x19, 0x5E, 0x61, 0xE8, 0xDF, 0xA3, 0x39,
+};
+}  // namespace
+
+
+TEST(ReedSolomonTest, KnownAnswerCodeword)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    const std::vector<uint8_t> information(KNOWN_CODEWORD.begin(), KNOWN_CODEWORD.begin() + code.k());
+    EXPECT_EQ(code.encode(information), KNOWN_CODEWORD);
+}
+
+
+TEST(ReedSolomonTest, KnownAnswerErasureDecoding)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    const std::vector<uint8_t> information(KNOWN_CODEWORD.begin(), KNOWN_CODEWORD.begin() + code.k());
+
+    // All the information symbols are erased, only the last 32 parity symbols are received
+    Reed_Solomon_Erasure_Decoder decoder(code, code.k(), 1);
+    for (uint32_t index = code.n() - 1; index >= code.n() - code.k(); index--)
+        {
+            EXPECT_EQ(decoder.add_row(index, &KNOWN_CODEWORD[index]), index == code.n() - code.k());
+        }
+    EXPECT_EQ(decoder.get_message(), information);
+
+    // Half of them erased, with parity symbols from the middle of the codeword
+    Reed_Solomon_Erasure_Decoder mixed_decoder(code, code.k(), 1);
+    for (uint32_t index = 0; index < code.k(); index += 2)
+        {
+            mixed_decoder.add_row(index, &KNOWN_CODEWORD[index]);
+            mixed_decoder.add_row(index + 101, &KNOWN_CODEWORD[index + 101]);
+        }
+    ASSERT_TRUE(mixed_decoder.is_complete());
+    EXPECT_EQ(mixed_decoder.get_message(), information);
+}
+
+
+TEST(ReedSolomonTest, RegionProductsMatchFieldProduct)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    // 37 symbols, so vectorized kernels also go through their scalar tail
+    std::vector<uint8_t> src(37);
+    std::iota(src.begin(), src.end(), 219);
+    src[5] = 0;
+    for (uint32_t c = 0; c < 256; c++)
+        {
+            std::vector<uint8_t> dst(src.size());
+            std::iota(dst.begin(), dst.end(), 3);
+            std::vector<uint8_t> expected(dst);
+            for (size_t i = 0; i < src.size(); i++)
+                {
+                    expected[i] ^= code.mul(static_cast<uint8_t>(c), src[i]);
+                }
+            code.mul_add_region(dst.data(), src.data(), static_cast<uint8_t>(c), dst.size());
+            EXPECT_EQ(dst, expected) << "mul_add_region, c = " << c;
+
+            dst = src;
+            for (size_t i = 0; i < src.size(); i++)
+                {
+                    expected[i] = code.mul(static_cast<uint8_t>(c), src[i]);
+                }
+            code.mul_region(dst.data(), static_cast<uint8_t>(c), dst.size());
+            EXPECT_EQ(dst, expected) << "mul_region, c = " << c;
+        }
+}
+
+
+TEST(ReedSolomonTest, CodewordsVanishAtRoots)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> symbol(0, 255);
+    std::vector<uint8_t> information(code.k());
+    for (auto& s : information)
+        {
+            s = static_cast<uint8_t>(symbol(gen));
+        }
+    const std::vector<uint8_t> codeword = code.encode(information);
+    ASSERT_TRUE(std::equal(information.begin(), information.end(), codeword.begin()));
+
+    // Codeword symbol j is the coefficient of x^(n - 1 - j)
+    uint8_t alpha = 2;
+    uint8_t root = 1;
+    for (uint32_t i = 0; i < GALILEO_CNAV_RS_FCR; i++)
+        {
+            root = code.mul(root, alpha);
+        }
+    for (uint32_t i = 0; i < code.n() - code.k(); i++)
+        {
+            uint8_t value = 0;
+            for (uint32_t j = 0; j < code.n(); j++)
+                {
+                    value = code.mul(value, root) ^ codeword[j];
+                }
+            EXPECT_EQ(value, 0) << "root " << i;
+            root = code.mul(root, alpha);
+        }
+}
+
+
+TEST(ReedSolomonTest, FieldInverse)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    for (uint32_t a = 1; a < 256; a++)
+        {
+            EXPECT_EQ(code.mul(static_cast<uint8_t>(a), code.inv(static_cast<uint8_t>(a))), 1);
+        }
+}
+
+
+TEST(ReedSolomonTest, ErasureDecodingFromRandomPages)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    const uint32_t row_length = GALILEO_CNAV_OCTETS_IN_SUBPAGE;
+    std::mt19937 gen(2);
+    std::uniform_int_distribution<int> symbol(0, 255);
+    for (uint32_t message_size : {1U, 5U, 17U, 32U})
+        {
+            std::vector<uint8_t> message(message_size * row_length);
+            for (auto& s : message)
+                {
+                    s = static_cast<uint8_t>(symbol(gen));
+                }
+            const auto encoded = encode_message(code, message, message_size, row_length);
+
+            for (int trial = 0; trial < 10; trial++)
+                {
+                    std::vector<uint32_t> pages(code.n());
+                    std::iota(pages.begin(), pages.end(), 0);
+                    std::shuffle(pages.begin(), pages.end(), gen);
+
+                    Reed_Solomon_Erasure_Decoder decoder(code, message_size, row_length);
+                    uint32_t used = 0;
+                    for (uint32_t p : pages)
+                        {
+                            // The information symbols message_size to k - 1 are the
+                            // zero padding, so those pages carry no information
+                            if (p < message_size || p >= code.k())
+                                {
+                                    used++;
+                                }
+                            if (decoder.add_row(p, encoded[p].data()))
+                                {
+                                    break;
+                                }
+                        }
+                    ASSERT_TRUE(decoder.is_complete());
+                    // Any message_size informative pages are independent (MDS code)
+                    EXPECT_EQ(used, message_size);
+                    EXPECT_EQ(decoder.get_message(), message);
+                }
+        }
+}
+
+
+TEST(ReedSolomonTest, RepeatedPagesAreIgnored)
+{
+    const Reed_Solomon code(GALILEO_CNAV_MAX_NUMBER_ENCODED_BLOCKS, GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, GALILEO_CNAV_RS_GF_POLY, GALILEO_CNAV_RS_FCR, GALILEO_CNAV_RS_PRIM);
+    const uint32_t message_size = 3;
+    const uint32_t row_length = GALILEO_CNAV_OCTETS_IN_SUBPAGE;
+    std::vector<uint8_t> message(message_size * row_length);
+    std::iota(message.begin(), message.end(), 7);
+    const auto encoded = encode_message(code, message, message_size, row_length);
+
+    Reed_Solomon_Erasure_Decoder decoder(code, message_size, row_length);
+    EXPECT_FALSE(decoder.add_row(100, encoded[100].data()));
+    EXPECT_FALSE(decoder.add_row(100, encoded[100].data()));
+    EXPECT_FALSE(decoder.add_row(2, encoded[2].data()));
+    EXPECT_FALSE(decoder.add_row(100, encoded[100].data()));
+    EXPECT_FALSE(decoder.add_row(code.n(), encoded[0].data()));  // out of range
+    EXPECT_FALSE(decoder.is_complete());
+    EXPECT_TRUE(decoder.add_row(200, encoded[200].data()));
+    EXPECT_EQ(decoder.get_message(), message);
+}
@@ -22,6 +22,7 @@
 #include "gps_ephemeris.h"
 #include "gps_iono.h"
 #include "gps_utc_model.h"
+#include "nav_data_store.h"
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
@@ -32,8 +33,10 @@
 #include <gpstk/Rinex3NavHeader.hpp>
 #include <gpstk/Rinex3NavStream.hpp>
 #include <cstddef>  // for size_t
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <map>
 
 #if GFLAGS_OLD_NAMESPACE
 namespace gflags
@@ -42,6 +45,27 @@ using namespace google;
 }
 #endif
 
+DEFINE_string(nav_data_store, "", "If set, the navigation data is also appended to this binary navigation data store, readable by GNSS-SDR.nav_data_store_file");
+
+
+// The navigation data store keeps one ephemeris per satellite: the most recent one in the RINEX file
+template <class T, class F>
+std::map<int32_t, T> latest_per_satellite(const std::map<int, T>& eph_map, F epoch)
+{
+    std::map<int32_t, T> latest;
+    for (const auto& eph : eph_map)
+        {
+            const auto prn = static_cast<int32_t>(eph.second.i_satellite_PRN);
+            const auto it = latest.find(prn);
+            if (it == latest.cend() || epoch(eph.second) >= epoch(it->second))
+                {
+                    latest[prn] = eph.second;
+                }
+        }
+    return latest;
+}
+
+
 int main(int argc, char** argv)
 {
     const std::string intro_help(
@@ -50,7 +74,7 @@ int main(int argc, char** argv)
         "This program comes with ABSOLUTELY NO WARRANTY;\n" +
         "See COPYING file to see a copy of the General Public License.\n \n" +
         "Usage: \n" +
-        "   rinex2assist <RINEX Nav file input>");
+        "   rinex2assist <RINEX Nav file input> [--nav_data_store=<file>]");
 
     gflags::SetUsageMessage(intro_help);
     google::SetVersionString("1.0");
@@ -428,6 +452,38 @@ int main(int argc, char** argv)
                 }
             std::cout << "Generated file: " << xml_filename << '\n';
         }
+
+    // Write binary navigation data store
+    if (!FLAGS_nav_data_store.empty())
+        {
+            Nav_Data_Store store(FLAGS_nav_data_store);
+            store.load();
+            bool ok = store.put(latest_per_satellite(eph_map, [](const Gps_Ephemeris& eph) { return static_cast<double>(eph.i_GPS_week) * 604800.0 + eph.d_Toe; }));
+            ok = store.put(latest_per_satellite(eph_gal_map, [](const Galileo_Ephemeris& eph) { return static_cast<double>(eph.WN_5) * 604800.0 + eph.t0e_1; })) && ok;
+            if (gps_utc_model.valid)
+                {
+                    ok = store.put(gps_utc_model) && ok;
+                }
+            if (gps_iono.valid)
+                {
+                    ok = store.put(gps_iono) && ok;
+                }
+            if (gal_utc_model.A0_6 != 0)
+                {
+                    ok = store.put(gal_utc_model) && ok;
+                }
+            if (gal_iono.ai0_5 != 0)
+                {
+                    ok = store.put(gal_iono) && ok;
+                }
+            if (!ok)
+                {
+                    std::cerr << "Problem writing the navigation data store " << FLAGS_nav_data_store << '\n';
+                    gflags::ShutDownCommandLineFlags();
+                    return 1;
+                }
+            std::cout << "Generated file: " << FLAGS_nav_data_store << '\n';
+        }
     gflags::ShutDownCommandLineFlags();
     return 0;
 }
@@ -1,6 +1,8 @@
 #!/bin/sh
 # GNSS-SDR shell script that enables the remote GNSS-SDR restart telecommand
 # usage: ./gnss-sdr-harness.sh ./gnss-sdr -c config_file.conf
+# Not needed if GNSS-SDR.restart_in_process=true, which restarts the receiver
+# without leaving the process.
 
 # SPDX-FileCopyrightText: Javier Arribas <javier.arribas(at)cttc.es>
 # SPDX-License-Identifier: GPL-3.0-or-later